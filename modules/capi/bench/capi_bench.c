@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Measures the C interface: reading whole boards in bulk and playing random
+ * games with batched actions.
+ */
+
+#include <fosssweeper/fosssweeper.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BOARD_READ_COUNT 200000
+#define GAME_COUNT 20000
+#define BATCH_SIZE 16
+
+static double get_seconds(void) {
+  struct timespec now;
+  timespec_get(&now, TIME_UTC);
+  return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+static uint64_t next_random(uint64_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+static int check(fosssweeper_status status, const char *what) {
+  if (status != FOSSSWEEPER_OK) {
+    fprintf(stderr, "fosssweeper_capi_bench: %s: %s\n", what,
+            fosssweeper_get_status_string(status));
+    return 0;
+  }
+  return 1;
+}
+
+int main(void) {
+  fosssweeper_game *game = NULL;
+  fosssweeper_game_info game_info;
+  fosssweeper_action actions[BATCH_SIZE];
+  uint8_t *visible_codes = NULL;
+  size_t button_count = 0;
+  size_t processed_count = 0;
+  uint64_t checksum = 0;
+  uint64_t action_count = 0;
+  uint64_t win_count = 0;
+  uint64_t random_state = 0x9e3779b97f4a7c15u;
+  double begin_seconds = 0.0;
+  double seconds = 0.0;
+  int read_i = 0;
+  int game_i = 0;
+  int action_i = 0;
+
+  if (!check(fosssweeper_check_version(FOSSSWEEPER_API_VERSION),
+             "incompatible library")) {
+    return 1;
+  }
+  printf("library %s, api %u.%u\n", fosssweeper_get_version_string(),
+         (unsigned)(fosssweeper_get_api_version() >> 16),
+         (unsigned)(fosssweeper_get_api_version() & 0xffff));
+  if (!check(fosssweeper_game_create(30, 16, 99,
+                                     FOSSSWEEPER_GENERATION_MODE_OPENING, 1,
+                                     &game),
+             "unable to create a game")) {
+    return 1;
+  }
+
+  /* asking with an empty buffer reports the size to allocate */
+  fosssweeper_game_export_visible(game, NULL, 0, &button_count);
+  visible_codes = malloc(button_count);
+  actions[0].action_type = FOSSSWEEPER_ACTION_CLICK;
+  actions[0].x = 15;
+  actions[0].y = 8;
+  fosssweeper_game_apply_actions(game, actions, 1, NULL, NULL);
+  begin_seconds = get_seconds();
+  for (read_i = 0; read_i < BOARD_READ_COUNT; read_i++) {
+    fosssweeper_game_export_visible(game, visible_codes, button_count, NULL);
+    checksum += visible_codes[read_i % button_count];
+  }
+  seconds = get_seconds() - begin_seconds;
+  printf("full board reads: %d boards of %zu buttons, %.1f ns per board, "
+         "%.3f ns per button (checksum %llu)\n",
+         BOARD_READ_COUNT, button_count, seconds * 1e9 / BOARD_READ_COUNT,
+         seconds * 1e9 / ((double)BOARD_READ_COUNT * (double)button_count),
+         (unsigned long long)checksum);
+
+  begin_seconds = get_seconds();
+  for (game_i = 0; game_i < GAME_COUNT; game_i++) {
+    fosssweeper_game_new(game, (uint64_t)game_i);
+    game_info.struct_size = sizeof(game_info);
+    do {
+      for (action_i = 0; action_i < BATCH_SIZE; action_i++) {
+        actions[action_i].action_type = FOSSSWEEPER_ACTION_CLICK;
+        actions[action_i].x = (int32_t)(next_random(&random_state) % 30);
+        actions[action_i].y = (int32_t)(next_random(&random_state) % 16);
+      }
+      if (!check(fosssweeper_game_apply_actions(game, actions, BATCH_SIZE,
+                                                NULL, &processed_count),
+                 "unable to apply actions")) {
+        return 1;
+      }
+      action_count += processed_count;
+      fosssweeper_game_get_info(game, &game_info);
+    } while (game_info.game_state == FOSSSWEEPER_GAME_STATE_PLAYING ||
+             game_info.game_state == FOSSSWEEPER_GAME_STATE_NONE);
+    if (game_info.game_state == FOSSSWEEPER_GAME_STATE_COOL) {
+      win_count++;
+    }
+  }
+  seconds = get_seconds() - begin_seconds;
+  printf("batched actions: %d games, %llu actions in batches of %d, "
+         "%.0f actions per second, %llu wins\n",
+         GAME_COUNT, (unsigned long long)action_count, BATCH_SIZE,
+         (double)action_count / seconds, (unsigned long long)win_count);
+
+  free(visible_codes);
+  fosssweeper_game_destroy(game);
+  return 0;
+}
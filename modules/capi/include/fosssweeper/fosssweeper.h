@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_FOSSSWEEPER_H
+#define FOSSSWEEPER_FOSSSWEEPER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(FOSSSWEEPER_CAPI_BUILD)
+#define FOSSSWEEPER_API __declspec(dllexport)
+#else
+#define FOSSSWEEPER_API __declspec(dllimport)
+#endif
+#else
+#define FOSSSWEEPER_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * C interface to the FossSweeper game engine. Games are opaque handles, and
+ * all state leaves the library in bulk through buffers owned by the caller,
+ * so reading a whole board is a single call. Functions never throw; they
+ * report failures through fosssweeper_status.
+ *
+ * The API version is (major << 16) | minor. A library is compatible with a
+ * caller when the majors are equal and its minor is at least the caller's.
+ */
+#define FOSSSWEEPER_API_VERSION_MAJOR 1
+#define FOSSSWEEPER_API_VERSION_MINOR 0
+#define FOSSSWEEPER_API_VERSION                                                \
+  ((FOSSSWEEPER_API_VERSION_MAJOR << 16) | FOSSSWEEPER_API_VERSION_MINOR)
+
+typedef struct fosssweeper_game fosssweeper_game;
+
+typedef enum fosssweeper_status {
+  FOSSSWEEPER_OK = 0,
+  FOSSSWEEPER_ERROR_INVALID_ARGUMENT = 1,
+  FOSSSWEEPER_ERROR_BUFFER_TOO_SMALL = 2,
+  FOSSSWEEPER_ERROR_VERSION_MISMATCH = 3,
+  FOSSSWEEPER_ERROR_OUT_OF_MEMORY = 4,
+  FOSSSWEEPER_ERROR_INTERNAL = 5
+} fosssweeper_status;
+
+enum {
+  FOSSSWEEPER_GAME_STATE_NONE = 0,
+  FOSSSWEEPER_GAME_STATE_PLAYING = 1,
+  FOSSSWEEPER_GAME_STATE_DEAD = 2,
+  FOSSSWEEPER_GAME_STATE_COOL = 3
+};
+
+enum {
+  FOSSSWEEPER_GENERATION_MODE_CLASSIC = 0,
+  FOSSSWEEPER_GENERATION_MODE_OPENING = 1,
+  FOSSSWEEPER_GENERATION_MODE_NO_GUESS = 2
+};
+
+enum {
+  FOSSSWEEPER_ACTION_CLICK = 0,
+  FOSSSWEEPER_ACTION_ALT_CLICK = 1,
+  FOSSSWEEPER_ACTION_AREA_CLICK = 2
+};
+
+enum {
+  FOSSSWEEPER_ACTION_RESULT_APPLIED = 0,
+  FOSSSWEEPER_ACTION_RESULT_IGNORED = 1,
+  FOSSSWEEPER_ACTION_RESULT_SKIPPED = 2
+};
+
+/* visible codes 3 through 11 are down buttons with 0 through 8 surrounding
+ * bombs */
+enum {
+  FOSSSWEEPER_VISIBLE_NONE = 0,
+  FOSSSWEEPER_VISIBLE_FLAGGED = 1,
+  FOSSSWEEPER_VISIBLE_QUESTIONED = 2,
+  FOSSSWEEPER_VISIBLE_DOWN = 3,
+  FOSSSWEEPER_VISIBLE_EXPLODED = 12
+};
+
+typedef struct fosssweeper_action {
+  int32_t action_type;
+  int32_t x;
+  int32_t y;
+} fosssweeper_action;
+
+/* struct_size has to be set to sizeof(fosssweeper_game_info) by the caller so
+ * fields can be appended in later minor versions */
+typedef struct fosssweeper_game_info {
+  uint32_t struct_size;
+  int32_t buttons_wide;
+  int32_t buttons_tall;
+  int32_t bomb_count;
+  int32_t game_state;
+  int32_t flag_count;
+  int32_t buttons_left;
+  uint64_t game_seed;
+  uint64_t visible_hash;
+} fosssweeper_game_info;
+
+FOSSSWEEPER_API uint32_t fosssweeper_get_api_version(void);
+FOSSSWEEPER_API const char *fosssweeper_get_version_string(void);
+FOSSSWEEPER_API fosssweeper_status
+fosssweeper_check_version(uint32_t api_version);
+FOSSSWEEPER_API const char *fosssweeper_get_status_string(fosssweeper_status status);
+
+/* board sizes are clamped to the engine's limits exactly like the desktop
+ * configuration dialog does */
+FOSSSWEEPER_API fosssweeper_status
+fosssweeper_game_create(int32_t buttons_wide, int32_t buttons_tall,
+                        int32_t bomb_count, int32_t generation_mode,
+                        uint64_t game_seed, fosssweeper_game **game);
+FOSSSWEEPER_API void fosssweeper_game_destroy(fosssweeper_game *game);
+FOSSSWEEPER_API fosssweeper_status
+fosssweeper_game_new(fosssweeper_game *game, uint64_t game_seed);
+FOSSSWEEPER_API fosssweeper_status
+fosssweeper_game_get_info(const fosssweeper_game *game,
+                          fosssweeper_game_info *game_info);
+
+/* writes one visible code per button in row major order; button_count
+ * receives the number of buttons even when the buffer is too small */
+FOSSSWEEPER_API fosssweeper_status
+fosssweeper_game_export_visible(const fosssweeper_game *game,
+                                uint8_t *visible_codes, size_t capacity,
+                                size_t *button_count);
+
+/* applies actions until the game is over; results may be NULL, otherwise it
+ * receives one result per action */
+FOSSSWEEPER_API fosssweeper_status fosssweeper_game_apply_actions(
+    fosssweeper_game *game, const fosssweeper_action *actions,
+    size_t action_count, int32_t *results, size_t *processed_count);
+
+/* writes the indices of the buttons changed by the last call that changed
+ * the game */
+FOSSSWEEPER_API fosssweeper_status
+fosssweeper_game_export_changes(const fosssweeper_game *game,
+                                uint32_t *button_indices, size_t capacity,
+                                size_t *change_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
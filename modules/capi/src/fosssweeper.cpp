@@ -0,0 +1,254 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fosssweeper/action.hpp>
+#include <fosssweeper/button_position.hpp>
+#include <fosssweeper/fosssweeper.h>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/version.hpp>
+#include <new>
+#include <vector>
+
+struct fosssweeper_game {
+  fosssweeper::GameModel _gameModel;
+  std::vector<fosssweeper::Action> _actions =
+      std::vector<fosssweeper::Action>();
+  std::vector<fosssweeper::ActionResult> _actionResults =
+      std::vector<fosssweeper::ActionResult>();
+};
+
+static_assert(static_cast<int>(fosssweeper::GameState::Cool) ==
+              FOSSSWEEPER_GAME_STATE_COOL);
+static_assert(static_cast<int>(fosssweeper::GenerationMode::NoGuess) ==
+              FOSSSWEEPER_GENERATION_MODE_NO_GUESS);
+static_assert(static_cast<int>(fosssweeper::ActionType::AreaClick) ==
+              FOSSSWEEPER_ACTION_AREA_CLICK);
+static_assert(static_cast<int>(fosssweeper::ActionResult::Skipped) ==
+              FOSSSWEEPER_ACTION_RESULT_SKIPPED);
+
+namespace {
+// keeps boards small enough for 32 bit button indices and int counters
+const std::int64_t MAX_BUTTON_COUNT = std::int64_t{1} << 24;
+
+// exceptions must not cross the C boundary
+template <typename Function> fosssweeper_status guard(Function function) {
+  try {
+    return function();
+  } catch (const std::bad_alloc &) {
+    return FOSSSWEEPER_ERROR_OUT_OF_MEMORY;
+  } catch (...) {
+    return FOSSSWEEPER_ERROR_INTERNAL;
+  }
+}
+} // namespace
+
+std::uint32_t fosssweeper_get_api_version(void) {
+  return FOSSSWEEPER_API_VERSION;
+}
+
+const char *fosssweeper_get_version_string(void) { return FOSSSWEEPER_VERSION; }
+
+fosssweeper_status fosssweeper_check_version(std::uint32_t api_version) {
+  if ((api_version >> 16) != FOSSSWEEPER_API_VERSION_MAJOR ||
+      (api_version & 0xffff) > FOSSSWEEPER_API_VERSION_MINOR)
+    return FOSSSWEEPER_ERROR_VERSION_MISMATCH;
+  return FOSSSWEEPER_OK;
+}
+
+const char *fosssweeper_get_status_string(fosssweeper_status status) {
+  switch (status) {
+  case FOSSSWEEPER_OK:
+    return "ok";
+  case FOSSSWEEPER_ERROR_INVALID_ARGUMENT:
+    return "invalid argument";
+  case FOSSSWEEPER_ERROR_BUFFER_TOO_SMALL:
+    return "buffer too small";
+  case FOSSSWEEPER_ERROR_VERSION_MISMATCH:
+    return "version mismatch";
+  case FOSSSWEEPER_ERROR_OUT_OF_MEMORY:
+    return "out of memory";
+  case FOSSSWEEPER_ERROR_INTERNAL:
+    return "internal error";
+  }
+  return "unknown status";
+}
+
+fosssweeper_status
+fosssweeper_game_create(std::int32_t buttons_wide, std::int32_t buttons_tall,
+                        std::int32_t bomb_count, std::int32_t generation_mode,
+                        std::uint64_t game_seed, fosssweeper_game **game) {
+  if (game == nullptr || buttons_wide <= 0 || buttons_tall <= 0 ||
+      static_cast<std::int64_t>(buttons_wide) * buttons_tall >
+          MAX_BUTTON_COUNT ||
+      generation_mode < FOSSSWEEPER_GENERATION_MODE_CLASSIC ||
+      generation_mode > FOSSSWEEPER_GENERATION_MODE_NO_GUESS)
+    return FOSSSWEEPER_ERROR_INVALID_ARGUMENT;
+  *game = nullptr;
+  return guard([&]() {
+    auto *const new_game = new fosssweeper_game();
+    auto &game_model = new_game->_gameModel;
+    game_model.setChangeSetEnabled(true);
+    game_model.newGame(fosssweeper::GameConfiguration(
+        buttons_wide, buttons_tall, bomb_count));
+    game_model.setGenerationMode(
+        static_cast<fosssweeper::GenerationMode>(generation_mode));
+    game_model.setGameSeed(game_seed);
+    *game = new_game;
+    return FOSSSWEEPER_OK;
+  });
+}
+
+void fosssweeper_game_destroy(fosssweeper_game *game) { delete game; }
+
+fosssweeper_status fosssweeper_game_new(fosssweeper_game *game,
+                                        std::uint64_t game_seed) {
+  if (game == nullptr)
+    return FOSSSWEEPER_ERROR_INVALID_ARGUMENT;
+  return guard([&]() {
+    game->_gameModel.newGame();
+    game->_gameModel.setGameSeed(game_seed);
+    return FOSSSWEEPER_OK;
+  });
+}
+
+fosssweeper_status
+fosssweeper_game_get_info(const fosssweeper_game *game,
+                          fosssweeper_game_info *game_info) {
+  if (game == nullptr || game_info == nullptr ||
+      game_info->struct_size < sizeof(fosssweeper_game_info))
+    return FOSSSWEEPER_ERROR_INVALID_ARGUMENT;
+  const auto &game_model = game->_gameModel;
+  const auto game_configuration = game_model.getGameConfiguration();
+  game_info->buttons_wide = game_configuration.getButtonsWide();
+  game_info->buttons_tall = game_configuration.getButtonsTall();
+  game_info->bomb_count = game_configuration.getBombCount();
+  game_info->game_state = static_cast<std::int32_t>(game_model.getGameState());
+  game_info->flag_count = game_model.getFlagCount();
+  game_info->buttons_left = game_model.getButtonsLeft();
+  game_info->game_seed = game_model.getGameSeed();
+  game_info->visible_hash = game_model.getVisibleHash();
+  return FOSSSWEEPER_OK;
+}
+
+fosssweeper_status
+fosssweeper_game_export_visible(const fosssweeper_game *game,
+                                std::uint8_t *visible_codes,
+                                std::size_t capacity,
+                                std::size_t *button_count) {
+  if (game == nullptr || (visible_codes == nullptr && capacity != 0))
+    return FOSSSWEEPER_ERROR_INVALID_ARGUMENT;
+  const auto &buttons = game->_gameModel.getButtons();
+  if (button_count != nullptr) {
+    *button_count = buttons.size();
+  }
+  if (capacity < buttons.size())
+    return FOSSSWEEPER_ERROR_BUFFER_TOO_SMALL;
+  for (std::size_t button_i = 0; button_i < buttons.size(); button_i++) {
+    visible_codes[button_i] = buttons[button_i].getVisibleCode();
+  }
+  return FOSSSWEEPER_OK;
+}
+
+fosssweeper_status fosssweeper_game_apply_actions(
+    fosssweeper_game *game, const fosssweeper_action *actions,
+    std::size_t action_count, std::int32_t *results,
+    std::size_t *processed_count) {
+  if (game == nullptr || (actions == nullptr && action_count != 0))
+    return FOSSSWEEPER_ERROR_INVALID_ARGUMENT;
+  const auto game_configuration = game->_gameModel.getGameConfiguration();
+  // the GameModel trusts positions, so every action is checked before any
+  // of them is applied
+  for (std::size_t action_i = 0; action_i < action_count; action_i++) {
+    const auto &action = actions[action_i];
+    if (action.action_type < FOSSSWEEPER_ACTION_CLICK ||
+        action.action_type > FOSSSWEEPER_ACTION_AREA_CLICK || action.x < 0 ||
+        action.y < 0 || action.x >= game_configuration.getButtonsWide() ||
+        action.y >= game_configuration.getButtonsTall())
+      return FOSSSWEEPER_ERROR_INVALID_ARGUMENT;
+  }
+  return guard([&]() {
+    game->_actions.resize(action_count);
+    for (std::size_t action_i = 0; action_i < action_count; action_i++) {
+      const auto &action = actions[action_i];
+      game->_actions[action_i] = {
+          static_cast<fosssweeper::ActionType>(action.action_type),
+          fosssweeper::ButtonPosition(action.x, action.y)};
+    }
+    game->_actionResults.resize(action_count);
+    const auto applied_count =
+        game->_gameModel.applyActions(game->_actions, game->_actionResults);
+    if (results != nullptr) {
+      for (std::size_t action_i = 0; action_i < action_count; action_i++) {
+        results[action_i] =
+            static_cast<std::int32_t>(game->_actionResults[action_i]);
+      }
+    }
+    if (processed_count != nullptr) {
+      *processed_count = applied_count;
+    }
+    return FOSSSWEEPER_OK;
+  });
+}
+
+fosssweeper_status
+fosssweeper_game_export_changes(const fosssweeper_game *game,
+                                std::uint32_t *button_indices,
+                                std::size_t capacity,
+                                std::size_t *change_count) {
+  if (game == nullptr || (button_indices == nullptr && capacity != 0))
+    return FOSSSWEEPER_ERROR_INVALID_ARGUMENT;
+  const auto &change_set = game->_gameModel.getChangeSet();
+  if (change_count != nullptr) {
+    *change_count = change_set.getChangedButtonCount();
+  }
+  if (capacity < change_set.getChangedButtonCount())
+    return FOSSSWEEPER_ERROR_BUFFER_TOO_SMALL;
+  if (change_set.getHasButtonList()) {
+    const auto &changed_buttons = change_set.getChangedButtons();
+    for (std::size_t change_i = 0; change_i < changed_buttons.size();
+         change_i++) {
+      button_indices[change_i] =
+          static_cast<std::uint32_t>(changed_buttons[change_i]);
+    }
+    return FOSSSWEEPER_OK;
+  }
+  std::size_t change_i = 0;
+  const auto &dirty_bits = change_set.getDirtyBits();
+  for (std::size_t word_i = 0; word_i < dirty_bits.size(); word_i++) {
+    auto word = dirty_bits[word_i];
+    while (word != 0) {
+      button_indices[change_i++] = static_cast<std::uint32_t>(
+          (word_i * 64) + static_cast<std::size_t>(std::countr_zero(word)));
+      word &= word - 1;
+    }
+  }
+  return FOSSSWEEPER_OK;
+}
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FOSSSWEEPER_BOUNDED_QUEUE_HPP
+#define FOSSSWEEPER_BOUNDED_QUEUE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace fosssweeper {
+// Blocking queue of limited capacity shared by any number of producer and
+// consumer threads. A full queue holds its producers back, so a slow stage
+// does not let the earlier stages run ahead without bound. Once closed, pushes
+// fail and pops only return what is still queued.
+template <typename T> struct BoundedQueue {
+  std::mutex _mutex = std::mutex();
+  std::condition_variable _condition = std::condition_variable();
+  std::deque<T> _values = std::deque<T>();
+  std::size_t _capacity = 0;
+  bool _closed = false;
+
+  BoundedQueue(std::size_t capacity);
+
+  bool push(T &&value);
+  bool pop(T &value);
+  void close();
+};
+
+template <typename T>
+fosssweeper::BoundedQueue<T>::BoundedQueue(std::size_t capacity)
+    : _capacity(capacity) {}
+
+template <typename T> bool fosssweeper::BoundedQueue<T>::push(T &&value) {
+  {
+    std::unique_lock<std::mutex> lock(this->_mutex);
+    this->_condition.wait(lock, [&]() {
+      return this->_closed || this->_values.size() < this->_capacity;
+    });
+    if (this->_closed)
+      return false;
+    this->_values.push_back(std::move(value));
+  }
+  this->_condition.notify_all();
+  return true;
+}
+
+template <typename T> bool fosssweeper::BoundedQueue<T>::pop(T &value) {
+  {
+    std::unique_lock<std::mutex> lock(this->_mutex);
+    this->_condition.wait(
+        lock, [&]() { return this->_closed || !this->_values.empty(); });
+    if (this->_values.empty())
+      return false;
+    value = std::move(this->_values.front());
+    this->_values.pop_front();
+  }
+  this->_condition.notify_all();
+  return true;
+}
+
+template <typename T> void fosssweeper::BoundedQueue<T>::close() {
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    this->_closed = true;
+  }
+  this->_condition.notify_all();
+}
+} // namespace fosssweeper
+
+#endif
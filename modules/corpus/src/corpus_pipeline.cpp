@@ -0,0 +1,343 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fosssweeper/board_corpus.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "bounded_queue.hpp"
+#include "corpus_pipeline.hpp"
+
+const std::size_t fosssweeper::CorpusPipelineSettings::BATCH_SIZE = 256;
+const std::size_t fosssweeper::CorpusPipelineSettings::QUEUE_CAPACITY = 16;
+
+namespace {
+// generated boards keep their own bomb bitmap until they are compressed into
+// the corpus records of their batch
+struct GeneratedBoard {
+  fosssweeper::BoardRecord _boardRecord = fosssweeper::BoardRecord();
+  std::vector<unsigned char> _bombBitmap = std::vector<unsigned char>();
+};
+
+struct BoardBatch {
+  std::size_t _batchI = 0;
+  std::vector<GeneratedBoard> _boards = std::vector<GeneratedBoard>();
+  std::vector<unsigned char> _records = std::vector<unsigned char>();
+};
+
+enum StageIndex : std::size_t { Generate, Filter, Compress, Write };
+
+double getSecondsSince(std::chrono::steady_clock::time_point begin) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       begin)
+      .count();
+}
+
+struct CorpusPipeline {
+  const fosssweeper::CorpusPipelineSettings &_settings;
+  fosssweeper::GameConfiguration _gameConfiguration =
+      fosssweeper::GameConfiguration();
+  std::size_t _recordSize = 0;
+  fosssweeper::BoundedQueue<BoardBatch> _generatedQueue;
+  fosssweeper::BoundedQueue<BoardBatch> _filteredQueue;
+  fosssweeper::BoundedQueue<BoardBatch> _compressedQueue;
+  std::atomic<std::size_t> _nextBatchI = 0;
+  std::atomic<bool> _stopping = false;
+  std::array<std::atomic<std::size_t>, 3> _runningCounts =
+      std::array<std::atomic<std::size_t>, 3>();
+  std::mutex _mutex = std::mutex();
+  std::array<fosssweeper::StageResult, 4> _stageResults =
+      std::array<fosssweeper::StageResult, 4>();
+  std::exception_ptr _exceptionPtr = nullptr;
+
+  CorpusPipeline(const fosssweeper::CorpusPipelineSettings &settings)
+      : _settings(settings),
+        _gameConfiguration(settings._boardCorpusSettings._gameConfiguration),
+        _recordSize(
+            fosssweeper::BoardCorpus::getRecordSize(this->_gameConfiguration)),
+        _generatedQueue(fosssweeper::CorpusPipelineSettings::QUEUE_CAPACITY),
+        _filteredQueue(fosssweeper::CorpusPipelineSettings::QUEUE_CAPACITY),
+        _compressedQueue(fosssweeper::CorpusPipelineSettings::QUEUE_CAPACITY) {
+  }
+
+  void stop() {
+    this->_stopping = true;
+    this->_generatedQueue.close();
+    this->_filteredQueue.close();
+    this->_compressedQueue.close();
+  }
+
+  void fail() {
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      if (!this->_exceptionPtr) {
+        this->_exceptionPtr = std::current_exception();
+      }
+    }
+    this->stop();
+  }
+
+  // a no guess board is one the solver clears from the first click alone
+  bool getPassesFilter(const GeneratedBoard &board,
+                       fosssweeper::GameModel &game_model) const {
+    const auto &board_record = board._boardRecord;
+    if (board_record._bbbv < this->_settings._minBbbv ||
+        board_record._bbbv > this->_settings._maxBbbv)
+      return false;
+    if (!this->_settings._noGuessOnly)
+      return true;
+    const auto buttons_wide =
+        static_cast<std::size_t>(this->_gameConfiguration.getButtonsWide());
+    game_model.newGame(this->_gameConfiguration, board._bombBitmap);
+    game_model.clickButton(
+        static_cast<int>(board_record._firstClickI % buttons_wide),
+        static_cast<int>(board_record._firstClickI / buttons_wide));
+    game_model.applyCertainMoves();
+    return game_model.getGameState() == fosssweeper::GameState::Cool;
+  }
+
+  void generate(fosssweeper::StageResult &stage_result) {
+    const auto &corpus_settings = this->_settings._boardCorpusSettings;
+    const auto candidate_limit = this->_settings._candidateLimit;
+    fosssweeper::GameModel game_model;
+    while (!this->_stopping) {
+      const auto batch_i = this->_nextBatchI++;
+      const auto begin_board_i =
+          batch_i * fosssweeper::CorpusPipelineSettings::BATCH_SIZE;
+      if (begin_board_i >= candidate_limit)
+        return;
+      const auto end_board_i = std::min(
+          candidate_limit,
+          begin_board_i + fosssweeper::CorpusPipelineSettings::BATCH_SIZE);
+      const auto begin = std::chrono::steady_clock::now();
+      BoardBatch batch;
+      batch._batchI = batch_i;
+      batch._boards.resize(end_board_i - begin_board_i);
+      for (auto board_i = begin_board_i; board_i < end_board_i; board_i++) {
+        auto &board = batch._boards[board_i - begin_board_i];
+        board._boardRecord = fosssweeper::BoardCorpus::generateRecord(
+            game_model, corpus_settings, corpus_settings._firstSeed + board_i,
+            board._bombBitmap);
+      }
+      stage_result._busySeconds += getSecondsSince(begin);
+      stage_result._boardCount += batch._boards.size();
+      stage_result._passedCount += batch._boards.size();
+      if (!this->_generatedQueue.push(std::move(batch)))
+        return;
+    }
+  }
+
+  // batches are passed on even when every board was dropped, the writer needs
+  // all of them to keep the order
+  void filter(fosssweeper::StageResult &stage_result) {
+    fosssweeper::GameModel game_model;
+    BoardBatch batch;
+    while (!this->_stopping && this->_generatedQueue.pop(batch)) {
+      const auto begin = std::chrono::steady_clock::now();
+      stage_result._boardCount += batch._boards.size();
+      std::erase_if(batch._boards, [&](const GeneratedBoard &board) {
+        return !this->getPassesFilter(board, game_model);
+      });
+      stage_result._passedCount += batch._boards.size();
+      stage_result._busySeconds += getSecondsSince(begin);
+      if (!this->_filteredQueue.push(std::move(batch)))
+        return;
+    }
+  }
+
+  void compress(fosssweeper::StageResult &stage_result) {
+    BoardBatch batch;
+    while (!this->_stopping && this->_filteredQueue.pop(batch)) {
+      const auto begin = std::chrono::steady_clock::now();
+      const auto board_count = batch._boards.size();
+      batch._records.resize(board_count * this->_recordSize);
+      for (std::size_t board_i = 0; board_i < board_count; board_i++) {
+        const auto &board = batch._boards[board_i];
+        // the boards were moved since they were generated
+        auto board_record = board._boardRecord;
+        board_record._bombBitmap = board._bombBitmap;
+        fosssweeper::BoardCorpus::encodeBoard(
+            board_record, std::span<unsigned char>(batch._records)
+                              .subspan(board_i * this->_recordSize,
+                                       this->_recordSize));
+      }
+      batch._boards.clear();
+      stage_result._boardCount += board_count;
+      stage_result._passedCount += board_count;
+      stage_result._busySeconds += getSecondsSince(begin);
+      if (!this->_compressedQueue.push(std::move(batch)))
+        return;
+    }
+  }
+
+  // batches arriving early wait until the ones before them are written
+  std::size_t write(std::ostream &stream,
+                    fosssweeper::StageResult &stage_result) {
+    const auto target_count = this->_settings._boardCorpusSettings._boardCount;
+    std::size_t board_count = 0;
+    std::size_t next_batch_i = 0;
+    std::map<std::size_t, BoardBatch> pending_batches;
+    BoardBatch batch;
+    while (board_count < target_count && this->_compressedQueue.pop(batch)) {
+      pending_batches.emplace(batch._batchI, std::move(batch));
+      for (auto it = pending_batches.find(next_batch_i);
+           it != pending_batches.end() && board_count < target_count;
+           it = pending_batches.find(++next_batch_i)) {
+        const auto begin = std::chrono::steady_clock::now();
+        const auto batch_board_count = it->second._records.size() /
+                                       this->_recordSize;
+        const auto write_count =
+            std::min(batch_board_count, target_count - board_count);
+        stream.write(
+            reinterpret_cast<const char *>(it->second._records.data()),
+            static_cast<std::streamsize>(write_count * this->_recordSize));
+        if (!stream) {
+          throw std::runtime_error("failed to write board corpus");
+        }
+        board_count += write_count;
+        stage_result._boardCount += batch_board_count;
+        stage_result._passedCount += write_count;
+        stage_result._busySeconds += getSecondsSince(begin);
+        pending_batches.erase(it);
+      }
+    }
+    return board_count;
+  }
+};
+} // namespace
+
+void fosssweeper::StageResult::add(
+    const fosssweeper::StageResult &other) noexcept {
+  this->_boardCount += other._boardCount;
+  this->_passedCount += other._passedCount;
+  this->_busySeconds += other._busySeconds;
+}
+
+double fosssweeper::StageResult::getBoardsPerSecond() const noexcept {
+  if (this->_busySeconds <= 0.0)
+    return 0.0;
+  return static_cast<double>(this->_boardCount) *
+         static_cast<double>(this->_threadCount) / this->_busySeconds;
+}
+
+fosssweeper::CorpusPipelineResult fosssweeper::runCorpusPipeline(
+    const std::filesystem::path &path,
+    const fosssweeper::CorpusPipelineSettings &settings) {
+  const auto pipeline_begin = std::chrono::steady_clock::now();
+  const auto thread_count = std::max<std::size_t>(settings._threadCount, 1);
+  CorpusPipeline pipeline(settings);
+  pipeline._stageResults[StageIndex::Generate]._name = "generate";
+  pipeline._stageResults[StageIndex::Filter]._name = "filter";
+  pipeline._stageResults[StageIndex::Compress]._name = "compress";
+  pipeline._stageResults[StageIndex::Write]._name = "write";
+
+  auto corpus_settings = settings._boardCorpusSettings;
+  std::array<unsigned char, 64> header = std::array<unsigned char, 64>();
+  corpus_settings._boardCount = 0;
+  fosssweeper::BoardCorpus::encodeHeader(corpus_settings, header);
+  std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+  stream.write(reinterpret_cast<const char *>(header.data()),
+               static_cast<std::streamsize>(header.size()));
+  if (!stream) {
+    throw std::runtime_error("failed to write " + path.string());
+  }
+
+  // the last thread leaving a stage closes the queue after it, so the closing
+  // travels down to the writer once the candidates run out
+  std::vector<std::thread> threads;
+  const auto startStage = [&](StageIndex stage_i, auto work,
+                              fosssweeper::BoundedQueue<BoardBatch> &output) {
+    pipeline._stageResults[stage_i]._threadCount = thread_count;
+    pipeline._runningCounts[stage_i] = thread_count;
+    for (std::size_t thread_i = 0; thread_i < thread_count; thread_i++) {
+      threads.emplace_back([&pipeline, &output, stage_i, work]() {
+        fosssweeper::StageResult stage_result;
+        try {
+          (pipeline.*work)(stage_result);
+        } catch (...) {
+          pipeline.fail();
+        }
+        {
+          std::lock_guard<std::mutex> lock(pipeline._mutex);
+          pipeline._stageResults[stage_i].add(stage_result);
+        }
+        if (--pipeline._runningCounts[stage_i] == 0) {
+          output.close();
+        }
+      });
+    }
+  };
+  startStage(StageIndex::Generate, &CorpusPipeline::generate,
+             pipeline._generatedQueue);
+  startStage(StageIndex::Filter, &CorpusPipeline::filter,
+             pipeline._filteredQueue);
+  startStage(StageIndex::Compress, &CorpusPipeline::compress,
+             pipeline._compressedQueue);
+
+  fosssweeper::CorpusPipelineResult pipeline_result;
+  auto &write_result = pipeline._stageResults[StageIndex::Write];
+  write_result._threadCount = 1;
+  try {
+    pipeline_result._boardCount = pipeline.write(stream, write_result);
+  } catch (...) {
+    pipeline.fail();
+  }
+  pipeline.stop();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (pipeline._exceptionPtr) {
+    std::rethrow_exception(pipeline._exceptionPtr);
+  }
+
+  corpus_settings._boardCount = pipeline_result._boardCount;
+  fosssweeper::BoardCorpus::encodeHeader(corpus_settings, header);
+  stream.seekp(0);
+  stream.write(reinterpret_cast<const char *>(header.data()),
+               static_cast<std::streamsize>(header.size()));
+  stream.flush();
+  if (!stream) {
+    throw std::runtime_error("failed to write " + path.string());
+  }
+  pipeline_result._stageResults.assign(pipeline._stageResults.begin(),
+                                       pipeline._stageResults.end());
+  pipeline_result._seconds = getSecondsSince(pipeline_begin);
+  return pipeline_result;
+}
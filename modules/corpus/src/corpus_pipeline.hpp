@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FOSSSWEEPER_CORPUS_PIPELINE_HPP
+#define FOSSSWEEPER_CORPUS_PIPELINE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <fosssweeper/board_corpus.hpp>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace fosssweeper {
+struct CorpusPipelineSettings {
+  static const std::size_t BATCH_SIZE;
+  static const std::size_t QUEUE_CAPACITY;
+
+  fosssweeper::BoardCorpusSettings _boardCorpusSettings =
+      fosssweeper::BoardCorpusSettings();
+  std::size_t _threadCount = 1;
+  // generation gives up after this many boards when the filter is too strict
+  std::size_t _candidateLimit = 0;
+  int _minBbbv = 0;
+  int _maxBbbv = std::numeric_limits<int>::max();
+  bool _noGuessOnly = false;
+};
+
+struct StageResult {
+  std::string _name = std::string();
+  std::size_t _threadCount = 0;
+  std::size_t _boardCount = 0;
+  std::size_t _passedCount = 0;
+  // time spent working, summed over the threads of the stage
+  double _busySeconds = 0.0;
+
+  void add(const fosssweeper::StageResult &other) noexcept;
+  double getBoardsPerSecond() const noexcept;
+};
+
+struct CorpusPipelineResult {
+  std::vector<fosssweeper::StageResult> _stageResults =
+      std::vector<fosssweeper::StageResult>();
+  std::size_t _boardCount = 0;
+  double _seconds = 0.0;
+};
+
+// Fills a board corpus through the stages generate, filter, compress and
+// write, connected by bounded queues. The first three stages run on their own
+// threads and pass batches of boards along; the writer puts the batches back
+// into seed order, so the corpus holds the first boards passing the filter
+// whatever the thread count. A stage's boards per second is what it would
+// manage if it never had to wait for another stage, so the slowest one is
+// the bottleneck.
+fosssweeper::CorpusPipelineResult
+runCorpusPipeline(const std::filesystem::path &path,
+                  const fosssweeper::CorpusPipelineSettings &settings);
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_difficulty.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/tool_options.hpp>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "corpus_pipeline.hpp"
+
+namespace {
+const char *const USAGE =
+    "usage: fosssweeper_corpus [options] --output <path>\n"
+    "  --boards <count>         boards per configuration (default 100000)\n"
+    "  --threads <count>        threads of each parallel stage (default:\n"
+    "                           hardware threads)\n"
+    "  --config <config>        beginner, intermediate, expert or <w>x<h>x<b>,\n"
+    "                           may be repeated (default expert)\n"
+    "  --mode <mode>            classic, opening or no_guess (default classic)\n"
+    "  --seed <seed>            seed of the first board (default 0)\n"
+    "  --min-3bv <3bv>          drop boards with a lower 3BV\n"
+    "  --max-3bv <3bv>          drop boards with a higher 3BV\n"
+    "  --no-guess               drop boards the solver can not clear\n"
+    "  --max-candidates <count> boards generated at most per configuration\n"
+    "                           (default: 100 times the boards)\n"
+    "  --output <path>          corpus file; with several configurations the\n"
+    "                           configuration is added to the file name\n";
+} // namespace
+
+int main(int argc, char *argv[]) {
+  try {
+    std::size_t board_count = 100000;
+    std::size_t candidate_count = 0;
+    fosssweeper::CorpusPipelineSettings settings;
+    settings._threadCount = std::thread::hardware_concurrency();
+    std::vector<fosssweeper::GameConfiguration> game_configurations;
+    std::filesystem::path output_path;
+    for (int arg_i = 1; arg_i < argc; arg_i++) {
+      const std::string_view option = argv[arg_i];
+      if (option == "--help") {
+        std::cout << USAGE;
+        return 0;
+      }
+      if (option == "--no-guess") {
+        settings._noGuessOnly = true;
+        continue;
+      }
+      if (arg_i + 1 >= argc) {
+        throw std::runtime_error("missing value for " + std::string(option));
+      }
+      const std::string value = argv[++arg_i];
+      if (option == "--boards") {
+        board_count = fosssweeper::parseNumber(option, value);
+      } else if (option == "--threads") {
+        settings._threadCount = fosssweeper::parseNumber(option, value);
+      } else if (option == "--config") {
+        game_configurations.push_back(
+            fosssweeper::parseGameConfiguration(value));
+      } else if (option == "--mode") {
+        settings._boardCorpusSettings._generationMode =
+            fosssweeper::parseGenerationMode(value);
+      } else if (option == "--seed") {
+        settings._boardCorpusSettings._firstSeed =
+            fosssweeper::parseNumber(option, value);
+      } else if (option == "--min-3bv") {
+        settings._minBbbv = static_cast<int>(std::min<std::uint64_t>(
+            fosssweeper::parseNumber(option, value),
+            std::numeric_limits<int>::max()));
+      } else if (option == "--max-3bv") {
+        settings._maxBbbv = static_cast<int>(std::min<std::uint64_t>(
+            fosssweeper::parseNumber(option, value),
+            std::numeric_limits<int>::max()));
+      } else if (option == "--max-candidates") {
+        candidate_count = fosssweeper::parseNumber(option, value);
+      } else if (option == "--output") {
+        output_path = value;
+      } else {
+        throw std::runtime_error("unknown option " + std::string(option));
+      }
+    }
+    if (output_path.empty())
+      throw std::runtime_error("no output path given");
+    if (game_configurations.empty()) {
+      game_configurations = {
+          fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert)};
+    }
+    settings._threadCount = std::max<std::size_t>(settings._threadCount, 1);
+    settings._boardCorpusSettings._boardCount = board_count;
+    settings._candidateLimit =
+        candidate_count != 0 ? candidate_count : board_count * 100;
+
+    std::cout << "threads per stage: " << settings._threadCount << "\n";
+    for (const auto &game_configuration : game_configurations) {
+      settings._boardCorpusSettings._gameConfiguration = game_configuration;
+      auto path = output_path;
+      if (game_configurations.size() > 1) {
+        path.replace_filename(
+            output_path.stem().string() + "_" +
+            fosssweeper::getConfigurationName(game_configuration) +
+            output_path.extension().string());
+      }
+      const auto pipeline_result =
+          fosssweeper::runCorpusPipeline(path, settings);
+      std::cout << "corpus: " << path.string() << "\n";
+      std::cout << "configuration: "
+                << fosssweeper::getConfigurationName(game_configuration)
+                << "\n";
+      std::cout << "boards: " << pipeline_result._boardCount << "\n";
+      std::cout << "seconds: " << pipeline_result._seconds << "\n";
+      std::cout << "boards per second: "
+                << (pipeline_result._seconds <= 0.0
+                        ? 0.0
+                        : static_cast<double>(pipeline_result._boardCount) /
+                              pipeline_result._seconds)
+                << "\n";
+      for (const auto &stage_result : pipeline_result._stageResults) {
+        std::cout << stage_result._name << ": "
+                  << stage_result.getBoardsPerSecond()
+                  << " boards per second (" << stage_result._threadCount
+                  << " threads, " << stage_result._boardCount << " in, "
+                  << stage_result._passedCount << " out, "
+                  << stage_result._busySeconds << " busy seconds)\n";
+      }
+      if (pipeline_result._boardCount < board_count) {
+        std::cout << "too few boards passed the filter\n";
+      }
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "fosssweeper_corpus: " << e.what() << "\n" << USAGE;
+    return 1;
+  }
+  return 0;
+}
@@ -45,4 +45,14 @@ void fosssweeper::DesktopTimer::stop() {
   this->_stopwatch.Pause();
 }
 
+void fosssweeper::DesktopTimer::resume() {
+  this->_stopwatch.Resume();
+  this->_timer.Start(TIMER_INTERVAL);
+}
+
+void fosssweeper::DesktopTimer::resumeAt(unsigned long game_time) {
+  this->_stopwatch.Start(static_cast<long>(game_time));
+  this->_timer.Start(TIMER_INTERVAL);
+}
+
 wxTimer &fosssweeper::DesktopTimer::getTimer() noexcept { return this->_timer; }
\ No newline at end of file
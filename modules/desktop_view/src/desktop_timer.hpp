@@ -40,6 +40,8 @@ struct DesktopTimer : public fosssweeper::Timer {
   unsigned long getGameTime() override;
   void start() override;
   void stop() override;
+  void resume();
+  void resumeAt(unsigned long game_time);
   wxTimer &getTimer() noexcept;
 };
 } // namespace fosssweeper
@@ -26,6 +26,7 @@
 
 #include <fosssweeper/desktop_model.hpp>
 #include <fosssweeper/game_model.hpp>
+#include <chrono>
 #include <functional>
 #include <sstream>
 #include <stdexcept>
@@ -59,4 +60,9 @@ fosssweeper::DesktopModel &fosssweeper::DesktopView::getDesktopModel() noexcept
 
 fosssweeper::GameModel &fosssweeper::DesktopView::getGameModel() noexcept {
   return this->_gameModel.get();
+}
+
+std::chrono::steady_clock::time_point
+fosssweeper::DesktopView::getStartTime() const noexcept {
+  return this->_startTime;
 }
\ No newline at end of file
@@ -25,6 +25,7 @@
 #ifndef FOSSSWEEPER_DESKTOP_VIEW_HPP
 #define FOSSSWEEPER_DESKTOP_VIEW_HPP
 
+#include <chrono>
 #include <functional>
 
 namespace fosssweeper {
@@ -34,6 +35,8 @@ class GameModel;
 struct DesktopView {
   std::reference_wrapper<fosssweeper::DesktopModel> _desktopModel;
   std::reference_wrapper<fosssweeper::GameModel> _gameModel;
+  std::chrono::steady_clock::time_point _startTime =
+      std::chrono::steady_clock::now();
 
   DesktopView(fosssweeper::DesktopModel &desktop_model,
               fosssweeper::GameModel &game_model) noexcept;
@@ -41,6 +44,7 @@ struct DesktopView {
   bool run() noexcept;
   fosssweeper::DesktopModel &getDesktopModel() noexcept;
   fosssweeper::GameModel &getGameModel() noexcept;
+  std::chrono::steady_clock::time_point getStartTime() const noexcept;
 };
 } // namespace fosssweeper
 
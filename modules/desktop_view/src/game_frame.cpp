@@ -24,7 +24,12 @@
 
 #include "game_frame.hpp"
 
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
 #include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/generation_mode.hpp>
 #include <fosssweeper/credits.hpp>
 #include <fosssweeper/license.hpp>
 #include <functional>
@@ -38,18 +43,47 @@
 #include "icon.hpp"
 #include "wx_include.hpp"
 
+#include <wx/filename.h>
+#include <wx/stdpaths.h>
+
 BEGIN_EVENT_TABLE(fosssweeper::GameFrame, wxFrame)
 EVT_MENU(wxID_NEW, fosssweeper::GameFrame::onNew)
 EVT_MENU(wxID_EXIT, fosssweeper::GameFrame::onExit)
 EVT_MENU(wxID_ABOUT, fosssweeper::GameFrame::onAbout)
+EVT_CLOSE(fosssweeper::GameFrame::onClose)
 END_EVENT_TABLE()
 
+namespace {
+std::filesystem::path getUserDataPath() {
+  const auto user_data_dir = wxStandardPaths::Get().GetUserDataDir();
+  wxFileName::Mkdir(user_data_dir, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+  return std::filesystem::path(user_data_dir.ToStdWstring());
+}
+} // namespace
+
 void fosssweeper::GameFrame::resizeGamePanel(int x, int y) {
   wxSize size(x, y);
   this->SetClientSize(size);
   this->_gamePanel->SetSize(size);
 }
 
+void fosssweeper::GameFrame::updateMenuItems() {
+  const auto &game_model = this->_view.get().getGameModel();
+  const auto game_difficulty =
+      game_model.getGameConfiguration().getGameDifficulty();
+  this->_beginnerItem->Check(game_difficulty ==
+                             fosssweeper::GameDifficulty::Beginner);
+  this->_intermediateItem->Check(game_difficulty ==
+                                 fosssweeper::GameDifficulty::Intermediate);
+  this->_expertItem->Check(game_difficulty ==
+                           fosssweeper::GameDifficulty::Expert);
+  this->_questionMarksItem->Check(game_model.getQuestionsEnabled());
+  this->_safeOpeningItem->Check(game_model.getGenerationMode() ==
+                                fosssweeper::GenerationMode::Opening);
+  this->_noGuessingItem->Check(game_model.getGenerationMode() ==
+                               fosssweeper::GenerationMode::NoGuess);
+}
+
 fosssweeper::GameFrame::GameFrame(fosssweeper::DesktopView &view)
     : _view(std::ref(view)),
       wxFrame(NULL, wxID_ANY, "", wxDefaultPosition, wxDefaultSize,
@@ -70,6 +104,13 @@ fosssweeper::GameFrame::GameFrame(fosssweeper::DesktopView &view)
 
   // create game menu items
   auto *const new_item = new wxMenuItem(game_menu, wxID_NEW, "&New\tF2");
+  auto *const undo_item = new wxMenuItem(game_menu, wxID_UNDO, "&Undo\tCtrl+Z");
+  auto *const redo_item = new wxMenuItem(game_menu, wxID_REDO, "&Redo\tCtrl+Y");
+  auto *const hint_item = new wxMenuItem(game_menu, wxID_ANY, "&Hint\tH");
+  auto *const certain_moves_item =
+      new wxMenuItem(game_menu, wxID_ANY, "&Certain Moves\tA");
+  auto *const best_times_item =
+      new wxMenuItem(game_menu, wxID_ANY, "Best &Times...");
   this->_beginnerItem = new wxMenuItem(game_menu, wxID_ANY, "&Beginner");
   this->_beginnerItem->SetCheckable(true);
   this->_intermediateItem = new wxMenuItem(game_menu, wxID_ANY, "&Intermediate");
@@ -79,12 +120,23 @@ fosssweeper::GameFrame::GameFrame(fosssweeper::DesktopView &view)
   auto *const custom_item = new wxMenuItem(game_menu, wxID_ANY, "&Custom...");
   this->_questionMarksItem = new wxMenuItem(game_menu, wxID_ANY, "&Question Marks");
   this->_questionMarksItem->SetCheckable(true);
+  this->_safeOpeningItem = new wxMenuItem(game_menu, wxID_ANY, "Safe &Opening");
+  this->_safeOpeningItem->SetCheckable(true);
+  this->_noGuessingItem = new wxMenuItem(game_menu, wxID_ANY, "No &Guessing");
+  this->_noGuessingItem->SetCheckable(true);
   auto *const pixel_scale_item =
       new wxMenuItem(game_menu, wxID_ANY, "&Pixel Scale...");
   auto *const exit_item = new wxMenuItem(game_menu, wxID_EXIT, "&Exit\tAlt+F4");
 
   // bind game menu items
   Bind(wxEVT_MENU, &fosssweeper::GameFrame::onNew, this, new_item->GetId());
+  Bind(wxEVT_MENU, &fosssweeper::GameFrame::onUndo, this, undo_item->GetId());
+  Bind(wxEVT_MENU, &fosssweeper::GameFrame::onRedo, this, redo_item->GetId());
+  Bind(wxEVT_MENU, &fosssweeper::GameFrame::onHint, this, hint_item->GetId());
+  Bind(wxEVT_MENU, &fosssweeper::GameFrame::onCertainMoves, this,
+       certain_moves_item->GetId());
+  Bind(wxEVT_MENU, &fosssweeper::GameFrame::onBestTimes, this,
+       best_times_item->GetId());
   Bind(wxEVT_MENU, &fosssweeper::GameFrame::onBeginner, this,
        this->_beginnerItem->GetId());
   Bind(wxEVT_MENU, &fosssweeper::GameFrame::onIntermediate, this,
@@ -93,12 +145,21 @@ fosssweeper::GameFrame::GameFrame(fosssweeper::DesktopView &view)
   Bind(wxEVT_MENU, &fosssweeper::GameFrame::onCustom, this, custom_item->GetId());
   Bind(wxEVT_MENU, &fosssweeper::GameFrame::onQuestionMarks, this,
        this->_questionMarksItem->GetId());
+  Bind(wxEVT_MENU, &fosssweeper::GameFrame::onGenerationMode, this,
+       this->_safeOpeningItem->GetId());
+  Bind(wxEVT_MENU, &fosssweeper::GameFrame::onGenerationMode, this,
+       this->_noGuessingItem->GetId());
   Bind(wxEVT_MENU, &fosssweeper::GameFrame::onPixelScale, this,
        pixel_scale_item->GetId());
   Bind(wxEVT_MENU, &fosssweeper::GameFrame::onExit, this, exit_item->GetId());
 
   // append menu items to game menu
   game_menu->Append(new_item);
+  game_menu->Append(undo_item);
+  game_menu->Append(redo_item);
+  game_menu->Append(hint_item);
+  game_menu->Append(certain_moves_item);
+  game_menu->Append(best_times_item);
   game_menu->AppendSeparator();
   game_menu->Append(this->_beginnerItem);
   game_menu->Append(this->_intermediateItem);
@@ -106,6 +167,8 @@ fosssweeper::GameFrame::GameFrame(fosssweeper::DesktopView &view)
   game_menu->Append(custom_item);
   game_menu->AppendSeparator();
   game_menu->Append(this->_questionMarksItem);
+  game_menu->Append(this->_safeOpeningItem);
+  game_menu->Append(this->_noGuessingItem);
   game_menu->Append(pixel_scale_item);
   game_menu->AppendSeparator();
   game_menu->Append(exit_item);
@@ -125,23 +188,74 @@ fosssweeper::GameFrame::GameFrame(fosssweeper::DesktopView &view)
   help_menu->Append(license_item);
   help_menu->Append(about_item);
 
-  // check the beginner difficulty menu item
-  this->_beginnerItem->Check(true);
+  this->updateMenuItems();
 
   // create the game panel
+  const auto user_data_path = getUserDataPath();
+  const auto autosave_path = user_data_path / "autosave.fss";
   auto &desktop_model = _view.get().getDesktopModel();
   const auto size = desktop_model.getSize();
   this->SetClientSize(size.x, size.y);
-  this->_gamePanel = new fosssweeper::GamePanel(view, this, size.x, size.y);
+  this->_gamePanel = new fosssweeper::GamePanel(
+      view, this, size.x, size.y, autosave_path,
+      user_data_path / "replays.fsr", user_data_path / "statistics.fsl");
   this->SetAutoLayout(true);
   this->Refresh(false);
+
+  // the game of the last session is restored once the event loop runs, so
+  // the disk read never holds up showing the window
+  this->CallAfter(
+      [this, autosave_path]() { this->restoreGame(autosave_path); });
+}
+
+void fosssweeper::GameFrame::restoreGame(
+    const std::filesystem::path &autosave_path) {
+  if (this->_gamePanel->restoreGame(autosave_path)) {
+    this->updateMenuItems();
+    const auto size = this->_view.get().getDesktopModel().getSize();
+    this->resizeGamePanel(size.x, size.y);
+  }
+  // FOSSSWEEPER_STARTUP_TIME reports how long it took from process start
+  // until the restored game was drawn and the window took input
+  if (wxGetEnv("FOSSSWEEPER_STARTUP_TIME", nullptr)) {
+    this->_gamePanel->Update();
+    const auto startup_time = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() -
+        this->_view.get().getStartTime());
+    std::fprintf(stderr, "first interactive frame after %.1f ms\n",
+                 startup_time.count());
+  }
 }
 
 void fosssweeper::GameFrame::onNew(wxCommandEvent &WXUNUSED(e)) {
+  // the worker hands the game back before the menu changes it
+  this->_gamePanel->finishModelUpdates();
   this->_view.get().getGameModel().newGame();
+  this->_gamePanel->recordGameEnd();
+  this->_gamePanel->autosave();
   this->Refresh(false);
 }
 
+void fosssweeper::GameFrame::onHint(wxCommandEvent &WXUNUSED(e)) {
+  this->_gamePanel->requestHint();
+}
+
+void fosssweeper::GameFrame::onUndo(wxCommandEvent &WXUNUSED(e)) {
+  this->_gamePanel->undo();
+}
+
+void fosssweeper::GameFrame::onRedo(wxCommandEvent &WXUNUSED(e)) {
+  this->_gamePanel->redo();
+}
+
+void fosssweeper::GameFrame::onCertainMoves(wxCommandEvent &WXUNUSED(e)) {
+  this->_gamePanel->applyCertainMoves();
+}
+
+void fosssweeper::GameFrame::onBestTimes(wxCommandEvent &WXUNUSED(e)) {
+  this->_gamePanel->showBestTimes();
+}
+
 void fosssweeper::GameFrame::onBeginner(wxCommandEvent &WXUNUSED(e)) {
   auto &game_model = this->_view.get().getGameModel();
   auto &desktop_model = this->_view.get().getDesktopModel();
@@ -150,7 +264,10 @@ void fosssweeper::GameFrame::onBeginner(wxCommandEvent &WXUNUSED(e)) {
   this->_expertItem->Check(false);
   const fosssweeper::GameConfiguration game_configuration(
       fosssweeper::GameDifficulty::Beginner);
+  this->_gamePanel->finishModelUpdates();
   game_model.newGame(game_configuration);
+  this->_gamePanel->recordGameEnd();
+  this->_gamePanel->autosave();
   auto size = desktop_model.getSize();
   this->resizeGamePanel(size.x, size.y);
   this->_gamePanel->Refresh(false);
@@ -164,7 +281,10 @@ void fosssweeper::GameFrame::onIntermediate(wxCommandEvent &WXUNUSED(e)) {
   this->_expertItem->Check(false);
   const fosssweeper::GameConfiguration game_configuration(
       fosssweeper::GameDifficulty::Intermediate);
+  this->_gamePanel->finishModelUpdates();
   game_model.newGame(game_configuration);
+  this->_gamePanel->recordGameEnd();
+  this->_gamePanel->autosave();
   auto size = desktop_model.getSize();
   this->resizeGamePanel(size.x, size.y);
   this->_gamePanel->Refresh(false);
@@ -178,7 +298,10 @@ void fosssweeper::GameFrame::onExpert(wxCommandEvent &WXUNUSED(e)) {
   this->_expertItem->Check(true);
   const fosssweeper::GameConfiguration game_configuration(
       fosssweeper::GameDifficulty::Expert);
+  this->_gamePanel->finishModelUpdates();
   game_model.newGame(game_configuration);
+  this->_gamePanel->recordGameEnd();
+  this->_gamePanel->autosave();
   auto size = desktop_model.getSize();
   this->resizeGamePanel(size.x, size.y);
   this->_gamePanel->Refresh(false);
@@ -193,7 +316,10 @@ void fosssweeper::GameFrame::onCustom(wxCommandEvent &WXUNUSED(e)) {
     const fosssweeper::GameConfiguration game_configuration(
         config_dialog.getButtonsWide(), config_dialog.getButtonsTall(),
         config_dialog.getBombCount());
+    this->_gamePanel->finishModelUpdates();
     game_model.newGame(game_configuration);
+    this->_gamePanel->recordGameEnd();
+    this->_gamePanel->autosave();
     auto size = desktop_model.getSize();
     this->resizeGamePanel(size.x, size.y);
     this->_gamePanel->Refresh(false);
@@ -202,10 +328,24 @@ void fosssweeper::GameFrame::onCustom(wxCommandEvent &WXUNUSED(e)) {
 
 void fosssweeper::GameFrame::onQuestionMarks(wxCommandEvent &WXUNUSED(e)) {
   const auto questions_enabled = this->_questionMarksItem->IsChecked();
+  this->_gamePanel->finishModelUpdates();
   this->_view.get().getGameModel().setQuestionsEnabled(questions_enabled);
+  this->_gamePanel->autosave();
   this->_gamePanel->Refresh(false);
 }
 
+void fosssweeper::GameFrame::onGenerationMode(wxCommandEvent &WXUNUSED(e)) {
+  auto generation_mode = fosssweeper::GenerationMode::Classic;
+  if (this->_noGuessingItem->IsChecked()) {
+    generation_mode = fosssweeper::GenerationMode::NoGuess;
+  } else if (this->_safeOpeningItem->IsChecked()) {
+    generation_mode = fosssweeper::GenerationMode::Opening;
+  }
+  this->_gamePanel->finishModelUpdates();
+  this->_view.get().getGameModel().setGenerationMode(generation_mode);
+  this->_gamePanel->autosave();
+}
+
 void fosssweeper::GameFrame::onPixelScale(wxCommandEvent &e) {
   const auto &desktop_model = this->_view.get().getDesktopModel();
   fosssweeper::PixelScaleDialog pixel_scale_dialog(
@@ -223,6 +363,11 @@ void fosssweeper::GameFrame::onPixelScale(wxCommandEvent &e) {
 
 void fosssweeper::GameFrame::onExit(wxCommandEvent &WXUNUSED(e)) { this->Close(); }
 
+void fosssweeper::GameFrame::onClose(wxCloseEvent &e) {
+  this->_gamePanel->autosave();
+  e.Skip();
+}
+
 void fosssweeper::GameFrame::onCredits(wxCommandEvent &e) {
   auto credits_dialog = fosssweeper::createCreditsDialog(this);
   credits_dialog.ShowModal();
@@ -25,6 +25,7 @@
 #ifndef FOSSSWEEPER_GAME_FRAME_HPP
 #define FOSSSWEEPER_GAME_FRAME_HPP
 
+#include <filesystem>
 #include <fosssweeper/desktop_model.hpp>
 #include <functional>
 
@@ -41,20 +42,31 @@ public:
   wxMenuItem *_intermediateItem;
   wxMenuItem *_expertItem;
   wxMenuItem *_questionMarksItem;
+  wxMenuItem *_safeOpeningItem;
+  wxMenuItem *_noGuessingItem;
   fosssweeper::GamePanel *_gamePanel;
 
   void resizeGamePanel(int x, int y);
+  void updateMenuItems();
+  void restoreGame(const std::filesystem::path &autosave_path);
 
   GameFrame(fosssweeper::DesktopView &view);
 
   void onNew(wxCommandEvent &e);
+  void onHint(wxCommandEvent &e);
+  void onCertainMoves(wxCommandEvent &e);
+  void onBestTimes(wxCommandEvent &e);
+  void onUndo(wxCommandEvent &e);
+  void onRedo(wxCommandEvent &e);
   void onBeginner(wxCommandEvent &e);
   void onIntermediate(wxCommandEvent &e);
   void onExpert(wxCommandEvent &e);
   void onCustom(wxCommandEvent &e);
   void onPixelScale(wxCommandEvent &e);
   void onQuestionMarks(wxCommandEvent &e);
+  void onGenerationMode(wxCommandEvent &e);
   void onExit(wxCommandEvent &e);
+  void onClose(wxCloseEvent &e);
   void onCredits(wxCommandEvent &e);
   void onLicense(wxCommandEvent &e);
   void onAbout(wxCommandEvent &e);
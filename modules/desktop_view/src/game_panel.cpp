@@ -28,11 +28,24 @@ const int TIMER_INTERVAL = MILLISECONDS_PER_SECOND / 15;
 #include "game_panel.hpp"
 #include "desktop_view.hpp"
 
+#include <chrono>
 #include <cstddef>
+#include <filesystem>
+#include <fosssweeper/autosave_service.hpp>
 #include <fosssweeper/desktop_model.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_record.hpp>
+#include <fosssweeper/hint_service.hpp>
+#include <fosssweeper/model_worker.hpp>
+#include <fosssweeper/replay_recorder.hpp>
 #include <fosssweeper/sprite.hpp>
+#include <fosssweeper/statistics_store.hpp>
+#include <fstream>
 #include <functional>
+#include <iomanip>
+#include <memory>
 #include <optional>
+#include <sstream>
 
 #include "spritesheet.hpp"
 #include "wx_include.hpp"
@@ -52,11 +65,44 @@ wxBitmap &fosssweeper::GamePanel::getBitmap(fosssweeper::Sprite sprite) {
 }
 
 fosssweeper::GamePanel::GamePanel(fosssweeper::DesktopView &desktop_view, wxFrame *parent,
-                             int width, int height)
+                             int width, int height,
+                             const std::filesystem::path &autosave_path,
+                             const std::filesystem::path &replay_path,
+                             const std::filesystem::path &statistics_path)
     : wxPanel(parent, wxID_ANY), _desktopView(std::ref(desktop_view)),
       _timer(this) {
   Bind(wxEVT_TIMER, &GamePanel::onTimer, this, this->_timer.getTimer().GetId());
+  Bind(wxEVT_THREAD, &GamePanel::onHint, this);
+  // hints are found on a worker thread and handed back to the UI thread
+  this->_hintService = std::make_unique<fosssweeper::HintService>(
+      [this](const fosssweeper::Hint &hint) {
+        auto *const event = new wxThreadEvent(wxEVT_THREAD);
+        event->SetPayload(hint);
+        wxQueueEvent(this, event);
+      });
+  this->_autosaveService =
+      std::make_unique<fosssweeper::AutosaveService>(autosave_path);
+  auto &game_model = this->_desktopView.get().getGameModel();
+  game_model.setJournalEnabled(true);
+  // every session appends its own recording to the replay log
+  this->_replayStream.open(replay_path, std::ios::binary | std::ios::app);
+  if (this->_replayStream) {
+    this->_replayRecorder =
+        std::make_unique<fosssweeper::ReplayRecorder>(this->_replayStream);
+    game_model.setReplayRecorder(this->_replayRecorder.get());
+  }
+  // the statistics log is loaded and appended to on its own worker
+  this->_statisticsStore =
+      std::make_unique<fosssweeper::StatisticsStore>(statistics_path);
   auto &desktop_model = this->_desktopView.get().getDesktopModel();
+  // optionally the game runs on a worker thread, its updates are applied
+  // back on the UI thread
+  if (wxGetEnv("FOSSSWEEPER_MODEL_WORKER", nullptr)) {
+    this->_modelWorker = std::make_unique<fosssweeper::ModelWorker>(
+        game_model,
+        [this]() { this->CallAfter([this]() { this->onModelUpdate(); }); });
+    desktop_model.setModelWorker(this->_modelWorker.get());
+  }
   int pixel_scale = desktop_model.getPixelScale();
   for (std::size_t bitmap_i = 0;
        bitmap_i < static_cast<std::size_t>(fosssweeper::Sprite::Count); bitmap_i++) {
@@ -71,12 +117,44 @@ fosssweeper::GamePanel::GamePanel(fosssweeper::DesktopView &desktop_view, wxFram
   this->SetSize(wxSize(width, height));
 }
 
-fosssweeper::GamePanel::~GamePanel() {}
+fosssweeper::GamePanel::~GamePanel() {
+  // the worker hands the game back before anything else uses it
+  if (this->_modelWorker) {
+    this->finishModelUpdates();
+    this->_desktopView.get().getDesktopModel().setModelWorker(nullptr);
+    this->_modelWorker.reset();
+  }
+  // join the hint worker before the panel it queues events to goes away
+  this->_hintService.reset();
+  // the autosave worker writes the save made when the window closed first
+  this->_autosaveService.reset();
+  this->_statisticsStore.reset();
+  this->_desktopView.get().getGameModel().setReplayRecorder(nullptr);
+  this->_replayRecorder.reset();
+}
+
+bool fosssweeper::GamePanel::restoreGame(
+    const std::filesystem::path &autosave_path) {
+  auto &game_model = this->_desktopView.get().getGameModel();
+  this->finishModelUpdates();
+  if (!fosssweeper::AutosaveService::tryLoad(autosave_path, game_model)) {
+    return false;
+  }
+  // a restored game that already ended was recorded in the session it ended in
+  this->_gameRecorded =
+      game_model.getGameState() == fosssweeper::GameState::Dead ||
+      game_model.getGameState() == fosssweeper::GameState::Cool;
+  // a restored game that was in progress keeps counting from its saved time
+  if (game_model.getGameState() == fosssweeper::GameState::Playing) {
+    this->_timer.resumeAt(game_model.getGameTime());
+  }
+  this->Refresh(false);
+  return true;
+}
 
 void fosssweeper::GamePanel::onRender(wxPaintEvent &WXUNUSED(e)) {
   wxPaintDC dc(this);
   const auto &desktop_model = this->_desktopView.get().getDesktopModel();
-  const auto &game_model = this->_desktopView.get().getGameModel();
   fosssweeper::Point point;
   wxPoint wx_point;
   dc.SetBrush(wxBrush(wxColour(142, 142, 142)));
@@ -158,14 +236,15 @@ void fosssweeper::GamePanel::onRender(wxPaintEvent &WXUNUSED(e)) {
                 i * desktop_model.getBorderSize()),
         false);
   }
-  const auto score_lcd = fosssweeper::LcdNumber(game_model.getBombsLeft());
+  const auto score_lcd = fosssweeper::LcdNumber(desktop_model.getBombsLeft());
   for (std::size_t digit_i = 0; digit_i < 3; digit_i++) {
     const auto lcd_sprite = fosssweeper::getSpriteFromDigit(score_lcd[digit_i]);
     point = desktop_model.getScorePoint(digit_i);
     wx_point = wxPoint(point.x, point.y);
     dc.DrawBitmap(this->getBitmap(lcd_sprite), wx_point, false);
   }
-  const auto time_lcd = fosssweeper::LcdNumber(game_model.getTimerSeconds());
+  const auto time_lcd =
+      fosssweeper::LcdNumber(desktop_model.getTimerSeconds());
   for (std::size_t digit_i = 0; digit_i < 3; digit_i++) {
     const auto lcd_sprite = fosssweeper::getSpriteFromDigit(time_lcd[digit_i]);
     point = desktop_model.getTimerPoint(digit_i);
@@ -176,15 +255,23 @@ void fosssweeper::GamePanel::onRender(wxPaintEvent &WXUNUSED(e)) {
   point = desktop_model.getFacePoint();
   wx_point = wxPoint(point.x, point.y);
   dc.DrawBitmap(this->getBitmap(face_sprite), wx_point, false);
-  for (int x = 0; x < game_model.getGameConfiguration().getButtonsWide(); x++) {
-    for (int y = 0; y < game_model.getGameConfiguration().getButtonsTall();
-         y++) {
+  const auto button_count = desktop_model.getButtonCount();
+  for (int x = 0; x < button_count.x; x++) {
+    for (int y = 0; y < button_count.y; y++) {
       const auto button_sprite = desktop_model.getButtonSprite(x, y);
       point = desktop_model.getButtonPoint(x, y);
       wx_point = wxPoint(point.x, point.y);
       dc.DrawBitmap(this->getBitmap(button_sprite), wx_point, false);
     }
   }
+  const auto hint_button_o = desktop_model.getHintButtonO();
+  if (hint_button_o.has_value()) {
+    point = desktop_model.getButtonPoint(hint_button_o->x, hint_button_o->y);
+    dc.SetBrush(*wxTRANSPARENT_BRUSH);
+    dc.SetPen(wxPen(wxColour(255, 0, 0), desktop_model.getPixelScale()));
+    dc.DrawRectangle(point.x, point.y, desktop_model.getButtonDimension(),
+                     desktop_model.getButtonDimension());
+  }
 }
 
 void fosssweeper::GamePanel::onMouseMove(wxMouseEvent &e) {
@@ -206,7 +293,13 @@ void fosssweeper::GamePanel::onLeftPress(wxMouseEvent &WXUNUSED(e)) {
 
 void fosssweeper::GamePanel::onLeftRelease(wxMouseEvent &WXUNUSED(e)) {
   auto &desktop_model = this->_desktopView.get().getDesktopModel();
+  this->cancelHint();
   desktop_model.leftRelease(this->_timer);
+  // with a worker the game is recorded and saved once its update arrives
+  if (desktop_model.getIsModelIdle()) {
+    this->recordGameEnd();
+    this->autosave();
+  }
   if (this->HasCapture()) {
     this->ReleaseMouse(); // undo the CaptureMouse() from the press event
   }
@@ -215,7 +308,13 @@ void fosssweeper::GamePanel::onLeftRelease(wxMouseEvent &WXUNUSED(e)) {
 
 void fosssweeper::GamePanel::onRightPress(wxMouseEvent &WXUNUSED(e)) {
   auto &desktop_model = this->_desktopView.get().getDesktopModel();
+  this->cancelHint();
   desktop_model.rightPress(this->_timer);
+  // with a worker the game is recorded and saved once its update arrives
+  if (desktop_model.getIsModelIdle()) {
+    this->recordGameEnd();
+    this->autosave();
+  }
   if (!this->HasCapture()) {
     this->CaptureMouse();
   }
@@ -224,7 +323,13 @@ void fosssweeper::GamePanel::onRightPress(wxMouseEvent &WXUNUSED(e)) {
 
 void fosssweeper::GamePanel::onRightRelease(wxMouseEvent &WXUNUSED(e)) {
   auto &desktop_model = this->_desktopView.get().getDesktopModel();
+  this->cancelHint();
   desktop_model.rightRelease(this->_timer);
+  // with a worker the game is recorded and saved once its update arrives
+  if (desktop_model.getIsModelIdle()) {
+    this->recordGameEnd();
+    this->autosave();
+  }
   if (this->HasCapture()) {
     this->ReleaseMouse();
   }
@@ -239,10 +344,183 @@ void fosssweeper::GamePanel::onMouseLeave(wxMouseEvent &WXUNUSED(e)) {
 
 void fosssweeper::GamePanel::onTimer(wxTimerEvent &WXUNUSED(e)) {
   auto &game_model = this->_desktopView.get().getGameModel();
-  game_model.updateTime(this->_timer.getGameTime());
+  // while the worker has the game the time is sent along with the next click
+  if (this->_desktopView.get().getDesktopModel().getIsModelIdle()) {
+    game_model.updateTime(this->_timer.getGameTime());
+  }
   this->Refresh(false);
 }
 
+void fosssweeper::GamePanel::onHint(wxThreadEvent &e) {
+  const auto hint = e.GetPayload<fosssweeper::Hint>();
+  if (!this->_hintService->getIsCurrent(hint._generation))
+    return;
+  auto &desktop_model = this->_desktopView.get().getDesktopModel();
+  desktop_model.setHintButton(hint._safeButtonO);
+  this->Refresh(false);
+}
+
+void fosssweeper::GamePanel::onModelUpdate() {
+  auto &desktop_model = this->_desktopView.get().getDesktopModel();
+  if (desktop_model.applyModelUpdates(this->_timer)) {
+    this->recordGameEnd();
+    this->autosave();
+  }
+  this->Refresh(false);
+}
+
+// waits for the worker so the game can be used on the UI thread, does
+// nothing without a worker
+void fosssweeper::GamePanel::finishModelUpdates() {
+  auto &desktop_model = this->_desktopView.get().getDesktopModel();
+  desktop_model.finishModelUpdates(this->_timer);
+}
+
+void fosssweeper::GamePanel::requestHint() {
+  auto &game_model = this->_desktopView.get().getGameModel();
+  this->finishModelUpdates();
+  if (game_model.getGameState() != fosssweeper::GameState::Playing)
+    return;
+  this->_hintService->request(game_model);
+}
+
+void fosssweeper::GamePanel::applyCertainMoves() {
+  auto &game_model = this->_desktopView.get().getGameModel();
+  const auto &desktop_model = this->_desktopView.get().getDesktopModel();
+  this->finishModelUpdates();
+  this->cancelHint();
+  if (game_model.getGameState() == fosssweeper::GameState::Playing) {
+    game_model.updateTime(this->_timer.getGameTime());
+  }
+  const auto changed_buttons = game_model.applyCertainMoves();
+  if (changed_buttons.empty())
+    return;
+  if (game_model.getGameState() == fosssweeper::GameState::Cool) {
+    this->_timer.stop();
+  }
+  this->recordGameEnd();
+  this->autosave();
+  const auto buttons_wide = game_model.getGameConfiguration().getButtonsWide();
+  const auto button_dimension = desktop_model.getButtonDimension();
+  const auto size = desktop_model.getSize();
+  // the header holds the face and the bomb counter, which may change too
+  this->RefreshRect(wxRect(0, 0, size.x, desktop_model.getHeaderHeight()),
+                    false);
+  for (const auto button_i : changed_buttons) {
+    const auto point = desktop_model.getButtonPoint(
+        static_cast<int>(button_i % buttons_wide),
+        static_cast<int>(button_i / buttons_wide));
+    this->RefreshRect(
+        wxRect(point.x, point.y, button_dimension, button_dimension), false);
+  }
+}
+
+void fosssweeper::GamePanel::undo() {
+  auto &game_model = this->_desktopView.get().getGameModel();
+  this->finishModelUpdates();
+  this->cancelHint();
+  const auto previous_game_state = game_model.getGameState();
+  if (game_model.undo()) {
+    this->updateTimerAfterJournal(previous_game_state);
+    this->recordGameEnd();
+    this->autosave();
+    this->Refresh(false);
+  }
+}
+
+void fosssweeper::GamePanel::redo() {
+  auto &game_model = this->_desktopView.get().getGameModel();
+  this->finishModelUpdates();
+  this->cancelHint();
+  const auto previous_game_state = game_model.getGameState();
+  if (game_model.redo()) {
+    this->updateTimerAfterJournal(previous_game_state);
+    this->recordGameEnd();
+    this->autosave();
+    this->Refresh(false);
+  }
+}
+
+// undo and redo can move the game in and out of the playing state, the time
+// spent keeps counting from where the timer stopped
+void fosssweeper::GamePanel::updateTimerAfterJournal(
+    fosssweeper::GameState previous_game_state) {
+  auto &game_model = this->_desktopView.get().getGameModel();
+  const bool was_playing =
+      previous_game_state == fosssweeper::GameState::Playing;
+  const bool is_playing =
+      game_model.getGameState() == fosssweeper::GameState::Playing;
+  if (was_playing && !is_playing) {
+    game_model.updateTime(this->_timer.getGameTime());
+    this->_timer.stop();
+  } else if (!was_playing && is_playing) {
+    this->_timer.resume();
+  }
+}
+
+void fosssweeper::GamePanel::cancelHint() {
+  auto &desktop_model = this->_desktopView.get().getDesktopModel();
+  this->_hintService->cancel();
+  desktop_model.setHintButton(std::nullopt);
+}
+
+// only a snapshot of the game is taken here, the save is serialized and
+// written on the autosave worker
+void fosssweeper::GamePanel::autosave() {
+  auto &game_model = this->_desktopView.get().getGameModel();
+  this->finishModelUpdates();
+  if (game_model.getGameState() == fosssweeper::GameState::Playing) {
+    game_model.updateTime(this->_timer.getGameTime());
+  }
+  this->_autosaveService->request(game_model);
+}
+
+// called after every action that can end the game or start a new one; a game
+// is recorded the first time it ends, undoing the end and finishing it again
+// does not count as another game
+void fosssweeper::GamePanel::recordGameEnd() {
+  const auto &game_model = this->_desktopView.get().getGameModel();
+  const auto game_state = game_model.getGameState();
+  if (game_state == fosssweeper::GameState::None) {
+    this->_gameRecorded = false;
+    return;
+  }
+  if (this->_gameRecorded || (game_state != fosssweeper::GameState::Dead &&
+                              game_state != fosssweeper::GameState::Cool))
+    return;
+  this->_gameRecorded = true;
+  const auto finished_at =
+      std::chrono::duration_cast<std::chrono::seconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count();
+  const auto rank_o = this->_statisticsStore->add(
+      fosssweeper::GameRecord::fromGameModel(game_model, finished_at));
+  // the dialog waits until the mouse is released
+  if (rank_o.has_value()) {
+    this->CallAfter([this]() { this->showBestTimes(); });
+  }
+}
+
+void fosssweeper::GamePanel::showBestTimes() {
+  const auto &game_model = this->_desktopView.get().getGameModel();
+  this->finishModelUpdates();
+  const auto best_times = this->_statisticsStore->getBestTimes(
+      game_model.getGameConfiguration());
+  std::ostringstream ss;
+  if (best_times.empty()) {
+    ss << "No game won yet.";
+  }
+  for (std::size_t record_i = 0; record_i < best_times.size(); record_i++) {
+    const auto &game_record = best_times[record_i];
+    ss << (record_i + 1) << ". " << std::fixed << std::setprecision(3)
+       << static_cast<double>(game_record._gameTime) / MILLISECONDS_PER_SECOND
+       << " s, 3BV " << game_record._bbbv << ", " << game_record._clickCount
+       << " clicks\n";
+  }
+  wxMessageBox(wxString::FromUTF8(ss.str()), _("Best Times"),
+               wxOK | wxICON_INFORMATION, this);
+}
+
 bool fosssweeper::GamePanel::tryChangePixelScale(int new_pixel_scale) {
   auto &desktop_model = this->_desktopView.get().getDesktopModel();
   if (desktop_model.tryChangePixelScale(new_pixel_scale)) {
@@ -26,8 +26,17 @@
 #define FOSSSWEEPER_GAME_PANEL_HPP
 
 #include <array>
+#include <filesystem>
+#include <fosssweeper/autosave_service.hpp>
 #include <fosssweeper/button_position.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/hint_service.hpp>
+#include <fosssweeper/model_worker.hpp>
+#include <fosssweeper/replay_recorder.hpp>
+#include <fosssweeper/statistics_store.hpp>
+#include <fstream>
 #include <functional>
+#include <memory>
 #include <optional>
 
 #include "desktop_timer.hpp"
@@ -47,14 +56,24 @@ public:
   std::array<wxBitmap, static_cast<std::size_t>(fosssweeper::Sprite::Count)>
       _scaledBitmaps;
   fosssweeper::GamePanelState _gamePanelState;
+  std::unique_ptr<fosssweeper::HintService> _hintService;
+  std::unique_ptr<fosssweeper::AutosaveService> _autosaveService;
+  std::ofstream _replayStream;
+  std::unique_ptr<fosssweeper::ReplayRecorder> _replayRecorder;
+  std::unique_ptr<fosssweeper::StatisticsStore> _statisticsStore;
+  std::unique_ptr<fosssweeper::ModelWorker> _modelWorker;
+  bool _gameRecorded = false;
   bool _needsRedraw = true;
   bool _timerOnly = false;
   wxBitmap &getBitmap(fosssweeper::Sprite sprite);
 
   GamePanel(fosssweeper::DesktopView &desktop_view, wxFrame *parent, int width,
-            int height);
+            int height, const std::filesystem::path &autosave_path,
+            const std::filesystem::path &replay_path,
+            const std::filesystem::path &statistics_path);
   virtual ~GamePanel();
 
+  bool restoreGame(const std::filesystem::path &autosave_path);
   void onRender(wxPaintEvent &evt);
   void onMouseMove(wxMouseEvent &evt);
   void onLeftPress(wxMouseEvent &evt);
@@ -63,6 +82,19 @@ public:
   void onRightRelease(wxMouseEvent &evt);
   void onMouseLeave(wxMouseEvent &evt);
   void onTimer(wxTimerEvent &evt);
+  void onHint(wxThreadEvent &evt);
+  void onModelUpdate();
+
+  void finishModelUpdates();
+  void requestHint();
+  void applyCertainMoves();
+  void undo();
+  void redo();
+  void updateTimerAfterJournal(fosssweeper::GameState previous_game_state);
+  void cancelHint();
+  void autosave();
+  void recordGameEnd();
+  void showBestTimes();
 
   bool tryChangePixelScale(int new_pixel_scale);
   int getPixelScale() const noexcept;
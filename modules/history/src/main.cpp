@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_history.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/statistics_store.hpp>
+#include <fosssweeper/tool_options.hpp>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+const char *const USAGE =
+    "usage: fosssweeper_history <command> [options] <path>\n"
+    "  answers queries over a statistics log or a game history file\n"
+    "commands:\n"
+    "  summary                  games, win rate, average and best time per\n"
+    "                           configuration\n"
+    "  trend                    win rate per period\n"
+    "  rate                     distribution of 3BV/s over won games\n"
+    "  convert                  write the games as a game history file, which\n"
+    "                           is mapped instead of read by later queries\n"
+    "options:\n"
+    "  --config <config>        beginner, intermediate, expert or <w>x<h>x<b>\n"
+    "  --mode <mode>            classic, opening or no_guess\n"
+    "  --won, --lost            only won or only lost games\n"
+    "  --from <time>            games finished at or after a Unix time\n"
+    "  --to <time>              games finished before a Unix time\n"
+    "  --period <seconds>       trend period (default 86400)\n"
+    "  --width <3bv/s>          rate bucket width (default 0.25)\n"
+    "  --buckets <count>        rate bucket count (default 40)\n"
+    "  --output <path>          game history file written by convert\n";
+
+// a game history file is mapped, a statistics log is read and turned into
+// columns first
+fosssweeper::GameHistory loadGameHistory(const std::filesystem::path &path) {
+  std::array<char, 8> magic = std::array<char, 8>();
+  {
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+      throw std::runtime_error("failed to open " + path.string());
+    }
+    stream.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+  }
+  if (magic == fosssweeper::GameHistory::MAGIC)
+    return fosssweeper::GameHistory(path);
+  bool needs_rewrite = false;
+  const auto game_records =
+      fosssweeper::StatisticsStore::readLog(path, needs_rewrite);
+  return fosssweeper::GameHistory(game_records);
+}
+
+double getMilliseconds(std::chrono::steady_clock::time_point begin) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - begin)
+      .count();
+}
+
+void printSummary(const fosssweeper::GameHistory &game_history,
+                  const fosssweeper::GameHistoryFilter &filter) {
+  const auto configuration_summaries = game_history.summarize(filter);
+  std::cout << std::left << std::setw(14) << "configuration" << std::right
+            << std::setw(10) << "games" << std::setw(10) << "wins"
+            << std::setw(10) << "win rate" << std::setw(12) << "average s"
+            << std::setw(10) << "best s" << "\n";
+  for (const auto &configuration_summary : configuration_summaries) {
+    std::cout << std::left << std::setw(14)
+              << fosssweeper::getConfigurationName(
+                     configuration_summary._gameConfiguration)
+              << std::right << std::setw(10)
+              << configuration_summary._gameCount << std::setw(10)
+              << configuration_summary._winCount << std::setw(9)
+              << configuration_summary.getWinRate() * 100.0 << "%"
+              << std::setw(12)
+              << configuration_summary.getAverageWinTime() / 1000.0
+              << std::setw(10) << configuration_summary._bestTime / 1000.0
+              << "\n";
+  }
+}
+
+void printTrend(const fosssweeper::GameHistory &game_history,
+                const fosssweeper::GameHistoryFilter &filter,
+                std::int64_t period) {
+  const auto trend_buckets = game_history.getWinRateTrend(filter, period);
+  std::cout << std::setw(14) << "period start" << std::setw(10) << "games"
+            << std::setw(10) << "wins" << std::setw(10) << "win rate" << "\n";
+  for (const auto &trend_bucket : trend_buckets) {
+    if (trend_bucket._gameCount == 0)
+      continue;
+    std::cout << std::setw(14) << trend_bucket._begin << std::setw(10)
+              << trend_bucket._gameCount << std::setw(10)
+              << trend_bucket._winCount << std::setw(9)
+              << trend_bucket.getWinRate() * 100.0 << "%\n";
+  }
+}
+
+void printRates(const fosssweeper::GameHistory &game_history,
+                const fosssweeper::GameHistoryFilter &filter,
+                double bucket_width, std::size_t bucket_count) {
+  const auto rate_histogram =
+      game_history.getBbbvRateHistogram(filter, bucket_width, bucket_count);
+  std::cout << "won games: " << rate_histogram._gameCount << "\n";
+  std::cout << "average 3BV/s: " << rate_histogram.getAverage() << "\n";
+  std::cout << "median 3BV/s: below " << rate_histogram.getPercentile(0.5)
+            << "\n";
+  std::cout << "90th percentile 3BV/s: below "
+            << rate_histogram.getPercentile(0.9) << "\n";
+  const auto max_count = std::max<std::size_t>(
+      *std::max_element(rate_histogram._counts.begin(),
+                        rate_histogram._counts.end()),
+      1);
+  for (std::size_t bucket_i = 0; bucket_i < rate_histogram._counts.size();
+       bucket_i++) {
+    const auto count = rate_histogram._counts[bucket_i];
+    std::cout << std::setw(8) << static_cast<double>(bucket_i) * bucket_width
+              << (bucket_i + 1 == rate_histogram._counts.size() ? "+ " : "  ")
+              << std::setw(10) << count << " "
+              << std::string(count * 50 / max_count, '#') << "\n";
+  }
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+  try {
+    std::string command;
+    std::filesystem::path path;
+    std::filesystem::path output_path;
+    fosssweeper::GameHistoryFilter filter;
+    std::int64_t period = 86400;
+    double bucket_width = 0.25;
+    std::size_t bucket_count = 40;
+    for (int arg_i = 1; arg_i < argc; arg_i++) {
+      const std::string_view option = argv[arg_i];
+      if (option == "--help") {
+        std::cout << USAGE;
+        return 0;
+      }
+      if (option == "--won" || option == "--lost") {
+        filter._wonO = option == "--won";
+        continue;
+      }
+      if (!option.starts_with("--")) {
+        if (command.empty()) {
+          command = option;
+        } else if (path.empty()) {
+          path = option;
+        } else {
+          throw std::runtime_error("unexpected argument " +
+                                   std::string(option));
+        }
+        continue;
+      }
+      if (arg_i + 1 >= argc) {
+        throw std::runtime_error("missing value for " + std::string(option));
+      }
+      const std::string value = argv[++arg_i];
+      if (option == "--config") {
+        filter._gameConfigurationO = fosssweeper::parseGameConfiguration(value);
+      } else if (option == "--mode") {
+        filter._generationModeO = fosssweeper::parseGenerationMode(value);
+      } else if (option == "--from") {
+        filter._finishedFrom =
+            static_cast<std::int64_t>(fosssweeper::parseNumber(option, value));
+      } else if (option == "--to") {
+        filter._finishedTo =
+            static_cast<std::int64_t>(fosssweeper::parseNumber(option, value));
+      } else if (option == "--period") {
+        period =
+            static_cast<std::int64_t>(fosssweeper::parseNumber(option, value));
+      } else if (option == "--width") {
+        bucket_width = fosssweeper::parseDecimal(option, value);
+      } else if (option == "--buckets") {
+        bucket_count = fosssweeper::parseNumber(option, value);
+      } else if (option == "--output") {
+        output_path = value;
+      } else {
+        throw std::runtime_error("unknown option " + std::string(option));
+      }
+    }
+    if (command != "summary" && command != "trend" && command != "rate" &&
+        command != "convert")
+      throw std::runtime_error("unknown command " + command);
+    if (path.empty())
+      throw std::runtime_error("no path given");
+    if (command == "convert" && output_path.empty())
+      throw std::runtime_error("no output path given");
+
+    const auto load_begin = std::chrono::steady_clock::now();
+    const auto game_history = loadGameHistory(path);
+    const auto load_milliseconds = getMilliseconds(load_begin);
+    const auto query_begin = std::chrono::steady_clock::now();
+    if (command == "summary") {
+      printSummary(game_history, filter);
+    } else if (command == "trend") {
+      printTrend(game_history, filter, period);
+    } else if (command == "rate") {
+      printRates(game_history, filter, bucket_width, bucket_count);
+    } else {
+      game_history.write(output_path);
+      std::cout << "history: " << output_path.string() << "\n";
+    }
+    std::cout << "games: " << game_history.getRecordCount() << "\n";
+    std::cout << "load ms: " << load_milliseconds << "\n";
+    std::cout << "query ms: " << getMilliseconds(query_begin) << "\n";
+  } catch (const std::exception &e) {
+    std::cerr << "fosssweeper_history: " << e.what() << "\n" << USAGE;
+    return 1;
+  }
+  return 0;
+}
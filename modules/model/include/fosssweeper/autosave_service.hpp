@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_AUTOSAVE_SERVICE_HPP
+#define FOSSSWEEPER_AUTOSAVE_SERVICE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <fosssweeper/board_snapshot.hpp>
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/save_file.hpp>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace fosssweeper {
+struct GameModel;
+
+// Keeps the current game in a save file without blocking the caller. A
+// requested save only copies the save header and a BoardSnapshot of the game,
+// and a worker thread serializes and writes only the newest pending save. The
+// file is replaced through a temporary file, so a crash while writing leaves
+// the previous save intact.
+struct AutosaveService {
+  struct PendingSave {
+    fosssweeper::SaveFile::Header _header = fosssweeper::SaveFile::Header();
+    fosssweeper::BoardSnapshot _boardSnapshot = fosssweeper::BoardSnapshot();
+  };
+
+  std::filesystem::path _path;
+  std::mutex _mutex = std::mutex();
+  std::condition_variable _condition = std::condition_variable();
+  std::optional<fosssweeper::AutosaveService::PendingSave> _pendingSaveO =
+      std::nullopt;
+  std::vector<fosssweeper::Button> _saveButtons =
+      std::vector<fosssweeper::Button>();
+  bool _writing = false;
+  bool _stopping = false;
+  std::size_t _writtenCount = 0;
+  std::thread _thread;
+
+  void run();
+  void
+  writeSave(const fosssweeper::AutosaveService::PendingSave &pending_save);
+
+  AutosaveService(std::filesystem::path path);
+  AutosaveService(const fosssweeper::AutosaveService &) = delete;
+  fosssweeper::AutosaveService &
+  operator=(const fosssweeper::AutosaveService &) = delete;
+  ~AutosaveService();
+
+  static bool tryLoad(const std::filesystem::path &path,
+                      fosssweeper::GameModel &game_model);
+
+  void request(fosssweeper::GameModel &game_model);
+  void flush();
+  std::size_t getWrittenCount();
+  const std::filesystem::path &getPath() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FOSSSWEEPER_BOARD_CORPUS_HPP
+#define FOSSSWEEPER_BOARD_CORPUS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/mapped_file.hpp>
+#include <span>
+#include <vector>
+
+namespace fosssweeper {
+struct GameModel;
+
+// One board of a corpus. The bomb bitmap holds one bit per button, least
+// significant bit first, and points straight into the corpus file.
+struct BoardRecord {
+  std::uint64_t _gameSeed = 0;
+  int _bbbv = 0;
+  int _openingCount = 0;
+  std::size_t _firstClickI = 0;
+  std::span<const unsigned char> _bombBitmap = std::span<const unsigned char>();
+};
+
+struct BoardCorpusSettings {
+  fosssweeper::GameConfiguration _gameConfiguration =
+      fosssweeper::GameConfiguration();
+  fosssweeper::GenerationMode _generationMode =
+      fosssweeper::GenerationMode::Default;
+  std::size_t _boardCount = 0;
+  std::uint64_t _firstSeed = 0;
+};
+
+// Many pre-generated boards of one configuration in a single file. After a
+// 64 byte header every board takes a record of the same size, so a board is
+// found by its index without reading the others. A record holds the seed, the
+// 3BV, the opening count and the first click of the board, followed by its
+// bomb bitmap padded to 8 bytes. The file is mapped and boards are read in
+// place.
+struct BoardCorpus {
+  static const std::array<char, 8> MAGIC;
+  static const std::uint32_t VERSION;
+  static const std::size_t HEADER_SIZE;
+  static const std::size_t METADATA_SIZE;
+  static const std::size_t GENERATE_CHUNK_SIZE;
+
+  fosssweeper::MappedFile _mappedFile = fosssweeper::MappedFile();
+  fosssweeper::GameConfiguration _gameConfiguration =
+      fosssweeper::GameConfiguration();
+  fosssweeper::GenerationMode _generationMode =
+      fosssweeper::GenerationMode::Default;
+  std::size_t _recordSize = 0;
+  std::size_t _boardCount = 0;
+
+  static std::size_t
+  getRecordSize(fosssweeper::GameConfiguration game_configuration) noexcept;
+  static void encodeHeader(const fosssweeper::BoardCorpusSettings &settings,
+                           std::span<unsigned char> header);
+  static void encodeBoard(const fosssweeper::BoardRecord &board_record,
+                          std::span<unsigned char> record);
+  static fosssweeper::BoardRecord
+  decodeBoard(std::span<const unsigned char> record,
+              fosssweeper::GameConfiguration game_configuration);
+  static fosssweeper::BoardRecord
+  generateRecord(fosssweeper::GameModel &game_model,
+                 const fosssweeper::BoardCorpusSettings &settings,
+                 std::uint64_t game_seed,
+                 std::vector<unsigned char> &bomb_bitmap);
+  static void
+  generateBoard(fosssweeper::GameModel &game_model,
+                const fosssweeper::BoardCorpusSettings &settings,
+                std::uint64_t game_seed, std::span<unsigned char> record);
+  static void generate(const std::filesystem::path &path,
+                       const fosssweeper::BoardCorpusSettings &settings,
+                       std::size_t thread_count);
+
+  BoardCorpus(const std::filesystem::path &path);
+
+  std::size_t getBoardCount() const noexcept;
+  fosssweeper::GameConfiguration getGameConfiguration() const noexcept;
+  fosssweeper::GenerationMode getGenerationMode() const noexcept;
+  fosssweeper::BoardRecord getBoard(std::size_t board_i) const;
+  void loadBoard(std::size_t board_i, fosssweeper::GameModel &game_model) const;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FOSSSWEEPER_BOARD_METRICS_HPP
+#define FOSSSWEEPER_BOARD_METRICS_HPP
+
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <span>
+
+namespace fosssweeper {
+// Difficulty of a bomb layout. The 3BV is the least number of clicks needed to
+// clear the board without flags: one per opening and one per number that does
+// not border an opening.
+struct BoardMetrics {
+  int _bbbv = 0;
+  int _openingCount = 0;
+
+  static fosssweeper::BoardMetrics
+  measure(fosssweeper::GameConfiguration game_configuration,
+          std::span<const fosssweeper::Button> buttons);
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_BOARD_SNAPSHOT_HPP
+#define FOSSSWEEPER_BOARD_SNAPSHOT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/persistent_board.hpp>
+
+namespace fosssweeper {
+// Read-only view of a GameModel at one point in time. Snapshots share the
+// buttons they have in common with the GameModel and each other, and stay
+// valid and unchanged while the GameModel keeps being played.
+struct BoardSnapshot {
+  fosssweeper::GameConfiguration _gameConfiguration =
+      fosssweeper::GameConfiguration();
+  fosssweeper::GameState _gameState = fosssweeper::GameState::Default;
+  int _flagCount = 0;
+  int _buttonsLeft = 0;
+  std::uint64_t _visibleHash = 0;
+  fosssweeper::PersistentBoard _persistentBoard =
+      fosssweeper::PersistentBoard();
+
+  fosssweeper::GameConfiguration getGameConfiguration() const noexcept;
+  fosssweeper::GameState getGameState() const noexcept;
+  int getFlagCount() const noexcept;
+  int getButtonsLeft() const noexcept;
+  std::uint64_t getVisibleHash() const noexcept;
+  std::size_t getButtonCount() const noexcept;
+  const fosssweeper::Button &getButton(std::size_t button_i) const noexcept;
+  const fosssweeper::Button &getButton(int x, int y) const noexcept;
+  const fosssweeper::PersistentBoard &getPersistentBoard() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_BOMB_PLACEMENT_HPP
+#define FOSSSWEEPER_BOMB_PLACEMENT_HPP
+
+#include <cstddef>
+#include <fosssweeper/game_configuration.hpp>
+#include <random>
+#include <vector>
+
+namespace fosssweeper {
+// Picks the bomb buttons for a game so that the initial button has no
+// surrounding bombs. When the board is too dense for that, as many of the
+// surrounding buttons as possible are kept free instead. Runs in O(bombs).
+void placeOpeningBombs(fosssweeper::GameConfiguration game_configuration,
+                       int initial_x, int initial_y, std::mt19937_64 &rng,
+                       std::vector<std::size_t> &bomb_buttons);
+} // namespace fosssweeper
+
+#endif
@@ -25,10 +25,18 @@
 #ifndef FOSSSWEEPER_BUTTON_HPP
 #define FOSSSWEEPER_BUTTON_HPP
 
+#include <cstdint>
 #include <fosssweeper/button_state.hpp>
 
 namespace fosssweeper {
 struct Button {
+  static const std::uint8_t VISIBLE_CODE_NONE;
+  static const std::uint8_t VISIBLE_CODE_FLAGGED;
+  static const std::uint8_t VISIBLE_CODE_QUESTIONED;
+  static const std::uint8_t VISIBLE_CODE_DOWN;
+  static const std::uint8_t VISIBLE_CODE_EXPLODED;
+  static const std::uint8_t VISIBLE_CODE_COUNT;
+
   fosssweeper::ButtonState _buttonState = fosssweeper::ButtonState::Default;
   bool _hasBomb = false;
   int _surroundingBombs = 0;
@@ -40,6 +48,7 @@ struct Button {
   void press() noexcept;
   void altPress(bool questions_enabled) noexcept;
   void removeQuestion() noexcept;
+  void setButtonState(fosssweeper::ButtonState button_state) noexcept;
   void setHasBomb(bool has_bomb) noexcept;
   void setSurroundingBombs(int surrounding_bombs) noexcept;
   void addSurroundingBomb() noexcept;
@@ -47,6 +56,7 @@ struct Button {
   bool getHasBomb() const noexcept;
   int getSurroundingBombs() const noexcept;
   fosssweeper::ButtonState getButtonState() const noexcept;
+  std::uint8_t getVisibleCode() const noexcept;
 };
 } // namespace fosssweeper
 
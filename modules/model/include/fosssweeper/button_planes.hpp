@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_BUTTON_PLANES_HPP
+#define FOSSSWEEPER_BUTTON_PLANES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button.hpp>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace fosssweeper {
+// A board as three bit planes with one bit per button, packed into 64 bit
+// words: bombs and the low and high bit of the ButtonState. Flagged buttons
+// are low and not high, down buttons are both, so counters come from
+// popcounts instead of a walk over the buttons.
+struct ButtonPlanes {
+  std::vector<std::uint64_t> _bombPlane = std::vector<std::uint64_t>();
+  std::vector<std::uint64_t> _lowPlane = std::vector<std::uint64_t>();
+  std::vector<std::uint64_t> _highPlane = std::vector<std::uint64_t>();
+  std::size_t _buttonCount = 0;
+
+  static std::size_t getWordCount(std::size_t button_count) noexcept;
+
+  void reset(std::size_t button_count);
+  void parseButtonString(std::string_view button_string);
+  void unpack(std::vector<fosssweeper::Button> &buttons, int buttons_wide,
+              int buttons_tall) const;
+  bool getHasPadding() const noexcept;
+  std::size_t getButtonCount() const noexcept;
+  int getBombCount() const noexcept;
+  int getFlagCount() const noexcept;
+  int getDownCount() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_CHANGE_SET_HPP
+#define FOSSSWEEPER_CHANGE_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_state.hpp>
+#include <vector>
+
+namespace fosssweeper {
+// The buttons and counters changed by a single GameModel action. Changed
+// buttons are always marked in a dirty bitmask and additionally listed by
+// index until an eighth of the board changed, after which only the bitmask
+// is kept.
+struct ChangeSet {
+  static const std::size_t MIN_LIST_CAPACITY;
+
+  std::vector<std::size_t> _changedButtons = std::vector<std::size_t>();
+  std::vector<std::uint64_t> _dirtyBits = std::vector<std::uint64_t>();
+  std::size_t _buttonCount = 0;
+  std::size_t _listCapacity = 0;
+  std::size_t _changedButtonCount = 0;
+  bool _hasButtonList = true;
+  fosssweeper::GameState _previousGameState = fosssweeper::GameState::Default;
+  int _previousFlagCount = 0;
+  bool _gameStateChanged = false;
+  bool _flagCountChanged = false;
+  bool _timerChanged = false;
+
+  void reset(std::size_t button_count);
+  void clear() noexcept;
+  void begin(fosssweeper::GameState game_state, int flag_count) noexcept;
+  void end(fosssweeper::GameState game_state, int flag_count) noexcept;
+  void addButton(std::size_t button_i);
+  void addAllButtons() noexcept;
+  bool getHasChanges() const noexcept;
+  bool getHasButtonList() const noexcept;
+  bool getIsButtonChanged(std::size_t button_i) const noexcept;
+  std::size_t getChangedButtonCount() const noexcept;
+  const std::vector<std::size_t> &getChangedButtons() const noexcept;
+  const std::vector<std::uint64_t> &getDirtyBits() const noexcept;
+  bool getGameStateChanged() const noexcept;
+  bool getFlagCountChanged() const noexcept;
+  bool getTimerChanged() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
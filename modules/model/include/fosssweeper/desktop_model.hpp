@@ -26,8 +26,15 @@
 #define FOSSSWEEPER_DESKTOP_MODEL_HPP
 
 #include <cstddef>
+#include <deque>
+#include <fosssweeper/board_snapshot.hpp>
+#include <fosssweeper/button.hpp>
 #include <fosssweeper/button_position.hpp>
+#include <fosssweeper/game_configuration.hpp>
 #include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/model_command.hpp>
+#include <fosssweeper/model_update.hpp>
 #include <fosssweeper/point.hpp>
 #include <fosssweeper/sprite.hpp>
 #include <functional>
@@ -35,17 +42,47 @@
 
 namespace fosssweeper {
 class Timer;
+struct ModelWorker;
 
+// With a ModelWorker set, mouse input is sent to the worker as commands
+// instead of being applied to the GameModel. Until the update of the last
+// command arrives the GameModel belongs to the worker thread, so the board is
+// drawn from the snapshot of the newest update; once the worker is idle the
+// GameModel may be used on the UI thread again.
 struct DesktopModel {
   std::reference_wrapper<fosssweeper::GameModel> _gameModel;
+  fosssweeper::ModelWorker *_modelWorker = nullptr;
+  std::deque<fosssweeper::ModelCommand> _waitingCommands =
+      std::deque<fosssweeper::ModelCommand>();
+  std::size_t _pendingCount = 0;
+  fosssweeper::BoardSnapshot _boardSnapshot = fosssweeper::BoardSnapshot();
+  unsigned long _snapshotGameTime = 0;
+  fosssweeper::GameState _updateGameState = fosssweeper::GameState::None;
   std::optional<fosssweeper::ButtonPosition> _hoverButtonO = std::nullopt;
+  std::optional<fosssweeper::ButtonPosition> _hintButtonO = std::nullopt;
   bool _leftDown = false;
   bool _rightDown = false;
   bool _hoverFace = false;
   int _pixelScale = 2;
 
+  void pushCommand(const fosssweeper::ModelCommand &model_command);
+  void pushButtonCommand(fosssweeper::ModelCommandType command_type,
+                         const fosssweeper::ButtonPosition &button_position);
+  void pushTimeCommand(fosssweeper::Timer &timer);
+  void pushWaitingCommands();
+  void applyModelUpdate(fosssweeper::ModelUpdate &model_update,
+                        fosssweeper::Timer &timer);
+  fosssweeper::GameState getViewGameState() const noexcept;
+  fosssweeper::GameConfiguration getViewGameConfiguration() const noexcept;
+  const fosssweeper::Button &getViewButton(int x, int y) const noexcept;
+
   DesktopModel(fosssweeper::GameModel &game_model) noexcept;
 
+  void setModelWorker(fosssweeper::ModelWorker *model_worker) noexcept;
+  bool getIsModelIdle() const noexcept;
+  bool applyModelUpdates(fosssweeper::Timer &timer);
+  void finishModelUpdates(fosssweeper::Timer &timer);
+
   bool tryChangePixelScale(int new_pixel_scale);
   void leftPress();
   void leftRelease(fosssweeper::Timer &timer);
@@ -53,6 +90,10 @@ struct DesktopModel {
   void rightRelease(fosssweeper::Timer &timer);
   void mouseLeave();
   void mouseMove(int x, int y);
+  void setHintButton(std::optional<fosssweeper::ButtonPosition> hint_button_o);
+  std::optional<fosssweeper::ButtonPosition> getHintButtonO() const noexcept;
+  int getBombsLeft() const noexcept;
+  unsigned long getTimerSeconds() const noexcept;
   int getPixelScale() const noexcept;
   int getFaceDimension() const noexcept;
   int getBorderSize() const noexcept;
@@ -66,6 +107,7 @@ struct DesktopModel {
   fosssweeper::Point getScorePoint(std::size_t digit) const noexcept;
   fosssweeper::Point getTimerPoint(std::size_t digit) const noexcept;
   fosssweeper::Point getSize() const noexcept;
+  fosssweeper::Point getButtonCount() const noexcept;
 };
 } // namespace fosssweeper
 
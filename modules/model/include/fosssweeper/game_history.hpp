@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_GAME_HISTORY_HPP
+#define FOSSSWEEPER_GAME_HISTORY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/mapped_file.hpp>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace fosssweeper {
+struct GameRecord;
+
+// Games selected by a query; unset fields select every game. The finish times
+// are seconds since the Unix epoch, the end excluded.
+struct GameHistoryFilter {
+  std::optional<fosssweeper::GameConfiguration> _gameConfigurationO =
+      std::nullopt;
+  std::optional<fosssweeper::GenerationMode> _generationModeO = std::nullopt;
+  std::optional<bool> _wonO = std::nullopt;
+  std::int64_t _finishedFrom = std::numeric_limits<std::int64_t>::min();
+  std::int64_t _finishedTo = std::numeric_limits<std::int64_t>::max();
+};
+
+struct ConfigurationSummary {
+  fosssweeper::GameConfiguration _gameConfiguration =
+      fosssweeper::GameConfiguration();
+  std::size_t _gameCount = 0;
+  std::size_t _winCount = 0;
+  // milliseconds, over won games only
+  std::uint64_t _winTimeSum = 0;
+  std::uint32_t _bestTime = 0;
+
+  double getWinRate() const noexcept;
+  double getAverageWinTime() const noexcept;
+};
+
+struct TrendBucket {
+  std::int64_t _begin = 0;
+  std::size_t _gameCount = 0;
+  std::size_t _winCount = 0;
+
+  double getWinRate() const noexcept;
+};
+
+// 3BV per second of won games; the last bucket also counts every faster game
+struct RateHistogram {
+  double _bucketWidth = 0.0;
+  std::vector<std::size_t> _counts = std::vector<std::size_t>();
+  std::size_t _gameCount = 0;
+  double _rateSum = 0.0;
+
+  double getAverage() const noexcept;
+  double getPercentile(double fraction) const noexcept;
+};
+
+// Finished games stored column by column, so a query only reads the columns
+// it needs and runs as tight loops over plain arrays the compiler vectorizes.
+// Games are filtered a block at a time into a byte mask, which the sums are
+// masked with instead of branching, and which the grouped aggregates turn
+// into a list of the selected games. A history is built in memory from game
+// records, or written to a file and mapped again, where the columns are read
+// in place. After a 64 byte header the file holds the table of configurations
+// followed by the columns, each aligned to COLUMN_ALIGNMENT bytes.
+struct GameHistory {
+  struct Layout {
+    std::size_t _finishedAtsOffset = 0;
+    std::size_t _gameTimesOffset = 0;
+    std::size_t _bbbvsOffset = 0;
+    std::size_t _clickCountsOffset = 0;
+    std::size_t _configurationIsOffset = 0;
+    std::size_t _generationModesOffset = 0;
+    std::size_t _winsOffset = 0;
+    std::size_t _size = 0;
+  };
+
+  static const std::array<char, 8> MAGIC;
+  static const std::uint32_t VERSION;
+  static const std::size_t HEADER_SIZE;
+  static const std::size_t CONFIGURATION_SIZE;
+  static const std::size_t COLUMN_ALIGNMENT;
+  static const std::size_t BLOCK_SIZE;
+  static const std::size_t MAX_CONFIGURATION_COUNT;
+  static const std::size_t MAX_PASS_CONFIGURATION_COUNT;
+  static const std::size_t MAX_TREND_BUCKET_COUNT;
+
+  fosssweeper::MappedFile _mappedFile = fosssweeper::MappedFile();
+  // the file image of a history built in memory, or of a mapped file on a big
+  // endian machine
+  std::vector<std::uint64_t> _ownedWords = std::vector<std::uint64_t>();
+  std::vector<fosssweeper::GameConfiguration> _gameConfigurations =
+      std::vector<fosssweeper::GameConfiguration>();
+  std::size_t _recordCount = 0;
+  std::span<const std::int64_t> _finishedAts = std::span<const std::int64_t>();
+  std::span<const std::uint32_t> _gameTimes = std::span<const std::uint32_t>();
+  std::span<const std::uint32_t> _bbbvs = std::span<const std::uint32_t>();
+  std::span<const std::uint32_t> _clickCounts =
+      std::span<const std::uint32_t>();
+  std::span<const std::uint16_t> _configurationIs =
+      std::span<const std::uint16_t>();
+  std::span<const std::uint8_t> _generationModes =
+      std::span<const std::uint8_t>();
+  std::span<const std::uint8_t> _wins = std::span<const std::uint8_t>();
+
+  static fosssweeper::GameHistory::Layout
+  getLayout(std::size_t record_count, std::size_t configuration_count) noexcept;
+  void attach(std::span<const unsigned char> image);
+  std::span<const unsigned char> getImage() const noexcept;
+  std::optional<std::uint16_t> findConfigurationI(
+      fosssweeper::GameConfiguration game_configuration) const noexcept;
+
+  GameHistory();
+  GameHistory(std::span<const fosssweeper::GameRecord> game_records);
+  GameHistory(const std::filesystem::path &path);
+  GameHistory(const fosssweeper::GameHistory &) = delete;
+  GameHistory(fosssweeper::GameHistory &&other) noexcept = default;
+  fosssweeper::GameHistory &
+  operator=(const fosssweeper::GameHistory &) = delete;
+  fosssweeper::GameHistory &
+  operator=(fosssweeper::GameHistory &&other) noexcept = default;
+
+  void write(const std::filesystem::path &path) const;
+  std::size_t select(const fosssweeper::GameHistoryFilter &filter,
+                     std::size_t begin_i,
+                     std::span<std::uint8_t> selection) const;
+  std::size_t count(const fosssweeper::GameHistoryFilter &filter) const;
+  std::vector<fosssweeper::ConfigurationSummary>
+  summarize(const fosssweeper::GameHistoryFilter &filter) const;
+  std::vector<fosssweeper::TrendBucket>
+  getWinRateTrend(const fosssweeper::GameHistoryFilter &filter,
+                  std::int64_t bucket_seconds) const;
+  fosssweeper::RateHistogram
+  getBbbvRateHistogram(const fosssweeper::GameHistoryFilter &filter,
+                       double bucket_width, std::size_t bucket_count) const;
+  std::size_t getRecordCount() const noexcept;
+  const std::vector<fosssweeper::GameConfiguration> &
+  getGameConfigurations() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
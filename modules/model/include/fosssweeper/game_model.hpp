@@ -25,17 +25,33 @@
 #ifndef FOSSSWEEPER_GAME_MODEL_HPP
 #define FOSSSWEEPER_GAME_MODEL_HPP
 
+#include <fosssweeper/action.hpp>
+#include <fosssweeper/board_snapshot.hpp>
 #include <fosssweeper/button.hpp>
 #include <fosssweeper/button_position.hpp>
+#include <fosssweeper/change_set.hpp>
 #include <fosssweeper/game_configuration.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/journal.hpp>
+#include <fosssweeper/persistent_board.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <fosssweeper/save_file.hpp>
+#include <fosssweeper/zobrist.hpp>
 #include <functional>
+#include <istream>
+#include <ostream>
 #include <random>
+#include <span>
 #include <stack>
 #include <string>
 #include <vector>
 
 namespace fosssweeper {
+struct ReplayRecorder;
+
 struct GameModel {
   std::vector<fosssweeper::Button> _buttons = std::vector<fosssweeper::Button>(
       fosssweeper::GameConfiguration::BEGINNER_BUTTONS_WIDE *
@@ -48,14 +64,36 @@ struct GameModel {
                       fosssweeper::GameConfiguration::BEGINNER_BUTTONS_TALL) -
                      fosssweeper::GameConfiguration::BEGINNER_BOMB_COUNT;
   unsigned long _gameTime = 0;
+  int _clickCount = 0;
   std::random_device _rnd = std::random_device();
   std::mt19937 _rng = std::mt19937(_rnd());
+  fosssweeper::GenerationMode _generationMode =
+      fosssweeper::GenerationMode::Default;
+  std::uint64_t _gameSeed = this->drawGameSeed();
   std::vector<fosssweeper::ButtonPosition> _floodFillStack =
       std::vector<fosssweeper::ButtonPosition>();
+  std::vector<std::size_t> _pressedButtons = std::vector<std::size_t>();
+  std::uint64_t _layoutHash = fosssweeper::getConfigurationZobristKey(
+      fosssweeper::GameConfiguration::BEGINNER_BUTTONS_WIDE,
+      fosssweeper::GameConfiguration::BEGINNER_BUTTONS_TALL);
+  std::uint64_t _visibleHash = 0;
+  bool _changeSetEnabled = false;
+  fosssweeper::ChangeSet _changeSet = fosssweeper::ChangeSet();
+  bool _journalEnabled = false;
+  fosssweeper::Journal _journal = fosssweeper::Journal();
+  bool _persistentBoardEnabled = false;
+  fosssweeper::PersistentBoard _persistentBoard =
+      fosssweeper::PersistentBoard();
+  fosssweeper::ReplayRecorder *_replayRecorder = nullptr;
+  bool _replayGameBegun = false;
+  bool _replaySkipping = false;
+  fosssweeper::GameState _replayGameState = fosssweeper::GameState::Default;
 
   fosssweeper::Button &getButton(int x, int y);
+  std::uint64_t drawGameSeed();
   void pressButton(int x, int y);
   void floodFillClick(int x, int y);
+  void floodFill();
   bool choordingPossible(int x, int y);
   void
   surroundingButtonAction(const fosssweeper::ButtonPosition &center_position,
@@ -63,8 +101,29 @@ struct GameModel {
                                              const fosssweeper::ButtonPosition &)>
                               action);
   void placeBombs(int initial_x, int initial_y);
+  void placeBomb(std::size_t button_i) noexcept;
+  void placeClassicBombs(int initial_x, int initial_y,
+                         std::vector<bool> &bombs);
   void calculateSurroundingBombs();
   void tryWin() noexcept;
+  void applyClick(int x, int y);
+  void applyAltClick(int x, int y);
+  void applyAreaClick(int x, int y);
+  void toggleVisibleHash(std::size_t button_i) noexcept;
+  std::uint8_t beginButtonChange(std::size_t button_i) noexcept;
+  void endButtonChange(std::size_t button_i, std::uint8_t visible_code);
+  void beginChanges();
+  void endChanges();
+  fosssweeper::Journal::Counters getJournalCounters() const noexcept;
+  bool getIsBoardClean() const noexcept;
+  void restoreButton(std::size_t button_i, std::uint8_t button_state);
+  void restoreCounters(const fosssweeper::Journal::Counters &counters) noexcept;
+  void updatePersistentBoard();
+  void updatePersistentButton(std::size_t button_i);
+  void calculateHashes() noexcept;
+  void recordReplayEvent(fosssweeper::ReplayEventType event_type,
+                         std::uint64_t value);
+  void recordReplayChanges();
 
   GameModel() noexcept = default;
   GameModel(fosssweeper::GameConfiguration game_configuration,
@@ -73,10 +132,19 @@ struct GameModel {
 
   void newGame();
   void newGame(fosssweeper::GameConfiguration game_configuration);
+  void newGame(fosssweeper::GameConfiguration game_configuration,
+               std::span<const unsigned char> bomb_bitmap);
   void clickButton(int x, int y);
   void altClickButton(int x, int y);
   void areaClickButton(int x, int y);
+  std::size_t applyActions(std::span<const fosssweeper::Action> actions,
+                           std::span<fosssweeper::ActionResult> results);
+  std::vector<std::size_t> applyCertainMoves();
   void setQuestionsEnabled(bool questions_enabled);
+  void setGenerationMode(fosssweeper::GenerationMode generation_mode);
+  fosssweeper::GenerationMode getGenerationMode() const noexcept;
+  void setGameSeed(std::uint64_t game_seed) noexcept;
+  std::uint64_t getGameSeed() const noexcept;
   bool getQuestionsEnabled() const noexcept;
   int getFlagCount() const noexcept;
   int getBombsLeft() const noexcept;
@@ -86,8 +154,25 @@ struct GameModel {
   fosssweeper::GameConfiguration getGameConfiguration() const noexcept;
   unsigned long getGameTime() const noexcept;
   unsigned long getTimerSeconds() const noexcept;
+  int getClickCount() const noexcept;
   const fosssweeper::Button &getButton(int x, int y) const;
   const std::vector<fosssweeper::Button> &getButtons() const noexcept;
+  std::uint64_t getLayoutHash() const noexcept;
+  std::uint64_t getVisibleHash() const noexcept;
+  void setChangeSetEnabled(bool change_set_enabled);
+  bool getChangeSetEnabled() const noexcept;
+  const fosssweeper::ChangeSet &getChangeSet() const noexcept;
+  void setJournalEnabled(bool journal_enabled);
+  bool getJournalEnabled() const noexcept;
+  const fosssweeper::Journal &getJournal() const noexcept;
+  bool undo();
+  bool redo();
+  fosssweeper::BoardSnapshot snapshot();
+  fosssweeper::SaveFile::Header getSaveHeader() const;
+  void save(std::ostream &stream) const;
+  void load(std::istream &stream);
+  void setReplayRecorder(fosssweeper::ReplayRecorder *replay_recorder) noexcept;
+  fosssweeper::ReplayRecorder *getReplayRecorder() const noexcept;
 };
 } // namespace fosssweeper
 
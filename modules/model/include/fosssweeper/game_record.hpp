@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FOSSSWEEPER_GAME_RECORD_HPP
+#define FOSSSWEEPER_GAME_RECORD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <span>
+
+namespace fosssweeper {
+struct GameModel;
+
+// Result of one finished game. Records are stored as 64 little endian bytes
+// ending in a checksum, so a record torn by a crash is recognized.
+struct GameRecord {
+  static const std::size_t SIZE;
+
+  fosssweeper::GameConfiguration _gameConfiguration =
+      fosssweeper::GameConfiguration();
+  fosssweeper::GenerationMode _generationMode =
+      fosssweeper::GenerationMode::Default;
+  fosssweeper::GameState _gameState = fosssweeper::GameState::Dead;
+  // milliseconds
+  std::uint64_t _gameTime = 0;
+  std::uint64_t _gameSeed = 0;
+  // seconds since the Unix epoch
+  std::int64_t _finishedAt = 0;
+  int _bbbv = 0;
+  int _clickCount = 0;
+
+  static fosssweeper::GameRecord
+  fromGameModel(const fosssweeper::GameModel &game_model,
+                std::int64_t finished_at);
+  static bool tryDecode(std::span<const unsigned char> bytes,
+                        fosssweeper::GameRecord &game_record);
+
+  void encode(std::span<unsigned char> bytes) const;
+  bool getIsWon() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
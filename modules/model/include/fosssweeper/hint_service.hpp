@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_HINT_SERVICE_HPP
+#define FOSSSWEEPER_HINT_SERVICE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fosssweeper/board_snapshot.hpp>
+#include <fosssweeper/button_position.hpp>
+#include <fosssweeper/solver.hpp>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace fosssweeper {
+struct GameModel;
+
+struct Hint {
+  std::uint64_t _generation = 0;
+  std::optional<fosssweeper::ButtonPosition> _safeButtonO = std::nullopt;
+};
+
+// Finds a safe button on a worker thread. The board is snapshotted when a
+// hint is requested and loaded into the solver on the worker, and every new
+// request or cancel() makes older requests stale so their result is never
+// delivered.
+struct HintService {
+  std::function<void(const fosssweeper::Hint &)> _onHint;
+  std::mutex _mutex = std::mutex();
+  std::condition_variable _condition = std::condition_variable();
+  std::optional<fosssweeper::BoardSnapshot> _pendingSnapshotO = std::nullopt;
+  std::uint64_t _pendingGeneration = 0;
+  std::atomic<std::uint64_t> _generation = 0;
+  bool _stopping = false;
+  std::thread _thread;
+
+  void run();
+  std::optional<fosssweeper::ButtonPosition>
+  findSafeButton(fosssweeper::Solver &solver, std::uint64_t generation) const;
+
+  HintService(std::function<void(const fosssweeper::Hint &)> on_hint);
+  HintService(const fosssweeper::HintService &) = delete;
+  fosssweeper::HintService &operator=(const fosssweeper::HintService &) = delete;
+  ~HintService();
+
+  std::uint64_t request(fosssweeper::GameModel &game_model);
+  void cancel() noexcept;
+  bool getIsCurrent(std::uint64_t generation) const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_JOURNAL_HPP
+#define FOSSSWEEPER_JOURNAL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button_state.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <vector>
+
+namespace fosssweeper {
+// Undo and redo history of a GameModel stored as deltas. Every action adds
+// one entry holding the counters before and after it plus the buttons it
+// changed. Buttons pressed from ButtonState::None, which is what flood fills
+// produce, are stored as runs of consecutive indices; every other change is
+// stored as a single button with its previous and new state.
+struct Journal {
+  struct Button {
+    std::uint32_t _buttonI = 0;
+    std::uint8_t _previousState = 0;
+    std::uint8_t _newState = 0;
+  };
+
+  struct Run {
+    std::uint32_t _beginI = 0;
+    std::uint32_t _length = 0;
+  };
+
+  struct Counters {
+    int _flagCount = 0;
+    int _buttonsLeft = 0;
+    fosssweeper::GameState _gameState = fosssweeper::GameState::Default;
+
+    bool operator==(const Counters &other) const noexcept = default;
+  };
+
+  struct Entry {
+    std::uint32_t _buttonBegin = 0;
+    std::uint32_t _buttonEnd = 0;
+    std::uint32_t _runBegin = 0;
+    std::uint32_t _runEnd = 0;
+    fosssweeper::Journal::Counters _previousCounters =
+        fosssweeper::Journal::Counters();
+    fosssweeper::Journal::Counters _newCounters =
+        fosssweeper::Journal::Counters();
+  };
+
+  std::vector<fosssweeper::Journal::Entry> _entries =
+      std::vector<fosssweeper::Journal::Entry>();
+  std::vector<fosssweeper::Journal::Button> _buttons =
+      std::vector<fosssweeper::Journal::Button>();
+  std::vector<fosssweeper::Journal::Run> _runs =
+      std::vector<fosssweeper::Journal::Run>();
+  std::vector<std::uint32_t> _pressedButtons = std::vector<std::uint32_t>();
+  fosssweeper::Journal::Counters _previousCounters =
+      fosssweeper::Journal::Counters();
+  std::size_t _position = 0;
+  std::size_t _actionButtonBegin = 0;
+  bool _recording = false;
+
+  void clear() noexcept;
+  void begin(const fosssweeper::Journal::Counters &counters);
+  void recordButton(std::size_t button_i,
+                    fosssweeper::ButtonState previous_state,
+                    fosssweeper::ButtonState new_state);
+  void end(const fosssweeper::Journal::Counters &counters);
+  const fosssweeper::Journal::Entry *undo() noexcept;
+  const fosssweeper::Journal::Entry *redo() noexcept;
+  bool getCanUndo() const noexcept;
+  bool getCanRedo() const noexcept;
+  std::size_t getEntryCount() const noexcept;
+  std::size_t getPosition() const noexcept;
+  std::size_t getRecordedButtonCount() const noexcept;
+  std::size_t getRecordedRunCount() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_LATENCY_HISTOGRAM_HPP
+#define FOSSSWEEPER_LATENCY_HISTOGRAM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace fosssweeper {
+// Log-linear histogram of latencies in nanoseconds. Every power of two range
+// is split into eight buckets, so a percentile is never more than 12.5% above
+// the recorded value it stands for.
+struct LatencyHistogram {
+  static constexpr std::size_t SUB_BUCKET_BITS = 3;
+  static constexpr std::size_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+  static constexpr std::size_t BUCKET_COUNT = 64 * SUB_BUCKET_COUNT;
+
+  std::array<std::uint64_t, BUCKET_COUNT> _counts =
+      std::array<std::uint64_t, BUCKET_COUNT>();
+  std::uint64_t _count = 0;
+  std::uint64_t _max = 0;
+
+  static std::size_t getBucketI(std::uint64_t nanoseconds) noexcept;
+  static std::uint64_t getBucketMax(std::size_t bucket_i) noexcept;
+
+  void record(std::uint64_t nanoseconds) noexcept;
+  void merge(const fosssweeper::LatencyHistogram &other) noexcept;
+  std::uint64_t getCount() const noexcept;
+  std::uint64_t getMax() const noexcept;
+  std::uint64_t getPercentile(double percentile) const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_MAPPED_FILE_HPP
+#define FOSSSWEEPER_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace fosssweeper {
+// Read only memory mapping of a whole file. Pages are only read from disk
+// when they are first touched, so opening a file costs the same regardless of
+// its size.
+struct MappedFile {
+  const unsigned char *_data = nullptr;
+  std::size_t _size = 0;
+#ifdef _WIN32
+  void *_mappingHandle = nullptr;
+#endif
+
+  void close() noexcept;
+
+  MappedFile() noexcept = default;
+  MappedFile(const std::filesystem::path &path);
+  MappedFile(const fosssweeper::MappedFile &) = delete;
+  MappedFile(fosssweeper::MappedFile &&other) noexcept;
+  fosssweeper::MappedFile &operator=(const fosssweeper::MappedFile &) = delete;
+  fosssweeper::MappedFile &operator=(fosssweeper::MappedFile &&other) noexcept;
+  ~MappedFile();
+
+  std::span<const unsigned char> getData() const noexcept;
+  std::size_t getSize() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_MODEL_COMMAND_HPP
+#define FOSSSWEEPER_MODEL_COMMAND_HPP
+
+#include <cstdint>
+#include <fosssweeper/button_position.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <optional>
+
+namespace fosssweeper {
+enum class ModelCommandType {
+  Click,
+  AltClick,
+  AreaClick,
+  NewGame,
+  UpdateTime,
+  SetGameSeed,
+  SetQuestionsEnabled,
+  ApplyCertainMoves,
+  Undo,
+  Redo
+};
+
+// One GameModel call sent from the UI thread to a ModelWorker. Only the
+// members used by the command type are read.
+struct ModelCommand {
+  fosssweeper::ModelCommandType _commandType =
+      fosssweeper::ModelCommandType::Click;
+  fosssweeper::ButtonPosition _buttonPosition = fosssweeper::ButtonPosition();
+  std::optional<fosssweeper::GameConfiguration> _gameConfigurationO =
+      std::nullopt;
+  std::uint64_t _value = 0;
+};
+} // namespace fosssweeper
+
+#endif
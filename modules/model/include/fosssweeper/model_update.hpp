@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_MODEL_UPDATE_HPP
+#define FOSSSWEEPER_MODEL_UPDATE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/board_snapshot.hpp>
+#include <vector>
+
+namespace fosssweeper {
+// The result of one ModelCommand, sent from a ModelWorker back to the UI
+// thread. Changed buttons are listed by index unless so many changed that
+// the whole board should be redrawn.
+struct ModelUpdate {
+  std::uint64_t _sequence = 0;
+  fosssweeper::BoardSnapshot _boardSnapshot = fosssweeper::BoardSnapshot();
+  unsigned long _gameTime = 0;
+  bool _canUndo = false;
+  bool _canRedo = false;
+  std::vector<std::size_t> _changedButtons = std::vector<std::size_t>();
+  bool _allButtonsChanged = false;
+  bool _gameStateChanged = false;
+  bool _flagCountChanged = false;
+  bool _timerChanged = false;
+};
+} // namespace fosssweeper
+
+#endif
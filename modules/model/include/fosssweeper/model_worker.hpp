@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_MODEL_WORKER_HPP
+#define FOSSSWEEPER_MODEL_WORKER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/model_command.hpp>
+#include <fosssweeper/model_update.hpp>
+#include <fosssweeper/spsc_queue.hpp>
+#include <functional>
+#include <optional>
+#include <thread>
+
+namespace fosssweeper {
+struct GameModel;
+
+// Runs every GameModel call on its own thread. The UI thread pushes commands
+// and pops one update per command in the same order, both through lock-free
+// queues, so it never waits for the model. The GameModel must not be used
+// by anyone else while the worker exists.
+struct ModelWorker {
+  static const std::size_t QUEUE_CAPACITY;
+
+  std::reference_wrapper<fosssweeper::GameModel> _gameModel;
+  std::function<void()> _onUpdate;
+  fosssweeper::SpscQueue<fosssweeper::ModelCommand> _commandQueue;
+  fosssweeper::SpscQueue<fosssweeper::ModelUpdate> _updateQueue;
+  std::atomic<std::uint32_t> _commandSignal = 0;
+  std::atomic<std::uint32_t> _updateSignal = 0;
+  std::atomic<std::uint32_t> _publishSignal = 0;
+  std::atomic<bool> _stopping = false;
+  std::uint64_t _pushedCount = 0;
+  std::uint64_t _appliedCount = 0;
+  std::thread _thread;
+
+  void run();
+  fosssweeper::ModelUpdate apply(const fosssweeper::ModelCommand &command);
+
+  ModelWorker(fosssweeper::GameModel &game_model,
+              std::function<void()> on_update);
+  ModelWorker(const fosssweeper::ModelWorker &) = delete;
+  fosssweeper::ModelWorker &
+  operator=(const fosssweeper::ModelWorker &) = delete;
+  ~ModelWorker();
+
+  std::optional<std::uint64_t> tryPush(fosssweeper::ModelCommand command);
+  bool tryPopUpdate(fosssweeper::ModelUpdate &model_update);
+  void popUpdate(fosssweeper::ModelUpdate &model_update);
+};
+} // namespace fosssweeper
+
+#endif
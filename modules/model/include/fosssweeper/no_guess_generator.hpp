@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_NO_GUESS_GENERATOR_HPP
+#define FOSSSWEEPER_NO_GUESS_GENERATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/solver.hpp>
+#include <random>
+#include <vector>
+
+namespace fosssweeper {
+// Generates bomb layouts the Solver can clear from the initial click. A layout
+// is placed at random and then repaired by relocating bombs near the frontier
+// where the Solver got stuck, instead of being thrown away.
+struct NoGuessGenerator {
+  static const int MAX_CANDIDATES;
+  static const unsigned int MAX_THREADS;
+
+  fosssweeper::GameConfiguration _gameConfiguration;
+  std::size_t _initialI;
+  fosssweeper::Solver _solver;
+  std::vector<std::uint8_t> _bombs = std::vector<std::uint8_t>();
+  std::vector<std::uint8_t> _excluded = std::vector<std::uint8_t>();
+  std::vector<std::int8_t> _surroundingBombs = std::vector<std::int8_t>();
+  std::vector<std::size_t> _revealStack = std::vector<std::size_t>();
+  std::vector<std::size_t> _safeButtons = std::vector<std::size_t>();
+  std::vector<std::size_t> _bombButtons = std::vector<std::size_t>();
+  std::vector<std::size_t> _frontierButtons = std::vector<std::size_t>();
+  std::vector<std::size_t> _otherButtons = std::vector<std::size_t>();
+
+  void placeRandomBombs(std::mt19937_64 &rng);
+  void moveBomb(std::size_t from_i, std::size_t to_i);
+  void revealFrom(std::size_t button_i);
+  bool solve();
+  bool repair(std::mt19937_64 &rng);
+
+  NoGuessGenerator(fosssweeper::GameConfiguration game_configuration,
+                   int initial_x, int initial_y);
+
+  bool tryGenerate(std::uint64_t seed);
+  const std::vector<std::uint8_t> &getBombs() const noexcept;
+};
+
+bool generateNoGuessBombs(fosssweeper::GameConfiguration game_configuration,
+                          int initial_x, int initial_y, std::uint64_t seed,
+                          std::vector<bool> &bombs);
+} // namespace fosssweeper
+
+#endif
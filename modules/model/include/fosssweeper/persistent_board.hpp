@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_PERSISTENT_BOARD_HPP
+#define FOSSSWEEPER_PERSISTENT_BOARD_HPP
+
+#include <array>
+#include <cstddef>
+#include <fosssweeper/button.hpp>
+#include <memory>
+#include <vector>
+
+namespace fosssweeper {
+// Copy-on-write board split into fixed size chunks. Copying a board only
+// shares its root, and the first write after a copy duplicates the root
+// and then only the chunk that is written to. Shared chunks are never
+// written, so copies can be read from other threads without locking.
+struct PersistentBoard {
+  static const std::size_t CHUNK_SIZE = 64;
+
+  using Chunk = std::array<fosssweeper::Button, CHUNK_SIZE>;
+
+  struct Root {
+    std::vector<std::shared_ptr<fosssweeper::PersistentBoard::Chunk>> _chunks =
+        std::vector<std::shared_ptr<fosssweeper::PersistentBoard::Chunk>>();
+  };
+
+  std::shared_ptr<fosssweeper::PersistentBoard::Root> _root = nullptr;
+  std::size_t _buttonCount = 0;
+
+  fosssweeper::PersistentBoard::Root &getUniqueRoot();
+
+  void assign(const std::vector<fosssweeper::Button> &buttons);
+  void setButton(std::size_t button_i, const fosssweeper::Button &button);
+  const fosssweeper::Button &getButton(std::size_t button_i) const noexcept;
+  std::size_t getButtonCount() const noexcept;
+  const fosssweeper::PersistentBoard::Chunk *
+  getChunk(std::size_t chunk_i) const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
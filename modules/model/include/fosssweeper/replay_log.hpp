@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_REPLAY_LOG_HPP
+#define FOSSSWEEPER_REPLAY_LOG_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <span>
+#include <vector>
+
+namespace fosssweeper {
+enum class ReplayEventType {
+  GameBegin,
+  Click,
+  AltClick,
+  AreaClick,
+  CertainMoves,
+  Undo,
+  Redo,
+  QuestionsEnabled,
+  GameEnd,
+  Keyframe,
+  Index,
+  Count
+};
+
+// One input of a replay. _time is in milliseconds since the recording
+// started. _value is the button index of clicks, the new setting of
+// QuestionsEnabled and the final game state of a GameEnd; a GameBegin carries
+// everything needed to generate the same board again and a GameEnd the visible
+// hash and game time the game ended with, so playback can be verified. A
+// Keyframe holds a GameModel save of the board at that point, pointing into
+// the decoded bytes.
+struct ReplayEvent {
+  fosssweeper::ReplayEventType _eventType =
+      fosssweeper::ReplayEventType::GameBegin;
+  std::uint64_t _time = 0;
+  std::uint64_t _value = 0;
+  fosssweeper::GameConfiguration _gameConfiguration =
+      fosssweeper::GameConfiguration();
+  fosssweeper::GenerationMode _generationMode =
+      fosssweeper::GenerationMode::Default;
+  std::uint64_t _gameSeed = 0;
+  bool _questionsEnabled = false;
+  std::uint64_t _visibleHash = 0;
+  std::uint64_t _gameTime = 0;
+  std::span<const std::uint8_t> _keyframe = std::span<const std::uint8_t>();
+};
+
+// A point a recording can be played from: the position of a GameBegin or a
+// Keyframe relative to the start of the recording and the time it has.
+struct ReplayIndexEntry {
+  std::uint64_t _position = 0;
+  std::uint64_t _time = 0;
+  bool _isKeyframe = false;
+};
+
+// The seek points of one recording, written as an Index event when the
+// recording is finished. The event ends with its own size and INDEX_MAGIC so
+// it can be found from the end of the log.
+struct ReplayIndex {
+  static const std::array<char, 8> INDEX_MAGIC;
+  static const std::size_t TRAILER_SIZE;
+
+  std::vector<fosssweeper::ReplayIndexEntry> _entries =
+      std::vector<fosssweeper::ReplayIndexEntry>();
+  std::uint64_t _recordingSize = 0;
+
+  static bool tryRead(std::span<const std::uint8_t> bytes,
+                      fosssweeper::ReplayIndex &replay_index,
+                      std::size_t &recording_begin);
+};
+
+// Replay logs are append only. A log starts with the magic and a version and
+// may hold several recordings one after the other, each starting with its own
+// magic. Every event is an event type followed by the time since the previous
+// event and, for clicks, the zigzag coded difference to the previous button
+// index, all as LEB128 varints, so a typical click takes three or four bytes.
+// GameBegin and Keyframe events restart the button differences so decoding
+// can start at them.
+struct ReplayEncoder {
+  static const std::array<char, 8> MAGIC;
+  static const std::uint64_t VERSION;
+
+  std::vector<std::uint8_t> _bytes = std::vector<std::uint8_t>();
+  std::uint64_t _previousTime = 0;
+  std::uint64_t _previousButtonI = 0;
+
+  void writeVarint(std::uint64_t value);
+  void encodeEventBegin(fosssweeper::ReplayEventType event_type,
+                        std::uint64_t time);
+
+  void writeHeader();
+  void encode(const fosssweeper::ReplayEvent &replay_event);
+  void encodeKeyframeBegin(std::uint64_t time, std::size_t keyframe_size);
+  void encodeIndex(const fosssweeper::ReplayIndex &replay_index);
+  void clear() noexcept;
+  std::span<const std::uint8_t> getBytes() const noexcept;
+};
+
+struct ReplayDecoder {
+  std::span<const std::uint8_t> _bytes = std::span<const std::uint8_t>();
+  std::size_t _position = 0;
+  std::size_t _eventPosition = 0;
+  std::uint64_t _previousTime = 0;
+  std::uint64_t _previousButtonI = 0;
+
+  std::uint64_t readVarint();
+  void readHeader();
+  void skipIndex();
+
+  ReplayDecoder(std::span<const std::uint8_t> bytes);
+
+  bool tryDecode(fosssweeper::ReplayEvent &replay_event);
+  void seek(std::size_t position, std::uint64_t time);
+  std::size_t getPosition() const noexcept;
+  std::size_t getEventPosition() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
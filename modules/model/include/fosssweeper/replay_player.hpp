@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FOSSSWEEPER_REPLAY_PLAYER_HPP
+#define FOSSSWEEPER_REPLAY_PLAYER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/action.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace fosssweeper {
+struct ReplayPlayResult {
+  std::size_t _gameCount = 0;
+  std::size_t _endedGameCount = 0;
+  std::size_t _wonGameCount = 0;
+  std::size_t _inputCount = 0;
+  std::size_t _mismatchCount = 0;
+  std::uint64_t _recordedTime = 0;
+  std::string _firstMismatch = std::string();
+
+  void add(const fosssweeper::ReplayPlayResult &play_result);
+};
+
+// Plays replay logs back through GameModel::applyActions and checks every
+// recorded game end against the replayed game: the final state, the visible
+// hash and a game time that fits into the recorded input times. Runs of clicks
+// are applied as one batch; games that undo or redo are applied one action at
+// a time instead since an applied batch is undone as a whole. Keyframes are
+// not needed for playback and are skipped.
+struct ReplayPlayer {
+  static const std::uint64_t TIME_TOLERANCE;
+
+  fosssweeper::GameModel _gameModel = fosssweeper::GameModel();
+  std::vector<fosssweeper::ReplayEvent> _gameEvents =
+      std::vector<fosssweeper::ReplayEvent>();
+  std::vector<fosssweeper::Action> _actions =
+      std::vector<fosssweeper::Action>();
+  std::vector<fosssweeper::ActionResult> _actionResults =
+      std::vector<fosssweeper::ActionResult>();
+  std::size_t _batchSize = 1;
+
+  void addMismatch(fosssweeper::ReplayPlayResult &play_result,
+                   const std::string &mismatch) const;
+  void playGame(fosssweeper::ReplayPlayResult &play_result);
+
+  void beginGame(const fosssweeper::ReplayEvent &game_begin,
+                 bool journal_enabled);
+  void loadKeyframe(const fosssweeper::ReplayEvent &keyframe,
+                    bool journal_enabled);
+  void applyInput(const fosssweeper::ReplayEvent &replay_event);
+  void applyActions();
+  fosssweeper::ReplayPlayResult play(std::span<const std::uint8_t> bytes);
+  const fosssweeper::GameModel &getGameModel() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_REPLAY_RECORDER_HPP
+#define FOSSSWEEPER_REPLAY_RECORDER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/board_snapshot.hpp>
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <fosssweeper/save_file.hpp>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace fosssweeper {
+struct GameModel;
+
+// Records the inputs of a GameModel into a replay log. Events are encoded into
+// an in-memory buffer on the recording thread, a few byte appends per input,
+// and whenever FLUSH_SIZE bytes have collected the buffer is handed to a
+// worker thread that writes it to the stream. The stream must not be used by
+// anyone else while the recorder exists. A keyframe of the board is recorded
+// after every KEYFRAME_INPUT_COUNT inputs or KEYFRAME_TIME milliseconds of a
+// game, and the recording ends with an index of its keyframes and games.
+// Taking a keyframe only copies a BoardSnapshot of the GameModel; its save is
+// written by the worker thread.
+struct ReplayRecorder {
+  static const std::size_t FLUSH_SIZE;
+  static const std::size_t KEYFRAME_INPUT_COUNT;
+  static const std::uint64_t KEYFRAME_TIME;
+
+  struct PendingKeyframe {
+    std::size_t _offset = 0;
+    fosssweeper::SaveFile::Header _header = fosssweeper::SaveFile::Header();
+    fosssweeper::BoardSnapshot _boardSnapshot = fosssweeper::BoardSnapshot();
+  };
+
+  std::reference_wrapper<std::ostream> _stream;
+  std::chrono::steady_clock::time_point _startTime =
+      std::chrono::steady_clock::now();
+  fosssweeper::ReplayEncoder _encoder = fosssweeper::ReplayEncoder();
+  std::uint64_t _handedOffSize = 0;
+  fosssweeper::ReplayIndex _replayIndex = fosssweeper::ReplayIndex();
+  std::size_t _keyframeInputCount =
+      fosssweeper::ReplayRecorder::KEYFRAME_INPUT_COUNT;
+  std::uint64_t _keyframeTime = fosssweeper::ReplayRecorder::KEYFRAME_TIME;
+  std::size_t _inputsSinceKeyframe = 0;
+  std::uint64_t _keyframeBeginTime = 0;
+  std::mutex _mutex = std::mutex();
+  std::condition_variable _condition = std::condition_variable();
+  std::vector<std::uint8_t> _pendingBytes = std::vector<std::uint8_t>();
+  std::vector<fosssweeper::ReplayRecorder::PendingKeyframe> _pendingKeyframes =
+      std::vector<fosssweeper::ReplayRecorder::PendingKeyframe>();
+  std::vector<fosssweeper::Button> _keyframeButtons =
+      std::vector<fosssweeper::Button>();
+  bool _writing = false;
+  bool _stopping = false;
+  std::thread _thread;
+
+  void run();
+  void write(std::span<const std::uint8_t> bytes);
+  void writeKeyframe(
+      const fosssweeper::ReplayRecorder::PendingKeyframe &pending_keyframe);
+  void handOff(std::optional<fosssweeper::ReplayRecorder::PendingKeyframe>
+                   pending_keyframe_o = std::nullopt);
+  void addIndexEntry(std::uint64_t position, bool is_keyframe);
+  void encode(const fosssweeper::ReplayEvent &replay_event);
+
+  ReplayRecorder(std::ostream &stream);
+  ReplayRecorder(const fosssweeper::ReplayRecorder &) = delete;
+  fosssweeper::ReplayRecorder &
+  operator=(const fosssweeper::ReplayRecorder &) = delete;
+  ~ReplayRecorder();
+
+  void record(fosssweeper::ReplayEvent replay_event);
+  void recordKeyframe(fosssweeper::GameModel &game_model);
+  bool getKeyframeDue() const noexcept;
+  void setKeyframeInterval(std::size_t input_count,
+                           std::uint64_t time) noexcept;
+  void flush();
+  std::uint64_t getTime() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FOSSSWEEPER_REPLAY_SEEKER_HPP
+#define FOSSSWEEPER_REPLAY_SEEKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <fosssweeper/replay_player.hpp>
+#include <span>
+#include <vector>
+
+namespace fosssweeper {
+// Restores the board of the last recording in a replay log at any time since
+// the recording started. A seek starts from the last game start or keyframe
+// before that time, so only the inputs recorded since are applied. Keyframes do
+// not hold the undo journal, so when an undo or redo follows the keyframe the
+// game is played from its start instead. Logs cut off before their index are
+// indexed by decoding them once.
+struct ReplaySeeker {
+  std::span<const std::uint8_t> _bytes = std::span<const std::uint8_t>();
+  std::size_t _recordingBegin = 0;
+  fosssweeper::ReplayIndex _replayIndex = fosssweeper::ReplayIndex();
+  fosssweeper::ReplayPlayer _replayPlayer = fosssweeper::ReplayPlayer();
+  std::vector<fosssweeper::ReplayEvent> _events =
+      std::vector<fosssweeper::ReplayEvent>();
+  std::size_t _appliedCount = 0;
+
+  void buildIndex();
+  bool collectEvents(std::size_t entry_i, std::uint64_t time);
+
+  ReplaySeeker(std::span<const std::uint8_t> bytes);
+
+  bool seek(std::uint64_t time);
+  const fosssweeper::GameModel &getGameModel() const noexcept;
+  const fosssweeper::ReplayIndex &getReplayIndex() const noexcept;
+  std::size_t getAppliedCount() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_SAVE_FILE_HPP
+#define FOSSSWEEPER_SAVE_FILE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <vector>
+
+namespace fosssweeper {
+// Versioned binary save of a GameModel. A fixed size little endian header
+// holding the configuration, state, time, seed and counters is followed by
+// three bit planes with one bit per button: bombs and the low and high bit of
+// the ButtonState. Every plane is padded to whole little endian 64 bit words,
+// so loading is a bulk read followed by unpacking words instead of a parse of
+// every button. The layout hash and the counters of the header are checked
+// against the planes when a save is read.
+struct SaveFile {
+  static const std::array<char, 8> MAGIC;
+  static const std::uint32_t VERSION;
+  static const std::size_t HEADER_SIZE;
+  static const std::size_t PLANE_COUNT;
+  static const std::size_t MAX_BUTTON_COUNT;
+  static const std::size_t CHUNK_WORD_COUNT;
+
+  struct Header {
+    fosssweeper::GameConfiguration _gameConfiguration =
+        fosssweeper::GameConfiguration();
+    fosssweeper::GameState _gameState = fosssweeper::GameState::Default;
+    fosssweeper::GenerationMode _generationMode =
+        fosssweeper::GenerationMode::Default;
+    bool _questionsEnabled = false;
+    std::uint64_t _gameTime = 0;
+    std::uint64_t _gameSeed = 0;
+    int _flagCount = 0;
+    int _buttonsLeft = 0;
+    std::uint64_t _layoutHash = 0;
+    int _clickCount = 0;
+  };
+
+  static std::size_t getWordCount(std::size_t button_count) noexcept;
+  static std::size_t getFileSize(std::size_t button_count) noexcept;
+  static void write(std::ostream &stream,
+                    const fosssweeper::SaveFile::Header &header,
+                    std::span<const fosssweeper::Button> buttons);
+  static fosssweeper::SaveFile::Header
+  read(std::istream &stream, std::vector<fosssweeper::Button> &buttons);
+};
+} // namespace fosssweeper
+
+#endif
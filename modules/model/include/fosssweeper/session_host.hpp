@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_SESSION_HOST_HPP
+#define FOSSSWEEPER_SESSION_HOST_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/action.hpp>
+#include <fosssweeper/board_snapshot.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/latency_histogram.hpp>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fosssweeper {
+struct GameModel;
+
+enum class SessionOperation { Create, Act, Query, Destroy, Count };
+
+struct SessionResponse {
+  std::uint64_t _sessionId = 0;
+  fosssweeper::BoardSnapshot _boardSnapshot = fosssweeper::BoardSnapshot();
+  std::vector<fosssweeper::ActionResult> _actionResults =
+      std::vector<fosssweeper::ActionResult>();
+  std::size_t _processedCount = 0;
+};
+
+// Hosts many independent games in one process. Sessions are spread over
+// shards, each with its own worker thread and request queue, so a session is
+// only ever touched by the thread of its shard. GameModels live in slabs
+// that are never freed while the host exists; destroying a session returns
+// its GameModel to the shard, and the next session reuses it together with
+// its button storage. Session ids carry a generation, so the id of a
+// destroyed session stays invalid after its GameModel is reused.
+struct SessionHost {
+  static const std::size_t SLAB_SIZE;
+
+  struct Request {
+    fosssweeper::SessionOperation _operation =
+        fosssweeper::SessionOperation::Query;
+    std::uint64_t _sessionId = 0;
+    fosssweeper::GameConfiguration _gameConfiguration =
+        fosssweeper::GameConfiguration();
+    fosssweeper::GenerationMode _generationMode =
+        fosssweeper::GenerationMode::Default;
+    std::uint64_t _gameSeed = 0;
+    std::vector<fosssweeper::Action> _actions =
+        std::vector<fosssweeper::Action>();
+    std::promise<fosssweeper::SessionResponse> _promise =
+        std::promise<fosssweeper::SessionResponse>();
+    std::chrono::steady_clock::time_point _enqueueTime =
+        std::chrono::steady_clock::time_point();
+  };
+
+  struct Shard {
+    std::mutex _mutex = std::mutex();
+    std::condition_variable _condition = std::condition_variable();
+    std::vector<fosssweeper::SessionHost::Request> _pendingRequests =
+        std::vector<fosssweeper::SessionHost::Request>();
+    bool _stopping = false;
+    std::vector<std::unique_ptr<fosssweeper::GameModel[]>> _slabs =
+        std::vector<std::unique_ptr<fosssweeper::GameModel[]>>();
+    std::vector<std::uint32_t> _generations = std::vector<std::uint32_t>();
+    std::vector<std::uint8_t> _liveSlots = std::vector<std::uint8_t>();
+    std::vector<std::uint32_t> _freeSlots = std::vector<std::uint32_t>();
+    std::atomic<std::size_t> _sessionCount = 0;
+    mutable std::mutex _statsMutex = std::mutex();
+    std::array<fosssweeper::LatencyHistogram,
+               static_cast<std::size_t>(fosssweeper::SessionOperation::Count)>
+        _latencyHistograms = std::array<
+            fosssweeper::LatencyHistogram,
+            static_cast<std::size_t>(fosssweeper::SessionOperation::Count)>();
+    std::thread _thread;
+  };
+
+  std::vector<std::unique_ptr<fosssweeper::SessionHost::Shard>> _shards;
+  std::atomic<std::size_t> _nextShardI = 0;
+
+  void run(std::size_t shard_i);
+  void handle(std::size_t shard_i, fosssweeper::SessionHost::Request &request);
+  fosssweeper::GameModel *findGameModel(std::size_t shard_i,
+                                        std::uint64_t session_id);
+  std::uint32_t allocateSlot(std::size_t shard_i);
+  fosssweeper::GameModel &getSlotGameModel(std::size_t shard_i,
+                                           std::uint32_t slot_i);
+  std::future<fosssweeper::SessionResponse>
+  submit(std::size_t shard_i, fosssweeper::SessionHost::Request request);
+  std::uint64_t makeSessionId(std::size_t shard_i, std::uint32_t slot_i,
+                              std::uint32_t generation) const noexcept;
+  std::size_t getShardI(std::uint64_t session_id) const noexcept;
+  std::uint32_t getSlotI(std::uint64_t session_id) const noexcept;
+
+  SessionHost(std::size_t shard_count);
+  SessionHost(const fosssweeper::SessionHost &) = delete;
+  fosssweeper::SessionHost &operator=(const fosssweeper::SessionHost &) = delete;
+  ~SessionHost();
+
+  std::future<fosssweeper::SessionResponse>
+  create(fosssweeper::GameConfiguration game_configuration,
+         fosssweeper::GenerationMode generation_mode, std::uint64_t game_seed);
+  std::future<fosssweeper::SessionResponse>
+  act(std::uint64_t session_id, std::vector<fosssweeper::Action> actions);
+  std::future<fosssweeper::SessionResponse> query(std::uint64_t session_id);
+  std::future<fosssweeper::SessionResponse> destroy(std::uint64_t session_id);
+  std::size_t getShardCount() const noexcept;
+  std::size_t getSessionCount() const noexcept;
+  fosssweeper::LatencyHistogram
+  getLatencyHistogram(fosssweeper::SessionOperation operation) const;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_SOLVER_HPP
+#define FOSSSWEEPER_SOLVER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <vector>
+
+namespace fosssweeper {
+struct BoardSnapshot;
+struct Button;
+struct GameModel;
+
+// Deterministic solver working on the player visible state of a board. Only
+// revealed numbers and bombs the solver deduced itself are trusted, so player
+// flags never lead to a wrong result.
+struct Solver {
+  static const std::int8_t UNKNOWN_BUTTON;
+
+  struct Constraint {
+    std::size_t _buttonI = 0;
+    int _bombsLeft = 0;
+    std::size_t _unknownCount = 0;
+    std::array<std::size_t, 8> _unknownButtons = std::array<std::size_t, 8>();
+  };
+
+  fosssweeper::GameConfiguration _gameConfiguration =
+      fosssweeper::GameConfiguration();
+  std::vector<std::int8_t> _surroundingBombs = std::vector<std::int8_t>();
+  std::vector<std::uint8_t> _knownBombs = std::vector<std::uint8_t>();
+  std::vector<std::uint8_t> _foundButtons = std::vector<std::uint8_t>();
+  std::vector<int> _constraintIndices = std::vector<int>();
+  std::vector<fosssweeper::Solver::Constraint> _constraints =
+      std::vector<fosssweeper::Solver::Constraint>();
+  int _revealedCount = 0;
+  int _knownBombCount = 0;
+
+  bool tryAddSafeButton(std::size_t button_i,
+                        std::vector<std::size_t> &safe_buttons);
+  bool tryAddBombButton(std::size_t button_i,
+                        std::vector<std::size_t> &bomb_buttons);
+  fosssweeper::Solver::Constraint
+  getConstraint(std::size_t button_i) const noexcept;
+  void findSingleConstraintButtons(std::vector<std::size_t> &safe_buttons,
+                                   std::vector<std::size_t> &bomb_buttons);
+  void findPairConstraintButtons(std::vector<std::size_t> &safe_buttons,
+                                 std::vector<std::size_t> &bomb_buttons);
+  void findBombCountButtons(std::vector<std::size_t> &safe_buttons,
+                            std::vector<std::size_t> &bomb_buttons);
+  void loadButton(std::size_t button_i, const fosssweeper::Button &button);
+
+  Solver() noexcept = default;
+  Solver(fosssweeper::GameConfiguration game_configuration);
+
+  void reset(fosssweeper::GameConfiguration game_configuration);
+  void load(const fosssweeper::GameModel &game_model);
+  void load(const fosssweeper::BoardSnapshot &board_snapshot);
+  void reveal(std::size_t button_i, int surrounding_bombs);
+  void markBomb(std::size_t button_i);
+  bool findCertainButtons(std::vector<std::size_t> &safe_buttons,
+                          std::vector<std::size_t> &bomb_buttons);
+  bool getIsRevealed(std::size_t button_i) const noexcept;
+  bool getIsKnownBomb(std::size_t button_i) const noexcept;
+  int getRevealedCount() const noexcept;
+  int getKnownBombCount() const noexcept;
+  fosssweeper::GameConfiguration getGameConfiguration() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
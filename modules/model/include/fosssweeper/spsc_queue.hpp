@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_SPSC_QUEUE_HPP
+#define FOSSSWEEPER_SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace fosssweeper {
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. The capacity is rounded up to a power of two, and each side keeps
+// its own index on a separate cache line together with a cached copy of the
+// other side's index, so the shared indices are only reloaded when the queue
+// looks full or empty.
+template <typename T> struct SpscQueue {
+  static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+  std::vector<T> _slots = std::vector<T>();
+  std::size_t _mask = 0;
+  alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> _head = 0;
+  std::size_t _cachedTail = 0;
+  alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> _tail = 0;
+  std::size_t _cachedHead = 0;
+
+  SpscQueue(std::size_t capacity);
+  SpscQueue(const fosssweeper::SpscQueue<T> &) = delete;
+  fosssweeper::SpscQueue<T> &
+  operator=(const fosssweeper::SpscQueue<T> &) = delete;
+
+  bool tryPush(T &&value);
+  bool tryPop(T &value);
+  bool getIsEmpty() const noexcept;
+  std::size_t getCapacity() const noexcept;
+};
+
+template <typename T>
+fosssweeper::SpscQueue<T>::SpscQueue(std::size_t capacity) {
+  if (capacity == 0) {
+    throw std::runtime_error("queue capacity must not be zero");
+  }
+  this->_slots.resize(std::bit_ceil(capacity));
+  this->_mask = this->_slots.size() - 1;
+}
+
+// called by the producer only; value is left untouched when the queue is full
+template <typename T> bool fosssweeper::SpscQueue<T>::tryPush(T &&value) {
+  const auto tail = this->_tail.load(std::memory_order_relaxed);
+  if (tail - this->_cachedHead == this->_slots.size()) {
+    this->_cachedHead = this->_head.load(std::memory_order_acquire);
+    if (tail - this->_cachedHead == this->_slots.size())
+      return false;
+  }
+  this->_slots[tail & this->_mask] = std::move(value);
+  this->_tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+// called by the consumer only
+template <typename T> bool fosssweeper::SpscQueue<T>::tryPop(T &value) {
+  const auto head = this->_head.load(std::memory_order_relaxed);
+  if (head == this->_cachedTail) {
+    this->_cachedTail = this->_tail.load(std::memory_order_acquire);
+    if (head == this->_cachedTail)
+      return false;
+  }
+  value = std::move(this->_slots[head & this->_mask]);
+  this->_head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+bool fosssweeper::SpscQueue<T>::getIsEmpty() const noexcept {
+  return this->_head.load(std::memory_order_acquire) ==
+         this->_tail.load(std::memory_order_acquire);
+}
+
+template <typename T>
+std::size_t fosssweeper::SpscQueue<T>::getCapacity() const noexcept {
+  return this->_slots.size();
+}
+} // namespace fosssweeper
+
+#endif
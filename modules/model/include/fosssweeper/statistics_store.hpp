@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FOSSSWEEPER_STATISTICS_STORE_HPP
+#define FOSSSWEEPER_STATISTICS_STORE_HPP
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_record.hpp>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace fosssweeper {
+struct GameConfigurationHash {
+  std::size_t
+  operator()(const fosssweeper::GameConfiguration &game_configuration)
+      const noexcept;
+};
+
+// Keeps the record of every finished game in an append only log after a 16
+// byte header. The log is read, and the records are appended, on a worker
+// thread; the caller only updates the best times kept in memory, so looking
+// them up at the end of a game takes constant time. A log with a torn or
+// damaged record is rewritten without it when it is loaded, and a log grown
+// past its record limit is compacted to its newest records and best times.
+struct StatisticsStore {
+  static const std::array<char, 8> MAGIC;
+  static const std::uint32_t VERSION;
+  static const std::size_t HEADER_SIZE;
+  static const std::size_t BEST_TIME_COUNT;
+  static const std::size_t MAX_RECORD_COUNT;
+
+  using BestTimeMap =
+      std::unordered_map<fosssweeper::GameConfiguration,
+                         std::vector<fosssweeper::GameRecord>,
+                         fosssweeper::GameConfigurationHash>;
+
+  std::filesystem::path _path;
+  std::size_t _maxRecordCount;
+  std::mutex _mutex = std::mutex();
+  std::condition_variable _condition = std::condition_variable();
+  std::vector<fosssweeper::GameRecord> _pendingRecords =
+      std::vector<fosssweeper::GameRecord>();
+  BestTimeMap _bestTimes = BestTimeMap();
+  std::size_t _recordCount = 0;
+  bool _loaded = false;
+  bool _failed = false;
+  bool _writing = false;
+  bool _stopping = false;
+  std::thread _thread;
+
+  static std::optional<std::size_t>
+  insertBestTime(BestTimeMap &best_times,
+                 const fosssweeper::GameRecord &game_record);
+  void run();
+  void load();
+  void append(const std::vector<fosssweeper::GameRecord> &game_records);
+
+  StatisticsStore(std::filesystem::path path,
+                  std::size_t max_record_count =
+                      fosssweeper::StatisticsStore::MAX_RECORD_COUNT);
+  StatisticsStore(const fosssweeper::StatisticsStore &) = delete;
+  fosssweeper::StatisticsStore &
+  operator=(const fosssweeper::StatisticsStore &) = delete;
+  ~StatisticsStore();
+
+  static std::vector<fosssweeper::GameRecord>
+  readLog(const std::filesystem::path &path, bool &needs_rewrite);
+  static void writeLog(const std::filesystem::path &path,
+                       std::span<const fosssweeper::GameRecord> game_records);
+  static std::vector<fosssweeper::GameRecord>
+  compact(std::span<const fosssweeper::GameRecord> game_records,
+          std::size_t kept_count);
+
+  std::optional<std::size_t> add(const fosssweeper::GameRecord &game_record);
+  std::vector<fosssweeper::GameRecord>
+  getBestTimes(fosssweeper::GameConfiguration game_configuration);
+  void flush();
+  std::size_t getRecordCount();
+  const std::filesystem::path &getPath() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
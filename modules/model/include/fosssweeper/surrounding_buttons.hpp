@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_SURROUNDING_BUTTONS_HPP
+#define FOSSSWEEPER_SURROUNDING_BUTTONS_HPP
+
+#include <array>
+#include <cstddef>
+
+namespace fosssweeper {
+struct SurroundingButtons {
+  std::array<std::size_t, 8> _indices = std::array<std::size_t, 8>();
+  std::size_t _count = 0;
+
+  constexpr SurroundingButtons(std::size_t button_i, int buttons_wide,
+                               int buttons_tall) noexcept {
+    const auto wide = static_cast<std::size_t>(buttons_wide);
+    const auto tall = static_cast<std::size_t>(buttons_tall);
+    const std::size_t x = button_i % wide;
+    const std::size_t y = button_i / wide;
+    const bool has_left = x > 0;
+    const bool has_right = x + 1 < wide;
+    if (y > 0) {
+      if (has_left)
+        this->_indices[this->_count++] = button_i - wide - 1;
+      this->_indices[this->_count++] = button_i - wide;
+      if (has_right)
+        this->_indices[this->_count++] = button_i - wide + 1;
+    }
+    if (has_left)
+      this->_indices[this->_count++] = button_i - 1;
+    if (has_right)
+      this->_indices[this->_count++] = button_i + 1;
+    if (y + 1 < tall) {
+      if (has_left)
+        this->_indices[this->_count++] = button_i + wide - 1;
+      this->_indices[this->_count++] = button_i + wide;
+      if (has_right)
+        this->_indices[this->_count++] = button_i + wide + 1;
+    }
+  }
+
+  constexpr const std::size_t *begin() const noexcept {
+    return this->_indices.data();
+  }
+
+  constexpr const std::size_t *end() const noexcept {
+    return this->_indices.data() + this->_count;
+  }
+
+  constexpr std::size_t size() const noexcept { return this->_count; }
+};
+} // namespace fosssweeper
+
+#endif
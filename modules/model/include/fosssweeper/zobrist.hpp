@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_ZOBRIST_HPP
+#define FOSSSWEEPER_ZOBRIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace fosssweeper {
+// Zobrist keys are derived from the button index instead of being stored in a
+// table, so hashes of boards with the same dimensions are comparable between
+// GameModel objects and processes.
+constexpr std::uint64_t mixZobristKey(std::uint64_t value) noexcept {
+  value += 0x9e3779b97f4a7c15ULL;
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+  return value ^ (value >> 31);
+}
+
+constexpr std::uint64_t getConfigurationZobristKey(int buttons_wide,
+                                                   int buttons_tall) noexcept {
+  return fosssweeper::mixZobristKey(
+      (static_cast<std::uint64_t>(static_cast<std::uint32_t>(buttons_wide))
+       << 32) |
+      static_cast<std::uint32_t>(buttons_tall));
+}
+
+constexpr std::uint64_t getLayoutZobristKey(std::size_t button_i) noexcept {
+  return fosssweeper::mixZobristKey((static_cast<std::uint64_t>(button_i)
+                                     << 4) |
+                                    0xf);
+}
+
+constexpr std::uint64_t
+getVisibleZobristKey(std::size_t button_i, std::uint8_t visible_code) noexcept {
+  if (visible_code == 0)
+    return 0;
+  return fosssweeper::mixZobristKey(
+      (static_cast<std::uint64_t>(button_i) << 4) | visible_code);
+}
+} // namespace fosssweeper
+
+#endif
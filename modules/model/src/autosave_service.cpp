@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstddef>
+#include <filesystem>
+#include <fosssweeper/autosave_service.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/mapped_file.hpp>
+#include <fosssweeper/save_file.hpp>
+#include <fstream>
+#include <istream>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <streambuf>
+#include <system_error>
+#include <utility>
+
+namespace {
+// reads straight from the mapped pages instead of copying the file first
+struct MappedFileBuffer : std::streambuf {
+  MappedFileBuffer(const fosssweeper::MappedFile &mapped_file) {
+    auto *const begin = const_cast<char *>(
+        reinterpret_cast<const char *>(mapped_file.getData().data()));
+    this->setg(begin, begin, begin + mapped_file.getSize());
+  }
+};
+} // namespace
+
+void fosssweeper::AutosaveService::run() {
+  while (true) {
+    fosssweeper::AutosaveService::PendingSave pending_save;
+    {
+      std::unique_lock<std::mutex> lock(this->_mutex);
+      this->_condition.wait(lock, [&]() {
+        return this->_stopping || this->_pendingSaveO.has_value();
+      });
+      // a save requested right before stopping is still written, it is
+      // usually the one made when the window closes
+      if (!this->_pendingSaveO.has_value())
+        return;
+      pending_save = std::move(this->_pendingSaveO.value());
+      this->_pendingSaveO = std::nullopt;
+      this->_writing = true;
+    }
+    try {
+      this->writeSave(pending_save);
+    } catch (const std::exception &) {
+      // a failed autosave only loses the resume point, the game goes on
+    }
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_writing = false;
+      this->_writtenCount++;
+    }
+    this->_condition.notify_all();
+  }
+}
+
+void fosssweeper::AutosaveService::writeSave(
+    const fosssweeper::AutosaveService::PendingSave &pending_save) {
+  const auto &board_snapshot = pending_save._boardSnapshot;
+  this->_saveButtons.clear();
+  this->_saveButtons.reserve(board_snapshot.getButtonCount());
+  for (std::size_t button_i = 0; button_i < board_snapshot.getButtonCount();
+       button_i++) {
+    this->_saveButtons.push_back(board_snapshot.getButton(button_i));
+  }
+  auto temporary_path = this->_path;
+  temporary_path += ".tmp";
+  {
+    std::ofstream stream(temporary_path, std::ios::binary | std::ios::trunc);
+    fosssweeper::SaveFile::write(stream, pending_save._header,
+                                 this->_saveButtons);
+    stream.flush();
+    if (!stream) {
+      throw std::runtime_error("failed to write " + temporary_path.string());
+    }
+  }
+  std::filesystem::rename(temporary_path, this->_path);
+}
+
+fosssweeper::AutosaveService::AutosaveService(std::filesystem::path path)
+    : _path(std::move(path)), _thread([this]() { this->run(); }) {}
+
+fosssweeper::AutosaveService::~AutosaveService() {
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    this->_stopping = true;
+  }
+  this->_condition.notify_all();
+  this->_thread.join();
+}
+
+// maps the save and loads it into the game model; a missing or invalid save
+// leaves the game model as it was
+bool fosssweeper::AutosaveService::tryLoad(const std::filesystem::path &path,
+                                           fosssweeper::GameModel &game_model) {
+  std::error_code error_code;
+  if (!std::filesystem::is_regular_file(path, error_code))
+    return false;
+  try {
+    const fosssweeper::MappedFile mapped_file(path);
+    MappedFileBuffer buffer(mapped_file);
+    std::istream stream(&buffer);
+    game_model.load(stream);
+  } catch (const std::exception &) {
+    return false;
+  }
+  return true;
+}
+
+// the snapshot shares its buttons with the game, so a request does not
+// depend on the size of the board
+void fosssweeper::AutosaveService::request(fosssweeper::GameModel &game_model) {
+  fosssweeper::AutosaveService::PendingSave pending_save;
+  pending_save._header = game_model.getSaveHeader();
+  pending_save._boardSnapshot = game_model.snapshot();
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    this->_pendingSaveO = std::move(pending_save);
+  }
+  this->_condition.notify_all();
+}
+
+void fosssweeper::AutosaveService::flush() {
+  std::unique_lock<std::mutex> lock(this->_mutex);
+  this->_condition.wait(lock, [&]() {
+    return !this->_pendingSaveO.has_value() && !this->_writing;
+  });
+}
+
+std::size_t fosssweeper::AutosaveService::getWrittenCount() {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  return this->_writtenCount;
+}
+
+const std::filesystem::path &
+fosssweeper::AutosaveService::getPath() const noexcept {
+  return this->_path;
+}
@@ -0,0 +1,379 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fosssweeper/board_corpus.hpp>
+#include <fosssweeper/board_metrics.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/save_file.hpp>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+const std::array<char, 8> fosssweeper::BoardCorpus::MAGIC = {
+    'F', 'S', 'W', 'C', 'O', 'R', 'P', 'S'};
+const std::uint32_t fosssweeper::BoardCorpus::VERSION = 1;
+const std::size_t fosssweeper::BoardCorpus::HEADER_SIZE = 64;
+const std::size_t fosssweeper::BoardCorpus::METADATA_SIZE = 24;
+const std::size_t fosssweeper::BoardCorpus::GENERATE_CHUNK_SIZE = 1024;
+
+namespace {
+void writeInteger(std::span<unsigned char> bytes, std::size_t offset,
+                  std::uint64_t value, std::size_t size) noexcept {
+  for (std::size_t byte_i = 0; byte_i < size; byte_i++) {
+    bytes[offset + byte_i] =
+        static_cast<unsigned char>((value >> (byte_i * 8)) & 0xff);
+  }
+}
+
+std::uint64_t readInteger(std::span<const unsigned char> bytes,
+                          std::size_t offset, std::size_t size) noexcept {
+  std::uint64_t value = 0;
+  for (std::size_t byte_i = 0; byte_i < size; byte_i++) {
+    value |= static_cast<std::uint64_t>(bytes[offset + byte_i]) << (byte_i * 8);
+  }
+  return value;
+}
+
+std::size_t getBitmapSize(
+    fosssweeper::GameConfiguration game_configuration) noexcept {
+  return (static_cast<std::size_t>(game_configuration.getButtonCount()) + 7) /
+         8;
+}
+} // namespace
+
+std::size_t fosssweeper::BoardCorpus::getRecordSize(
+    fosssweeper::GameConfiguration game_configuration) noexcept {
+  // records stay 8 byte aligned so the seeds can be read in place
+  return fosssweeper::BoardCorpus::METADATA_SIZE +
+         (getBitmapSize(game_configuration) + 7) / 8 * 8;
+}
+
+void fosssweeper::BoardCorpus::encodeHeader(
+    const fosssweeper::BoardCorpusSettings &settings,
+    std::span<unsigned char> header) {
+  if (header.size() != fosssweeper::BoardCorpus::HEADER_SIZE) {
+    throw std::runtime_error("invalid board corpus header size");
+  }
+  std::fill(header.begin(), header.end(), 0);
+  std::copy(fosssweeper::BoardCorpus::MAGIC.begin(),
+            fosssweeper::BoardCorpus::MAGIC.end(), header.begin());
+  writeInteger(header, 8, fosssweeper::BoardCorpus::VERSION, 4);
+  writeInteger(header, 12, fosssweeper::BoardCorpus::HEADER_SIZE, 4);
+  const auto &game_configuration = settings._gameConfiguration;
+  writeInteger(header, 16,
+               static_cast<std::uint64_t>(game_configuration.getButtonsWide()),
+               4);
+  writeInteger(header, 20,
+               static_cast<std::uint64_t>(game_configuration.getButtonsTall()),
+               4);
+  writeInteger(header, 24,
+               static_cast<std::uint64_t>(game_configuration.getBombCount()),
+               4);
+  writeInteger(header, 28,
+               static_cast<std::uint64_t>(settings._generationMode), 1);
+  writeInteger(header, 32,
+               fosssweeper::BoardCorpus::getRecordSize(game_configuration), 4);
+  writeInteger(header, 40, settings._boardCount, 8);
+  writeInteger(header, 48, settings._firstSeed, 8);
+}
+
+void fosssweeper::BoardCorpus::encodeBoard(
+    const fosssweeper::BoardRecord &board_record,
+    std::span<unsigned char> record) {
+  if (record.size() <
+      fosssweeper::BoardCorpus::METADATA_SIZE + board_record._bombBitmap.size()) {
+    throw std::runtime_error("board corpus record too small");
+  }
+  std::fill(record.begin(), record.end(), 0);
+  writeInteger(record, 0, board_record._gameSeed, 8);
+  writeInteger(record, 8, static_cast<std::uint64_t>(board_record._bbbv), 4);
+  writeInteger(record, 12,
+               static_cast<std::uint64_t>(board_record._openingCount), 4);
+  writeInteger(record, 16, board_record._firstClickI, 4);
+  std::copy(board_record._bombBitmap.begin(), board_record._bombBitmap.end(),
+            record.begin() + fosssweeper::BoardCorpus::METADATA_SIZE);
+}
+
+fosssweeper::BoardRecord fosssweeper::BoardCorpus::decodeBoard(
+    std::span<const unsigned char> record,
+    fosssweeper::GameConfiguration game_configuration) {
+  const auto bitmap_size = getBitmapSize(game_configuration);
+  if (record.size() < fosssweeper::BoardCorpus::METADATA_SIZE + bitmap_size) {
+    throw std::runtime_error("truncated board corpus record");
+  }
+  fosssweeper::BoardRecord board_record;
+  board_record._gameSeed = readInteger(record, 0, 8);
+  board_record._bbbv = static_cast<int>(readInteger(record, 8, 4));
+  board_record._openingCount = static_cast<int>(readInteger(record, 12, 4));
+  board_record._firstClickI =
+      static_cast<std::size_t>(readInteger(record, 16, 4));
+  if (board_record._firstClickI >=
+      static_cast<std::size_t>(game_configuration.getButtonCount())) {
+    throw std::runtime_error("invalid board corpus record");
+  }
+  board_record._bombBitmap =
+      record.subspan(fosssweeper::BoardCorpus::METADATA_SIZE, bitmap_size);
+  return board_record;
+}
+
+// the board is generated the way a game would be for a first click in the
+// middle, so opening and no guess boards keep that click safe. The bombs are
+// packed into bomb_bitmap, which the returned record points at.
+fosssweeper::BoardRecord fosssweeper::BoardCorpus::generateRecord(
+    fosssweeper::GameModel &game_model,
+    const fosssweeper::BoardCorpusSettings &settings, std::uint64_t game_seed,
+    std::vector<unsigned char> &bomb_bitmap) {
+  const auto &game_configuration = settings._gameConfiguration;
+  const auto buttons_wide = game_configuration.getButtonsWide();
+  const auto first_click_x = buttons_wide / 2;
+  const auto first_click_y = game_configuration.getButtonsTall() / 2;
+  game_model.newGame(game_configuration);
+  game_model.setGenerationMode(settings._generationMode);
+  game_model.setGameSeed(game_seed);
+  game_model.placeBombs(first_click_x, first_click_y);
+
+  const auto &buttons = game_model.getButtons();
+  bomb_bitmap.assign(getBitmapSize(game_configuration), 0);
+  for (std::size_t button_i = 0; button_i < buttons.size(); button_i++) {
+    if (buttons[button_i].getHasBomb()) {
+      bomb_bitmap[button_i / 8] |=
+          static_cast<unsigned char>(1 << (button_i % 8));
+    }
+  }
+  const auto board_metrics =
+      fosssweeper::BoardMetrics::measure(game_configuration, buttons);
+  fosssweeper::BoardRecord board_record;
+  board_record._gameSeed = game_seed;
+  board_record._bbbv = board_metrics._bbbv;
+  board_record._openingCount = board_metrics._openingCount;
+  board_record._firstClickI = static_cast<std::size_t>(
+      first_click_y * buttons_wide + first_click_x);
+  board_record._bombBitmap = bomb_bitmap;
+  return board_record;
+}
+
+void fosssweeper::BoardCorpus::generateBoard(
+    fosssweeper::GameModel &game_model,
+    const fosssweeper::BoardCorpusSettings &settings, std::uint64_t game_seed,
+    std::span<unsigned char> record) {
+  std::vector<unsigned char> bomb_bitmap;
+  fosssweeper::BoardCorpus::encodeBoard(
+      fosssweeper::BoardCorpus::generateRecord(game_model, settings, game_seed,
+                                               bomb_bitmap),
+      record);
+}
+
+// the boards are generated in chunks by every thread and written at their
+// place in the file, so the corpus does not depend on the thread count
+void fosssweeper::BoardCorpus::generate(
+    const std::filesystem::path &path,
+    const fosssweeper::BoardCorpusSettings &settings,
+    std::size_t thread_count) {
+  const auto record_size =
+      fosssweeper::BoardCorpus::getRecordSize(settings._gameConfiguration);
+  {
+    std::array<unsigned char, 64> header = std::array<unsigned char, 64>();
+    fosssweeper::BoardCorpus::encodeHeader(settings, header);
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<const char *>(header.data()),
+                 static_cast<std::streamsize>(header.size()));
+    if (!stream) {
+      throw std::runtime_error("failed to write " + path.string());
+    }
+  }
+  std::filesystem::resize_file(path, fosssweeper::BoardCorpus::HEADER_SIZE +
+                                         settings._boardCount * record_size);
+  std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out);
+  if (!stream) {
+    throw std::runtime_error("failed to open " + path.string());
+  }
+
+  const auto chunk_count =
+      (settings._boardCount + fosssweeper::BoardCorpus::GENERATE_CHUNK_SIZE -
+       1) /
+      fosssweeper::BoardCorpus::GENERATE_CHUNK_SIZE;
+  std::atomic<std::size_t> next_chunk_i = 0;
+  std::mutex mutex;
+  std::exception_ptr exception_ptr;
+  const auto generate_chunks = [&]() {
+    try {
+      fosssweeper::GameModel game_model;
+      std::vector<unsigned char> records(
+          fosssweeper::BoardCorpus::GENERATE_CHUNK_SIZE * record_size);
+      while (true) {
+        const auto chunk_i = next_chunk_i++;
+        if (chunk_i >= chunk_count)
+          return;
+        const auto begin_board_i =
+            chunk_i * fosssweeper::BoardCorpus::GENERATE_CHUNK_SIZE;
+        const auto end_board_i = std::min(
+            settings._boardCount,
+            begin_board_i + fosssweeper::BoardCorpus::GENERATE_CHUNK_SIZE);
+        for (auto board_i = begin_board_i; board_i < end_board_i; board_i++) {
+          fosssweeper::BoardCorpus::generateBoard(
+              game_model, settings, settings._firstSeed + board_i,
+              std::span<unsigned char>(records).subspan(
+                  (board_i - begin_board_i) * record_size, record_size));
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        stream.seekp(static_cast<std::streamoff>(
+            fosssweeper::BoardCorpus::HEADER_SIZE +
+            begin_board_i * record_size));
+        stream.write(reinterpret_cast<const char *>(records.data()),
+                     static_cast<std::streamsize>(
+                         (end_board_i - begin_board_i) * record_size));
+        if (!stream) {
+          throw std::runtime_error("failed to write " + path.string());
+        }
+      }
+    } catch (...) {
+      // the other threads stop after their current chunk
+      next_chunk_i = chunk_count;
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!exception_ptr) {
+        exception_ptr = std::current_exception();
+      }
+    }
+  };
+  thread_count = std::clamp<std::size_t>(thread_count, 1,
+                                         std::max<std::size_t>(chunk_count, 1));
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count - 1);
+  for (std::size_t thread_i = 1; thread_i < thread_count; thread_i++) {
+    threads.emplace_back(generate_chunks);
+  }
+  generate_chunks();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (exception_ptr) {
+    std::rethrow_exception(exception_ptr);
+  }
+  stream.flush();
+  if (!stream) {
+    throw std::runtime_error("failed to write " + path.string());
+  }
+}
+
+fosssweeper::BoardCorpus::BoardCorpus(const std::filesystem::path &path)
+    : _mappedFile(path) {
+  const auto bytes = this->_mappedFile.getData();
+  if (bytes.size() < fosssweeper::BoardCorpus::HEADER_SIZE) {
+    throw std::runtime_error("truncated board corpus");
+  }
+  if (!std::equal(fosssweeper::BoardCorpus::MAGIC.begin(),
+                  fosssweeper::BoardCorpus::MAGIC.end(), bytes.begin())) {
+    throw std::runtime_error("not a board corpus");
+  }
+  if (readInteger(bytes, 8, 4) != fosssweeper::BoardCorpus::VERSION) {
+    throw std::runtime_error("unsupported board corpus version");
+  }
+  if (readInteger(bytes, 12, 4) != fosssweeper::BoardCorpus::HEADER_SIZE) {
+    throw std::runtime_error("invalid board corpus header");
+  }
+
+  const auto buttons_wide = readInteger(bytes, 16, 4);
+  const auto buttons_tall = readInteger(bytes, 20, 4);
+  const auto bomb_count = readInteger(bytes, 24, 4);
+  if (buttons_wide * buttons_tall > fosssweeper::SaveFile::MAX_BUTTON_COUNT) {
+    throw std::runtime_error("board corpus board too large");
+  }
+  this->_gameConfiguration = fosssweeper::GameConfiguration(
+      static_cast<int>(buttons_wide), static_cast<int>(buttons_tall),
+      static_cast<int>(bomb_count));
+  if (static_cast<std::uint64_t>(this->_gameConfiguration.getButtonsWide()) !=
+          buttons_wide ||
+      static_cast<std::uint64_t>(this->_gameConfiguration.getButtonsTall()) !=
+          buttons_tall ||
+      static_cast<std::uint64_t>(this->_gameConfiguration.getBombCount()) !=
+          bomb_count) {
+    throw std::runtime_error("invalid board corpus configuration");
+  }
+  const auto generation_mode = readInteger(bytes, 28, 1);
+  if (generation_mode >
+      static_cast<std::uint64_t>(fosssweeper::GenerationMode::NoGuess)) {
+    throw std::runtime_error("invalid board corpus header");
+  }
+  this->_generationMode =
+      static_cast<fosssweeper::GenerationMode>(generation_mode);
+  this->_recordSize =
+      fosssweeper::BoardCorpus::getRecordSize(this->_gameConfiguration);
+  if (readInteger(bytes, 32, 4) != this->_recordSize) {
+    throw std::runtime_error("invalid board corpus header");
+  }
+  const auto board_count = readInteger(bytes, 40, 8);
+  if (board_count >
+          (bytes.size() - fosssweeper::BoardCorpus::HEADER_SIZE) /
+              this->_recordSize ||
+      fosssweeper::BoardCorpus::HEADER_SIZE + board_count * this->_recordSize !=
+          bytes.size()) {
+    throw std::runtime_error("invalid board corpus size");
+  }
+  this->_boardCount = static_cast<std::size_t>(board_count);
+}
+
+std::size_t fosssweeper::BoardCorpus::getBoardCount() const noexcept {
+  return this->_boardCount;
+}
+
+fosssweeper::GameConfiguration
+fosssweeper::BoardCorpus::getGameConfiguration() const noexcept {
+  return this->_gameConfiguration;
+}
+
+fosssweeper::GenerationMode
+fosssweeper::BoardCorpus::getGenerationMode() const noexcept {
+  return this->_generationMode;
+}
+
+fosssweeper::BoardRecord
+fosssweeper::BoardCorpus::getBoard(std::size_t board_i) const {
+  if (board_i >= this->_boardCount) {
+    throw std::runtime_error("board corpus index out of range");
+  }
+  return fosssweeper::BoardCorpus::decodeBoard(
+      this->_mappedFile.getData().subspan(fosssweeper::BoardCorpus::HEADER_SIZE +
+                                              board_i * this->_recordSize,
+                                          this->_recordSize),
+      this->_gameConfiguration);
+}
+
+// the game starts with the bombs in place and the first click of the board
+// still to be made
+void fosssweeper::BoardCorpus::loadBoard(
+    std::size_t board_i, fosssweeper::GameModel &game_model) const {
+  const auto board_record = this->getBoard(board_i);
+  game_model.newGame(this->_gameConfiguration, board_record._bombBitmap);
+  game_model.setGenerationMode(this->_generationMode);
+  game_model.setGameSeed(board_record._gameSeed);
+}
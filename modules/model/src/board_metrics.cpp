@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/board_metrics.hpp>
+#include <fosssweeper/surrounding_buttons.hpp>
+#include <span>
+#include <vector>
+
+fosssweeper::BoardMetrics fosssweeper::BoardMetrics::measure(
+    fosssweeper::GameConfiguration game_configuration,
+    std::span<const fosssweeper::Button> buttons) {
+  const auto buttons_wide = game_configuration.getButtonsWide();
+  const auto buttons_tall = game_configuration.getButtonsTall();
+  fosssweeper::BoardMetrics board_metrics;
+  // buttons revealed by clicking an opening need no click of their own
+  std::vector<std::uint8_t> covered(buttons.size(), 0);
+  std::vector<std::size_t> stack;
+  for (std::size_t button_i = 0; button_i < buttons.size(); button_i++) {
+    if (covered[button_i] != 0 || buttons[button_i].getHasBomb() ||
+        buttons[button_i].getSurroundingBombs() != 0)
+      continue;
+    board_metrics._openingCount++;
+    covered[button_i] = 1;
+    stack.push_back(button_i);
+    while (!stack.empty()) {
+      const auto cur_button_i = stack.back();
+      stack.pop_back();
+      for (const auto surrounding_button_i : fosssweeper::SurroundingButtons(
+               cur_button_i, buttons_wide, buttons_tall)) {
+        if (covered[surrounding_button_i] != 0)
+          continue;
+        covered[surrounding_button_i] = 1;
+        if (buttons[surrounding_button_i].getSurroundingBombs() == 0) {
+          stack.push_back(surrounding_button_i);
+        }
+      }
+    }
+  }
+  board_metrics._bbbv = board_metrics._openingCount;
+  for (std::size_t button_i = 0; button_i < buttons.size(); button_i++) {
+    if (covered[button_i] == 0 && !buttons[button_i].getHasBomb()) {
+      board_metrics._bbbv++;
+    }
+  }
+  return board_metrics;
+}
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/board_snapshot.hpp>
+#include <fosssweeper/button_position.hpp>
+
+fosssweeper::GameConfiguration
+fosssweeper::BoardSnapshot::getGameConfiguration() const noexcept {
+  return this->_gameConfiguration;
+}
+
+fosssweeper::GameState
+fosssweeper::BoardSnapshot::getGameState() const noexcept {
+  return this->_gameState;
+}
+
+int fosssweeper::BoardSnapshot::getFlagCount() const noexcept {
+  return this->_flagCount;
+}
+
+int fosssweeper::BoardSnapshot::getButtonsLeft() const noexcept {
+  return this->_buttonsLeft;
+}
+
+std::uint64_t fosssweeper::BoardSnapshot::getVisibleHash() const noexcept {
+  return this->_visibleHash;
+}
+
+std::size_t fosssweeper::BoardSnapshot::getButtonCount() const noexcept {
+  return this->_persistentBoard.getButtonCount();
+}
+
+const fosssweeper::Button &
+fosssweeper::BoardSnapshot::getButton(std::size_t button_i) const noexcept {
+  return this->_persistentBoard.getButton(button_i);
+}
+
+const fosssweeper::Button &
+fosssweeper::BoardSnapshot::getButton(int x, int y) const noexcept {
+  return this->_persistentBoard.getButton(fosssweeper::ButtonPosition(x, y).getIndex(
+      this->_gameConfiguration.getButtonsWide()));
+}
+
+const fosssweeper::PersistentBoard &
+fosssweeper::BoardSnapshot::getPersistentBoard() const noexcept {
+  return this->_persistentBoard;
+}
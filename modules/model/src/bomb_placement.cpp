@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <fosssweeper/bomb_placement.hpp>
+#include <fosssweeper/button_position.hpp>
+#include <fosssweeper/surrounding_buttons.hpp>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+void fosssweeper::placeOpeningBombs(
+    fosssweeper::GameConfiguration game_configuration, int initial_x,
+    int initial_y, std::mt19937_64 &rng,
+    std::vector<std::size_t> &bomb_buttons) {
+  const auto button_count =
+      static_cast<std::size_t>(game_configuration.getButtonCount());
+  const auto bomb_count =
+      static_cast<std::size_t>(game_configuration.getBombCount());
+  const std::size_t initial_i = fosssweeper::ButtonPosition(initial_x, initial_y)
+                                    .getIndex(game_configuration.getButtonsWide());
+  bomb_buttons.clear();
+  if (bomb_count >= button_count) {
+    for (std::size_t button_i = 0; button_i < button_count; button_i++) {
+      bomb_buttons.push_back(button_i);
+    }
+    return;
+  }
+  // keep the initial button free plus as many surrounding buttons as the
+  // bomb count allows, choosing which ones at random when not all fit.
+  const fosssweeper::SurroundingButtons surrounding_buttons(
+      initial_i, game_configuration.getButtonsWide(),
+      game_configuration.getButtonsTall());
+  std::array<std::size_t, 9> excluded_buttons;
+  std::copy(surrounding_buttons.begin(), surrounding_buttons.end(),
+            excluded_buttons.begin());
+  const std::size_t excluded_surrounding_count =
+      std::min(surrounding_buttons.size(), button_count - 1 - bomb_count);
+  if (excluded_surrounding_count < surrounding_buttons.size()) {
+    std::shuffle(excluded_buttons.begin(),
+                 excluded_buttons.begin() + surrounding_buttons.size(), rng);
+  }
+  excluded_buttons[excluded_surrounding_count] = initial_i;
+  const std::size_t excluded_count = excluded_surrounding_count + 1;
+  std::sort(excluded_buttons.begin(),
+            excluded_buttons.begin() + excluded_count);
+  // Floyd's algorithm picks bomb_count distinct indices among the buttons that
+  // are not excluded, which are then mapped back onto the board by skipping
+  // over the excluded buttons.
+  const std::size_t candidate_count = button_count - excluded_count;
+  std::unordered_set<std::size_t> chosen;
+  chosen.reserve(bomb_count);
+  for (std::size_t candidate_i = candidate_count - bomb_count;
+       candidate_i < candidate_count; candidate_i++) {
+    std::uniform_int_distribution<std::size_t> distributor(0, candidate_i);
+    const std::size_t chosen_i = distributor(rng);
+    if (!chosen.insert(chosen_i).second) {
+      chosen.insert(candidate_i);
+    }
+  }
+  bomb_buttons.reserve(bomb_count);
+  for (auto button_i : chosen) {
+    for (std::size_t excluded_i = 0; excluded_i < excluded_count;
+         excluded_i++) {
+      if (excluded_buttons[excluded_i] <= button_i) {
+        button_i++;
+      }
+    }
+    bomb_buttons.push_back(button_i);
+  }
+}
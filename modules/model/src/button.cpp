@@ -23,6 +23,14 @@
 #include <fosssweeper/button.hpp>
 #include <fosssweeper/button_state.hpp>
 
+// visible codes 3 through 11 are down buttons with 0 through 8 surrounding bombs
+const std::uint8_t fosssweeper::Button::VISIBLE_CODE_NONE = 0;
+const std::uint8_t fosssweeper::Button::VISIBLE_CODE_FLAGGED = 1;
+const std::uint8_t fosssweeper::Button::VISIBLE_CODE_QUESTIONED = 2;
+const std::uint8_t fosssweeper::Button::VISIBLE_CODE_DOWN = 3;
+const std::uint8_t fosssweeper::Button::VISIBLE_CODE_EXPLODED = 12;
+const std::uint8_t fosssweeper::Button::VISIBLE_CODE_COUNT = 13;
+
 fosssweeper::Button::Button(char c) noexcept
 {
   switch (c)
@@ -101,6 +109,12 @@ void fosssweeper::Button::removeQuestion() noexcept
   }
 }
 
+void fosssweeper::Button::setButtonState(
+    fosssweeper::ButtonState button_state) noexcept
+{
+  this->_buttonState = button_state;
+}
+
 void fosssweeper::Button::setHasBomb(bool has_bomb) noexcept { this->_hasBomb = has_bomb; }
 
 void fosssweeper::Button::setSurroundingBombs(int surrounding_bombs) noexcept
@@ -120,4 +134,24 @@ bool fosssweeper::Button::getHasBomb() const noexcept { return this->_hasBomb; }
 
 int fosssweeper::Button::getSurroundingBombs() const noexcept { return this->_surroundingBombs; }
 
-fosssweeper::ButtonState fosssweeper::Button::getButtonState() const noexcept { return this->_buttonState; }
\ No newline at end of file
+fosssweeper::ButtonState fosssweeper::Button::getButtonState() const noexcept { return this->_buttonState; }
+
+std::uint8_t fosssweeper::Button::getVisibleCode() const noexcept
+{
+  switch (this->_buttonState)
+  {
+  case fosssweeper::ButtonState::Flagged:
+    return fosssweeper::Button::VISIBLE_CODE_FLAGGED;
+  case fosssweeper::ButtonState::Questioned:
+    return fosssweeper::Button::VISIBLE_CODE_QUESTIONED;
+  case fosssweeper::ButtonState::Down:
+    if (this->_hasBomb)
+    {
+      return fosssweeper::Button::VISIBLE_CODE_EXPLODED;
+    }
+    return static_cast<std::uint8_t>(fosssweeper::Button::VISIBLE_CODE_DOWN +
+                                     this->_surroundingBombs);
+  default:
+    return fosssweeper::Button::VISIBLE_CODE_NONE;
+  }
+}
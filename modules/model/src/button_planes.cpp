@@ -0,0 +1,297 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button_planes.hpp>
+#include <fosssweeper/button_state.hpp>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define FOSSSWEEPER_BUTTON_PLANES_SSE2
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define FOSSSWEEPER_BUTTON_PLANES_NEON
+#endif
+
+namespace {
+struct BlockMasks {
+  std::uint64_t _bomb = 0;
+  std::uint64_t _low = 0;
+  std::uint64_t _high = 0;
+  std::uint64_t _valid = 0;
+};
+
+#if defined(FOSSSWEEPER_BUTTON_PLANES_SSE2)
+// a plain array, std::array drops the alignment attributes of __m128i
+struct Block {
+  __m128i _vectors[4];
+};
+
+Block loadBlock(const char *chars) noexcept {
+  Block block;
+  for (std::size_t vector_i = 0; vector_i < std::size(block._vectors);
+       vector_i++) {
+    block._vectors[vector_i] = _mm_loadu_si128(
+        reinterpret_cast<const __m128i *>(chars + vector_i * 16));
+  }
+  return block;
+}
+
+// one bit for each of the 64 chars that equals c
+std::uint64_t matchBlock(const Block &block, char c) noexcept {
+  const __m128i needle = _mm_set1_epi8(c);
+  std::uint64_t mask = 0;
+  for (std::size_t vector_i = 0; vector_i < std::size(block._vectors);
+       vector_i++) {
+    const auto vector_mask = static_cast<std::uint16_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(block._vectors[vector_i], needle)));
+    mask |= static_cast<std::uint64_t>(vector_mask) << (vector_i * 16);
+  }
+  return mask;
+}
+#elif defined(FOSSSWEEPER_BUTTON_PLANES_NEON)
+struct Block {
+  uint8x16_t _vectors[4];
+};
+
+Block loadBlock(const char *chars) noexcept {
+  Block block;
+  for (std::size_t vector_i = 0; vector_i < std::size(block._vectors);
+       vector_i++) {
+    block._vectors[vector_i] =
+        vld1q_u8(reinterpret_cast<const std::uint8_t *>(chars + vector_i * 16));
+  }
+  return block;
+}
+
+// one bit for each of the 64 chars that equals c; neon has no movemask, so
+// the matches are weighted by their bit and summed per half
+std::uint64_t matchBlock(const Block &block, char c) noexcept {
+  static constexpr std::array<std::uint8_t, 16> BIT_WEIGHTS = {
+      1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+  const uint8x16_t weights = vld1q_u8(BIT_WEIGHTS.data());
+  const uint8x16_t needle = vdupq_n_u8(static_cast<std::uint8_t>(c));
+  std::uint64_t mask = 0;
+  for (std::size_t vector_i = 0; vector_i < std::size(block._vectors);
+       vector_i++) {
+    const uint8x16_t bits =
+        vandq_u8(vceqq_u8(block._vectors[vector_i], needle), weights);
+    const std::uint64_t vector_mask =
+        static_cast<std::uint64_t>(vaddv_u8(vget_low_u8(bits))) |
+        (static_cast<std::uint64_t>(vaddv_u8(vget_high_u8(bits))) << 8);
+    mask |= vector_mask << (vector_i * 16);
+  }
+  return mask;
+}
+#else
+using Block = const char *;
+
+Block loadBlock(const char *chars) noexcept { return chars; }
+
+std::uint64_t matchBlock(Block block, char c) noexcept {
+  std::uint64_t mask = 0;
+  for (std::size_t char_i = 0; char_i < 64; char_i++) {
+    mask |= static_cast<std::uint64_t>(block[char_i] == c) << char_i;
+  }
+  return mask;
+}
+#endif
+
+BlockMasks classifyBlock(const char *chars) noexcept {
+  const auto block = loadBlock(chars);
+  const auto empty = matchBlock(block, '.');
+  const auto down = matchBlock(block, 'd');
+  const auto bomb = matchBlock(block, 'b');
+  const auto exploded = matchBlock(block, 'x');
+  const auto flag = matchBlock(block, 'f');
+  const auto flagged_bomb = matchBlock(block, 'c');
+  const auto question = matchBlock(block, 'q');
+  const auto questioned_bomb = matchBlock(block, 'r');
+  BlockMasks block_masks;
+  block_masks._bomb = bomb | exploded | flagged_bomb | questioned_bomb;
+  block_masks._low = down | exploded | flag | flagged_bomb;
+  block_masks._high = down | exploded | question | questioned_bomb;
+  block_masks._valid = empty | block_masks._bomb | block_masks._low |
+                       block_masks._high;
+  return block_masks;
+}
+
+int countBits(const std::vector<std::uint64_t> &plane) noexcept {
+  int count = 0;
+  for (const auto word : plane) {
+    count += std::popcount(word);
+  }
+  return count;
+}
+} // namespace
+
+std::size_t
+fosssweeper::ButtonPlanes::getWordCount(std::size_t button_count) noexcept {
+  return (button_count + 63) / 64;
+}
+
+void fosssweeper::ButtonPlanes::reset(std::size_t button_count) {
+  const auto word_count = fosssweeper::ButtonPlanes::getWordCount(button_count);
+  this->_bombPlane.assign(word_count, 0);
+  this->_lowPlane.assign(word_count, 0);
+  this->_highPlane.assign(word_count, 0);
+  this->_buttonCount = button_count;
+}
+
+// classifies 64 chars per step; the last partial block is copied into a
+// buffer padded with empty buttons so it takes the same path
+void fosssweeper::ButtonPlanes::parseButtonString(
+    std::string_view button_string) {
+  this->reset(button_string.size());
+  std::array<char, 64> tail_block = std::array<char, 64>();
+  for (std::size_t word_i = 0; word_i < this->_bombPlane.size(); word_i++) {
+    const std::size_t char_begin = word_i * 64;
+    const char *block = button_string.data() + char_begin;
+    std::uint64_t used_mask = ~std::uint64_t(0);
+    if (button_string.size() - char_begin < 64) {
+      const auto char_count = button_string.size() - char_begin;
+      tail_block.fill('.');
+      std::copy_n(block, char_count, tail_block.begin());
+      block = tail_block.data();
+      used_mask = (std::uint64_t(1) << char_count) - 1;
+    }
+    const auto block_masks = classifyBlock(block);
+    const auto invalid_mask = ~block_masks._valid & used_mask;
+    if (invalid_mask != 0) {
+      const std::size_t char_i =
+          char_begin + static_cast<std::size_t>(std::countr_zero(invalid_mask));
+      throw std::runtime_error("invalid button string character '" +
+                               std::string(1, button_string[char_i]) +
+                               "' at " + std::to_string(char_i));
+    }
+    this->_bombPlane[word_i] = block_masks._bomb;
+    this->_lowPlane[word_i] = block_masks._low;
+    this->_highPlane[word_i] = block_masks._high;
+  }
+}
+
+// every button counts the bombs in the 3x3 square around it minus its own,
+// so the square is summed from rolling horizontal sums of three rows
+void fosssweeper::ButtonPlanes::unpack(std::vector<fosssweeper::Button> &buttons,
+                                       int buttons_wide,
+                                       int buttons_tall) const {
+  if (static_cast<std::size_t>(buttons_wide) *
+          static_cast<std::size_t>(buttons_tall) !=
+      this->_buttonCount) {
+    throw std::runtime_error("invalid button plane dimensions");
+  }
+  buttons.resize(this->_buttonCount);
+  for (std::size_t word_i = 0; word_i < this->_bombPlane.size(); word_i++) {
+    const std::size_t button_begin = word_i * 64;
+    const std::size_t button_end =
+        std::min(button_begin + 64, this->_buttonCount);
+    const auto bomb_word = this->_bombPlane[word_i];
+    const auto low_word = this->_lowPlane[word_i];
+    const auto high_word = this->_highPlane[word_i];
+    for (std::size_t button_i = button_begin; button_i < button_end;
+         button_i++) {
+      const auto bit_i = button_i - button_begin;
+      auto &button = buttons[button_i];
+      button._buttonState = static_cast<fosssweeper::ButtonState>(
+          ((low_word >> bit_i) & 1) | (((high_word >> bit_i) & 1) << 1));
+      button._hasBomb = ((bomb_word >> bit_i) & 1) != 0;
+    }
+  }
+
+  const auto width = static_cast<std::size_t>(buttons_wide);
+  std::vector<std::uint8_t> row_sums((width + 2) * 3, 0);
+  const auto sumRow = [&](int y, std::size_t row_i) {
+    auto *row_sum = row_sums.data() + row_i * (width + 2);
+    std::fill(row_sum, row_sum + width + 2, 0);
+    if (y < 0 || y >= buttons_tall)
+      return;
+    const auto *row = buttons.data() + static_cast<std::size_t>(y) * width;
+    for (std::size_t x = 0; x < width; x++) {
+      const std::uint8_t has_bomb = row[x].getHasBomb() ? 1 : 0;
+      row_sum[x] += has_bomb;
+      row_sum[x + 1] += has_bomb;
+      row_sum[x + 2] += has_bomb;
+    }
+  };
+  sumRow(-1, 0);
+  sumRow(0, 1);
+  for (int y = 0; y < buttons_tall; y++) {
+    sumRow(y + 1, static_cast<std::size_t>(y + 2) % 3);
+    const auto *above = row_sums.data() +
+                        static_cast<std::size_t>(y) % 3 * (width + 2) + 1;
+    const auto *center = row_sums.data() +
+                         static_cast<std::size_t>(y + 1) % 3 * (width + 2) + 1;
+    const auto *below = row_sums.data() +
+                        static_cast<std::size_t>(y + 2) % 3 * (width + 2) + 1;
+    auto *row = buttons.data() + static_cast<std::size_t>(y) * width;
+    for (std::size_t x = 0; x < width; x++) {
+      row[x].setSurroundingBombs(above[x] + center[x] + below[x] -
+                                 (row[x].getHasBomb() ? 1 : 0));
+    }
+  }
+}
+
+bool fosssweeper::ButtonPlanes::getHasPadding() const noexcept {
+  const std::size_t padding_bits =
+      this->_bombPlane.size() * 64 - this->_buttonCount;
+  if (padding_bits == 0)
+    return false;
+  const std::uint64_t padding_mask = ~std::uint64_t(0) << (64 - padding_bits);
+  return ((this->_bombPlane.back() | this->_lowPlane.back() |
+           this->_highPlane.back()) &
+          padding_mask) != 0;
+}
+
+std::size_t fosssweeper::ButtonPlanes::getButtonCount() const noexcept {
+  return this->_buttonCount;
+}
+
+int fosssweeper::ButtonPlanes::getBombCount() const noexcept {
+  return countBits(this->_bombPlane);
+}
+
+int fosssweeper::ButtonPlanes::getFlagCount() const noexcept {
+  int count = 0;
+  for (std::size_t word_i = 0; word_i < this->_lowPlane.size(); word_i++) {
+    count += std::popcount(this->_lowPlane[word_i] & ~this->_highPlane[word_i]);
+  }
+  return count;
+}
+
+int fosssweeper::ButtonPlanes::getDownCount() const noexcept {
+  int count = 0;
+  for (std::size_t word_i = 0; word_i < this->_lowPlane.size(); word_i++) {
+    count += std::popcount(this->_lowPlane[word_i] & this->_highPlane[word_i]);
+  }
+  return count;
+}
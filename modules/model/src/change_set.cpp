@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/change_set.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <vector>
+
+const std::size_t fosssweeper::ChangeSet::MIN_LIST_CAPACITY = 8;
+
+void fosssweeper::ChangeSet::reset(std::size_t button_count) {
+  this->_buttonCount = button_count;
+  this->_dirtyBits.assign((button_count + 63) / 64, 0);
+  this->_changedButtons.clear();
+  this->_listCapacity = std::max(
+      button_count / 8, fosssweeper::ChangeSet::MIN_LIST_CAPACITY);
+  this->_changedButtons.reserve(this->_listCapacity);
+  this->_changedButtonCount = 0;
+  this->_hasButtonList = true;
+  this->_gameStateChanged = false;
+  this->_flagCountChanged = false;
+  this->_timerChanged = false;
+}
+
+void fosssweeper::ChangeSet::clear() noexcept {
+  if (this->_hasButtonList) {
+    for (const auto button_i : this->_changedButtons) {
+      this->_dirtyBits[button_i / 64] = 0;
+    }
+  } else {
+    std::fill(this->_dirtyBits.begin(), this->_dirtyBits.end(), 0);
+  }
+  this->_changedButtons.clear();
+  this->_changedButtonCount = 0;
+  this->_hasButtonList = true;
+  this->_gameStateChanged = false;
+  this->_flagCountChanged = false;
+  this->_timerChanged = false;
+}
+
+void fosssweeper::ChangeSet::begin(fosssweeper::GameState game_state,
+                                   int flag_count) noexcept {
+  this->clear();
+  this->_previousGameState = game_state;
+  this->_previousFlagCount = flag_count;
+}
+
+void fosssweeper::ChangeSet::end(fosssweeper::GameState game_state,
+                                 int flag_count) noexcept {
+  this->_gameStateChanged = game_state != this->_previousGameState;
+  this->_flagCountChanged = flag_count != this->_previousFlagCount;
+  // the timer runs exactly while playing
+  this->_timerChanged =
+      (game_state == fosssweeper::GameState::Playing) !=
+      (this->_previousGameState == fosssweeper::GameState::Playing);
+}
+
+void fosssweeper::ChangeSet::addButton(std::size_t button_i) {
+  const std::uint64_t bit = std::uint64_t{1} << (button_i % 64);
+  auto &word = this->_dirtyBits[button_i / 64];
+  if ((word & bit) != 0)
+    return;
+  word |= bit;
+  this->_changedButtonCount++;
+  if (!this->_hasButtonList)
+    return;
+  if (this->_changedButtons.size() >= this->_listCapacity) {
+    this->_changedButtons.clear();
+    this->_hasButtonList = false;
+    return;
+  }
+  this->_changedButtons.push_back(button_i);
+}
+
+void fosssweeper::ChangeSet::addAllButtons() noexcept {
+  std::fill(this->_dirtyBits.begin(), this->_dirtyBits.end(), ~std::uint64_t{0});
+  if (this->_buttonCount % 64 != 0) {
+    this->_dirtyBits.back() = (std::uint64_t{1} << (this->_buttonCount % 64)) - 1;
+  }
+  this->_changedButtons.clear();
+  this->_changedButtonCount = this->_buttonCount;
+  this->_hasButtonList = false;
+}
+
+bool fosssweeper::ChangeSet::getHasChanges() const noexcept {
+  return this->_changedButtonCount != 0 || this->_gameStateChanged ||
+         this->_flagCountChanged || this->_timerChanged;
+}
+
+bool fosssweeper::ChangeSet::getHasButtonList() const noexcept {
+  return this->_hasButtonList;
+}
+
+bool fosssweeper::ChangeSet::getIsButtonChanged(
+    std::size_t button_i) const noexcept {
+  return (this->_dirtyBits[button_i / 64] >> (button_i % 64) & 1) != 0;
+}
+
+std::size_t fosssweeper::ChangeSet::getChangedButtonCount() const noexcept {
+  return this->_changedButtonCount;
+}
+
+const std::vector<std::size_t> &
+fosssweeper::ChangeSet::getChangedButtons() const noexcept {
+  return this->_changedButtons;
+}
+
+const std::vector<std::uint64_t> &
+fosssweeper::ChangeSet::getDirtyBits() const noexcept {
+  return this->_dirtyBits;
+}
+
+bool fosssweeper::ChangeSet::getGameStateChanged() const noexcept {
+  return this->_gameStateChanged;
+}
+
+bool fosssweeper::ChangeSet::getFlagCountChanged() const noexcept {
+  return this->_flagCountChanged;
+}
+
+bool fosssweeper::ChangeSet::getTimerChanged() const noexcept {
+  return this->_timerChanged;
+}
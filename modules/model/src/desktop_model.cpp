@@ -23,17 +23,141 @@
 #include <cstddef>
 #include <fosssweeper/desktop_model.hpp>
 #include <fosssweeper/game_model.hpp>
+#include <fosssweeper/model_worker.hpp>
 #include <fosssweeper/point.hpp>
 #include <fosssweeper/sprite.hpp>
 #include <fosssweeper/timer.hpp>
 #include <functional>
 #include <utility>
 
+void fosssweeper::DesktopModel::pushCommand(const fosssweeper::ModelCommand& model_command)
+{
+  // the GameModel is only read here while the worker is idle
+  if (this->_pendingCount == 0)
+  {
+    auto& game_model = this->_gameModel.get();
+    this->_boardSnapshot = game_model.snapshot();
+    this->_snapshotGameTime = game_model.getGameTime();
+    this->_updateGameState = game_model.getGameState();
+  }
+  this->_pendingCount++;
+  // commands that do not fit into the queue wait for the worker to catch up
+  if (!this->_waitingCommands.empty() ||
+      !this->_modelWorker->tryPush(model_command).has_value())
+  {
+    this->_waitingCommands.push_back(model_command);
+  }
+}
+
+void fosssweeper::DesktopModel::pushButtonCommand(
+    fosssweeper::ModelCommandType command_type, const fosssweeper::ButtonPosition& button_position)
+{
+  fosssweeper::ModelCommand model_command;
+  model_command._commandType = command_type;
+  model_command._buttonPosition = button_position;
+  this->pushCommand(model_command);
+}
+
+void fosssweeper::DesktopModel::pushTimeCommand(fosssweeper::Timer& timer)
+{
+  fosssweeper::ModelCommand model_command;
+  model_command._commandType = fosssweeper::ModelCommandType::UpdateTime;
+  model_command._value = timer.getGameTime();
+  this->pushCommand(model_command);
+}
+
+void fosssweeper::DesktopModel::pushWaitingCommands()
+{
+  while (!this->_waitingCommands.empty() &&
+         this->_modelWorker->tryPush(this->_waitingCommands.front()).has_value())
+  {
+    this->_waitingCommands.pop_front();
+  }
+}
+
+// the timer is started and stopped on the same game state changes as in the
+// synchronous input handlers
+void fosssweeper::DesktopModel::applyModelUpdate(fosssweeper::ModelUpdate& model_update,
+                                                 fosssweeper::Timer& timer)
+{
+  const auto previous_game_state = this->_updateGameState;
+  this->_boardSnapshot = std::move(model_update._boardSnapshot);
+  this->_snapshotGameTime = model_update._gameTime;
+  this->_updateGameState = this->_boardSnapshot.getGameState();
+  this->_pendingCount--;
+  if (this->_updateGameState == previous_game_state) return;
+  if (this->_updateGameState == fosssweeper::GameState::Playing)
+  {
+    timer.start();
+  }
+  else if (this->_updateGameState == fosssweeper::GameState::Dead ||
+           (this->_updateGameState == fosssweeper::GameState::Cool &&
+            previous_game_state == fosssweeper::GameState::Playing))
+  {
+    timer.stop();
+  }
+}
+
+fosssweeper::GameState fosssweeper::DesktopModel::getViewGameState() const noexcept
+{
+  if (this->_pendingCount > 0) return this->_boardSnapshot.getGameState();
+  return this->_gameModel.get().getGameState();
+}
+
+fosssweeper::GameConfiguration fosssweeper::DesktopModel::getViewGameConfiguration() const noexcept
+{
+  if (this->_pendingCount > 0) return this->_boardSnapshot.getGameConfiguration();
+  return this->_gameModel.get().getGameConfiguration();
+}
+
+const fosssweeper::Button& fosssweeper::DesktopModel::getViewButton(int x, int y) const noexcept
+{
+  if (this->_pendingCount > 0) return this->_boardSnapshot.getButton(x, y);
+  return this->_gameModel.get().getButton(x, y);
+}
+
 fosssweeper::DesktopModel::DesktopModel(fosssweeper::GameModel& game_model) noexcept
     : _gameModel(std::ref(game_model))
 {
 }
 
+// the worker must be idle when it is replaced or removed
+void fosssweeper::DesktopModel::setModelWorker(fosssweeper::ModelWorker* model_worker) noexcept
+{
+  this->_modelWorker = model_worker;
+  this->_waitingCommands.clear();
+  this->_pendingCount = 0;
+}
+
+bool fosssweeper::DesktopModel::getIsModelIdle() const noexcept { return this->_pendingCount == 0; }
+
+// returns whether the worker became idle, which is when the results of the
+// input, like a game that ended, can be read from the GameModel
+bool fosssweeper::DesktopModel::applyModelUpdates(fosssweeper::Timer& timer)
+{
+  if (this->_pendingCount == 0) return false;
+  fosssweeper::ModelUpdate model_update;
+  while (this->_modelWorker->tryPopUpdate(model_update))
+  {
+    this->applyModelUpdate(model_update, timer);
+  }
+  this->pushWaitingCommands();
+  return this->_pendingCount == 0;
+}
+
+// blocks until every command was applied, for actions that use the GameModel
+// directly
+void fosssweeper::DesktopModel::finishModelUpdates(fosssweeper::Timer& timer)
+{
+  fosssweeper::ModelUpdate model_update;
+  while (this->_pendingCount > 0)
+  {
+    this->pushWaitingCommands();
+    this->_modelWorker->popUpdate(model_update);
+    this->applyModelUpdate(model_update, timer);
+  }
+}
+
 bool fosssweeper::DesktopModel::tryChangePixelScale(int new_pixel_scale)
 {
   if (this->_pixelScale == new_pixel_scale) return false;
@@ -45,6 +169,27 @@ void fosssweeper::DesktopModel::leftPress() { this->_leftDown = true; }
 
 void fosssweeper::DesktopModel::leftRelease(fosssweeper::Timer& timer)
 {
+  if (this->_modelWorker != nullptr)
+  {
+    this->pushTimeCommand(timer);
+    if (this->_hoverButtonO.has_value())
+    {
+      this->_hintButtonO = std::nullopt;
+      this->pushButtonCommand(this->_rightDown ? fosssweeper::ModelCommandType::AreaClick
+                                               : fosssweeper::ModelCommandType::Click,
+                              this->_hoverButtonO.value());
+    }
+    else if (this->_hoverFace)
+    {
+      fosssweeper::ModelCommand model_command;
+      model_command._commandType = fosssweeper::ModelCommandType::NewGame;
+      this->pushCommand(model_command);
+      this->_hintButtonO = std::nullopt;
+      timer.stop();
+    }
+    this->_leftDown = false;
+    return;
+  }
   auto& game_model = this->_gameModel.get();
   if (game_model.getGameState() == fosssweeper::GameState::Playing)
   {
@@ -54,6 +199,7 @@ void fosssweeper::DesktopModel::leftRelease(fosssweeper::Timer& timer)
   if (this->_hoverButtonO.has_value())
   {
     auto& hover_button = this->_hoverButtonO.value();
+    this->_hintButtonO = std::nullopt;
     if (this->_rightDown)
     {
       game_model.areaClickButton(hover_button.x, hover_button.y);
@@ -75,6 +221,7 @@ void fosssweeper::DesktopModel::leftRelease(fosssweeper::Timer& timer)
   else if (this->_hoverFace)
   {
     game_model.newGame();
+    this->_hintButtonO = std::nullopt;
     timer.stop();
   }
   this->_leftDown = false;
@@ -82,8 +229,19 @@ void fosssweeper::DesktopModel::leftRelease(fosssweeper::Timer& timer)
 
 void fosssweeper::DesktopModel::rightPress(fosssweeper::Timer& timer)
 {
-  auto& game_model = this->_gameModel.get();
   this->_rightDown = true;
+  if (this->_modelWorker != nullptr)
+  {
+    this->pushTimeCommand(timer);
+    if (!this->_leftDown && this->_hoverButtonO.has_value())
+    {
+      this->_hintButtonO = std::nullopt;
+      this->pushButtonCommand(fosssweeper::ModelCommandType::AltClick,
+                              this->_hoverButtonO.value());
+    }
+    return;
+  }
+  auto& game_model = this->_gameModel.get();
   if (game_model.getGameState() == fosssweeper::GameState::Playing)
   {
     game_model.updateTime(timer.getGameTime());
@@ -91,17 +249,30 @@ void fosssweeper::DesktopModel::rightPress(fosssweeper::Timer& timer)
   if (!this->_leftDown && this->_hoverButtonO.has_value())
   {
     auto& hover_button = this->_hoverButtonO.value();
+    this->_hintButtonO = std::nullopt;
     game_model.altClickButton(hover_button.x, hover_button.y);
   }
 }
 
 void fosssweeper::DesktopModel::rightRelease(fosssweeper::Timer& timer)
 {
+  if (this->_modelWorker != nullptr)
+  {
+    if (this->_hoverButtonO.has_value() && this->_leftDown)
+    {
+      this->_hintButtonO = std::nullopt;
+      this->pushButtonCommand(fosssweeper::ModelCommandType::AreaClick,
+                              this->_hoverButtonO.value());
+    }
+    this->_rightDown = false;
+    return;
+  }
   auto& game_model = this->_gameModel.get();
   auto initially_playing = game_model.getGameState() == fosssweeper::GameState::Playing;
   if (this->_hoverButtonO.has_value() && this->_leftDown)
   {
     auto& hover_button = this->_hoverButtonO.value();
+    this->_hintButtonO = std::nullopt;
     game_model.areaClickButton(hover_button.x, hover_button.y);
     if (game_model.getGameState() == fosssweeper::GameState::Dead ||
               game_model.getGameState() == fosssweeper::GameState::Cool)
@@ -129,6 +300,33 @@ void fosssweeper::DesktopModel::mouseMove(int x, int y)
                      y >= face_point.y && y < face_point.y + this->getFaceDimension();
 }
 
+void fosssweeper::DesktopModel::setHintButton(
+    std::optional<fosssweeper::ButtonPosition> hint_button_o)
+{
+  this->_hintButtonO = hint_button_o;
+}
+
+std::optional<fosssweeper::ButtonPosition> fosssweeper::DesktopModel::getHintButtonO() const noexcept
+{
+  return this->_hintButtonO;
+}
+
+int fosssweeper::DesktopModel::getBombsLeft() const noexcept
+{
+  if (this->_pendingCount > 0)
+  {
+    return this->_boardSnapshot.getGameConfiguration().getBombCount() -
+           this->_boardSnapshot.getFlagCount();
+  }
+  return this->_gameModel.get().getBombsLeft();
+}
+
+unsigned long fosssweeper::DesktopModel::getTimerSeconds() const noexcept
+{
+  if (this->_pendingCount > 0) return this->_snapshotGameTime / 1000;
+  return this->_gameModel.get().getTimerSeconds();
+}
+
 const int FACE_BUTTON_DIMENSION = 24;
 const int BORDER_SIZE = 8;
 const int BUTTON_DIMENSION = 16;
@@ -161,9 +359,9 @@ int fosssweeper::DesktopModel::getHeaderHeight() const noexcept
 
 fosssweeper::Sprite fosssweeper::DesktopModel::getFaceSprite() const noexcept
 {
-  const auto& game_model = this->_gameModel.get();
-  if (game_model.getGameState() == fosssweeper::GameState::None ||
-      game_model.getGameState() == fosssweeper::GameState::Playing)
+  const auto game_state = this->getViewGameState();
+  if (game_state == fosssweeper::GameState::None ||
+      game_state == fosssweeper::GameState::Playing)
   {
     if (this->_leftDown && this->_hoverFace)
     {
@@ -172,7 +370,7 @@ fosssweeper::Sprite fosssweeper::DesktopModel::getFaceSprite() const noexcept
     else if (this->_leftDown && this->_hoverButtonO.has_value())
     {
       const auto& hover_button = this->_hoverButtonO.value();
-      const auto& button = game_model.getButton(hover_button.x, hover_button.y);
+      const auto& button = this->getViewButton(hover_button.x, hover_button.y);
       if (button.getButtonState() != fosssweeper::ButtonState::Down &&
           button.getButtonState() != fosssweeper::ButtonState::Flagged)
       {
@@ -180,7 +378,7 @@ fosssweeper::Sprite fosssweeper::DesktopModel::getFaceSprite() const noexcept
       }
     }
   }
-  else if (game_model.getGameState() == fosssweeper::GameState::Cool)
+  else if (game_state == fosssweeper::GameState::Cool)
   {
     if (this->_leftDown && this->_hoverFace)
     {
@@ -207,16 +405,16 @@ fosssweeper::Sprite fosssweeper::DesktopModel::getFaceSprite() const noexcept
 
 fosssweeper::Sprite fosssweeper::DesktopModel::getButtonSprite(int x, int y) const noexcept
 {
-  const auto& game_model = this->_gameModel.get();
-  if (x >= game_model.getGameConfiguration().getButtonsWide() ||
-      y >= game_model.getGameConfiguration().getButtonsTall())
+  const auto game_configuration = this->getViewGameConfiguration();
+  if (x >= game_configuration.getButtonsWide() || y >= game_configuration.getButtonsTall())
   {
     return fosssweeper::Sprite::ButtonNone;
   }
-  const auto& button = game_model.getButton(x, y);
+  const auto& button = this->getViewButton(x, y);
   auto button_position = fosssweeper::ButtonPosition(x, y);
-  if (game_model.getGameState() == fosssweeper::GameState::None ||
-      game_model.getGameState() == fosssweeper::GameState::Playing)
+  const auto game_state = this->getViewGameState();
+  if (game_state == fosssweeper::GameState::None ||
+      game_state == fosssweeper::GameState::Playing)
   {
     if (button.getButtonState() != fosssweeper::ButtonState::Flagged &&
         button.getButtonState() != fosssweeper::ButtonState::Down && this->_leftDown &&
@@ -318,12 +516,18 @@ fosssweeper::Point fosssweeper::DesktopModel::getTimerPoint(std::size_t digit) c
 
 fosssweeper::Point fosssweeper::DesktopModel::getSize() const noexcept
 {
-  const auto& game_model = this->_gameModel.get();
+  const auto game_configuration = this->getViewGameConfiguration();
   return fosssweeper::Point(
-      (game_model.getGameConfiguration().getButtonsWide() *
+      (game_configuration.getButtonsWide() *
        (this->_pixelScale * BUTTON_DIMENSION)) +
           ((this->_pixelScale * BORDER_SIZE) * 2),
-      (game_model.getGameConfiguration().getButtonsTall() *
+      (game_configuration.getButtonsTall() *
        (this->_pixelScale * BUTTON_DIMENSION)) +
           ((this->_pixelScale * BORDER_SIZE) + (this->_pixelScale * HEADER_HEIGHT)));
 }
+
+fosssweeper::Point fosssweeper::DesktopModel::getButtonCount() const noexcept
+{
+  const auto game_configuration = this->getViewGameConfiguration();
+  return fosssweeper::Point(game_configuration.getButtonsWide(), game_configuration.getButtonsTall());
+}
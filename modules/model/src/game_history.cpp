@@ -0,0 +1,742 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fosssweeper/game_history.hpp>
+#include <fosssweeper/game_record.hpp>
+#include <fosssweeper/save_file.hpp>
+#include <fosssweeper/statistics_store.hpp>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+const std::array<char, 8> fosssweeper::GameHistory::MAGIC = {
+    'F', 'S', 'W', 'H', 'I', 'S', 'T', 'C'};
+const std::uint32_t fosssweeper::GameHistory::VERSION = 1;
+const std::size_t fosssweeper::GameHistory::HEADER_SIZE = 64;
+const std::size_t fosssweeper::GameHistory::CONFIGURATION_SIZE = 12;
+const std::size_t fosssweeper::GameHistory::COLUMN_ALIGNMENT = 64;
+const std::size_t fosssweeper::GameHistory::BLOCK_SIZE = 4096;
+const std::size_t fosssweeper::GameHistory::MAX_CONFIGURATION_COUNT = 1 << 16;
+const std::size_t fosssweeper::GameHistory::MAX_PASS_CONFIGURATION_COUNT = 8;
+const std::size_t fosssweeper::GameHistory::MAX_TREND_BUCKET_COUNT = 1 << 20;
+
+namespace {
+void writeInteger(std::span<unsigned char> bytes, std::size_t offset,
+                  std::uint64_t value, std::size_t size) noexcept {
+  for (std::size_t byte_i = 0; byte_i < size; byte_i++) {
+    bytes[offset + byte_i] =
+        static_cast<unsigned char>((value >> (byte_i * 8)) & 0xff);
+  }
+}
+
+std::uint64_t readInteger(std::span<const unsigned char> bytes,
+                          std::size_t offset, std::size_t size) noexcept {
+  std::uint64_t value = 0;
+  for (std::size_t byte_i = 0; byte_i < size; byte_i++) {
+    value |= static_cast<std::uint64_t>(bytes[offset + byte_i]) << (byte_i * 8);
+  }
+  return value;
+}
+
+std::size_t alignColumn(std::size_t offset) noexcept {
+  return (offset + fosssweeper::GameHistory::COLUMN_ALIGNMENT - 1) /
+         fosssweeper::GameHistory::COLUMN_ALIGNMENT *
+         fosssweeper::GameHistory::COLUMN_ALIGNMENT;
+}
+
+template <typename T>
+std::span<T> getColumn(std::span<unsigned char> image, std::size_t offset,
+                       std::size_t count) noexcept {
+  return std::span<T>(reinterpret_cast<T *>(image.data() + offset), count);
+}
+
+template <typename T>
+std::span<const T> getColumn(std::span<const unsigned char> image,
+                             std::size_t offset, std::size_t count) noexcept {
+  return std::span<const T>(reinterpret_cast<const T *>(image.data() + offset),
+                            count);
+}
+
+template <typename T>
+void swapColumn(std::span<unsigned char> image, std::size_t offset,
+                std::size_t count) noexcept {
+  for (std::size_t value_i = 0; value_i < count; value_i++) {
+    const auto value_begin = image.begin() + offset + value_i * sizeof(T);
+    std::reverse(value_begin, value_begin + sizeof(T));
+  }
+}
+
+// columns are little endian in a file and native in memory
+void swapColumns(std::span<unsigned char> image,
+                 const fosssweeper::GameHistory::Layout &layout,
+                 std::size_t record_count) noexcept {
+  swapColumn<std::int64_t>(image, layout._finishedAtsOffset, record_count);
+  swapColumn<std::uint32_t>(image, layout._gameTimesOffset, record_count);
+  swapColumn<std::uint32_t>(image, layout._bbbvsOffset, record_count);
+  swapColumn<std::uint32_t>(image, layout._clickCountsOffset, record_count);
+  swapColumn<std::uint16_t>(image, layout._configurationIsOffset,
+                            record_count);
+}
+
+// every query walks the selected games a block at a time, so the mask stays
+// in the first level cache
+template <typename Function>
+void forEachBlock(const fosssweeper::GameHistory &game_history,
+                  const fosssweeper::GameHistoryFilter &filter,
+                  Function function) {
+  std::vector<std::uint8_t> selection(fosssweeper::GameHistory::BLOCK_SIZE);
+  for (std::size_t begin_i = 0; begin_i < game_history.getRecordCount();
+       begin_i += fosssweeper::GameHistory::BLOCK_SIZE) {
+    const auto row_count =
+        std::min(fosssweeper::GameHistory::BLOCK_SIZE,
+                 game_history.getRecordCount() - begin_i);
+    if (game_history.select(filter, begin_i, selection) == 0)
+      continue;
+    function(begin_i, row_count, selection.data());
+  }
+}
+struct WinTotals {
+  std::uint64_t _gameCount = 0;
+  std::uint64_t _winCount = 0;
+  std::uint64_t _winTimeSum = 0;
+  std::uint32_t _bestTime = std::numeric_limits<std::uint32_t>::max();
+};
+
+// sums the selected games of one configuration; the win mask turns into an
+// all ones or all zeros word, so the loop has no branch and vectorizes
+void addWinTotals(const std::uint8_t *mask,
+                  const std::uint16_t *configuration_is,
+                  std::uint16_t configuration_i, const std::uint8_t *wins,
+                  const std::uint32_t *game_times, std::size_t row_count,
+                  WinTotals &win_totals) noexcept {
+  // a block is short enough for the counts to fit 32 bits
+  std::uint32_t game_count = 0;
+  std::uint32_t win_count = 0;
+  std::uint64_t win_time_sum = 0;
+  auto best_time = win_totals._bestTime;
+  for (std::size_t row_i = 0; row_i < row_count; row_i++) {
+    const auto selected = static_cast<std::uint32_t>(
+        mask[row_i] & (configuration_is[row_i] == configuration_i ? 1 : 0));
+    const auto won = selected & (wins[row_i] != 0 ? 1u : 0u);
+    const auto won_time = game_times[row_i] & (0u - won);
+    game_count += selected;
+    win_count += won;
+    win_time_sum += won_time;
+    best_time = std::min(best_time, won_time | (won - 1u));
+  }
+  win_totals._gameCount += game_count;
+  win_totals._winCount += win_count;
+  win_totals._winTimeSum += win_time_sum;
+  win_totals._bestTime = best_time;
+}
+
+// writes the rows selected by the mask to the front of row_is
+std::size_t compactSelection(const std::uint8_t *mask, std::size_t row_count,
+                             std::uint32_t *row_is) noexcept {
+  std::size_t selected_count = 0;
+  for (std::size_t row_i = 0; row_i < row_count; row_i++) {
+    row_is[selected_count] = static_cast<std::uint32_t>(row_i);
+    selected_count += mask[row_i];
+  }
+  return selected_count;
+}
+} // namespace
+
+double fosssweeper::ConfigurationSummary::getWinRate() const noexcept {
+  return this->_gameCount == 0 ? 0.0
+                               : static_cast<double>(this->_winCount) /
+                                     static_cast<double>(this->_gameCount);
+}
+
+double fosssweeper::ConfigurationSummary::getAverageWinTime() const noexcept {
+  return this->_winCount == 0 ? 0.0
+                              : static_cast<double>(this->_winTimeSum) /
+                                    static_cast<double>(this->_winCount);
+}
+
+double fosssweeper::TrendBucket::getWinRate() const noexcept {
+  return this->_gameCount == 0 ? 0.0
+                               : static_cast<double>(this->_winCount) /
+                                     static_cast<double>(this->_gameCount);
+}
+
+double fosssweeper::RateHistogram::getAverage() const noexcept {
+  return this->_gameCount == 0
+             ? 0.0
+             : this->_rateSum / static_cast<double>(this->_gameCount);
+}
+
+// the upper edge of the bucket holding the given fraction of the games
+double fosssweeper::RateHistogram::getPercentile(double fraction) const noexcept {
+  if (this->_gameCount == 0)
+    return 0.0;
+  const auto wanted_count =
+      std::clamp(fraction, 0.0, 1.0) * static_cast<double>(this->_gameCount);
+  std::size_t seen_count = 0;
+  for (std::size_t bucket_i = 0; bucket_i < this->_counts.size(); bucket_i++) {
+    seen_count += this->_counts[bucket_i];
+    if (static_cast<double>(seen_count) >= wanted_count && seen_count > 0)
+      return static_cast<double>(bucket_i + 1) * this->_bucketWidth;
+  }
+  return static_cast<double>(this->_counts.size()) * this->_bucketWidth;
+}
+
+fosssweeper::GameHistory::Layout
+fosssweeper::GameHistory::getLayout(std::size_t record_count,
+                                    std::size_t configuration_count) noexcept {
+  fosssweeper::GameHistory::Layout layout;
+  layout._finishedAtsOffset = alignColumn(
+      fosssweeper::GameHistory::HEADER_SIZE +
+      configuration_count * fosssweeper::GameHistory::CONFIGURATION_SIZE);
+  layout._gameTimesOffset = alignColumn(layout._finishedAtsOffset +
+                                        record_count * sizeof(std::int64_t));
+  layout._bbbvsOffset =
+      alignColumn(layout._gameTimesOffset + record_count * sizeof(std::uint32_t));
+  layout._clickCountsOffset =
+      alignColumn(layout._bbbvsOffset + record_count * sizeof(std::uint32_t));
+  layout._configurationIsOffset = alignColumn(
+      layout._clickCountsOffset + record_count * sizeof(std::uint32_t));
+  layout._generationModesOffset = alignColumn(
+      layout._configurationIsOffset + record_count * sizeof(std::uint16_t));
+  layout._winsOffset = alignColumn(layout._generationModesOffset +
+                                   record_count * sizeof(std::uint8_t));
+  layout._size =
+      alignColumn(layout._winsOffset + record_count * sizeof(std::uint8_t));
+  return layout;
+}
+
+// points the columns into the image after checking its header and size
+void fosssweeper::GameHistory::attach(std::span<const unsigned char> image) {
+  if (image.size() < fosssweeper::GameHistory::HEADER_SIZE) {
+    throw std::runtime_error("truncated game history");
+  }
+  if (!std::equal(fosssweeper::GameHistory::MAGIC.begin(),
+                  fosssweeper::GameHistory::MAGIC.end(), image.begin())) {
+    throw std::runtime_error("not a game history");
+  }
+  if (readInteger(image, 8, 4) != fosssweeper::GameHistory::VERSION) {
+    throw std::runtime_error("unsupported game history version");
+  }
+  if (readInteger(image, 12, 4) != fosssweeper::GameHistory::HEADER_SIZE) {
+    throw std::runtime_error("invalid game history header");
+  }
+  const auto record_count = readInteger(image, 16, 8);
+  const auto configuration_count = readInteger(image, 24, 4);
+  if (record_count > image.size() ||
+      configuration_count > fosssweeper::GameHistory::MAX_CONFIGURATION_COUNT) {
+    throw std::runtime_error("invalid game history header");
+  }
+  const auto layout = fosssweeper::GameHistory::getLayout(
+      static_cast<std::size_t>(record_count),
+      static_cast<std::size_t>(configuration_count));
+  if (layout._size != image.size()) {
+    throw std::runtime_error("invalid game history size");
+  }
+
+  this->_gameConfigurations.clear();
+  for (std::size_t configuration_i = 0; configuration_i < configuration_count;
+       configuration_i++) {
+    const auto offset =
+        fosssweeper::GameHistory::HEADER_SIZE +
+        configuration_i * fosssweeper::GameHistory::CONFIGURATION_SIZE;
+    const auto buttons_wide = readInteger(image, offset, 4);
+    const auto buttons_tall = readInteger(image, offset + 4, 4);
+    const auto bomb_count = readInteger(image, offset + 8, 4);
+    if (buttons_wide * buttons_tall > fosssweeper::SaveFile::MAX_BUTTON_COUNT) {
+      throw std::runtime_error("game history board too large");
+    }
+    const fosssweeper::GameConfiguration game_configuration(
+        static_cast<int>(buttons_wide), static_cast<int>(buttons_tall),
+        static_cast<int>(bomb_count));
+    if (static_cast<std::uint64_t>(game_configuration.getButtonsWide()) !=
+            buttons_wide ||
+        static_cast<std::uint64_t>(game_configuration.getButtonsTall()) !=
+            buttons_tall ||
+        static_cast<std::uint64_t>(game_configuration.getBombCount()) !=
+            bomb_count) {
+      throw std::runtime_error("invalid game history configuration");
+    }
+    this->_gameConfigurations.push_back(game_configuration);
+  }
+
+  this->_recordCount = static_cast<std::size_t>(record_count);
+  this->_finishedAts = getColumn<std::int64_t>(image, layout._finishedAtsOffset,
+                                               this->_recordCount);
+  this->_gameTimes = getColumn<std::uint32_t>(image, layout._gameTimesOffset,
+                                              this->_recordCount);
+  this->_bbbvs =
+      getColumn<std::uint32_t>(image, layout._bbbvsOffset, this->_recordCount);
+  this->_clickCounts = getColumn<std::uint32_t>(
+      image, layout._clickCountsOffset, this->_recordCount);
+  this->_configurationIs = getColumn<std::uint16_t>(
+      image, layout._configurationIsOffset, this->_recordCount);
+  this->_generationModes = getColumn<std::uint8_t>(
+      image, layout._generationModesOffset, this->_recordCount);
+  this->_wins =
+      getColumn<std::uint8_t>(image, layout._winsOffset, this->_recordCount);
+}
+
+std::span<const unsigned char>
+fosssweeper::GameHistory::getImage() const noexcept {
+  if (!this->_ownedWords.empty()) {
+    return std::span<const unsigned char>(
+        reinterpret_cast<const unsigned char *>(this->_ownedWords.data()),
+        this->_ownedWords.size() * sizeof(std::uint64_t));
+  }
+  return this->_mappedFile.getData();
+}
+
+std::optional<std::uint16_t> fosssweeper::GameHistory::findConfigurationI(
+    fosssweeper::GameConfiguration game_configuration) const noexcept {
+  const auto it = std::find(this->_gameConfigurations.begin(),
+                            this->_gameConfigurations.end(), game_configuration);
+  if (it == this->_gameConfigurations.end())
+    return std::nullopt;
+  return static_cast<std::uint16_t>(it - this->_gameConfigurations.begin());
+}
+
+fosssweeper::GameHistory::GameHistory()
+    : fosssweeper::GameHistory(std::span<const fosssweeper::GameRecord>()) {}
+
+fosssweeper::GameHistory::GameHistory(
+    std::span<const fosssweeper::GameRecord> game_records) {
+  std::unordered_map<fosssweeper::GameConfiguration, std::uint16_t,
+                     fosssweeper::GameConfigurationHash>
+      configuration_is;
+  std::vector<fosssweeper::GameConfiguration> game_configurations;
+  for (const auto &game_record : game_records) {
+    if (configuration_is.contains(game_record._gameConfiguration))
+      continue;
+    if (game_configurations.size() >=
+        fosssweeper::GameHistory::MAX_CONFIGURATION_COUNT) {
+      throw std::runtime_error("too many configurations for a game history");
+    }
+    configuration_is.emplace(
+        game_record._gameConfiguration,
+        static_cast<std::uint16_t>(game_configurations.size()));
+    game_configurations.push_back(game_record._gameConfiguration);
+  }
+
+  const auto record_count = game_records.size();
+  const auto layout = fosssweeper::GameHistory::getLayout(
+      record_count, game_configurations.size());
+  this->_ownedWords.resize(layout._size / sizeof(std::uint64_t));
+  const std::span<unsigned char> image(
+      reinterpret_cast<unsigned char *>(this->_ownedWords.data()),
+      layout._size);
+  std::copy(fosssweeper::GameHistory::MAGIC.begin(),
+            fosssweeper::GameHistory::MAGIC.end(), image.begin());
+  writeInteger(image, 8, fosssweeper::GameHistory::VERSION, 4);
+  writeInteger(image, 12, fosssweeper::GameHistory::HEADER_SIZE, 4);
+  writeInteger(image, 16, record_count, 8);
+  writeInteger(image, 24, game_configurations.size(), 4);
+  for (std::size_t configuration_i = 0;
+       configuration_i < game_configurations.size(); configuration_i++) {
+    const auto offset =
+        fosssweeper::GameHistory::HEADER_SIZE +
+        configuration_i * fosssweeper::GameHistory::CONFIGURATION_SIZE;
+    const auto &game_configuration = game_configurations[configuration_i];
+    writeInteger(
+        image, offset,
+        static_cast<std::uint64_t>(game_configuration.getButtonsWide()), 4);
+    writeInteger(
+        image, offset + 4,
+        static_cast<std::uint64_t>(game_configuration.getButtonsTall()), 4);
+    writeInteger(image, offset + 8,
+                 static_cast<std::uint64_t>(game_configuration.getBombCount()),
+                 4);
+  }
+
+  const auto finished_ats =
+      getColumn<std::int64_t>(image, layout._finishedAtsOffset, record_count);
+  const auto game_times =
+      getColumn<std::uint32_t>(image, layout._gameTimesOffset, record_count);
+  const auto bbbvs =
+      getColumn<std::uint32_t>(image, layout._bbbvsOffset, record_count);
+  const auto click_counts =
+      getColumn<std::uint32_t>(image, layout._clickCountsOffset, record_count);
+  const auto configuration_is_column = getColumn<std::uint16_t>(
+      image, layout._configurationIsOffset, record_count);
+  const auto generation_modes = getColumn<std::uint8_t>(
+      image, layout._generationModesOffset, record_count);
+  const auto wins =
+      getColumn<std::uint8_t>(image, layout._winsOffset, record_count);
+  for (std::size_t record_i = 0; record_i < record_count; record_i++) {
+    const auto &game_record = game_records[record_i];
+    finished_ats[record_i] = game_record._finishedAt;
+    // times past 49 days are kept as the longest time a column can hold
+    game_times[record_i] = static_cast<std::uint32_t>(
+        std::min<std::uint64_t>(game_record._gameTime,
+                                std::numeric_limits<std::uint32_t>::max()));
+    bbbvs[record_i] = static_cast<std::uint32_t>(game_record._bbbv);
+    click_counts[record_i] = static_cast<std::uint32_t>(game_record._clickCount);
+    configuration_is_column[record_i] =
+        configuration_is.at(game_record._gameConfiguration);
+    generation_modes[record_i] =
+        static_cast<std::uint8_t>(game_record._generationMode);
+    wins[record_i] = game_record.getIsWon() ? 1 : 0;
+  }
+  this->attach(image);
+}
+
+fosssweeper::GameHistory::GameHistory(const std::filesystem::path &path)
+    : _mappedFile(path) {
+  const auto bytes = this->_mappedFile.getData();
+  if constexpr (std::endian::native == std::endian::little) {
+    this->attach(bytes);
+  } else {
+    this->_ownedWords.resize((bytes.size() + sizeof(std::uint64_t) - 1) /
+                             sizeof(std::uint64_t));
+    const std::span<unsigned char> image(
+        reinterpret_cast<unsigned char *>(this->_ownedWords.data()),
+        bytes.size());
+    std::copy(bytes.begin(), bytes.end(), image.begin());
+    this->attach(image);
+    swapColumns(image,
+                fosssweeper::GameHistory::getLayout(
+                    this->_recordCount, this->_gameConfigurations.size()),
+                this->_recordCount);
+    this->_mappedFile.close();
+  }
+  std::uint16_t max_configuration_i = 0;
+  for (const auto configuration_i : this->_configurationIs) {
+    max_configuration_i = std::max(max_configuration_i, configuration_i);
+  }
+  if (this->_recordCount > 0 &&
+      max_configuration_i >= this->_gameConfigurations.size()) {
+    throw std::runtime_error("invalid game history configuration index");
+  }
+}
+
+void fosssweeper::GameHistory::write(const std::filesystem::path &path) const {
+  const auto image = this->getImage();
+  std::vector<unsigned char> bytes;
+  auto write_image = image;
+  if constexpr (std::endian::native != std::endian::little) {
+    bytes.assign(image.begin(), image.end());
+    swapColumns(bytes,
+                fosssweeper::GameHistory::getLayout(
+                    this->_recordCount, this->_gameConfigurations.size()),
+                this->_recordCount);
+    write_image = bytes;
+  }
+  auto temporary_path = path;
+  temporary_path += ".tmp";
+  {
+    std::ofstream stream(temporary_path, std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<const char *>(write_image.data()),
+                 static_cast<std::streamsize>(write_image.size()));
+    stream.flush();
+    if (!stream) {
+      throw std::runtime_error("failed to write " + temporary_path.string());
+    }
+  }
+  std::filesystem::rename(temporary_path, path);
+}
+
+// the filter kernel; every condition is a separate branch free pass over one
+// column that ands its result into the mask
+std::size_t
+fosssweeper::GameHistory::select(const fosssweeper::GameHistoryFilter &filter,
+                                 std::size_t begin_i,
+                                 std::span<std::uint8_t> selection) const {
+  if (begin_i >= this->_recordCount)
+    return 0;
+  const auto row_count = std::min(selection.size(), this->_recordCount - begin_i);
+  auto *const mask = selection.data();
+  std::fill_n(mask, row_count, static_cast<std::uint8_t>(1));
+  if (filter._gameConfigurationO.has_value()) {
+    const auto configuration_iO =
+        this->findConfigurationI(filter._gameConfigurationO.value());
+    if (!configuration_iO.has_value()) {
+      std::fill_n(mask, row_count, static_cast<std::uint8_t>(0));
+      return 0;
+    }
+    const auto configuration_i = configuration_iO.value();
+    const auto *const configuration_is = this->_configurationIs.data() + begin_i;
+    for (std::size_t row_i = 0; row_i < row_count; row_i++) {
+      mask[row_i] &=
+          static_cast<std::uint8_t>(configuration_is[row_i] == configuration_i);
+    }
+  }
+  if (filter._generationModeO.has_value()) {
+    const auto generation_mode =
+        static_cast<std::uint8_t>(filter._generationModeO.value());
+    const auto *const generation_modes = this->_generationModes.data() + begin_i;
+    for (std::size_t row_i = 0; row_i < row_count; row_i++) {
+      mask[row_i] &=
+          static_cast<std::uint8_t>(generation_modes[row_i] == generation_mode);
+    }
+  }
+  if (filter._wonO.has_value()) {
+    const auto won = filter._wonO.value();
+    const auto *const wins = this->_wins.data() + begin_i;
+    for (std::size_t row_i = 0; row_i < row_count; row_i++) {
+      mask[row_i] &= static_cast<std::uint8_t>((wins[row_i] != 0) == won);
+    }
+  }
+  if (filter._finishedFrom != std::numeric_limits<std::int64_t>::min() ||
+      filter._finishedTo != std::numeric_limits<std::int64_t>::max()) {
+    const auto *const finished_ats = this->_finishedAts.data() + begin_i;
+    for (std::size_t row_i = 0; row_i < row_count; row_i++) {
+      mask[row_i] &= static_cast<std::uint8_t>(
+          (finished_ats[row_i] >= filter._finishedFrom) &
+          (finished_ats[row_i] < filter._finishedTo));
+    }
+  }
+  std::size_t selected_count = 0;
+  for (std::size_t row_i = 0; row_i < row_count; row_i++) {
+    selected_count += mask[row_i];
+  }
+  return selected_count;
+}
+
+std::size_t
+fosssweeper::GameHistory::count(const fosssweeper::GameHistoryFilter &filter) const {
+  std::size_t selected_count = 0;
+  std::vector<std::uint8_t> selection(fosssweeper::GameHistory::BLOCK_SIZE);
+  for (std::size_t begin_i = 0; begin_i < this->_recordCount;
+       begin_i += fosssweeper::GameHistory::BLOCK_SIZE) {
+    selected_count += this->select(filter, begin_i, selection);
+  }
+  return selected_count;
+}
+
+// with few configurations every one of them is summed by its own vectorized
+// pass over the block, otherwise the selected rows are added to the sums of
+// their configuration one by one
+std::vector<fosssweeper::ConfigurationSummary> fosssweeper::GameHistory::summarize(
+    const fosssweeper::GameHistoryFilter &filter) const {
+  const auto configuration_count = this->_gameConfigurations.size();
+  std::vector<WinTotals> win_totals(configuration_count);
+  std::vector<std::uint16_t> pass_configuration_is;
+  if (filter._gameConfigurationO.has_value()) {
+    const auto configuration_iO =
+        this->findConfigurationI(filter._gameConfigurationO.value());
+    if (configuration_iO.has_value()) {
+      pass_configuration_is.push_back(configuration_iO.value());
+    }
+  } else if (configuration_count <=
+             fosssweeper::GameHistory::MAX_PASS_CONFIGURATION_COUNT) {
+    for (std::size_t configuration_i = 0;
+         configuration_i < configuration_count; configuration_i++) {
+      pass_configuration_is.push_back(
+          static_cast<std::uint16_t>(configuration_i));
+    }
+  }
+  std::vector<std::uint32_t> row_is(fosssweeper::GameHistory::BLOCK_SIZE);
+  forEachBlock(*this, filter, [&](std::size_t begin_i, std::size_t row_count,
+                                  const std::uint8_t *mask) {
+    const auto *const configuration_is = this->_configurationIs.data() + begin_i;
+    const auto *const wins = this->_wins.data() + begin_i;
+    const auto *const game_times = this->_gameTimes.data() + begin_i;
+    if (!pass_configuration_is.empty()) {
+      for (const auto configuration_i : pass_configuration_is) {
+        addWinTotals(mask, configuration_is, configuration_i, wins, game_times,
+                     row_count, win_totals[configuration_i]);
+      }
+      return;
+    }
+    const auto selected_count =
+        compactSelection(mask, row_count, row_is.data());
+    for (std::size_t selected_i = 0; selected_i < selected_count;
+         selected_i++) {
+      const auto row_i = row_is[selected_i];
+      auto &configuration_totals = win_totals[configuration_is[row_i]];
+      configuration_totals._gameCount++;
+      if (wins[row_i] == 0)
+        continue;
+      configuration_totals._winCount++;
+      configuration_totals._winTimeSum += game_times[row_i];
+      configuration_totals._bestTime =
+          std::min(configuration_totals._bestTime, game_times[row_i]);
+    }
+  });
+
+  std::vector<fosssweeper::ConfigurationSummary> configuration_summaries;
+  for (std::size_t configuration_i = 0; configuration_i < configuration_count;
+       configuration_i++) {
+    const auto &configuration_totals = win_totals[configuration_i];
+    if (configuration_totals._gameCount == 0)
+      continue;
+    fosssweeper::ConfigurationSummary configuration_summary;
+    configuration_summary._gameConfiguration =
+        this->_gameConfigurations[configuration_i];
+    configuration_summary._gameCount =
+        static_cast<std::size_t>(configuration_totals._gameCount);
+    configuration_summary._winCount =
+        static_cast<std::size_t>(configuration_totals._winCount);
+    configuration_summary._winTimeSum = configuration_totals._winTimeSum;
+    configuration_summary._bestTime =
+        configuration_totals._winCount == 0 ? 0
+                                            : configuration_totals._bestTime;
+    configuration_summaries.push_back(configuration_summary);
+  }
+  return configuration_summaries;
+}
+
+// the buckets start at a multiple of their length and run from the first to
+// the last selected game. Games are mostly stored in the order they finished,
+// so the counts are kept for a run of games in the same bucket and a bucket
+// is only looked up by division when the run ends.
+std::vector<fosssweeper::TrendBucket> fosssweeper::GameHistory::getWinRateTrend(
+    const fosssweeper::GameHistoryFilter &filter,
+    std::int64_t bucket_seconds) const {
+  if (bucket_seconds <= 0) {
+    throw std::runtime_error("invalid trend bucket length");
+  }
+  auto first_finished_at = std::numeric_limits<std::int64_t>::max();
+  auto last_finished_at = std::numeric_limits<std::int64_t>::min();
+  forEachBlock(*this, filter, [&](std::size_t begin_i, std::size_t row_count,
+                                  const std::uint8_t *mask) {
+    const auto *const finished_ats = this->_finishedAts.data() + begin_i;
+    for (std::size_t row_i = 0; row_i < row_count; row_i++) {
+      first_finished_at = std::min(
+          first_finished_at, mask[row_i] != 0
+                                 ? finished_ats[row_i]
+                                 : std::numeric_limits<std::int64_t>::max());
+      last_finished_at = std::max(
+          last_finished_at, mask[row_i] != 0
+                                ? finished_ats[row_i]
+                                : std::numeric_limits<std::int64_t>::min());
+    }
+  });
+  if (first_finished_at > last_finished_at)
+    return {};
+
+  auto first_bucket_i = first_finished_at / bucket_seconds;
+  if (first_finished_at % bucket_seconds < 0) {
+    first_bucket_i--;
+  }
+  const auto first_bucket_begin =
+      static_cast<std::uint64_t>(first_bucket_i * bucket_seconds);
+  const auto length = static_cast<std::uint64_t>(bucket_seconds);
+  const auto bucket_count =
+      (static_cast<std::uint64_t>(last_finished_at) - first_bucket_begin) /
+          length +
+      1;
+  if (bucket_count > fosssweeper::GameHistory::MAX_TREND_BUCKET_COUNT) {
+    throw std::runtime_error("too many trend buckets");
+  }
+  std::vector<std::uint64_t> game_counts(bucket_count, 0);
+  std::vector<std::uint64_t> win_counts(bucket_count, 0);
+  std::vector<std::uint32_t> row_is(fosssweeper::GameHistory::BLOCK_SIZE);
+  std::uint64_t run_bucket_i = 0;
+  std::uint64_t run_begin = 0;
+  std::uint64_t run_game_count = 0;
+  std::uint64_t run_win_count = 0;
+  forEachBlock(*this, filter, [&](std::size_t begin_i, std::size_t row_count,
+                                  const std::uint8_t *mask) {
+    const auto *const finished_ats = this->_finishedAts.data() + begin_i;
+    const auto *const wins = this->_wins.data() + begin_i;
+    const auto selected_count =
+        compactSelection(mask, row_count, row_is.data());
+    for (std::size_t selected_i = 0; selected_i < selected_count;
+         selected_i++) {
+      const auto row_i = row_is[selected_i];
+      const auto offset =
+          static_cast<std::uint64_t>(finished_ats[row_i]) - first_bucket_begin;
+      if (offset - run_begin >= length) {
+        game_counts[run_bucket_i] += run_game_count;
+        win_counts[run_bucket_i] += run_win_count;
+        run_bucket_i = std::min<std::uint64_t>(offset / length, bucket_count - 1);
+        run_begin = run_bucket_i * length;
+        run_game_count = 0;
+        run_win_count = 0;
+      }
+      run_game_count++;
+      run_win_count += wins[row_i] != 0 ? 1 : 0;
+    }
+  });
+  game_counts[run_bucket_i] += run_game_count;
+  win_counts[run_bucket_i] += run_win_count;
+
+  std::vector<fosssweeper::TrendBucket> trend_buckets(bucket_count);
+  for (std::size_t bucket_i = 0; bucket_i < bucket_count; bucket_i++) {
+    trend_buckets[bucket_i]._begin =
+        static_cast<std::int64_t>(first_bucket_begin + bucket_i * length);
+    trend_buckets[bucket_i]._gameCount =
+        static_cast<std::size_t>(game_counts[bucket_i]);
+    trend_buckets[bucket_i]._winCount =
+        static_cast<std::size_t>(win_counts[bucket_i]);
+  }
+  return trend_buckets;
+}
+
+// only won games have a meaningful rate, so the filter is narrowed to them; a
+// game won in no time counts as taking a millisecond
+fosssweeper::RateHistogram fosssweeper::GameHistory::getBbbvRateHistogram(
+    const fosssweeper::GameHistoryFilter &filter, double bucket_width,
+    std::size_t bucket_count) const {
+  if (!(bucket_width > 0.0) || bucket_count == 0) {
+    throw std::runtime_error("invalid rate histogram buckets");
+  }
+  fosssweeper::RateHistogram rate_histogram;
+  rate_histogram._bucketWidth = bucket_width;
+  rate_histogram._counts.assign(bucket_count, 0);
+  if (filter._wonO == false)
+    return rate_histogram;
+  auto won_filter = filter;
+  won_filter._wonO = true;
+  const auto last_bucket = static_cast<double>(bucket_count - 1);
+  std::vector<std::uint32_t> row_is(fosssweeper::GameHistory::BLOCK_SIZE);
+  forEachBlock(*this, won_filter, [&](std::size_t begin_i,
+                                      std::size_t row_count,
+                                      const std::uint8_t *mask) {
+    const auto *const bbbvs = this->_bbbvs.data() + begin_i;
+    const auto *const game_times = this->_gameTimes.data() + begin_i;
+    const auto selected_count =
+        compactSelection(mask, row_count, row_is.data());
+    for (std::size_t selected_i = 0; selected_i < selected_count;
+         selected_i++) {
+      const auto row_i = row_is[selected_i];
+      const auto rate =
+          static_cast<double>(bbbvs[row_i]) * 1000.0 /
+          static_cast<double>(std::max<std::uint32_t>(game_times[row_i], 1));
+      rate_histogram._counts[static_cast<std::size_t>(
+          std::min(rate / bucket_width, last_bucket))]++;
+      rate_histogram._rateSum += rate;
+    }
+    rate_histogram._gameCount += selected_count;
+  });
+  return rate_histogram;
+}
+
+std::size_t fosssweeper::GameHistory::getRecordCount() const noexcept {
+  return this->_recordCount;
+}
+
+const std::vector<fosssweeper::GameConfiguration> &
+fosssweeper::GameHistory::getGameConfigurations() const noexcept {
+  return this->_gameConfigurations;
+}
@@ -23,12 +23,49 @@
  */
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
+#include <fosssweeper/bomb_placement.hpp>
+#include <fosssweeper/button_planes.hpp>
 #include <fosssweeper/button_position.hpp>
 #include <fosssweeper/game_model.hpp>
+#include <fosssweeper/no_guess_generator.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <fosssweeper/replay_recorder.hpp>
+#include <fosssweeper/save_file.hpp>
+#include <fosssweeper/solver.hpp>
 #include <fosssweeper/timer.hpp>
+#include <istream>
+#include <ostream>
+#include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+fosssweeper::ButtonState getVisibleButtonState(std::uint8_t visible_code) {
+  if (visible_code == fosssweeper::Button::VISIBLE_CODE_NONE)
+    return fosssweeper::ButtonState::None;
+  if (visible_code == fosssweeper::Button::VISIBLE_CODE_FLAGGED)
+    return fosssweeper::ButtonState::Flagged;
+  if (visible_code == fosssweeper::Button::VISIBLE_CODE_QUESTIONED)
+    return fosssweeper::ButtonState::Questioned;
+  return fosssweeper::ButtonState::Down;
+}
+
+// records the changes of one public action into the change set and journal
+struct ChangeScope {
+  fosssweeper::GameModel &_gameModel;
+
+  ChangeScope(fosssweeper::GameModel &game_model) : _gameModel(game_model) {
+    this->_gameModel.beginChanges();
+  }
+  ~ChangeScope() { this->_gameModel.endChanges(); }
+};
+} // namespace
 
 fosssweeper::GameModel::GameModel(
     fosssweeper::GameConfiguration game_configuration, bool questions_enabled,
@@ -41,19 +78,13 @@ fosssweeper::GameModel::GameModel(
   if (button_string.length() != game_configuration.getButtonCount()) {
     throw std::runtime_error("invalid button string length");
   }
-  this->_buttons.reserve(game_configuration.getButtonCount());
-  for (std::size_t button_i = 0; button_i < game_configuration.getButtonCount();
-       button_i++) {
-    this->_buttons.emplace_back(button_string[button_i]);
-    const auto &button = this->_buttons.back();
-    if (button.getButtonState() == fosssweeper::ButtonState::Flagged) {
-      this->_flagCount++;
-    }
-    if (button.getButtonState() == fosssweeper::ButtonState::Down) {
-      this->_buttonsLeft--;
-    }
-  }
-  this->calculateSurroundingBombs();
+  fosssweeper::ButtonPlanes button_planes;
+  button_planes.parseButtonString(button_string);
+  button_planes.unpack(this->_buttons, game_configuration.getButtonsWide(),
+                       game_configuration.getButtonsTall());
+  this->_flagCount = button_planes.getFlagCount();
+  this->_buttonsLeft -= button_planes.getDownCount();
+  this->calculateHashes();
 }
 
 fosssweeper::Button &fosssweeper::GameModel::getButton(int x, int y) {
@@ -62,11 +93,20 @@ fosssweeper::Button &fosssweeper::GameModel::getButton(int x, int y) {
       ->_buttons[position.getIndex(this->_gameConfiguration.getButtonsWide())];
 }
 
+std::uint64_t fosssweeper::GameModel::drawGameSeed() {
+  const auto high = static_cast<std::uint64_t>(this->_rng());
+  return (high << 32) | static_cast<std::uint64_t>(this->_rng());
+}
+
 void fosssweeper::GameModel::pressButton(int x, int y) {
   auto &button = this->getButton(x, y);
   if (button.getIsPressable()) {
     if (button.getHasBomb()) {
+      const std::size_t button_i = fosssweeper::ButtonPosition(x, y).getIndex(
+          this->_gameConfiguration.getButtonsWide());
+      const auto visible_code = this->beginButtonChange(button_i);
       button.press();
+      this->endButtonChange(button_i, visible_code);
       this->_gameState = fosssweeper::GameState::Dead;
     } else {
       this->floodFillClick(x, y);
@@ -75,30 +115,38 @@ void fosssweeper::GameModel::pressButton(int x, int y) {
 }
 
 void fosssweeper::GameModel::floodFillClick(int x, int y) {
-  const fosssweeper::ButtonPosition start_position(x, y);
-  const auto buttons_wide = this->_gameConfiguration.getButtonsWide();
-  const auto buttons_tall = this->_gameConfiguration.getButtonsTall();
   this->_floodFillStack.clear();
-  this->_floodFillStack.push_back(start_position);
-  do {
+  this->_floodFillStack.emplace_back(x, y);
+  this->_pressedButtons.clear();
+  this->floodFill();
+}
+
+// presses every button on the flood fill stack and spreads from the ones
+// without surrounding bombs, so several starting buttons share one pass
+void fosssweeper::GameModel::floodFill() {
+  const auto buttons_wide = this->_gameConfiguration.getButtonsWide();
+  while (!this->_floodFillStack.empty()) {
     const auto cur_position = this->_floodFillStack.back();
     this->_floodFillStack.pop_back();
     auto &cur_button = this->getButton(cur_position.x, cur_position.y);
+    if (!cur_button.getIsPressable())
+      continue;
+    const std::size_t cur_button_i = cur_position.getIndex(buttons_wide);
+    const auto visible_code = this->beginButtonChange(cur_button_i);
     cur_button.press();
+    this->endButtonChange(cur_button_i, visible_code);
     this->_buttonsLeft--;
+    this->_pressedButtons.push_back(cur_button_i);
     if (cur_button.getSurroundingBombs() == 0) {
       this->surroundingButtonAction(
           cur_position, [&](const fosssweeper::Button &button,
                             const fosssweeper::ButtonPosition &position) {
-            if (button.getIsPressable() &&
-                std::find(this->_floodFillStack.begin(),
-                          this->_floodFillStack.end(),
-                          position) == this->_floodFillStack.end()) {
+            if (button.getIsPressable()) {
               this->_floodFillStack.push_back(position);
             }
           });
     }
-  } while (!this->_floodFillStack.empty());
+  }
 }
 
 bool fosssweeper::GameModel::choordingPossible(int x, int y) {
@@ -172,26 +220,75 @@ void fosssweeper::GameModel::surroundingButtonAction(
 
 void fosssweeper::GameModel::placeBombs(int initial_x, int initial_y) {
   const auto bomb_count = this->_gameConfiguration.getBombCount();
-  for (auto &button : this->_buttons) {
-    button.setHasBomb(false);
+  for (std::size_t button_i = 0; button_i < this->_buttons.size(); button_i++) {
+    auto &button = this->_buttons[button_i];
+    const auto visible_code = this->beginButtonChange(button_i);
     button.unpress();
+    this->endButtonChange(button_i, visible_code);
+    // an undone first click leaves the previous layout behind
+    button.setHasBomb(false);
+    button.setSurroundingBombs(0);
   }
-  std::vector<bool> bombs(this->_gameConfiguration.getButtonCount());
-  for (std::size_t button_i = 0; button_i < bomb_count; button_i++) {
-    bombs[button_i] = true;
-  }
+  this->_layoutHash = fosssweeper::getConfigurationZobristKey(
+      this->_gameConfiguration.getButtonsWide(),
+      this->_gameConfiguration.getButtonsTall());
   if (bomb_count == this->_buttons.size()) {
     for (auto &cur_button : this->_buttons) {
       cur_button.setSurroundingBombs(8);
     }
+    this->updatePersistentBoard();
     return;
   }
+  std::vector<bool> bombs;
+  if (this->_generationMode == fosssweeper::GenerationMode::NoGuess &&
+      fosssweeper::generateNoGuessBombs(this->_gameConfiguration, initial_x,
+                                        initial_y, this->_gameSeed, bombs)) {
+    for (std::size_t button_i = 0; button_i < this->_buttons.size();
+         button_i++) {
+      if (bombs[button_i]) {
+        this->placeBomb(button_i);
+      }
+    }
+  } else if (this->_generationMode != fosssweeper::GenerationMode::Classic) {
+    std::mt19937_64 rng(this->_gameSeed);
+    std::vector<std::size_t> bomb_buttons;
+    fosssweeper::placeOpeningBombs(this->_gameConfiguration, initial_x,
+                                   initial_y, rng, bomb_buttons);
+    for (const auto button_i : bomb_buttons) {
+      this->placeBomb(button_i);
+    }
+  } else {
+    this->placeClassicBombs(initial_x, initial_y, bombs);
+    for (std::size_t button_i = 0; button_i < this->_buttons.size();
+         button_i++) {
+      if (bombs[button_i]) {
+        this->placeBomb(button_i);
+      }
+    }
+  }
+  this->calculateSurroundingBombs();
+  this->updatePersistentBoard();
+}
+
+void fosssweeper::GameModel::placeBomb(std::size_t button_i) noexcept {
+  this->_buttons[button_i].setHasBomb(true);
+  this->_layoutHash ^= fosssweeper::getLayoutZobristKey(button_i);
+}
+
+void fosssweeper::GameModel::placeClassicBombs(int initial_x, int initial_y,
+                                               std::vector<bool> &bombs) {
+  const auto bomb_count = this->_gameConfiguration.getBombCount();
+  bombs.assign(this->_gameConfiguration.getButtonCount(), false);
+  for (std::size_t button_i = 0; button_i < bomb_count; button_i++) {
+    bombs[button_i] = true;
+  }
+  std::mt19937_64 rng(this->_gameSeed);
   const auto last_minable_button_i = this->_buttons.size() - 2;
-  std::uniform_int_distribution<std::mt19937::result_type> distributor(
+  std::uniform_int_distribution<std::size_t> distributor(
       0, last_minable_button_i);
   for (std::size_t button_i = 0; button_i <= last_minable_button_i;
        button_i++) {
-    const std::size_t swap_i = static_cast<std::size_t>(distributor(this->_rng));
+    const std::size_t swap_i = distributor(rng);
     // vector of bool are weird, std::swap doesn't work.
     bool temp = bombs[button_i];
     bombs[button_i] = bombs[swap_i];
@@ -204,12 +301,6 @@ void fosssweeper::GameModel::placeBombs(int initial_x, int initial_y) {
   bool temp = bombs[initial_i];
   bombs[initial_i] = bombs[swap_i];
   bombs[swap_i] = temp;
-  for (std::size_t button_i = 0; button_i < this->_buttons.size(); button_i++) {
-    if (bombs[button_i]) {
-      this->_buttons[button_i].setHasBomb(true);
-    }
-  }
-  this->calculateSurroundingBombs();
 }
 
 void fosssweeper::GameModel::calculateSurroundingBombs() {
@@ -237,40 +328,348 @@ void fosssweeper::GameModel::tryWin() noexcept {
   }
 }
 
+// the game is described by a GameBegin before its first input, so the seed
+// set up to the first click is the one that generated the bombs
+void fosssweeper::GameModel::recordReplayEvent(
+    fosssweeper::ReplayEventType event_type, std::uint64_t value) {
+  if (this->_replayRecorder == nullptr || this->_replaySkipping)
+    return;
+  if (!this->_replayGameBegun) {
+    this->_replayGameBegun = true;
+    fosssweeper::ReplayEvent game_begin;
+    game_begin._eventType = fosssweeper::ReplayEventType::GameBegin;
+    game_begin._gameConfiguration = this->_gameConfiguration;
+    game_begin._generationMode = this->_generationMode;
+    game_begin._gameSeed = this->_gameSeed;
+    game_begin._questionsEnabled = this->_questionsEnabled;
+    this->_replayRecorder->record(game_begin);
+  }
+  fosssweeper::ReplayEvent replay_event;
+  replay_event._eventType = event_type;
+  replay_event._value = value;
+  this->_replayRecorder->record(replay_event);
+}
+
+// a game is recorded as ended whenever its state becomes lost or won, which
+// can happen more than once when the end is undone; keyframes are taken after
+// the changes of an input so playback can start from them
+void fosssweeper::GameModel::recordReplayChanges() {
+  const auto previous_game_state = this->_replayGameState;
+  this->_replayGameState = this->_gameState;
+  if (this->_replayRecorder == nullptr || this->_replaySkipping ||
+      !this->_replayGameBegun)
+    return;
+  if (this->_gameState != previous_game_state &&
+      (this->_gameState == fosssweeper::GameState::Dead ||
+       this->_gameState == fosssweeper::GameState::Cool)) {
+    fosssweeper::ReplayEvent game_end;
+    game_end._eventType = fosssweeper::ReplayEventType::GameEnd;
+    game_end._value = static_cast<std::uint64_t>(this->_gameState);
+    game_end._visibleHash = this->_visibleHash;
+    game_end._gameTime = this->_gameTime;
+    this->_replayRecorder->record(game_end);
+  }
+  if (this->_replayRecorder->getKeyframeDue()) {
+    this->_replayRecorder->recordKeyframe(*this);
+  }
+}
+
+void fosssweeper::GameModel::toggleVisibleHash(std::size_t button_i) noexcept {
+  this->_visibleHash ^= fosssweeper::getVisibleZobristKey(
+      button_i, this->_buttons[button_i].getVisibleCode());
+}
+
+std::uint8_t
+fosssweeper::GameModel::beginButtonChange(std::size_t button_i) noexcept {
+  this->toggleVisibleHash(button_i);
+  return this->_buttons[button_i].getVisibleCode();
+}
+
+void fosssweeper::GameModel::endButtonChange(std::size_t button_i,
+                                             std::uint8_t visible_code) {
+  this->toggleVisibleHash(button_i);
+  if (this->_buttons[button_i].getVisibleCode() == visible_code)
+    return;
+  this->updatePersistentButton(button_i);
+  if (this->_changeSetEnabled) {
+    this->_changeSet.addButton(button_i);
+  }
+  if (this->_journalEnabled) {
+    this->_journal.recordButton(button_i, getVisibleButtonState(visible_code),
+                                this->_buttons[button_i].getButtonState());
+  }
+}
+
+void fosssweeper::GameModel::beginChanges() {
+  if (this->_changeSetEnabled) {
+    this->_changeSet.begin(this->_gameState, this->_flagCount);
+  }
+  if (this->_journalEnabled) {
+    this->_journal.begin(this->getJournalCounters());
+  }
+}
+
+void fosssweeper::GameModel::endChanges() {
+  if (this->_changeSetEnabled) {
+    this->_changeSet.end(this->_gameState, this->_flagCount);
+  }
+  if (this->_journalEnabled) {
+    this->_journal.end(this->getJournalCounters());
+  }
+  this->recordReplayChanges();
+}
+
+fosssweeper::Journal::Counters
+fosssweeper::GameModel::getJournalCounters() const noexcept {
+  return {this->_flagCount, this->_buttonsLeft, this->_gameState};
+}
+
+// flags placed before the first click and a first click that was undone
+// leave the board dirty while no game is running
+bool fosssweeper::GameModel::getIsBoardClean() const noexcept {
+  return this->_gameState == fosssweeper::GameState::None &&
+         this->_visibleHash == 0 &&
+         this->_layoutHash == fosssweeper::getConfigurationZobristKey(
+                                  this->_gameConfiguration.getButtonsWide(),
+                                  this->_gameConfiguration.getButtonsTall());
+}
+
+void fosssweeper::GameModel::restoreButton(std::size_t button_i,
+                                           std::uint8_t button_state) {
+  this->toggleVisibleHash(button_i);
+  const auto visible_code = this->_buttons[button_i].getVisibleCode();
+  this->_buttons[button_i].setButtonState(
+      static_cast<fosssweeper::ButtonState>(button_state));
+  this->toggleVisibleHash(button_i);
+  this->updatePersistentButton(button_i);
+  if (this->_changeSetEnabled &&
+      this->_buttons[button_i].getVisibleCode() != visible_code) {
+    this->_changeSet.addButton(button_i);
+  }
+}
+
+void fosssweeper::GameModel::updatePersistentBoard() {
+  if (this->_persistentBoardEnabled) {
+    this->_persistentBoard.assign(this->_buttons);
+  }
+}
+
+void fosssweeper::GameModel::updatePersistentButton(std::size_t button_i) {
+  if (this->_persistentBoardEnabled) {
+    this->_persistentBoard.setButton(button_i, this->_buttons[button_i]);
+  }
+}
+
+void fosssweeper::GameModel::restoreCounters(
+    const fosssweeper::Journal::Counters &counters) noexcept {
+  this->_flagCount = counters._flagCount;
+  this->_buttonsLeft = counters._buttonsLeft;
+  this->_gameState = counters._gameState;
+}
+
+void fosssweeper::GameModel::calculateHashes() noexcept {
+  this->_layoutHash = fosssweeper::getConfigurationZobristKey(
+      this->_gameConfiguration.getButtonsWide(),
+      this->_gameConfiguration.getButtonsTall());
+  this->_visibleHash = 0;
+  for (std::size_t button_i = 0; button_i < this->_buttons.size(); button_i++) {
+    const auto &button = this->_buttons[button_i];
+    if (button.getHasBomb()) {
+      this->_layoutHash ^= fosssweeper::getLayoutZobristKey(button_i);
+    }
+    this->toggleVisibleHash(button_i);
+  }
+}
+
 void fosssweeper::GameModel::newGame() {
-  if (this->_gameState != fosssweeper::GameState::None) {
+  const ChangeScope change_scope(*this);
+  this->_replayGameBegun = false;
+  this->_replaySkipping = false;
+  if (!this->getIsBoardClean()) {
+    if (this->_changeSetEnabled) {
+      for (std::size_t button_i = 0; button_i < this->_buttons.size();
+           button_i++) {
+        if (this->_buttons[button_i].getVisibleCode() !=
+            fosssweeper::Button::VISIBLE_CODE_NONE) {
+          this->_changeSet.addButton(button_i);
+        }
+      }
+    }
     std::fill(this->_buttons.begin(), this->_buttons.end(),
               fosssweeper::Button());
+    this->_layoutHash = fosssweeper::getConfigurationZobristKey(
+        this->_gameConfiguration.getButtonsWide(),
+        this->_gameConfiguration.getButtonsTall());
+    this->_visibleHash = 0;
+    this->updatePersistentBoard();
   }
+  this->_journal.clear();
   this->_gameTime = 0;
+  this->_clickCount = 0;
   this->_gameState = fosssweeper::GameState::None;
   this->_flagCount = 0;
   this->_buttonsLeft = this->_gameConfiguration.getButtonCount() -
                        this->_gameConfiguration.getBombCount();
+  this->_gameSeed = this->drawGameSeed();
 }
 
 void fosssweeper::GameModel::newGame(
     fosssweeper::GameConfiguration game_configuration) {
   if (this->_gameConfiguration != game_configuration) {
+    const ChangeScope change_scope(*this);
     const std::size_t button_count = game_configuration.getButtonCount();
     this->_gameConfiguration = game_configuration;
     this->_buttons.clear();
     this->_buttons.resize(button_count);
     this->_floodFillStack.reserve(button_count);
+    if (this->_changeSetEnabled) {
+      this->_changeSet.reset(button_count);
+      this->_changeSet.addAllButtons();
+    }
+    this->_journal.clear();
+    this->_replayGameBegun = false;
+    this->_replaySkipping = false;
+    this->updatePersistentBoard();
+    this->_layoutHash = fosssweeper::getConfigurationZobristKey(
+        this->_gameConfiguration.getButtonsWide(),
+        this->_gameConfiguration.getButtonsTall());
+    this->_visibleHash = 0;
     this->_gameTime = 0;
+    this->_clickCount = 0;
     this->_gameState = fosssweeper::GameState::None;
     this->_flagCount = 0;
     this->_buttonsLeft = this->_gameConfiguration.getButtonCount() -
                          this->_gameConfiguration.getBombCount();
+    this->_gameSeed = this->drawGameSeed();
   } else {
     this->newGame();
   }
 }
 
+// starts a game on a bomb layout stored one bit per button, as in a board
+// corpus; the game is running already, so the first click is not kept safe
+void fosssweeper::GameModel::newGame(
+    fosssweeper::GameConfiguration game_configuration,
+    std::span<const unsigned char> bomb_bitmap) {
+  const auto button_count =
+      static_cast<std::size_t>(game_configuration.getButtonCount());
+  if (bomb_bitmap.size() != (button_count + 7) / 8 ||
+      (button_count % 8 != 0 && (bomb_bitmap.back() >> (button_count % 8)))) {
+    throw std::runtime_error("invalid bomb bitmap size");
+  }
+  int bomb_count = 0;
+  for (const auto byte : bomb_bitmap) {
+    bomb_count += std::popcount(byte);
+  }
+  if (bomb_count != game_configuration.getBombCount()) {
+    throw std::runtime_error("invalid bomb bitmap bomb count");
+  }
+  this->newGame(game_configuration);
+  {
+    const ChangeScope change_scope(*this);
+    for (std::size_t button_i = 0; button_i < button_count; button_i++) {
+      if ((bomb_bitmap[button_i / 8] >> (button_i % 8)) & 1) {
+        this->placeBomb(button_i);
+      }
+    }
+    this->calculateSurroundingBombs();
+    this->updatePersistentBoard();
+    this->_gameState = fosssweeper::GameState::Playing;
+    // the game can not be generated from its seed, so it is not recorded
+    this->_replaySkipping = true;
+  }
+  this->_journal.clear();
+}
+
 void fosssweeper::GameModel::clickButton(int x, int y) {
+  const ChangeScope change_scope(*this);
+  this->recordReplayEvent(fosssweeper::ReplayEventType::Click,
+                          fosssweeper::ButtonPosition(x, y).getIndex(
+                              this->_gameConfiguration.getButtonsWide()));
   if (this->_gameState != fosssweeper::GameState::Playing &&
       this->_gameState != fosssweeper::GameState::None)
     return;
+  this->applyClick(x, y);
+  this->tryWin();
+}
+
+void fosssweeper::GameModel::altClickButton(int x, int y) {
+  const ChangeScope change_scope(*this);
+  this->recordReplayEvent(fosssweeper::ReplayEventType::AltClick,
+                          fosssweeper::ButtonPosition(x, y).getIndex(
+                              this->_gameConfiguration.getButtonsWide()));
+  if (this->_gameState == fosssweeper::GameState::Dead ||
+      this->_gameState == fosssweeper::GameState::Cool)
+    return;
+  this->applyAltClick(x, y);
+}
+
+void fosssweeper::GameModel::areaClickButton(int x, int y) {
+  const ChangeScope change_scope(*this);
+  this->recordReplayEvent(fosssweeper::ReplayEventType::AreaClick,
+                          fosssweeper::ButtonPosition(x, y).getIndex(
+                              this->_gameConfiguration.getButtonsWide()));
+  if (this->_gameState == fosssweeper::GameState::Dead ||
+      this->_gameState == fosssweeper::GameState::Cool)
+    return;
+  this->applyAreaClick(x, y);
+  this->tryWin();
+}
+
+// applies actions until the game is lost or won; actions that are not
+// reached are reported as skipped
+std::size_t
+fosssweeper::GameModel::applyActions(std::span<const fosssweeper::Action> actions,
+                                     std::span<fosssweeper::ActionResult> results) {
+  if (results.size() < actions.size()) {
+    throw std::runtime_error("action result buffer too small");
+  }
+  const ChangeScope change_scope(*this);
+  const auto buttons_wide = this->_gameConfiguration.getButtonsWide();
+  const auto buttons_tall = this->_gameConfiguration.getButtonsTall();
+  std::size_t action_i = 0;
+  for (; action_i < actions.size(); action_i++) {
+    if (this->_gameState == fosssweeper::GameState::Dead ||
+        this->_gameState == fosssweeper::GameState::Cool ||
+        (this->_gameState == fosssweeper::GameState::Playing &&
+         this->_buttonsLeft <= 0))
+      break;
+    const auto &action = actions[action_i];
+    const auto &position = action._buttonPosition;
+    if (position.x < 0 || position.y < 0 || position.x >= buttons_wide ||
+        position.y >= buttons_tall) {
+      results[action_i] = fosssweeper::ActionResult::Ignored;
+      continue;
+    }
+    const auto visible_hash = this->_visibleHash;
+    const auto button_i = position.getIndex(buttons_wide);
+    switch (action._actionType) {
+    case fosssweeper::ActionType::Click:
+      this->recordReplayEvent(fosssweeper::ReplayEventType::Click, button_i);
+      this->applyClick(position.x, position.y);
+      break;
+    case fosssweeper::ActionType::AltClick:
+      this->recordReplayEvent(fosssweeper::ReplayEventType::AltClick, button_i);
+      this->applyAltClick(position.x, position.y);
+      break;
+    case fosssweeper::ActionType::AreaClick:
+      this->recordReplayEvent(fosssweeper::ReplayEventType::AreaClick,
+                              button_i);
+      this->applyAreaClick(position.x, position.y);
+      break;
+    }
+    results[action_i] = this->_visibleHash != visible_hash
+                            ? fosssweeper::ActionResult::Applied
+                            : fosssweeper::ActionResult::Ignored;
+  }
+  std::fill(results.begin() + action_i, results.begin() + actions.size(),
+            fosssweeper::ActionResult::Skipped);
+  this->tryWin();
+  return action_i;
+}
+
+void fosssweeper::GameModel::applyClick(int x, int y) {
+  this->_clickCount++;
   const auto &button = this->getButton(x, y);
   if (button.getButtonState() == fosssweeper::ButtonState::Flagged)
     return;
@@ -283,27 +682,26 @@ void fosssweeper::GameModel::clickButton(int x, int y) {
       this->_gameConfiguration.getButtonCount()) {
     this->_gameState = fosssweeper::GameState::Dead;
   }
-  this->tryWin();
 }
 
-void fosssweeper::GameModel::altClickButton(int x, int y) {
-  if (this->_gameState == fosssweeper::GameState::Dead ||
-      this->_gameState == fosssweeper::GameState::Cool)
-    return;
+void fosssweeper::GameModel::applyAltClick(int x, int y) {
+  this->_clickCount++;
   auto &button = this->getButton(x, y);
+  const std::size_t button_i = fosssweeper::ButtonPosition(x, y).getIndex(
+      this->_gameConfiguration.getButtonsWide());
   if (button.getButtonState() == fosssweeper::ButtonState::Flagged) {
     this->_flagCount--;
   }
+  const auto visible_code = this->beginButtonChange(button_i);
   button.altPress(this->_questionsEnabled);
+  this->endButtonChange(button_i, visible_code);
   if (button.getButtonState() == fosssweeper::ButtonState::Flagged) {
     this->_flagCount++;
   }
 }
 
-void fosssweeper::GameModel::areaClickButton(int x, int y) {
-  if (this->_gameState == fosssweeper::GameState::Dead ||
-      this->_gameState == fosssweeper::GameState::Cool)
-    return;
+void fosssweeper::GameModel::applyAreaClick(int x, int y) {
+  this->_clickCount++;
   if (!this->choordingPossible(x, y))
     return;
   const auto buttons_wide = this->_gameConfiguration.getButtonsWide();
@@ -320,20 +718,98 @@ void fosssweeper::GameModel::areaClickButton(int x, int y) {
           this->pressButton(position.x, position.y);
         }
       });
+}
+
+// flags every certain bomb and presses every certain safe button until the
+// solver runs out of deductions, returning the indices of changed buttons
+std::vector<std::size_t> fosssweeper::GameModel::applyCertainMoves() {
+  const ChangeScope change_scope(*this);
+  this->recordReplayEvent(fosssweeper::ReplayEventType::CertainMoves, 0);
+  std::vector<std::size_t> changed_buttons;
+  if (this->_gameState != fosssweeper::GameState::Playing)
+    return changed_buttons;
+  const auto buttons_wide = this->_gameConfiguration.getButtonsWide();
+  fosssweeper::Solver solver;
+  solver.load(*this);
+  std::vector<std::size_t> safe_buttons;
+  std::vector<std::size_t> bomb_buttons;
+  while (solver.findCertainButtons(safe_buttons, bomb_buttons)) {
+    for (const auto button_i : bomb_buttons) {
+      solver.markBomb(button_i);
+      auto &button = this->_buttons[button_i];
+      if (button.getButtonState() == fosssweeper::ButtonState::Flagged)
+        continue;
+      const auto visible_code = this->beginButtonChange(button_i);
+      button.setButtonState(fosssweeper::ButtonState::Flagged);
+      this->endButtonChange(button_i, visible_code);
+      this->_flagCount++;
+      changed_buttons.push_back(button_i);
+    }
+    this->_floodFillStack.clear();
+    for (const auto button_i : safe_buttons) {
+      auto &button = this->_buttons[button_i];
+      if (button.getButtonState() == fosssweeper::ButtonState::Flagged) {
+        // the solver ignores player flags, so a flag here is a mistake
+        const auto visible_code = this->beginButtonChange(button_i);
+        button.setButtonState(fosssweeper::ButtonState::None);
+        this->endButtonChange(button_i, visible_code);
+        this->_flagCount--;
+      }
+      this->_floodFillStack.emplace_back(
+          static_cast<int>(button_i % buttons_wide),
+          static_cast<int>(button_i / buttons_wide));
+    }
+    this->_pressedButtons.clear();
+    this->floodFill();
+    for (const auto button_i : this->_pressedButtons) {
+      solver.reveal(button_i, this->_buttons[button_i].getSurroundingBombs());
+      changed_buttons.push_back(button_i);
+    }
+  }
   this->tryWin();
+  return changed_buttons;
 }
 
 void fosssweeper::GameModel::setQuestionsEnabled(bool questions_enabled) {
+  const ChangeScope change_scope(*this);
   if (this->_questionsEnabled == questions_enabled)
     return;
+  this->recordReplayEvent(fosssweeper::ReplayEventType::QuestionsEnabled,
+                          questions_enabled ? 1 : 0);
   if (!questions_enabled) {
-    for (auto &button : this->_buttons) {
-      button.removeQuestion();
+    for (std::size_t button_i = 0; button_i < this->_buttons.size();
+         button_i++) {
+      auto &button = this->_buttons[button_i];
+      if (button.getButtonState() == fosssweeper::ButtonState::Questioned) {
+        const auto visible_code = this->beginButtonChange(button_i);
+        button.removeQuestion();
+        this->endButtonChange(button_i, visible_code);
+      }
     }
+    // undoing would bring back questions that can no longer be placed
+    this->_journal.clear();
   }
   this->_questionsEnabled = questions_enabled;
 }
 
+void fosssweeper::GameModel::setGenerationMode(
+    fosssweeper::GenerationMode generation_mode) {
+  this->_generationMode = generation_mode;
+}
+
+fosssweeper::GenerationMode
+fosssweeper::GameModel::getGenerationMode() const noexcept {
+  return this->_generationMode;
+}
+
+void fosssweeper::GameModel::setGameSeed(std::uint64_t game_seed) noexcept {
+  this->_gameSeed = game_seed;
+}
+
+std::uint64_t fosssweeper::GameModel::getGameSeed() const noexcept {
+  return this->_gameSeed;
+}
+
 bool fosssweeper::GameModel::getQuestionsEnabled() const noexcept {
   return this->_questionsEnabled;
 }
@@ -371,6 +847,10 @@ unsigned long fosssweeper::GameModel::getGameTime() const noexcept {
 
 const unsigned long MILLISECONDS_PER_SECOND = 1000;
 
+int fosssweeper::GameModel::getClickCount() const noexcept {
+  return this->_clickCount;
+}
+
 unsigned long fosssweeper::GameModel::getTimerSeconds() const noexcept {
   return this->_gameTime / MILLISECONDS_PER_SECOND;
 }
@@ -385,4 +865,182 @@ const fosssweeper::Button &fosssweeper::GameModel::getButton(int x,
 const std::vector<fosssweeper::Button> &
 fosssweeper::GameModel::getButtons() const noexcept {
   return this->_buttons;
-}
\ No newline at end of file
+}
+
+std::uint64_t fosssweeper::GameModel::getLayoutHash() const noexcept {
+  return this->_layoutHash;
+}
+
+std::uint64_t fosssweeper::GameModel::getVisibleHash() const noexcept {
+  return this->_visibleHash;
+}
+
+void fosssweeper::GameModel::setChangeSetEnabled(bool change_set_enabled) {
+  if (change_set_enabled && !this->_changeSetEnabled) {
+    this->_changeSet.reset(this->_buttons.size());
+  }
+  this->_changeSetEnabled = change_set_enabled;
+}
+
+bool fosssweeper::GameModel::getChangeSetEnabled() const noexcept {
+  return this->_changeSetEnabled;
+}
+
+const fosssweeper::ChangeSet &
+fosssweeper::GameModel::getChangeSet() const noexcept {
+  return this->_changeSet;
+}
+
+void fosssweeper::GameModel::setJournalEnabled(bool journal_enabled) {
+  this->_journal.clear();
+  this->_journalEnabled = journal_enabled;
+}
+
+bool fosssweeper::GameModel::getJournalEnabled() const noexcept {
+  return this->_journalEnabled;
+}
+
+const fosssweeper::Journal &fosssweeper::GameModel::getJournal() const noexcept {
+  return this->_journal;
+}
+
+// an undone first click keeps its bomb layout, so redoing it is exact while
+// clicking somewhere else places the bombs again
+bool fosssweeper::GameModel::undo() {
+  this->recordReplayEvent(fosssweeper::ReplayEventType::Undo, 0);
+  const auto *const entry = this->_journal.undo();
+  if (entry == nullptr)
+    return false;
+  if (this->_changeSetEnabled) {
+    this->_changeSet.begin(this->_gameState, this->_flagCount);
+  }
+  for (auto run_i = entry->_runBegin; run_i < entry->_runEnd; run_i++) {
+    const auto &run = this->_journal._runs[run_i];
+    for (std::size_t button_i = run._beginI;
+         button_i < run._beginI + run._length; button_i++) {
+      this->restoreButton(button_i, static_cast<std::uint8_t>(
+                                        fosssweeper::ButtonState::None));
+    }
+  }
+  for (auto journal_button_i = entry->_buttonEnd;
+       journal_button_i > entry->_buttonBegin; journal_button_i--) {
+    const auto &button = this->_journal._buttons[journal_button_i - 1];
+    this->restoreButton(button._buttonI, button._previousState);
+  }
+  this->restoreCounters(entry->_previousCounters);
+  if (this->_changeSetEnabled) {
+    this->_changeSet.end(this->_gameState, this->_flagCount);
+  }
+  this->recordReplayChanges();
+  return true;
+}
+
+bool fosssweeper::GameModel::redo() {
+  this->recordReplayEvent(fosssweeper::ReplayEventType::Redo, 0);
+  const auto *const entry = this->_journal.redo();
+  if (entry == nullptr)
+    return false;
+  if (this->_changeSetEnabled) {
+    this->_changeSet.begin(this->_gameState, this->_flagCount);
+  }
+  for (auto journal_button_i = entry->_buttonBegin;
+       journal_button_i < entry->_buttonEnd; journal_button_i++) {
+    const auto &button = this->_journal._buttons[journal_button_i];
+    this->restoreButton(button._buttonI, button._newState);
+  }
+  for (auto run_i = entry->_runBegin; run_i < entry->_runEnd; run_i++) {
+    const auto &run = this->_journal._runs[run_i];
+    for (std::size_t button_i = run._beginI;
+         button_i < run._beginI + run._length; button_i++) {
+      this->restoreButton(button_i, static_cast<std::uint8_t>(
+                                        fosssweeper::ButtonState::Down));
+    }
+  }
+  this->restoreCounters(entry->_newCounters);
+  if (this->_changeSetEnabled) {
+    this->_changeSet.end(this->_gameState, this->_flagCount);
+  }
+  this->recordReplayChanges();
+  return true;
+}
+
+// the first snapshot copies the board once, after that the board is kept
+// as a persistent board and a snapshot only shares it
+fosssweeper::BoardSnapshot fosssweeper::GameModel::snapshot() {
+  if (!this->_persistentBoardEnabled) {
+    this->_persistentBoardEnabled = true;
+    this->updatePersistentBoard();
+  }
+  fosssweeper::BoardSnapshot board_snapshot;
+  board_snapshot._gameConfiguration = this->_gameConfiguration;
+  board_snapshot._gameState = this->_gameState;
+  board_snapshot._flagCount = this->_flagCount;
+  board_snapshot._buttonsLeft = this->_buttonsLeft;
+  board_snapshot._visibleHash = this->_visibleHash;
+  board_snapshot._persistentBoard = this->_persistentBoard;
+  return board_snapshot;
+}
+
+fosssweeper::SaveFile::Header fosssweeper::GameModel::getSaveHeader() const {
+  fosssweeper::SaveFile::Header header;
+  header._gameConfiguration = this->_gameConfiguration;
+  header._gameState = this->_gameState;
+  header._generationMode = this->_generationMode;
+  header._questionsEnabled = this->_questionsEnabled;
+  header._gameTime = this->_gameTime;
+  header._gameSeed = this->_gameSeed;
+  header._flagCount = this->_flagCount;
+  header._buttonsLeft = this->_buttonsLeft;
+  header._layoutHash = this->_layoutHash;
+  header._clickCount = this->_clickCount;
+  return header;
+}
+
+void fosssweeper::GameModel::save(std::ostream &stream) const {
+  fosssweeper::SaveFile::write(stream, this->getSaveHeader(), this->_buttons);
+}
+
+// the save is read completely before the model is touched, so a failed load
+// leaves the current game as it was
+void fosssweeper::GameModel::load(std::istream &stream) {
+  std::vector<fosssweeper::Button> buttons;
+  const auto header = fosssweeper::SaveFile::read(stream, buttons);
+  const ChangeScope change_scope(*this);
+  const std::size_t button_count = buttons.size();
+  this->_gameConfiguration = header._gameConfiguration;
+  this->_buttons = std::move(buttons);
+  this->_floodFillStack.reserve(button_count);
+  if (this->_changeSetEnabled) {
+    this->_changeSet.reset(button_count);
+    this->_changeSet.addAllButtons();
+  }
+  this->_journal.clear();
+  // a loaded game in progress can not be generated from its seed again, so
+  // its inputs are only recorded from the next new game on
+  this->_replayGameBegun = false;
+  this->_replaySkipping = header._gameState != fosssweeper::GameState::None;
+  this->updatePersistentBoard();
+  this->_gameState = header._gameState;
+  this->_generationMode = header._generationMode;
+  this->_questionsEnabled = header._questionsEnabled;
+  this->_gameTime = static_cast<unsigned long>(header._gameTime);
+  this->_clickCount = header._clickCount;
+  this->_gameSeed = header._gameSeed;
+  this->_flagCount = header._flagCount;
+  this->_buttonsLeft = header._buttonsLeft;
+  this->calculateHashes();
+}
+
+// a recorder attached to a game in progress starts with the next new game
+void fosssweeper::GameModel::setReplayRecorder(
+    fosssweeper::ReplayRecorder *replay_recorder) noexcept {
+  this->_replayRecorder = replay_recorder;
+  this->_replayGameBegun = false;
+  this->_replaySkipping = this->_gameState != fosssweeper::GameState::None;
+  this->_replayGameState = this->_gameState;
+}
+
+fosssweeper::ReplayRecorder *
+fosssweeper::GameModel::getReplayRecorder() const noexcept {
+  return this->_replayRecorder;
+}
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/board_metrics.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_record.hpp>
+#include <fosssweeper/save_file.hpp>
+#include <fosssweeper/zobrist.hpp>
+#include <span>
+#include <stdexcept>
+
+const std::size_t fosssweeper::GameRecord::SIZE = 64;
+
+namespace {
+const std::size_t CHECKSUM_OFFSET = 56;
+
+void writeInteger(std::span<unsigned char> bytes, std::size_t offset,
+                  std::uint64_t value, std::size_t size) noexcept {
+  for (std::size_t byte_i = 0; byte_i < size; byte_i++) {
+    bytes[offset + byte_i] =
+        static_cast<unsigned char>((value >> (byte_i * 8)) & 0xff);
+  }
+}
+
+std::uint64_t readInteger(std::span<const unsigned char> bytes,
+                          std::size_t offset, std::size_t size) noexcept {
+  std::uint64_t value = 0;
+  for (std::size_t byte_i = 0; byte_i < size; byte_i++) {
+    value |= static_cast<std::uint64_t>(bytes[offset + byte_i]) << (byte_i * 8);
+  }
+  return value;
+}
+
+std::uint64_t getChecksum(std::span<const unsigned char> bytes) noexcept {
+  std::uint64_t checksum = 0;
+  for (std::size_t offset = 0; offset < CHECKSUM_OFFSET; offset += 8) {
+    checksum = fosssweeper::mixZobristKey(checksum ^
+                                          readInteger(bytes, offset, 8));
+  }
+  return checksum;
+}
+} // namespace
+
+fosssweeper::GameRecord
+fosssweeper::GameRecord::fromGameModel(const fosssweeper::GameModel &game_model,
+                                       std::int64_t finished_at) {
+  fosssweeper::GameRecord game_record;
+  game_record._gameConfiguration = game_model.getGameConfiguration();
+  game_record._generationMode = game_model.getGenerationMode();
+  game_record._gameState = game_model.getGameState();
+  game_record._gameTime = game_model.getGameTime();
+  game_record._gameSeed = game_model.getGameSeed();
+  game_record._finishedAt = finished_at;
+  game_record._bbbv =
+      fosssweeper::BoardMetrics::measure(game_model.getGameConfiguration(),
+                                         game_model.getButtons())
+          ._bbbv;
+  game_record._clickCount = game_model.getClickCount();
+  return game_record;
+}
+
+bool fosssweeper::GameRecord::tryDecode(std::span<const unsigned char> bytes,
+                                        fosssweeper::GameRecord &game_record) {
+  if (bytes.size() < fosssweeper::GameRecord::SIZE ||
+      readInteger(bytes, CHECKSUM_OFFSET, 8) != getChecksum(bytes))
+    return false;
+  const auto buttons_wide = readInteger(bytes, 0, 4);
+  const auto buttons_tall = readInteger(bytes, 4, 4);
+  const auto bomb_count = readInteger(bytes, 8, 4);
+  const auto game_state = readInteger(bytes, 12, 1);
+  const auto generation_mode = readInteger(bytes, 13, 1);
+  if (buttons_wide * buttons_tall > fosssweeper::SaveFile::MAX_BUTTON_COUNT ||
+      bomb_count > buttons_wide * buttons_tall ||
+      (game_state != static_cast<std::uint64_t>(fosssweeper::GameState::Dead) &&
+       game_state != static_cast<std::uint64_t>(fosssweeper::GameState::Cool)) ||
+      generation_mode >
+          static_cast<std::uint64_t>(fosssweeper::GenerationMode::NoGuess))
+    return false;
+  game_record._gameConfiguration = fosssweeper::GameConfiguration(
+      static_cast<int>(buttons_wide), static_cast<int>(buttons_tall),
+      static_cast<int>(bomb_count));
+  game_record._generationMode =
+      static_cast<fosssweeper::GenerationMode>(generation_mode);
+  game_record._gameState = static_cast<fosssweeper::GameState>(game_state);
+  game_record._gameTime = readInteger(bytes, 16, 8);
+  game_record._gameSeed = readInteger(bytes, 24, 8);
+  game_record._finishedAt = static_cast<std::int64_t>(readInteger(bytes, 32, 8));
+  game_record._bbbv = static_cast<int>(readInteger(bytes, 40, 4));
+  game_record._clickCount = static_cast<int>(readInteger(bytes, 44, 4));
+  return true;
+}
+
+void fosssweeper::GameRecord::encode(std::span<unsigned char> bytes) const {
+  if (bytes.size() < fosssweeper::GameRecord::SIZE) {
+    throw std::runtime_error("game record buffer too small");
+  }
+  std::fill(bytes.begin(), bytes.begin() + fosssweeper::GameRecord::SIZE, 0);
+  writeInteger(bytes, 0,
+               static_cast<std::uint64_t>(
+                   this->_gameConfiguration.getButtonsWide()),
+               4);
+  writeInteger(bytes, 4,
+               static_cast<std::uint64_t>(
+                   this->_gameConfiguration.getButtonsTall()),
+               4);
+  writeInteger(bytes, 8,
+               static_cast<std::uint64_t>(this->_gameConfiguration.getBombCount()),
+               4);
+  writeInteger(bytes, 12, static_cast<std::uint64_t>(this->_gameState), 1);
+  writeInteger(bytes, 13, static_cast<std::uint64_t>(this->_generationMode), 1);
+  writeInteger(bytes, 16, this->_gameTime, 8);
+  writeInteger(bytes, 24, this->_gameSeed, 8);
+  writeInteger(bytes, 32, static_cast<std::uint64_t>(this->_finishedAt), 8);
+  writeInteger(bytes, 40, static_cast<std::uint32_t>(this->_bbbv), 4);
+  writeInteger(bytes, 44, static_cast<std::uint32_t>(this->_clickCount), 4);
+  writeInteger(bytes, CHECKSUM_OFFSET, getChecksum(bytes), 8);
+}
+
+bool fosssweeper::GameRecord::getIsWon() const noexcept {
+  return this->_gameState == fosssweeper::GameState::Cool;
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/hint_service.hpp>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+void fosssweeper::HintService::run() {
+  while (true) {
+    std::optional<fosssweeper::BoardSnapshot> board_snapshot_o;
+    std::uint64_t generation = 0;
+    {
+      std::unique_lock<std::mutex> lock(this->_mutex);
+      this->_condition.wait(lock, [&]() {
+        return this->_stopping || this->_pendingSnapshotO.has_value();
+      });
+      if (this->_stopping)
+        return;
+      board_snapshot_o = std::move(this->_pendingSnapshotO);
+      this->_pendingSnapshotO = std::nullopt;
+      generation = this->_pendingGeneration;
+    }
+    if (!this->getIsCurrent(generation))
+      continue;
+    fosssweeper::Solver solver;
+    solver.load(board_snapshot_o.value());
+    fosssweeper::Hint hint;
+    hint._generation = generation;
+    hint._safeButtonO = this->findSafeButton(solver, generation);
+    if (this->getIsCurrent(generation)) {
+      this->_onHint(hint);
+    }
+  }
+}
+
+std::optional<fosssweeper::ButtonPosition>
+fosssweeper::HintService::findSafeButton(fosssweeper::Solver &solver,
+                                         std::uint64_t generation) const {
+  const int buttons_wide = solver.getGameConfiguration().getButtonsWide();
+  std::vector<std::size_t> safe_buttons;
+  std::vector<std::size_t> bomb_buttons;
+  while (this->getIsCurrent(generation) &&
+         solver.findCertainButtons(safe_buttons, bomb_buttons)) {
+    if (!safe_buttons.empty()) {
+      const auto button_i = static_cast<int>(safe_buttons.front());
+      return fosssweeper::ButtonPosition(button_i % buttons_wide,
+                                         button_i / buttons_wide);
+    }
+    for (const auto button_i : bomb_buttons) {
+      solver.markBomb(button_i);
+    }
+  }
+  return std::nullopt;
+}
+
+fosssweeper::HintService::HintService(
+    std::function<void(const fosssweeper::Hint &)> on_hint)
+    : _onHint(std::move(on_hint)), _thread([this]() { this->run(); }) {}
+
+fosssweeper::HintService::~HintService() {
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    this->_stopping = true;
+  }
+  this->cancel();
+  this->_condition.notify_one();
+  this->_thread.join();
+}
+
+std::uint64_t
+fosssweeper::HintService::request(fosssweeper::GameModel &game_model) {
+  auto board_snapshot = game_model.snapshot();
+  const std::uint64_t generation = ++this->_generation;
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    this->_pendingSnapshotO = std::move(board_snapshot);
+    this->_pendingGeneration = generation;
+  }
+  this->_condition.notify_one();
+  return generation;
+}
+
+void fosssweeper::HintService::cancel() noexcept { this->_generation++; }
+
+bool fosssweeper::HintService::getIsCurrent(
+    std::uint64_t generation) const noexcept {
+  return this->_generation.load() == generation;
+}
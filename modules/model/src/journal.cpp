@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button_state.hpp>
+#include <fosssweeper/journal.hpp>
+#include <vector>
+
+void fosssweeper::Journal::clear() noexcept {
+  this->_entries.clear();
+  this->_buttons.clear();
+  this->_runs.clear();
+  this->_pressedButtons.clear();
+  this->_position = 0;
+  this->_actionButtonBegin = 0;
+  this->_recording = false;
+}
+
+void fosssweeper::Journal::begin(
+    const fosssweeper::Journal::Counters &counters) {
+  this->_actionButtonBegin = this->_buttons.size();
+  this->_pressedButtons.clear();
+  this->_previousCounters = counters;
+  this->_recording = true;
+}
+
+void fosssweeper::Journal::recordButton(
+    std::size_t button_i, fosssweeper::ButtonState previous_state,
+    fosssweeper::ButtonState new_state) {
+  if (previous_state == fosssweeper::ButtonState::None &&
+      new_state == fosssweeper::ButtonState::Down) {
+    this->_pressedButtons.push_back(static_cast<std::uint32_t>(button_i));
+    return;
+  }
+  this->_buttons.push_back({static_cast<std::uint32_t>(button_i),
+                            static_cast<std::uint8_t>(previous_state),
+                            static_cast<std::uint8_t>(new_state)});
+}
+
+void fosssweeper::Journal::end(const fosssweeper::Journal::Counters &counters) {
+  if (!this->_recording)
+    return;
+  this->_recording = false;
+  // an action without any change keeps the undone entries for redo
+  if (this->_buttons.size() == this->_actionButtonBegin &&
+      this->_pressedButtons.empty() && counters == this->_previousCounters)
+    return;
+  // otherwise they are discarded and the buttons of the action, recorded
+  // after theirs, take their place
+  if (this->_position < this->_entries.size()) {
+    const auto &first_discarded = this->_entries[this->_position];
+    const auto action_begin = this->_buttons.begin() +
+                              static_cast<std::ptrdiff_t>(
+                                  this->_actionButtonBegin);
+    const auto new_end = std::copy(
+        action_begin, this->_buttons.end(),
+        this->_buttons.begin() + first_discarded._buttonBegin);
+    this->_buttons.erase(new_end, this->_buttons.end());
+    this->_runs.resize(first_discarded._runBegin);
+    this->_entries.resize(this->_position);
+  }
+  const auto button_begin = static_cast<std::uint32_t>(
+      this->_entries.empty() ? 0 : this->_entries.back()._buttonEnd);
+  const auto run_begin = static_cast<std::uint32_t>(this->_runs.size());
+  std::sort(this->_pressedButtons.begin(), this->_pressedButtons.end());
+  for (const auto button_i : this->_pressedButtons) {
+    if (this->_runs.size() > run_begin) {
+      auto &run = this->_runs.back();
+      if (run._beginI + run._length == button_i) {
+        run._length++;
+        continue;
+      }
+    }
+    this->_runs.push_back({button_i, 1});
+  }
+  this->_pressedButtons.clear();
+  fosssweeper::Journal::Entry entry;
+  entry._buttonBegin = button_begin;
+  entry._buttonEnd = static_cast<std::uint32_t>(this->_buttons.size());
+  entry._runBegin = run_begin;
+  entry._runEnd = static_cast<std::uint32_t>(this->_runs.size());
+  entry._previousCounters = this->_previousCounters;
+  entry._newCounters = counters;
+  this->_entries.push_back(entry);
+  this->_position = this->_entries.size();
+}
+
+const fosssweeper::Journal::Entry *fosssweeper::Journal::undo() noexcept {
+  if (!this->getCanUndo())
+    return nullptr;
+  this->_position--;
+  return &this->_entries[this->_position];
+}
+
+const fosssweeper::Journal::Entry *fosssweeper::Journal::redo() noexcept {
+  if (!this->getCanRedo())
+    return nullptr;
+  this->_position++;
+  return &this->_entries[this->_position - 1];
+}
+
+bool fosssweeper::Journal::getCanUndo() const noexcept {
+  return this->_position > 0;
+}
+
+bool fosssweeper::Journal::getCanRedo() const noexcept {
+  return this->_position < this->_entries.size();
+}
+
+std::size_t fosssweeper::Journal::getEntryCount() const noexcept {
+  return this->_entries.size();
+}
+
+std::size_t fosssweeper::Journal::getPosition() const noexcept {
+  return this->_position;
+}
+
+std::size_t fosssweeper::Journal::getRecordedButtonCount() const noexcept {
+  return this->_buttons.size();
+}
+
+std::size_t fosssweeper::Journal::getRecordedRunCount() const noexcept {
+  return this->_runs.size();
+}
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/latency_histogram.hpp>
+
+std::size_t
+fosssweeper::LatencyHistogram::getBucketI(std::uint64_t nanoseconds) noexcept {
+  if (nanoseconds < fosssweeper::LatencyHistogram::SUB_BUCKET_COUNT)
+    return static_cast<std::size_t>(nanoseconds);
+  const auto msb_i = static_cast<std::size_t>(std::bit_width(nanoseconds)) - 1;
+  const auto shift = msb_i - fosssweeper::LatencyHistogram::SUB_BUCKET_BITS;
+  const auto sub_bucket_i =
+      static_cast<std::size_t>(nanoseconds >> shift) &
+      (fosssweeper::LatencyHistogram::SUB_BUCKET_COUNT - 1);
+  return ((shift + 1) * fosssweeper::LatencyHistogram::SUB_BUCKET_COUNT) +
+         sub_bucket_i;
+}
+
+std::uint64_t
+fosssweeper::LatencyHistogram::getBucketMax(std::size_t bucket_i) noexcept {
+  if (bucket_i < fosssweeper::LatencyHistogram::SUB_BUCKET_COUNT)
+    return bucket_i;
+  const auto shift =
+      (bucket_i / fosssweeper::LatencyHistogram::SUB_BUCKET_COUNT) - 1;
+  const auto sub_bucket_i =
+      bucket_i % fosssweeper::LatencyHistogram::SUB_BUCKET_COUNT;
+  const auto bucket_min =
+      static_cast<std::uint64_t>(
+          fosssweeper::LatencyHistogram::SUB_BUCKET_COUNT + sub_bucket_i)
+      << shift;
+  return bucket_min + ((std::uint64_t{1} << shift) - 1);
+}
+
+void fosssweeper::LatencyHistogram::record(std::uint64_t nanoseconds) noexcept {
+  this->_counts[fosssweeper::LatencyHistogram::getBucketI(nanoseconds)]++;
+  this->_count++;
+  this->_max = std::max(this->_max, nanoseconds);
+}
+
+void fosssweeper::LatencyHistogram::merge(
+    const fosssweeper::LatencyHistogram &other) noexcept {
+  for (std::size_t bucket_i = 0; bucket_i < this->_counts.size(); bucket_i++) {
+    this->_counts[bucket_i] += other._counts[bucket_i];
+  }
+  this->_count += other._count;
+  this->_max = std::max(this->_max, other._max);
+}
+
+std::uint64_t fosssweeper::LatencyHistogram::getCount() const noexcept {
+  return this->_count;
+}
+
+std::uint64_t fosssweeper::LatencyHistogram::getMax() const noexcept {
+  return this->_max;
+}
+
+// percentile is in [0, 100]; the result is capped at the largest recorded
+// value so the top bucket does not overstate it
+std::uint64_t
+fosssweeper::LatencyHistogram::getPercentile(double percentile) const noexcept {
+  if (this->_count == 0)
+    return 0;
+  const auto rank = std::max<std::uint64_t>(
+      1, static_cast<std::uint64_t>(std::ceil(
+             (std::clamp(percentile, 0.0, 100.0) / 100.0) *
+             static_cast<double>(this->_count))));
+  std::uint64_t seen_count = 0;
+  for (std::size_t bucket_i = 0; bucket_i < this->_counts.size(); bucket_i++) {
+    seen_count += this->_counts[bucket_i];
+    if (seen_count >= rank) {
+      return std::min(fosssweeper::LatencyHistogram::getBucketMax(bucket_i),
+                      this->_max);
+    }
+  }
+  return this->_max;
+}
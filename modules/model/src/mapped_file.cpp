@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstddef>
+#include <filesystem>
+#include <fosssweeper/mapped_file.hpp>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+void fosssweeper::MappedFile::close() noexcept {
+#ifdef _WIN32
+  if (this->_data != nullptr) {
+    UnmapViewOfFile(this->_data);
+  }
+  if (this->_mappingHandle != nullptr) {
+    CloseHandle(this->_mappingHandle);
+  }
+  this->_mappingHandle = nullptr;
+#else
+  if (this->_data != nullptr) {
+    munmap(const_cast<unsigned char *>(this->_data), this->_size);
+  }
+#endif
+  this->_data = nullptr;
+  this->_size = 0;
+}
+
+fosssweeper::MappedFile::MappedFile(const std::filesystem::path &path) {
+#ifdef _WIN32
+  const HANDLE file_handle =
+      CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file_handle == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error("failed to open " + path.string());
+  }
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file_handle, &file_size)) {
+    CloseHandle(file_handle);
+    throw std::runtime_error("failed to read the size of " + path.string());
+  }
+  this->_size = static_cast<std::size_t>(file_size.QuadPart);
+  if (this->_size > 0) {
+    this->_mappingHandle =
+        CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (this->_mappingHandle != nullptr) {
+      this->_data = static_cast<const unsigned char *>(
+          MapViewOfFile(this->_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    }
+  }
+  CloseHandle(file_handle);
+  if (this->_size > 0 && this->_data == nullptr) {
+    this->close();
+    throw std::runtime_error("failed to map " + path.string());
+  }
+#else
+  const int file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (file < 0) {
+    throw std::runtime_error("failed to open " + path.string());
+  }
+  struct stat file_stat;
+  if (fstat(file, &file_stat) != 0) {
+    ::close(file);
+    throw std::runtime_error("failed to read the size of " + path.string());
+  }
+  this->_size = static_cast<std::size_t>(file_stat.st_size);
+  if (this->_size > 0) {
+    void *const data = mmap(nullptr, this->_size, PROT_READ, MAP_PRIVATE, file, 0);
+    if (data == MAP_FAILED) {
+      ::close(file);
+      this->_size = 0;
+      throw std::runtime_error("failed to map " + path.string());
+    }
+    this->_data = static_cast<const unsigned char *>(data);
+  }
+  ::close(file);
+#endif
+}
+
+fosssweeper::MappedFile::MappedFile(fosssweeper::MappedFile &&other) noexcept
+    : _data(std::exchange(other._data, nullptr)),
+      _size(std::exchange(other._size, 0))
+#ifdef _WIN32
+      ,
+      _mappingHandle(std::exchange(other._mappingHandle, nullptr))
+#endif
+{
+}
+
+fosssweeper::MappedFile &
+fosssweeper::MappedFile::operator=(fosssweeper::MappedFile &&other) noexcept {
+  if (this != &other) {
+    this->close();
+    this->_data = std::exchange(other._data, nullptr);
+    this->_size = std::exchange(other._size, 0);
+#ifdef _WIN32
+    this->_mappingHandle = std::exchange(other._mappingHandle, nullptr);
+#endif
+  }
+  return *this;
+}
+
+fosssweeper::MappedFile::~MappedFile() { this->close(); }
+
+std::span<const unsigned char>
+fosssweeper::MappedFile::getData() const noexcept {
+  return std::span<const unsigned char>(this->_data, this->_size);
+}
+
+std::size_t fosssweeper::MappedFile::getSize() const noexcept {
+  return this->_size;
+}
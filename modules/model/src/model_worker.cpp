@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/model_worker.hpp>
+#include <optional>
+#include <utility>
+
+const std::size_t fosssweeper::ModelWorker::QUEUE_CAPACITY = 256;
+
+void fosssweeper::ModelWorker::run() {
+  while (true) {
+    const auto command_signal =
+        this->_commandSignal.load(std::memory_order_acquire);
+    fosssweeper::ModelCommand command;
+    if (!this->_commandQueue.tryPop(command)) {
+      if (this->_stopping.load())
+        return;
+      this->_commandSignal.wait(command_signal);
+      continue;
+    }
+    auto model_update = this->apply(command);
+    while (true) {
+      const auto update_signal =
+          this->_updateSignal.load(std::memory_order_acquire);
+      if (this->_updateQueue.tryPush(std::move(model_update)))
+        break;
+      if (this->_stopping.load())
+        return;
+      this->_updateSignal.wait(update_signal);
+    }
+    this->_publishSignal.fetch_add(1, std::memory_order_release);
+    this->_publishSignal.notify_one();
+    if (this->_onUpdate) {
+      this->_onUpdate();
+    }
+  }
+}
+
+fosssweeper::ModelUpdate
+fosssweeper::ModelWorker::apply(const fosssweeper::ModelCommand &command) {
+  auto &game_model = this->_gameModel.get();
+  const auto x = command._buttonPosition.x;
+  const auto y = command._buttonPosition.y;
+  // commands that never go through a change scope leave the change set of
+  // the previous command behind
+  bool changed = true;
+  switch (command._commandType) {
+  case fosssweeper::ModelCommandType::Click:
+    game_model.clickButton(x, y);
+    break;
+  case fosssweeper::ModelCommandType::AltClick:
+    game_model.altClickButton(x, y);
+    break;
+  case fosssweeper::ModelCommandType::AreaClick:
+    game_model.areaClickButton(x, y);
+    break;
+  case fosssweeper::ModelCommandType::NewGame:
+    if (command._gameConfigurationO.has_value()) {
+      game_model.newGame(command._gameConfigurationO.value());
+    } else {
+      game_model.newGame();
+    }
+    break;
+  case fosssweeper::ModelCommandType::UpdateTime:
+    game_model.updateTime(static_cast<unsigned int>(command._value));
+    changed = false;
+    break;
+  case fosssweeper::ModelCommandType::SetGameSeed:
+    game_model.setGameSeed(command._value);
+    changed = false;
+    break;
+  case fosssweeper::ModelCommandType::SetQuestionsEnabled:
+    game_model.setQuestionsEnabled(command._value != 0);
+    break;
+  case fosssweeper::ModelCommandType::ApplyCertainMoves:
+    game_model.applyCertainMoves();
+    break;
+  case fosssweeper::ModelCommandType::Undo:
+    changed = game_model.undo();
+    break;
+  case fosssweeper::ModelCommandType::Redo:
+    changed = game_model.redo();
+    break;
+  }
+
+  fosssweeper::ModelUpdate model_update;
+  model_update._sequence = ++this->_appliedCount;
+  model_update._boardSnapshot = game_model.snapshot();
+  model_update._gameTime = game_model.getGameTime();
+  model_update._canUndo = game_model.getJournal().getCanUndo();
+  model_update._canRedo = game_model.getJournal().getCanRedo();
+  if (changed) {
+    const auto &change_set = game_model.getChangeSet();
+    if (change_set.getHasButtonList()) {
+      model_update._changedButtons = change_set.getChangedButtons();
+    } else {
+      model_update._allButtonsChanged = true;
+    }
+    model_update._gameStateChanged = change_set.getGameStateChanged();
+    model_update._flagCountChanged = change_set.getFlagCountChanged();
+    model_update._timerChanged = change_set.getTimerChanged();
+  }
+  return model_update;
+}
+
+fosssweeper::ModelWorker::ModelWorker(fosssweeper::GameModel &game_model,
+                                      std::function<void()> on_update)
+    : _gameModel(game_model), _onUpdate(std::move(on_update)),
+      _commandQueue(fosssweeper::ModelWorker::QUEUE_CAPACITY),
+      _updateQueue(fosssweeper::ModelWorker::QUEUE_CAPACITY) {
+  game_model.setChangeSetEnabled(true);
+  // the first snapshot copies the board, which should not delay the first
+  // command
+  game_model.snapshot();
+  this->_thread = std::thread([this]() { this->run(); });
+}
+
+fosssweeper::ModelWorker::~ModelWorker() {
+  this->_stopping = true;
+  this->_commandSignal++;
+  this->_commandSignal.notify_one();
+  this->_updateSignal++;
+  this->_updateSignal.notify_one();
+  this->_thread.join();
+}
+
+// returns the sequence number of the update answering the command, or
+// nothing when the queue is full
+std::optional<std::uint64_t>
+fosssweeper::ModelWorker::tryPush(fosssweeper::ModelCommand command) {
+  if (!this->_commandQueue.tryPush(std::move(command)))
+    return std::nullopt;
+  this->_commandSignal.fetch_add(1, std::memory_order_release);
+  this->_commandSignal.notify_one();
+  return ++this->_pushedCount;
+}
+
+bool fosssweeper::ModelWorker::tryPopUpdate(
+    fosssweeper::ModelUpdate &model_update) {
+  if (!this->_updateQueue.tryPop(model_update))
+    return false;
+  this->_updateSignal.fetch_add(1, std::memory_order_release);
+  this->_updateSignal.notify_one();
+  return true;
+}
+
+// waits for the update of a command that was pushed, for callers that need
+// the GameModel back before they go on
+void fosssweeper::ModelWorker::popUpdate(
+    fosssweeper::ModelUpdate &model_update) {
+  while (true) {
+    const auto publish_signal =
+        this->_publishSignal.load(std::memory_order_acquire);
+    if (this->tryPopUpdate(model_update))
+      return;
+    this->_publishSignal.wait(publish_signal);
+  }
+}
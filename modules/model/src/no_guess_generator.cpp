@@ -0,0 +1,293 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button_position.hpp>
+#include <fosssweeper/no_guess_generator.hpp>
+#include <fosssweeper/surrounding_buttons.hpp>
+#include <fosssweeper/zobrist.hpp>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+const int fosssweeper::NoGuessGenerator::MAX_CANDIDATES = 256;
+const unsigned int fosssweeper::NoGuessGenerator::MAX_THREADS = 8;
+
+void fosssweeper::NoGuessGenerator::placeRandomBombs(std::mt19937_64 &rng) {
+  const auto button_count = this->_bombs.size();
+  const auto bomb_count =
+      static_cast<std::size_t>(this->_gameConfiguration.getBombCount());
+  this->_otherButtons.clear();
+  for (std::size_t button_i = 0; button_i < button_count; button_i++) {
+    if (!this->_excluded[button_i]) {
+      this->_otherButtons.push_back(button_i);
+    }
+  }
+  std::fill(this->_bombs.begin(), this->_bombs.end(), 0);
+  for (std::size_t bomb_i = 0; bomb_i < bomb_count; bomb_i++) {
+    std::uniform_int_distribution<std::size_t> distributor(
+        bomb_i, this->_otherButtons.size() - 1);
+    std::swap(this->_otherButtons[bomb_i],
+              this->_otherButtons[distributor(rng)]);
+    this->_bombs[this->_otherButtons[bomb_i]] = 1;
+  }
+  const int buttons_wide = this->_gameConfiguration.getButtonsWide();
+  const int buttons_tall = this->_gameConfiguration.getButtonsTall();
+  for (std::size_t button_i = 0; button_i < button_count; button_i++) {
+    std::int8_t surrounding_bombs = 0;
+    for (const auto surrounding_i : fosssweeper::SurroundingButtons(
+             button_i, buttons_wide, buttons_tall)) {
+      surrounding_bombs += this->_bombs[surrounding_i];
+    }
+    this->_surroundingBombs[button_i] = surrounding_bombs;
+  }
+}
+
+void fosssweeper::NoGuessGenerator::moveBomb(std::size_t from_i,
+                                             std::size_t to_i) {
+  const int buttons_wide = this->_gameConfiguration.getButtonsWide();
+  const int buttons_tall = this->_gameConfiguration.getButtonsTall();
+  this->_bombs[from_i] = 0;
+  for (const auto surrounding_i :
+       fosssweeper::SurroundingButtons(from_i, buttons_wide, buttons_tall)) {
+    this->_surroundingBombs[surrounding_i]--;
+  }
+  this->_bombs[to_i] = 1;
+  for (const auto surrounding_i :
+       fosssweeper::SurroundingButtons(to_i, buttons_wide, buttons_tall)) {
+    this->_surroundingBombs[surrounding_i]++;
+  }
+}
+
+void fosssweeper::NoGuessGenerator::revealFrom(std::size_t button_i) {
+  const int buttons_wide = this->_gameConfiguration.getButtonsWide();
+  const int buttons_tall = this->_gameConfiguration.getButtonsTall();
+  this->_revealStack.clear();
+  this->_revealStack.push_back(button_i);
+  this->_solver.reveal(button_i, this->_surroundingBombs[button_i]);
+  do {
+    const auto cur_i = this->_revealStack.back();
+    this->_revealStack.pop_back();
+    if (this->_surroundingBombs[cur_i] != 0)
+      continue;
+    for (const auto surrounding_i :
+         fosssweeper::SurroundingButtons(cur_i, buttons_wide, buttons_tall)) {
+      if (!this->_solver.getIsRevealed(surrounding_i)) {
+        this->_solver.reveal(surrounding_i,
+                             this->_surroundingBombs[surrounding_i]);
+        this->_revealStack.push_back(surrounding_i);
+      }
+    }
+  } while (!this->_revealStack.empty());
+}
+
+bool fosssweeper::NoGuessGenerator::solve() {
+  this->_solver.reset(this->_gameConfiguration);
+  this->revealFrom(this->_initialI);
+  while (this->_solver.findCertainButtons(this->_safeButtons,
+                                          this->_bombButtons)) {
+    for (const auto button_i : this->_bombButtons) {
+      this->_solver.markBomb(button_i);
+    }
+    for (const auto button_i : this->_safeButtons) {
+      if (!this->_solver.getIsRevealed(button_i)) {
+        this->revealFrom(button_i);
+      }
+    }
+  }
+  return this->_solver.getRevealedCount() ==
+         this->_gameConfiguration.getButtonCount() -
+             this->_gameConfiguration.getBombCount();
+}
+
+bool fosssweeper::NoGuessGenerator::repair(std::mt19937_64 &rng) {
+  const int buttons_wide = this->_gameConfiguration.getButtonsWide();
+  const int buttons_tall = this->_gameConfiguration.getButtonsTall();
+  this->_frontierButtons.clear();
+  this->_otherButtons.clear();
+  for (std::size_t button_i = 0; button_i < this->_bombs.size(); button_i++) {
+    if (this->_solver.getIsRevealed(button_i) ||
+        this->_solver.getIsKnownBomb(button_i) || this->_excluded[button_i]) {
+      continue;
+    }
+    bool on_frontier = false;
+    for (const auto surrounding_i :
+         fosssweeper::SurroundingButtons(button_i, buttons_wide, buttons_tall)) {
+      if (this->_solver.getIsRevealed(surrounding_i)) {
+        on_frontier = true;
+        break;
+      }
+    }
+    if (on_frontier) {
+      this->_frontierButtons.push_back(button_i);
+    } else {
+      this->_otherButtons.push_back(button_i);
+    }
+  }
+  if (this->_frontierButtons.empty())
+    return false;
+  // split both lists into bombs first and free buttons second
+  const auto frontier_free = std::partition(
+      this->_frontierButtons.begin(), this->_frontierButtons.end(),
+      [&](std::size_t button_i) { return this->_bombs[button_i] != 0; });
+  const auto other_free = std::partition(
+      this->_otherButtons.begin(), this->_otherButtons.end(),
+      [&](std::size_t button_i) { return this->_bombs[button_i] != 0; });
+  const auto frontier_bomb_count =
+      static_cast<std::size_t>(frontier_free - this->_frontierButtons.begin());
+  const auto other_bomb_count =
+      static_cast<std::size_t>(other_free - this->_otherButtons.begin());
+  const auto other_free_count = this->_otherButtons.size() - other_bomb_count;
+  if (frontier_bomb_count > 0) {
+    std::uniform_int_distribution<std::size_t> from_distributor(
+        0, frontier_bomb_count - 1);
+    const auto from_i = this->_frontierButtons[from_distributor(rng)];
+    if (other_free_count > 0) {
+      std::uniform_int_distribution<std::size_t> to_distributor(
+          other_bomb_count, this->_otherButtons.size() - 1);
+      this->moveBomb(from_i, this->_otherButtons[to_distributor(rng)]);
+      return true;
+    }
+    // nowhere left beyond the frontier, so push the bomb back into the area
+    // that was already revealed and let the next solve uncover it again.
+    this->_otherButtons.clear();
+    for (std::size_t button_i = 0; button_i < this->_bombs.size();
+         button_i++) {
+      if (this->_solver.getIsRevealed(button_i) && !this->_excluded[button_i]) {
+        this->_otherButtons.push_back(button_i);
+      }
+    }
+    if (this->_otherButtons.empty())
+      return false;
+    std::uniform_int_distribution<std::size_t> to_distributor(
+        0, this->_otherButtons.size() - 1);
+    this->moveBomb(from_i, this->_otherButtons[to_distributor(rng)]);
+    return true;
+  }
+  if (other_bomb_count == 0)
+    return false;
+  std::uniform_int_distribution<std::size_t> from_distributor(
+      0, other_bomb_count - 1);
+  std::uniform_int_distribution<std::size_t> to_distributor(
+      0, this->_frontierButtons.size() - 1);
+  this->moveBomb(this->_otherButtons[from_distributor(rng)],
+                 this->_frontierButtons[to_distributor(rng)]);
+  return true;
+}
+
+fosssweeper::NoGuessGenerator::NoGuessGenerator(
+    fosssweeper::GameConfiguration game_configuration, int initial_x,
+    int initial_y)
+    : _gameConfiguration(game_configuration),
+      _initialI(fosssweeper::ButtonPosition(initial_x, initial_y)
+                    .getIndex(game_configuration.getButtonsWide())),
+      _solver(game_configuration) {
+  const auto button_count =
+      static_cast<std::size_t>(game_configuration.getButtonCount());
+  this->_bombs.resize(button_count);
+  this->_excluded.resize(button_count);
+  this->_surroundingBombs.resize(button_count);
+  this->_revealStack.reserve(button_count);
+  this->_excluded[this->_initialI] = 1;
+  const fosssweeper::SurroundingButtons surrounding_buttons(
+      this->_initialI, game_configuration.getButtonsWide(),
+      game_configuration.getButtonsTall());
+  if (game_configuration.getBombCount() + 1 + surrounding_buttons.size() <=
+      button_count) {
+    for (const auto surrounding_i : surrounding_buttons) {
+      this->_excluded[surrounding_i] = 1;
+    }
+  }
+}
+
+bool fosssweeper::NoGuessGenerator::tryGenerate(std::uint64_t seed) {
+  if (this->_gameConfiguration.getBombCount() >=
+      this->_gameConfiguration.getButtonCount()) {
+    return false;
+  }
+  std::mt19937_64 rng(seed);
+  this->placeRandomBombs(rng);
+  const int max_repairs = this->_gameConfiguration.getButtonCount();
+  for (int repair_i = 0; repair_i < max_repairs; repair_i++) {
+    if (this->solve())
+      return true;
+    if (!this->repair(rng))
+      return false;
+  }
+  return this->solve();
+}
+
+const std::vector<std::uint8_t> &
+fosssweeper::NoGuessGenerator::getBombs() const noexcept {
+  return this->_bombs;
+}
+
+bool fosssweeper::generateNoGuessBombs(
+    fosssweeper::GameConfiguration game_configuration, int initial_x,
+    int initial_y, std::uint64_t seed, std::vector<bool> &bombs) {
+  // candidates are tried speculatively on every thread, but the lowest
+  // successful candidate always wins so the same seed gives the same board.
+  const unsigned int thread_count =
+      std::clamp(std::thread::hardware_concurrency(), 1u,
+                 fosssweeper::NoGuessGenerator::MAX_THREADS);
+  std::atomic<int> next_candidate = 0;
+  std::atomic<int> best_candidate =
+      fosssweeper::NoGuessGenerator::MAX_CANDIDATES;
+  std::mutex best_mutex;
+  std::vector<std::uint8_t> best_bombs;
+  const auto generate = [&]() {
+    fosssweeper::NoGuessGenerator generator(game_configuration, initial_x,
+                                            initial_y);
+    while (true) {
+      const int candidate = next_candidate++;
+      if (candidate >= best_candidate.load())
+        break;
+      if (generator.tryGenerate(fosssweeper::mixZobristKey(
+              seed + static_cast<std::uint64_t>(candidate)))) {
+        std::lock_guard<std::mutex> lock(best_mutex);
+        if (candidate < best_candidate.load()) {
+          best_candidate = candidate;
+          best_bombs = generator.getBombs();
+        }
+        break;
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (unsigned int thread_i = 1; thread_i < thread_count; thread_i++) {
+    threads.emplace_back(generate);
+  }
+  generate();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (best_bombs.empty())
+    return false;
+  bombs.assign(best_bombs.begin(), best_bombs.end());
+  return true;
+}
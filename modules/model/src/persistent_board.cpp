@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/persistent_board.hpp>
+#include <memory>
+#include <vector>
+
+namespace {
+// a use count of one means no other board can still read the object; the
+// fence orders our writes after the reads of the board that released it
+template <typename T> bool getIsUnique(const std::shared_ptr<T> &pointer) {
+  if (pointer.use_count() != 1)
+    return false;
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return true;
+}
+} // namespace
+
+const std::size_t fosssweeper::PersistentBoard::CHUNK_SIZE;
+
+fosssweeper::PersistentBoard::Root &
+fosssweeper::PersistentBoard::getUniqueRoot() {
+  if (!this->_root) {
+    this->_root = std::make_shared<fosssweeper::PersistentBoard::Root>();
+  } else if (!getIsUnique(this->_root)) {
+    this->_root =
+        std::make_shared<fosssweeper::PersistentBoard::Root>(*this->_root);
+  }
+  return *this->_root;
+}
+
+void fosssweeper::PersistentBoard::assign(
+    const std::vector<fosssweeper::Button> &buttons) {
+  auto root = std::make_shared<fosssweeper::PersistentBoard::Root>();
+  const auto chunk_count =
+      (buttons.size() + fosssweeper::PersistentBoard::CHUNK_SIZE - 1) /
+      fosssweeper::PersistentBoard::CHUNK_SIZE;
+  root->_chunks.reserve(chunk_count);
+  for (std::size_t chunk_i = 0; chunk_i < chunk_count; chunk_i++) {
+    auto chunk = std::make_shared<fosssweeper::PersistentBoard::Chunk>();
+    const auto begin_i = chunk_i * fosssweeper::PersistentBoard::CHUNK_SIZE;
+    for (std::size_t button_i = begin_i;
+         button_i < buttons.size() &&
+         button_i < begin_i + fosssweeper::PersistentBoard::CHUNK_SIZE;
+         button_i++) {
+      (*chunk)[button_i - begin_i] = buttons[button_i];
+    }
+    root->_chunks.push_back(std::move(chunk));
+  }
+  this->_root = std::move(root);
+  this->_buttonCount = buttons.size();
+}
+
+void fosssweeper::PersistentBoard::setButton(
+    std::size_t button_i, const fosssweeper::Button &button) {
+  auto &root = this->getUniqueRoot();
+  auto &chunk =
+      root._chunks[button_i / fosssweeper::PersistentBoard::CHUNK_SIZE];
+  if (!getIsUnique(chunk)) {
+    chunk = std::make_shared<fosssweeper::PersistentBoard::Chunk>(*chunk);
+  }
+  (*chunk)[button_i % fosssweeper::PersistentBoard::CHUNK_SIZE] = button;
+}
+
+const fosssweeper::Button &
+fosssweeper::PersistentBoard::getButton(std::size_t button_i) const noexcept {
+  return (*this->_root->_chunks[button_i /
+                                fosssweeper::PersistentBoard::CHUNK_SIZE])
+      [button_i % fosssweeper::PersistentBoard::CHUNK_SIZE];
+}
+
+std::size_t fosssweeper::PersistentBoard::getButtonCount() const noexcept {
+  return this->_buttonCount;
+}
+
+const fosssweeper::PersistentBoard::Chunk *
+fosssweeper::PersistentBoard::getChunk(std::size_t chunk_i) const noexcept {
+  return this->_root->_chunks[chunk_i].get();
+}
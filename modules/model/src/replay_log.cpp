@@ -0,0 +1,384 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+const std::array<char, 8> fosssweeper::ReplayEncoder::MAGIC = {
+    'F', 'S', 'W', 'R', 'E', 'P', 'L', 'Y'};
+const std::uint64_t fosssweeper::ReplayEncoder::VERSION = 1;
+const std::array<char, 8> fosssweeper::ReplayIndex::INDEX_MAGIC = {
+    'F', 'S', 'W', 'I', 'N', 'D', 'E', 'X'};
+const std::size_t fosssweeper::ReplayIndex::TRAILER_SIZE = 16;
+
+namespace {
+const std::uint64_t MAX_BUTTON_COUNT = 1 << 30;
+
+std::uint64_t encodeZigzag(std::int64_t value) noexcept {
+  return (static_cast<std::uint64_t>(value) << 1) ^
+         static_cast<std::uint64_t>(value >> 63);
+}
+
+std::int64_t decodeZigzag(std::uint64_t value) noexcept {
+  return static_cast<std::int64_t>(value >> 1) ^
+         -static_cast<std::int64_t>(value & 1);
+}
+
+bool getHasButton(fosssweeper::ReplayEventType event_type) noexcept {
+  return event_type == fosssweeper::ReplayEventType::Click ||
+         event_type == fosssweeper::ReplayEventType::AltClick ||
+         event_type == fosssweeper::ReplayEventType::AreaClick;
+}
+bool getRestartsButtons(fosssweeper::ReplayEventType event_type) noexcept {
+  return event_type == fosssweeper::ReplayEventType::GameBegin ||
+         event_type == fosssweeper::ReplayEventType::Keyframe;
+}
+} // namespace
+
+// the index sits at the very end of the log, so it is only looked for there;
+// a log cut off before its index simply has none
+bool fosssweeper::ReplayIndex::tryRead(std::span<const std::uint8_t> bytes,
+                                       fosssweeper::ReplayIndex &replay_index,
+                                       std::size_t &recording_begin) {
+  const auto trailer_size = fosssweeper::ReplayIndex::TRAILER_SIZE;
+  const auto &index_magic = fosssweeper::ReplayIndex::INDEX_MAGIC;
+  if (bytes.size() < trailer_size)
+    return false;
+  const auto trailer = bytes.last(trailer_size);
+  if (!std::equal(index_magic.begin(), index_magic.end(),
+                  trailer.begin() + 8)) {
+    return false;
+  }
+  std::uint64_t index_size = 0;
+  for (std::size_t byte_i = 0; byte_i < 8; byte_i++) {
+    index_size |= static_cast<std::uint64_t>(trailer[byte_i]) << (byte_i * 8);
+  }
+  if (index_size < trailer_size || index_size > bytes.size())
+    return false;
+  const auto index_begin = bytes.size() - index_size;
+  const auto index_end = bytes.size() - trailer_size;
+  fosssweeper::ReplayDecoder replay_decoder(bytes.first(index_end));
+  replay_decoder._position = index_begin;
+  fosssweeper::ReplayIndex read_index;
+  try {
+    if (replay_decoder.readVarint() !=
+        static_cast<std::uint64_t>(fosssweeper::ReplayEventType::Index))
+      return false;
+    replay_decoder.readVarint();
+    const auto entry_count = replay_decoder.readVarint();
+    // every entry takes at least three bytes
+    if (entry_count > (index_end - index_begin) / 3)
+      return false;
+    read_index._entries.resize(static_cast<std::size_t>(entry_count));
+    std::uint64_t time = 0;
+    std::uint64_t position = 0;
+    for (auto &entry : read_index._entries) {
+      entry._isKeyframe = replay_decoder.readVarint() != 0;
+      time += replay_decoder.readVarint();
+      position += replay_decoder.readVarint();
+      entry._time = time;
+      entry._position = position;
+    }
+    read_index._recordingSize = replay_decoder.readVarint();
+  } catch (const std::runtime_error &) {
+    return false;
+  }
+  if (replay_decoder._position != index_end ||
+      read_index._recordingSize > index_begin ||
+      (!read_index._entries.empty() &&
+       read_index._entries.back()._position >= read_index._recordingSize))
+    return false;
+  replay_index = std::move(read_index);
+  recording_begin = static_cast<std::size_t>(index_begin -
+                                             replay_index._recordingSize);
+  return true;
+}
+
+void fosssweeper::ReplayEncoder::writeVarint(std::uint64_t value) {
+  while (value >= 0x80) {
+    this->_bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  this->_bytes.push_back(static_cast<std::uint8_t>(value));
+}
+
+void fosssweeper::ReplayEncoder::writeHeader() {
+  this->_bytes.insert(this->_bytes.end(),
+                      fosssweeper::ReplayEncoder::MAGIC.begin(),
+                      fosssweeper::ReplayEncoder::MAGIC.end());
+  this->writeVarint(fosssweeper::ReplayEncoder::VERSION);
+  this->_previousTime = 0;
+  this->_previousButtonI = 0;
+}
+
+void fosssweeper::ReplayEncoder::encodeEventBegin(
+    fosssweeper::ReplayEventType event_type, std::uint64_t time) {
+  this->writeVarint(static_cast<std::uint64_t>(event_type));
+  // a clock that goes backwards is recorded as no time passing
+  time = std::max(time, this->_previousTime);
+  this->writeVarint(time - this->_previousTime);
+  this->_previousTime = time;
+}
+
+void fosssweeper::ReplayEncoder::encode(
+    const fosssweeper::ReplayEvent &replay_event) {
+  this->encodeEventBegin(replay_event._eventType, replay_event._time);
+  if (getHasButton(replay_event._eventType)) {
+    this->writeVarint(
+        encodeZigzag(static_cast<std::int64_t>(replay_event._value -
+                                               this->_previousButtonI)));
+    this->_previousButtonI = replay_event._value;
+  } else if (replay_event._eventType ==
+             fosssweeper::ReplayEventType::QuestionsEnabled) {
+    this->writeVarint(replay_event._value);
+  } else if (replay_event._eventType ==
+             fosssweeper::ReplayEventType::GameBegin) {
+    const auto &game_configuration = replay_event._gameConfiguration;
+    this->writeVarint(
+        static_cast<std::uint64_t>(game_configuration.getButtonsWide()));
+    this->writeVarint(
+        static_cast<std::uint64_t>(game_configuration.getButtonsTall()));
+    this->writeVarint(
+        static_cast<std::uint64_t>(game_configuration.getBombCount()));
+    this->writeVarint(static_cast<std::uint64_t>(replay_event._generationMode));
+    this->writeVarint(replay_event._gameSeed);
+    this->writeVarint(replay_event._questionsEnabled ? 1 : 0);
+  } else if (replay_event._eventType ==
+             fosssweeper::ReplayEventType::GameEnd) {
+    this->writeVarint(replay_event._value);
+    this->writeVarint(replay_event._visibleHash);
+    this->writeVarint(replay_event._gameTime);
+  } else if (replay_event._eventType ==
+             fosssweeper::ReplayEventType::Keyframe) {
+    this->writeVarint(replay_event._keyframe.size());
+    this->_bytes.insert(this->_bytes.end(), replay_event._keyframe.begin(),
+                        replay_event._keyframe.end());
+  }
+  if (getRestartsButtons(replay_event._eventType)) {
+    this->_previousButtonI = 0;
+  }
+}
+
+// the save of the keyframe is left out, the caller writes its keyframe_size
+// bytes right after the encoded bytes
+void fosssweeper::ReplayEncoder::encodeKeyframeBegin(
+    std::uint64_t time, std::size_t keyframe_size) {
+  this->encodeEventBegin(fosssweeper::ReplayEventType::Keyframe, time);
+  this->writeVarint(keyframe_size);
+  this->_previousButtonI = 0;
+}
+
+void fosssweeper::ReplayEncoder::encodeIndex(
+    const fosssweeper::ReplayIndex &replay_index) {
+  const auto index_begin = this->_bytes.size();
+  this->writeVarint(
+      static_cast<std::uint64_t>(fosssweeper::ReplayEventType::Index));
+  this->writeVarint(0);
+  this->writeVarint(replay_index._entries.size());
+  std::uint64_t time = 0;
+  std::uint64_t position = 0;
+  for (const auto &entry : replay_index._entries) {
+    this->writeVarint(entry._isKeyframe ? 1 : 0);
+    this->writeVarint(entry._time - time);
+    this->writeVarint(entry._position - position);
+    time = entry._time;
+    position = entry._position;
+  }
+  this->writeVarint(replay_index._recordingSize);
+  const std::uint64_t index_size = this->_bytes.size() - index_begin +
+                                   fosssweeper::ReplayIndex::TRAILER_SIZE;
+  for (std::size_t byte_i = 0; byte_i < 8; byte_i++) {
+    this->_bytes.push_back(
+        static_cast<std::uint8_t>(index_size >> (byte_i * 8)));
+  }
+  this->_bytes.insert(this->_bytes.end(),
+                      fosssweeper::ReplayIndex::INDEX_MAGIC.begin(),
+                      fosssweeper::ReplayIndex::INDEX_MAGIC.end());
+}
+
+void fosssweeper::ReplayEncoder::clear() noexcept { this->_bytes.clear(); }
+
+std::span<const std::uint8_t>
+fosssweeper::ReplayEncoder::getBytes() const noexcept {
+  return this->_bytes;
+}
+
+std::uint64_t fosssweeper::ReplayDecoder::readVarint() {
+  std::uint64_t value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    if (this->_position >= this->_bytes.size()) {
+      throw std::runtime_error("truncated replay log");
+    }
+    const auto byte = this->_bytes[this->_position++];
+    value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0)
+      return value;
+  }
+  throw std::runtime_error("invalid replay log varint");
+}
+
+void fosssweeper::ReplayDecoder::readHeader() {
+  const auto &magic = fosssweeper::ReplayEncoder::MAGIC;
+  if (this->_bytes.size() - this->_position < magic.size() ||
+      !std::equal(magic.begin(), magic.end(),
+                  this->_bytes.begin() +
+                      static_cast<std::ptrdiff_t>(this->_position))) {
+    throw std::runtime_error("not a replay log");
+  }
+  this->_position += magic.size();
+  if (this->readVarint() != fosssweeper::ReplayEncoder::VERSION) {
+    throw std::runtime_error("unsupported replay log version");
+  }
+  this->_previousTime = 0;
+  this->_previousButtonI = 0;
+}
+
+void fosssweeper::ReplayDecoder::skipIndex() {
+  this->readVarint();
+  const auto entry_count = this->readVarint();
+  for (std::uint64_t entry_i = 0; entry_i < entry_count; entry_i++) {
+    this->readVarint();
+    this->readVarint();
+    this->readVarint();
+  }
+  this->readVarint();
+  if (this->_bytes.size() - this->_position <
+      fosssweeper::ReplayIndex::TRAILER_SIZE) {
+    throw std::runtime_error("truncated replay log");
+  }
+  this->_position += fosssweeper::ReplayIndex::TRAILER_SIZE;
+}
+
+fosssweeper::ReplayDecoder::ReplayDecoder(std::span<const std::uint8_t> bytes)
+    : _bytes(bytes) {}
+
+// returns false at the end of the log; recordings appended one after another
+// are decoded as one stream with the time restarting at every header, and
+// their indices are skipped
+bool fosssweeper::ReplayDecoder::tryDecode(
+    fosssweeper::ReplayEvent &replay_event) {
+  const auto magic_start = static_cast<std::uint8_t>(
+      fosssweeper::ReplayEncoder::MAGIC.front());
+  std::uint64_t event_type = 0;
+  while (true) {
+    while (this->_position < this->_bytes.size() &&
+           (this->_position == 0 ||
+            this->_bytes[this->_position] == magic_start)) {
+      this->readHeader();
+    }
+    if (this->_position >= this->_bytes.size())
+      return false;
+    this->_eventPosition = this->_position;
+    event_type = this->readVarint();
+    if (event_type >=
+        static_cast<std::uint64_t>(fosssweeper::ReplayEventType::Count)) {
+      throw std::runtime_error("invalid replay log event type");
+    }
+    if (event_type !=
+        static_cast<std::uint64_t>(fosssweeper::ReplayEventType::Index))
+      break;
+    this->skipIndex();
+  }
+  replay_event = fosssweeper::ReplayEvent();
+  replay_event._eventType =
+      static_cast<fosssweeper::ReplayEventType>(event_type);
+  this->_previousTime += this->readVarint();
+  replay_event._time = this->_previousTime;
+  if (getHasButton(replay_event._eventType)) {
+    this->_previousButtonI += static_cast<std::uint64_t>(
+        decodeZigzag(this->readVarint()));
+    replay_event._value = this->_previousButtonI;
+  } else if (replay_event._eventType ==
+             fosssweeper::ReplayEventType::QuestionsEnabled) {
+    replay_event._value = this->readVarint();
+  } else if (replay_event._eventType ==
+             fosssweeper::ReplayEventType::GameBegin) {
+    const auto buttons_wide = this->readVarint();
+    const auto buttons_tall = this->readVarint();
+    const auto bomb_count = this->readVarint();
+    const auto generation_mode = this->readVarint();
+    if (buttons_wide > MAX_BUTTON_COUNT || buttons_tall > MAX_BUTTON_COUNT ||
+        buttons_wide * buttons_tall > MAX_BUTTON_COUNT ||
+        bomb_count > buttons_wide * buttons_tall ||
+        generation_mode >
+            static_cast<std::uint64_t>(fosssweeper::GenerationMode::NoGuess)) {
+      throw std::runtime_error("invalid replay log game");
+    }
+    replay_event._gameConfiguration = fosssweeper::GameConfiguration(
+        static_cast<int>(buttons_wide), static_cast<int>(buttons_tall),
+        static_cast<int>(bomb_count));
+    replay_event._generationMode =
+        static_cast<fosssweeper::GenerationMode>(generation_mode);
+    replay_event._gameSeed = this->readVarint();
+    replay_event._questionsEnabled = this->readVarint() != 0;
+  } else if (replay_event._eventType ==
+             fosssweeper::ReplayEventType::GameEnd) {
+    replay_event._value = this->readVarint();
+    replay_event._visibleHash = this->readVarint();
+    replay_event._gameTime = this->readVarint();
+  } else if (replay_event._eventType ==
+             fosssweeper::ReplayEventType::Keyframe) {
+    const auto keyframe_size = this->readVarint();
+    if (keyframe_size > this->_bytes.size() - this->_position) {
+      throw std::runtime_error("truncated replay log");
+    }
+    replay_event._keyframe = this->_bytes.subspan(
+        this->_position, static_cast<std::size_t>(keyframe_size));
+    this->_position += static_cast<std::size_t>(keyframe_size);
+  }
+  if (getRestartsButtons(replay_event._eventType)) {
+    this->_previousButtonI = 0;
+  }
+  return true;
+}
+
+// the next event decoded is the one at position and gets the given time
+void fosssweeper::ReplayDecoder::seek(std::size_t position,
+                                      std::uint64_t time) {
+  this->_position = position;
+  this->readVarint();
+  const auto time_delta = this->readVarint();
+  if (time_delta > time) {
+    throw std::runtime_error("invalid replay log seek time");
+  }
+  this->_position = position;
+  this->_previousTime = time - time_delta;
+  this->_previousButtonI = 0;
+}
+
+std::size_t fosssweeper::ReplayDecoder::getPosition() const noexcept {
+  return this->_position;
+}
+
+std::size_t fosssweeper::ReplayDecoder::getEventPosition() const noexcept {
+  return this->_eventPosition;
+}
@@ -0,0 +1,303 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/action.hpp>
+#include <fosssweeper/button_position.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <fosssweeper/replay_player.hpp>
+#include <istream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+
+const std::uint64_t fosssweeper::ReplayPlayer::TIME_TOLERANCE = 1000;
+
+namespace {
+bool getIsEnded(fosssweeper::GameState game_state) noexcept {
+  return game_state == fosssweeper::GameState::Dead ||
+         game_state == fosssweeper::GameState::Cool;
+}
+
+std::string getStateName(std::uint64_t game_state) {
+  switch (game_state) {
+  case static_cast<std::uint64_t>(fosssweeper::GameState::None):
+    return "none";
+  case static_cast<std::uint64_t>(fosssweeper::GameState::Playing):
+    return "playing";
+  case static_cast<std::uint64_t>(fosssweeper::GameState::Dead):
+    return "dead";
+  case static_cast<std::uint64_t>(fosssweeper::GameState::Cool):
+    return "cool";
+  default:
+    return "invalid state " + std::to_string(game_state);
+  }
+}
+
+bool getIsAction(fosssweeper::ReplayEventType event_type) noexcept {
+  return event_type == fosssweeper::ReplayEventType::Click ||
+         event_type == fosssweeper::ReplayEventType::AltClick ||
+         event_type == fosssweeper::ReplayEventType::AreaClick;
+}
+
+fosssweeper::ActionType getActionType(fosssweeper::ReplayEventType event_type) {
+  switch (event_type) {
+  case fosssweeper::ReplayEventType::AltClick:
+    return fosssweeper::ActionType::AltClick;
+  case fosssweeper::ReplayEventType::AreaClick:
+    return fosssweeper::ActionType::AreaClick;
+  default:
+    return fosssweeper::ActionType::Click;
+  }
+}
+// reads keyframes straight from the log instead of copying them first
+struct KeyframeBuffer : std::streambuf {
+  KeyframeBuffer(std::span<const std::uint8_t> keyframe) {
+    auto *const begin =
+        const_cast<char *>(reinterpret_cast<const char *>(keyframe.data()));
+    this->setg(begin, begin, begin + keyframe.size());
+  }
+};
+} // namespace
+
+void fosssweeper::ReplayPlayResult::add(
+    const fosssweeper::ReplayPlayResult &play_result) {
+  if (this->_firstMismatch.empty()) {
+    this->_firstMismatch = play_result._firstMismatch;
+  }
+  this->_gameCount += play_result._gameCount;
+  this->_endedGameCount += play_result._endedGameCount;
+  this->_wonGameCount += play_result._wonGameCount;
+  this->_inputCount += play_result._inputCount;
+  this->_mismatchCount += play_result._mismatchCount;
+  this->_recordedTime += play_result._recordedTime;
+}
+
+void fosssweeper::ReplayPlayer::addMismatch(
+    fosssweeper::ReplayPlayResult &play_result,
+    const std::string &mismatch) const {
+  if (play_result._firstMismatch.empty()) {
+    play_result._firstMismatch =
+        "game " + std::to_string(play_result._gameCount) + ": " + mismatch;
+  }
+  play_result._mismatchCount++;
+}
+
+// plays the events of one game, starting with its GameBegin, and stops at the
+// first difference to the recording
+void fosssweeper::ReplayPlayer::playGame(
+    fosssweeper::ReplayPlayResult &play_result) {
+  const auto &game_begin = this->_gameEvents.front();
+  const auto has_undo = std::any_of(
+      this->_gameEvents.begin(), this->_gameEvents.end(),
+      [](const fosssweeper::ReplayEvent &replay_event) {
+        return replay_event._eventType == fosssweeper::ReplayEventType::Undo ||
+               replay_event._eventType == fosssweeper::ReplayEventType::Redo;
+      });
+  play_result._gameCount++;
+  play_result._recordedTime +=
+      this->_gameEvents.back()._time - game_begin._time;
+  this->beginGame(game_begin, has_undo);
+
+  auto previous_game_state = this->_gameModel.getGameState();
+  bool end_pending = false;
+  bool ended = false;
+  const auto finishOperation = [&]() {
+    this->applyActions();
+    const auto game_state = this->_gameModel.getGameState();
+    if (game_state != previous_game_state && getIsEnded(game_state)) {
+      end_pending = true;
+    }
+    previous_game_state = game_state;
+  };
+  for (const auto &replay_event :
+       std::span(this->_gameEvents).subspan(1)) {
+    // only the inputs between batches can end a game unseen, so the game
+    // state is checked there
+    if (getIsAction(replay_event._eventType)) {
+      play_result._inputCount++;
+      this->applyInput(replay_event);
+      continue;
+    }
+    if (replay_event._eventType == fosssweeper::ReplayEventType::Keyframe)
+      continue;
+    finishOperation();
+    if (replay_event._eventType == fosssweeper::ReplayEventType::GameEnd) {
+      const auto game_state = this->_gameModel.getGameState();
+      if (static_cast<std::uint64_t>(game_state) != replay_event._value) {
+        this->addMismatch(play_result,
+                          "recorded as " + getStateName(replay_event._value) +
+                              " but replayed as " +
+                              getStateName(static_cast<std::uint64_t>(
+                                  game_state)));
+        return;
+      }
+      if (this->_gameModel.getVisibleHash() != replay_event._visibleHash) {
+        this->addMismatch(play_result, "the replayed board differs");
+        return;
+      }
+      if (replay_event._gameTime >
+          replay_event._time - game_begin._time +
+              fosssweeper::ReplayPlayer::TIME_TOLERANCE) {
+        this->addMismatch(play_result,
+                          "the game time is longer than the recording");
+        return;
+      }
+      end_pending = false;
+      ended = true;
+      continue;
+    }
+    if (end_pending) {
+      this->addMismatch(play_result, "the replayed game ended early");
+      return;
+    }
+    if (replay_event._eventType !=
+        fosssweeper::ReplayEventType::QuestionsEnabled) {
+      play_result._inputCount++;
+    }
+    this->applyInput(replay_event);
+    finishOperation();
+  }
+  finishOperation();
+  if (end_pending) {
+    this->addMismatch(play_result, "the replayed game ended early");
+    return;
+  }
+  if (ended) {
+    play_result._endedGameCount++;
+    if (this->_gameModel.getGameState() == fosssweeper::GameState::Cool) {
+      play_result._wonGameCount++;
+    }
+  }
+}
+
+void fosssweeper::ReplayPlayer::beginGame(
+    const fosssweeper::ReplayEvent &game_begin, bool journal_enabled) {
+  this->_gameModel.setJournalEnabled(journal_enabled);
+  this->_gameModel.newGame(game_begin._gameConfiguration);
+  this->_gameModel.setGenerationMode(game_begin._generationMode);
+  this->_gameModel.setGameSeed(game_begin._gameSeed);
+  this->_gameModel.setQuestionsEnabled(game_begin._questionsEnabled);
+  this->_actions.clear();
+  this->_batchSize =
+      journal_enabled ? 1 : std::numeric_limits<std::size_t>::max();
+}
+
+void fosssweeper::ReplayPlayer::loadKeyframe(
+    const fosssweeper::ReplayEvent &keyframe, bool journal_enabled) {
+  KeyframeBuffer keyframe_buffer(keyframe._keyframe);
+  std::istream stream(&keyframe_buffer);
+  this->_gameModel.setJournalEnabled(journal_enabled);
+  this->_gameModel.load(stream);
+  this->_actions.clear();
+  this->_batchSize =
+      journal_enabled ? 1 : std::numeric_limits<std::size_t>::max();
+}
+
+// clicks are collected until the batch is full or another input needs the
+// board; events that are not inputs are ignored
+void fosssweeper::ReplayPlayer::applyInput(
+    const fosssweeper::ReplayEvent &replay_event) {
+  if (getIsAction(replay_event._eventType)) {
+    const auto game_configuration = this->_gameModel.getGameConfiguration();
+    const auto buttons_wide =
+        static_cast<std::uint64_t>(game_configuration.getButtonsWide());
+    fosssweeper::Action action;
+    action._actionType = getActionType(replay_event._eventType);
+    // indices outside of the board keep the default position and are
+    // ignored by applyActions
+    if (replay_event._value <
+        static_cast<std::uint64_t>(game_configuration.getButtonCount())) {
+      action._buttonPosition = fosssweeper::ButtonPosition(
+          static_cast<int>(replay_event._value % buttons_wide),
+          static_cast<int>(replay_event._value / buttons_wide));
+    }
+    this->_actions.push_back(action);
+    if (this->_actions.size() >= this->_batchSize) {
+      this->applyActions();
+    }
+    return;
+  }
+  switch (replay_event._eventType) {
+  case fosssweeper::ReplayEventType::CertainMoves:
+    this->applyActions();
+    this->_gameModel.applyCertainMoves();
+    break;
+  case fosssweeper::ReplayEventType::Undo:
+    this->applyActions();
+    this->_gameModel.undo();
+    break;
+  case fosssweeper::ReplayEventType::Redo:
+    this->applyActions();
+    this->_gameModel.redo();
+    break;
+  case fosssweeper::ReplayEventType::QuestionsEnabled:
+    this->applyActions();
+    this->_gameModel.setQuestionsEnabled(replay_event._value != 0);
+    break;
+  default:
+    break;
+  }
+}
+
+void fosssweeper::ReplayPlayer::applyActions() {
+  if (this->_actions.empty())
+    return;
+  this->_actionResults.resize(this->_actions.size());
+  this->_gameModel.applyActions(this->_actions, this->_actionResults);
+  this->_actions.clear();
+}
+
+fosssweeper::ReplayPlayResult
+fosssweeper::ReplayPlayer::play(std::span<const std::uint8_t> bytes) {
+  fosssweeper::ReplayPlayResult play_result;
+  fosssweeper::ReplayDecoder replay_decoder(bytes);
+  fosssweeper::ReplayEvent replay_event;
+  this->_gameEvents.clear();
+  while (replay_decoder.tryDecode(replay_event)) {
+    if (replay_event._eventType == fosssweeper::ReplayEventType::GameBegin) {
+      if (!this->_gameEvents.empty()) {
+        this->playGame(play_result);
+      }
+      this->_gameEvents.clear();
+    } else if (this->_gameEvents.empty()) {
+      throw std::runtime_error("replay log input before a game");
+    }
+    this->_gameEvents.push_back(replay_event);
+  }
+  if (!this->_gameEvents.empty()) {
+    this->playGame(play_result);
+  }
+  return play_result;
+}
+
+const fosssweeper::GameModel &
+fosssweeper::ReplayPlayer::getGameModel() const noexcept {
+  return this->_gameModel;
+}
@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <fosssweeper/replay_recorder.hpp>
+#include <fosssweeper/save_file.hpp>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <utility>
+#include <vector>
+
+const std::size_t fosssweeper::ReplayRecorder::FLUSH_SIZE = 4096;
+const std::size_t fosssweeper::ReplayRecorder::KEYFRAME_INPUT_COUNT = 1000;
+const std::uint64_t fosssweeper::ReplayRecorder::KEYFRAME_TIME = 30000;
+
+void fosssweeper::ReplayRecorder::run() {
+  std::vector<std::uint8_t> bytes;
+  std::vector<fosssweeper::ReplayRecorder::PendingKeyframe> pending_keyframes;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(this->_mutex);
+      this->_condition.wait(lock, [&]() {
+        return this->_stopping || !this->_pendingBytes.empty();
+      });
+      // bytes handed off right before stopping are still written
+      if (this->_pendingBytes.empty())
+        return;
+      bytes.clear();
+      pending_keyframes.clear();
+      std::swap(bytes, this->_pendingBytes);
+      std::swap(pending_keyframes, this->_pendingKeyframes);
+      this->_writing = true;
+    }
+    // every keyframe save goes between the bytes encoded before and after it
+    const std::span<const std::uint8_t> byte_span(bytes);
+    std::size_t offset = 0;
+    for (const auto &pending_keyframe : pending_keyframes) {
+      this->write(byte_span.subspan(offset, pending_keyframe._offset - offset));
+      this->writeKeyframe(pending_keyframe);
+      offset = pending_keyframe._offset;
+    }
+    this->write(byte_span.subspan(offset));
+    this->_stream.get().flush();
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_writing = false;
+    }
+    this->_condition.notify_all();
+  }
+}
+
+void fosssweeper::ReplayRecorder::write(std::span<const std::uint8_t> bytes) {
+  this->_stream.get().write(reinterpret_cast<const char *>(bytes.data()),
+                            static_cast<std::streamsize>(bytes.size()));
+}
+
+void fosssweeper::ReplayRecorder::writeKeyframe(
+    const fosssweeper::ReplayRecorder::PendingKeyframe &pending_keyframe) {
+  const auto &board_snapshot = pending_keyframe._boardSnapshot;
+  this->_keyframeButtons.clear();
+  this->_keyframeButtons.reserve(board_snapshot.getButtonCount());
+  for (std::size_t button_i = 0; button_i < board_snapshot.getButtonCount();
+       button_i++) {
+    this->_keyframeButtons.push_back(board_snapshot.getButton(button_i));
+  }
+  fosssweeper::SaveFile::write(this->_stream.get(), pending_keyframe._header,
+                               this->_keyframeButtons);
+}
+
+// a keyframe handed off with the bytes is written right after them
+void fosssweeper::ReplayRecorder::handOff(
+    std::optional<fosssweeper::ReplayRecorder::PendingKeyframe>
+        pending_keyframe_o) {
+  const auto bytes = this->_encoder.getBytes();
+  if (bytes.empty())
+    return;
+  std::size_t keyframe_size = 0;
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    this->_pendingBytes.insert(this->_pendingBytes.end(), bytes.begin(),
+                               bytes.end());
+    if (pending_keyframe_o.has_value()) {
+      pending_keyframe_o->_offset = this->_pendingBytes.size();
+      keyframe_size = fosssweeper::SaveFile::getFileSize(
+          pending_keyframe_o->_boardSnapshot.getButtonCount());
+      this->_pendingKeyframes.push_back(std::move(*pending_keyframe_o));
+    }
+  }
+  this->_handedOffSize += bytes.size() + keyframe_size;
+  this->_encoder.clear();
+  this->_condition.notify_all();
+}
+
+// games and keyframes are added to the index with the time the decoder gives
+// them, which the encoder keeps from going backwards
+void fosssweeper::ReplayRecorder::addIndexEntry(std::uint64_t position,
+                                                bool is_keyframe) {
+  fosssweeper::ReplayIndexEntry entry;
+  entry._position = position;
+  entry._time = this->_encoder._previousTime;
+  entry._isKeyframe = is_keyframe;
+  this->_replayIndex._entries.push_back(entry);
+  this->_inputsSinceKeyframe = 0;
+  this->_keyframeBeginTime = entry._time;
+}
+
+void fosssweeper::ReplayRecorder::encode(
+    const fosssweeper::ReplayEvent &replay_event) {
+  const auto position = this->_handedOffSize + this->_encoder.getBytes().size();
+  this->_encoder.encode(replay_event);
+  if (replay_event._eventType == fosssweeper::ReplayEventType::GameBegin ||
+      replay_event._eventType == fosssweeper::ReplayEventType::Keyframe) {
+    this->addIndexEntry(position, replay_event._eventType ==
+                                      fosssweeper::ReplayEventType::Keyframe);
+  } else if (replay_event._eventType !=
+             fosssweeper::ReplayEventType::GameEnd) {
+    this->_inputsSinceKeyframe++;
+  }
+  if (this->_encoder.getBytes().size() >=
+      fosssweeper::ReplayRecorder::FLUSH_SIZE) {
+    this->handOff();
+  }
+}
+
+fosssweeper::ReplayRecorder::ReplayRecorder(std::ostream &stream)
+    : _stream(std::ref(stream)), _thread([this]() { this->run(); }) {
+  this->_encoder._bytes.reserve(fosssweeper::ReplayRecorder::FLUSH_SIZE * 2);
+  this->_encoder.writeHeader();
+}
+
+fosssweeper::ReplayRecorder::~ReplayRecorder() {
+  this->_replayIndex._recordingSize =
+      this->_handedOffSize + this->_encoder.getBytes().size();
+  this->_encoder.encodeIndex(this->_replayIndex);
+  this->handOff();
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    this->_stopping = true;
+  }
+  this->_condition.notify_all();
+  this->_thread.join();
+}
+
+void fosssweeper::ReplayRecorder::record(
+    fosssweeper::ReplayEvent replay_event) {
+  replay_event._time = this->getTime();
+  this->encode(replay_event);
+}
+
+// only the snapshot is taken here, which shares the buttons of the GameModel;
+// the worker writes the save of the keyframe
+void fosssweeper::ReplayRecorder::recordKeyframe(
+    fosssweeper::GameModel &game_model) {
+  fosssweeper::ReplayRecorder::PendingKeyframe pending_keyframe;
+  pending_keyframe._header = game_model.getSaveHeader();
+  pending_keyframe._boardSnapshot = game_model.snapshot();
+  const auto position = this->_handedOffSize + this->_encoder.getBytes().size();
+  this->_encoder.encodeKeyframeBegin(
+      this->getTime(), fosssweeper::SaveFile::getFileSize(
+                           pending_keyframe._boardSnapshot.getButtonCount()));
+  this->addIndexEntry(position, true);
+  this->handOff(std::move(pending_keyframe));
+}
+
+bool fosssweeper::ReplayRecorder::getKeyframeDue() const noexcept {
+  return this->_inputsSinceKeyframe >= this->_keyframeInputCount ||
+         (this->_inputsSinceKeyframe > 0 &&
+          this->getTime() - this->_keyframeBeginTime >= this->_keyframeTime);
+}
+
+void fosssweeper::ReplayRecorder::setKeyframeInterval(
+    std::size_t input_count, std::uint64_t time) noexcept {
+  this->_keyframeInputCount = input_count;
+  this->_keyframeTime = time;
+}
+
+void fosssweeper::ReplayRecorder::flush() {
+  this->handOff();
+  std::unique_lock<std::mutex> lock(this->_mutex);
+  this->_condition.wait(lock, [&]() {
+    return this->_pendingBytes.empty() && !this->_writing;
+  });
+}
+
+std::uint64_t fosssweeper::ReplayRecorder::getTime() const noexcept {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - this->_startTime)
+          .count());
+}
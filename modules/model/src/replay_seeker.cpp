@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <fosssweeper/replay_player.hpp>
+#include <fosssweeper/replay_seeker.hpp>
+#include <span>
+#include <stdexcept>
+
+namespace {
+bool getIsSeekPoint(fosssweeper::ReplayEventType event_type) noexcept {
+  return event_type == fosssweeper::ReplayEventType::GameBegin ||
+         event_type == fosssweeper::ReplayEventType::Keyframe;
+}
+} // namespace
+
+// a header in the middle of the log starts another recording, which replaces
+// everything indexed so far
+void fosssweeper::ReplaySeeker::buildIndex() {
+  const auto &magic = fosssweeper::ReplayEncoder::MAGIC;
+  // the version takes a single byte
+  const auto header_size = magic.size() + 1;
+  fosssweeper::ReplayDecoder replay_decoder(this->_bytes);
+  fosssweeper::ReplayEvent replay_event;
+  std::size_t event_end = 0;
+  while (replay_decoder.tryDecode(replay_event)) {
+    const auto event_position = replay_decoder.getEventPosition();
+    if (event_position != event_end && event_position >= header_size &&
+        std::equal(magic.begin(), magic.end(),
+                   this->_bytes.begin() + static_cast<std::ptrdiff_t>(
+                                              event_position - header_size))) {
+      this->_replayIndex._entries.clear();
+      this->_recordingBegin = event_position - header_size;
+    }
+    event_end = replay_decoder.getPosition();
+    if (!getIsSeekPoint(replay_event._eventType))
+      continue;
+    fosssweeper::ReplayIndexEntry entry;
+    entry._position = event_position - this->_recordingBegin;
+    entry._time = replay_event._time;
+    entry._isKeyframe =
+        replay_event._eventType == fosssweeper::ReplayEventType::Keyframe;
+    this->_replayIndex._entries.push_back(entry);
+  }
+  this->_replayIndex._recordingSize =
+      this->_bytes.size() - this->_recordingBegin;
+}
+
+// collects the events from an index entry up to the given time and returns
+// whether any of them undoes or redoes
+bool fosssweeper::ReplaySeeker::collectEvents(std::size_t entry_i,
+                                              std::uint64_t time) {
+  const auto &entry = this->_replayIndex._entries[entry_i];
+  fosssweeper::ReplayDecoder replay_decoder(this->_bytes);
+  replay_decoder.seek(
+      this->_recordingBegin + static_cast<std::size_t>(entry._position),
+      entry._time);
+  this->_events.clear();
+  bool has_undo = false;
+  fosssweeper::ReplayEvent replay_event;
+  while (replay_decoder.tryDecode(replay_event) && replay_event._time <= time) {
+    if (!this->_events.empty() &&
+        replay_event._eventType == fosssweeper::ReplayEventType::GameBegin)
+      break;
+    has_undo = has_undo ||
+               replay_event._eventType == fosssweeper::ReplayEventType::Undo ||
+               replay_event._eventType == fosssweeper::ReplayEventType::Redo;
+    this->_events.push_back(replay_event);
+  }
+  if (this->_events.empty() ||
+      this->_events.front()._eventType !=
+          (entry._isKeyframe ? fosssweeper::ReplayEventType::Keyframe
+                             : fosssweeper::ReplayEventType::GameBegin)) {
+    throw std::runtime_error("replay log index does not match its events");
+  }
+  return has_undo;
+}
+
+fosssweeper::ReplaySeeker::ReplaySeeker(std::span<const std::uint8_t> bytes)
+    : _bytes(bytes) {
+  if (!fosssweeper::ReplayIndex::tryRead(this->_bytes, this->_replayIndex,
+                                         this->_recordingBegin)) {
+    this->buildIndex();
+  }
+}
+
+// returns false for a time before the first game of the recording
+bool fosssweeper::ReplaySeeker::seek(std::uint64_t time) {
+  const auto &entries = this->_replayIndex._entries;
+  const auto entry_it = std::upper_bound(
+      entries.begin(), entries.end(), time,
+      [](std::uint64_t entry_time, const fosssweeper::ReplayIndexEntry &entry) {
+        return entry_time < entry._time;
+      });
+  if (entry_it == entries.begin())
+    return false;
+  auto entry_i = static_cast<std::size_t>(entry_it - entries.begin()) - 1;
+  auto has_undo = this->collectEvents(entry_i, time);
+  if (has_undo && entries[entry_i]._isKeyframe) {
+    while (entry_i > 0 && entries[entry_i]._isKeyframe) {
+      entry_i--;
+    }
+    has_undo = this->collectEvents(entry_i, time);
+  }
+  const auto &first_event = this->_events.front();
+  if (first_event._eventType == fosssweeper::ReplayEventType::GameBegin) {
+    this->_replayPlayer.beginGame(first_event, has_undo);
+  } else {
+    this->_replayPlayer.loadKeyframe(first_event, has_undo);
+  }
+  for (const auto &replay_event : std::span(this->_events).subspan(1)) {
+    this->_replayPlayer.applyInput(replay_event);
+  }
+  this->_replayPlayer.applyActions();
+  this->_appliedCount = this->_events.size() - 1;
+  return true;
+}
+
+const fosssweeper::GameModel &
+fosssweeper::ReplaySeeker::getGameModel() const noexcept {
+  return this->_replayPlayer.getGameModel();
+}
+
+const fosssweeper::ReplayIndex &
+fosssweeper::ReplaySeeker::getReplayIndex() const noexcept {
+  return this->_replayIndex;
+}
+
+std::size_t fosssweeper::ReplaySeeker::getAppliedCount() const noexcept {
+  return this->_appliedCount;
+}
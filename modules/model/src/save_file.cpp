@@ -0,0 +1,305 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button_planes.hpp>
+#include <fosssweeper/save_file.hpp>
+#include <fosssweeper/zobrist.hpp>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+const std::array<char, 8> fosssweeper::SaveFile::MAGIC = {
+    'F', 'S', 'W', 'S', 'A', 'V', 'E', '\0'};
+const std::uint32_t fosssweeper::SaveFile::VERSION = 2;
+const std::size_t fosssweeper::SaveFile::HEADER_SIZE = 72;
+const std::size_t fosssweeper::SaveFile::PLANE_COUNT = 3;
+const std::size_t fosssweeper::SaveFile::MAX_BUTTON_COUNT = 1 << 30;
+const std::size_t fosssweeper::SaveFile::CHUNK_WORD_COUNT = 4096;
+
+namespace {
+std::uint64_t toLittleEndian(std::uint64_t value) noexcept {
+  if constexpr (std::endian::native == std::endian::little) {
+    return value;
+  } else {
+    std::uint64_t swapped = 0;
+    for (int byte_i = 0; byte_i < 8; byte_i++) {
+      swapped = (swapped << 8) | ((value >> (byte_i * 8)) & 0xff);
+    }
+    return swapped;
+  }
+}
+
+void writeInteger(std::span<unsigned char> bytes, std::size_t offset,
+                  std::uint64_t value, std::size_t size) noexcept {
+  for (std::size_t byte_i = 0; byte_i < size; byte_i++) {
+    bytes[offset + byte_i] =
+        static_cast<unsigned char>((value >> (byte_i * 8)) & 0xff);
+  }
+}
+
+std::uint64_t readInteger(std::span<const unsigned char> bytes,
+                          std::size_t offset, std::size_t size) noexcept {
+  std::uint64_t value = 0;
+  for (std::size_t byte_i = 0; byte_i < size; byte_i++) {
+    value |= static_cast<std::uint64_t>(bytes[offset + byte_i]) << (byte_i * 8);
+  }
+  return value;
+}
+
+std::uint64_t getPlaneBit(const fosssweeper::Button &button,
+                          std::size_t plane_i) noexcept {
+  if (plane_i == 0)
+    return button.getHasBomb() ? 1 : 0;
+  const auto button_state = static_cast<unsigned>(button.getButtonState());
+  return (button_state >> (plane_i - 1)) & 1;
+}
+
+// pressed buttons without a bomb, the ones counted off the buttons left
+int getSafeDownCount(const fosssweeper::ButtonPlanes &button_planes) noexcept {
+  int count = 0;
+  for (std::size_t word_i = 0; word_i < button_planes._bombPlane.size();
+       word_i++) {
+    count += std::popcount(button_planes._lowPlane[word_i] &
+                           button_planes._highPlane[word_i] &
+                           ~button_planes._bombPlane[word_i]);
+  }
+  return count;
+}
+
+void readWords(std::istream &stream, std::span<std::uint64_t> words) {
+  stream.read(reinterpret_cast<char *>(words.data()),
+              static_cast<std::streamsize>(words.size_bytes()));
+  if (!stream) {
+    throw std::runtime_error("truncated save file");
+  }
+  if constexpr (std::endian::native != std::endian::little) {
+    for (auto &word : words) {
+      word = toLittleEndian(word);
+    }
+  }
+}
+} // namespace
+
+std::size_t
+fosssweeper::SaveFile::getWordCount(std::size_t button_count) noexcept {
+  return fosssweeper::ButtonPlanes::getWordCount(button_count);
+}
+
+std::size_t fosssweeper::SaveFile::getFileSize(std::size_t button_count) noexcept {
+  return fosssweeper::SaveFile::HEADER_SIZE +
+         fosssweeper::SaveFile::PLANE_COUNT *
+             fosssweeper::SaveFile::getWordCount(button_count) *
+             sizeof(std::uint64_t);
+}
+
+void fosssweeper::SaveFile::write(std::ostream &stream,
+                                  const fosssweeper::SaveFile::Header &header,
+                                  std::span<const fosssweeper::Button> buttons) {
+  const auto &game_configuration = header._gameConfiguration;
+  if (buttons.size() !=
+      static_cast<std::size_t>(game_configuration.getButtonCount())) {
+    throw std::runtime_error("invalid button count");
+  }
+  std::array<unsigned char, 72> header_bytes = std::array<unsigned char, 72>();
+  std::copy(fosssweeper::SaveFile::MAGIC.begin(),
+            fosssweeper::SaveFile::MAGIC.end(), header_bytes.begin());
+  writeInteger(header_bytes, 8, fosssweeper::SaveFile::VERSION, 4);
+  writeInteger(header_bytes, 12, fosssweeper::SaveFile::HEADER_SIZE, 4);
+  writeInteger(header_bytes, 16,
+               static_cast<std::uint32_t>(game_configuration.getButtonsWide()),
+               4);
+  writeInteger(header_bytes, 20,
+               static_cast<std::uint32_t>(game_configuration.getButtonsTall()),
+               4);
+  writeInteger(header_bytes, 24,
+               static_cast<std::uint32_t>(game_configuration.getBombCount()), 4);
+  writeInteger(header_bytes, 28, static_cast<std::uint8_t>(header._gameState),
+               1);
+  writeInteger(header_bytes, 29,
+               static_cast<std::uint8_t>(header._generationMode), 1);
+  writeInteger(header_bytes, 30, header._questionsEnabled ? 1 : 0, 1);
+  writeInteger(header_bytes, 31, fosssweeper::SaveFile::PLANE_COUNT, 1);
+  writeInteger(header_bytes, 32, header._gameTime, 8);
+  writeInteger(header_bytes, 40, header._gameSeed, 8);
+  writeInteger(header_bytes, 48, static_cast<std::uint32_t>(header._flagCount),
+               4);
+  writeInteger(header_bytes, 52,
+               static_cast<std::uint32_t>(header._buttonsLeft), 4);
+  writeInteger(header_bytes, 56, header._layoutHash, 8);
+  writeInteger(header_bytes, 64,
+               static_cast<std::uint32_t>(header._clickCount), 4);
+  stream.write(reinterpret_cast<const char *>(header_bytes.data()),
+               static_cast<std::streamsize>(header_bytes.size()));
+
+  // planes are packed and written in chunks so saving a large board does not
+  // need a second copy of it
+  std::vector<std::uint64_t> words(fosssweeper::SaveFile::CHUNK_WORD_COUNT);
+  const std::size_t word_count =
+      fosssweeper::SaveFile::getWordCount(buttons.size());
+  for (std::size_t plane_i = 0; plane_i < fosssweeper::SaveFile::PLANE_COUNT;
+       plane_i++) {
+    for (std::size_t chunk_begin = 0; chunk_begin < word_count;
+         chunk_begin += words.size()) {
+      const std::size_t chunk_size =
+          std::min(words.size(), word_count - chunk_begin);
+      for (std::size_t word_i = 0; word_i < chunk_size; word_i++) {
+        const std::size_t button_begin = (chunk_begin + word_i) * 64;
+        const std::size_t button_end =
+            std::min(button_begin + 64, buttons.size());
+        std::uint64_t word = 0;
+        for (std::size_t button_i = button_begin; button_i < button_end;
+             button_i++) {
+          word |= getPlaneBit(buttons[button_i], plane_i)
+                  << (button_i - button_begin);
+        }
+        words[word_i] = toLittleEndian(word);
+      }
+      stream.write(reinterpret_cast<const char *>(words.data()),
+                   static_cast<std::streamsize>(chunk_size *
+                                                sizeof(std::uint64_t)));
+    }
+  }
+  if (!stream) {
+    throw std::runtime_error("failed to write save file");
+  }
+}
+
+fosssweeper::SaveFile::Header
+fosssweeper::SaveFile::read(std::istream &stream,
+                            std::vector<fosssweeper::Button> &buttons) {
+  std::array<unsigned char, 72> header_bytes = std::array<unsigned char, 72>();
+  stream.read(reinterpret_cast<char *>(header_bytes.data()),
+              static_cast<std::streamsize>(header_bytes.size()));
+  if (!stream) {
+    throw std::runtime_error("truncated save file");
+  }
+  if (!std::equal(fosssweeper::SaveFile::MAGIC.begin(),
+                  fosssweeper::SaveFile::MAGIC.end(), header_bytes.begin())) {
+    throw std::runtime_error("not a save file");
+  }
+  if (readInteger(header_bytes, 8, 4) != fosssweeper::SaveFile::VERSION) {
+    throw std::runtime_error("unsupported save file version");
+  }
+  if (readInteger(header_bytes, 12, 4) != fosssweeper::SaveFile::HEADER_SIZE ||
+      readInteger(header_bytes, 31, 1) != fosssweeper::SaveFile::PLANE_COUNT) {
+    throw std::runtime_error("invalid save file header");
+  }
+
+  const auto buttons_wide = readInteger(header_bytes, 16, 4);
+  const auto buttons_tall = readInteger(header_bytes, 20, 4);
+  const auto bomb_count = readInteger(header_bytes, 24, 4);
+  if (buttons_wide > fosssweeper::SaveFile::MAX_BUTTON_COUNT ||
+      buttons_tall > fosssweeper::SaveFile::MAX_BUTTON_COUNT ||
+      buttons_wide * buttons_tall > fosssweeper::SaveFile::MAX_BUTTON_COUNT) {
+    throw std::runtime_error("save file board too large");
+  }
+  fosssweeper::SaveFile::Header header;
+  header._gameConfiguration = fosssweeper::GameConfiguration(
+      static_cast<int>(buttons_wide), static_cast<int>(buttons_tall),
+      static_cast<int>(bomb_count));
+  if (static_cast<std::uint64_t>(
+          header._gameConfiguration.getButtonsWide()) != buttons_wide ||
+      static_cast<std::uint64_t>(
+          header._gameConfiguration.getButtonsTall()) != buttons_tall ||
+      static_cast<std::uint64_t>(header._gameConfiguration.getBombCount()) !=
+          bomb_count) {
+    throw std::runtime_error("invalid save file configuration");
+  }
+  const auto game_state = readInteger(header_bytes, 28, 1);
+  const auto generation_mode = readInteger(header_bytes, 29, 1);
+  const auto questions_enabled = readInteger(header_bytes, 30, 1);
+  if (game_state > static_cast<std::uint64_t>(fosssweeper::GameState::Cool) ||
+      generation_mode >
+          static_cast<std::uint64_t>(fosssweeper::GenerationMode::NoGuess) ||
+      questions_enabled > 1) {
+    throw std::runtime_error("invalid save file header");
+  }
+  header._gameState = static_cast<fosssweeper::GameState>(game_state);
+  header._generationMode =
+      static_cast<fosssweeper::GenerationMode>(generation_mode);
+  header._questionsEnabled = questions_enabled != 0;
+  header._gameTime = readInteger(header_bytes, 32, 8);
+  header._gameSeed = readInteger(header_bytes, 40, 8);
+  header._flagCount =
+      static_cast<std::int32_t>(readInteger(header_bytes, 48, 4));
+  header._buttonsLeft =
+      static_cast<std::int32_t>(readInteger(header_bytes, 52, 4));
+  header._layoutHash = readInteger(header_bytes, 56, 8);
+  header._clickCount =
+      static_cast<std::int32_t>(readInteger(header_bytes, 64, 4));
+
+  fosssweeper::ButtonPlanes button_planes;
+  button_planes.reset(
+      static_cast<std::size_t>(header._gameConfiguration.getButtonCount()));
+  readWords(stream, button_planes._bombPlane);
+  readWords(stream, button_planes._lowPlane);
+  readWords(stream, button_planes._highPlane);
+  if (button_planes.getHasPadding()) {
+    throw std::runtime_error("invalid save file padding");
+  }
+  std::uint64_t layout_hash = fosssweeper::getConfigurationZobristKey(
+      header._gameConfiguration.getButtonsWide(),
+      header._gameConfiguration.getButtonsTall());
+  for (std::size_t word_i = 0; word_i < button_planes._bombPlane.size();
+       word_i++) {
+    for (auto word = button_planes._bombPlane[word_i]; word != 0;
+         word &= word - 1) {
+      layout_hash ^= fosssweeper::getLayoutZobristKey(
+          word_i * 64 + static_cast<std::size_t>(std::countr_zero(word)));
+    }
+  }
+  if (layout_hash != header._layoutHash) {
+    throw std::runtime_error("save file layout hash mismatch");
+  }
+  // the counters drive win detection and the bomb counter, so they have to
+  // agree with the planes; bombs are only missing before the first click
+  const auto &game_configuration = header._gameConfiguration;
+  const auto plane_bomb_count = button_planes.getBombCount();
+  if (plane_bomb_count != game_configuration.getBombCount() &&
+      (plane_bomb_count != 0 ||
+       header._gameState != fosssweeper::GameState::None)) {
+    throw std::runtime_error("save file bomb count mismatch");
+  }
+  if (header._flagCount != button_planes.getFlagCount()) {
+    throw std::runtime_error("save file flag count mismatch");
+  }
+  if (header._buttonsLeft != game_configuration.getButtonCount() -
+                                 game_configuration.getBombCount() -
+                                 getSafeDownCount(button_planes)) {
+    throw std::runtime_error("save file buttons left mismatch");
+  }
+  if (header._clickCount < 0) {
+    throw std::runtime_error("invalid save file click count");
+  }
+  button_planes.unpack(buttons, header._gameConfiguration.getButtonsWide(),
+                       header._gameConfiguration.getButtonsTall());
+  return header;
+}
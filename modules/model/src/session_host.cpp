@@ -0,0 +1,273 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/session_host.hpp>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+const std::size_t fosssweeper::SessionHost::SLAB_SIZE = 64;
+
+void fosssweeper::SessionHost::run(std::size_t shard_i) {
+  auto &shard = *this->_shards[shard_i];
+  std::vector<fosssweeper::SessionHost::Request> requests;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(shard._mutex);
+      shard._condition.wait(lock, [&]() {
+        return shard._stopping || !shard._pendingRequests.empty();
+      });
+      if (shard._pendingRequests.empty())
+        return;
+      std::swap(requests, shard._pendingRequests);
+    }
+    for (auto &request : requests) {
+      this->handle(shard_i, request);
+    }
+    requests.clear();
+  }
+}
+
+void fosssweeper::SessionHost::handle(
+    std::size_t shard_i, fosssweeper::SessionHost::Request &request) {
+  auto &shard = *this->_shards[shard_i];
+  fosssweeper::SessionResponse session_response;
+  session_response._sessionId = request._sessionId;
+  try {
+    if (request._operation == fosssweeper::SessionOperation::Create) {
+      const auto slot_i = this->allocateSlot(shard_i);
+      auto &game_model = this->getSlotGameModel(shard_i, slot_i);
+      game_model.newGame(request._gameConfiguration);
+      game_model.setGenerationMode(request._generationMode);
+      game_model.setGameSeed(request._gameSeed);
+      session_response._sessionId =
+          this->makeSessionId(shard_i, slot_i, shard._generations[slot_i]);
+      session_response._boardSnapshot = game_model.snapshot();
+    } else {
+      auto *const game_model =
+          this->findGameModel(shard_i, request._sessionId);
+      if (game_model == nullptr) {
+        throw std::runtime_error("unknown session");
+      }
+      if (request._operation == fosssweeper::SessionOperation::Act) {
+        session_response._actionResults.resize(request._actions.size());
+        session_response._processedCount = game_model->applyActions(
+            request._actions, session_response._actionResults);
+        session_response._boardSnapshot = game_model->snapshot();
+      } else if (request._operation == fosssweeper::SessionOperation::Query) {
+        session_response._boardSnapshot = game_model->snapshot();
+      } else {
+        const auto slot_i = this->getSlotI(request._sessionId);
+        shard._liveSlots[slot_i] = 0;
+        shard._generations[slot_i]++;
+        shard._freeSlots.push_back(slot_i);
+        shard._sessionCount--;
+      }
+    }
+    request._promise.set_value(std::move(session_response));
+  } catch (...) {
+    request._promise.set_exception(std::current_exception());
+  }
+  const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - request._enqueueTime);
+  const std::lock_guard<std::mutex> lock(shard._statsMutex);
+  shard._latencyHistograms[static_cast<std::size_t>(request._operation)]
+      .record(static_cast<std::uint64_t>(latency.count()));
+}
+
+fosssweeper::GameModel *
+fosssweeper::SessionHost::findGameModel(std::size_t shard_i,
+                                        std::uint64_t session_id) {
+  auto &shard = *this->_shards[shard_i];
+  const auto slot_i = this->getSlotI(session_id);
+  if (slot_i >= shard._liveSlots.size() || shard._liveSlots[slot_i] == 0 ||
+      shard._generations[slot_i] != static_cast<std::uint32_t>(session_id >> 32))
+    return nullptr;
+  return &this->getSlotGameModel(shard_i, slot_i);
+}
+
+std::uint32_t fosssweeper::SessionHost::allocateSlot(std::size_t shard_i) {
+  auto &shard = *this->_shards[shard_i];
+  if (shard._freeSlots.empty()) {
+    const auto slot_count = shard._liveSlots.size();
+    if ((slot_count + fosssweeper::SessionHost::SLAB_SIZE) * this->_shards.size() >
+        std::numeric_limits<std::uint32_t>::max()) {
+      throw std::runtime_error("too many sessions");
+    }
+    shard._slabs.push_back(std::make_unique<fosssweeper::GameModel[]>(
+        fosssweeper::SessionHost::SLAB_SIZE));
+    shard._generations.resize(slot_count + fosssweeper::SessionHost::SLAB_SIZE);
+    shard._liveSlots.resize(slot_count + fosssweeper::SessionHost::SLAB_SIZE);
+    // hand out the lowest slot first
+    for (auto slot_i = slot_count + fosssweeper::SessionHost::SLAB_SIZE;
+         slot_i > slot_count; slot_i--) {
+      shard._freeSlots.push_back(static_cast<std::uint32_t>(slot_i - 1));
+    }
+  }
+  const auto slot_i = shard._freeSlots.back();
+  shard._freeSlots.pop_back();
+  shard._liveSlots[slot_i] = 1;
+  shard._sessionCount++;
+  return slot_i;
+}
+
+fosssweeper::GameModel &
+fosssweeper::SessionHost::getSlotGameModel(std::size_t shard_i,
+                                           std::uint32_t slot_i) {
+  auto &shard = *this->_shards[shard_i];
+  return shard._slabs[slot_i / fosssweeper::SessionHost::SLAB_SIZE]
+                     [slot_i % fosssweeper::SessionHost::SLAB_SIZE];
+}
+
+std::future<fosssweeper::SessionResponse>
+fosssweeper::SessionHost::submit(std::size_t shard_i,
+                                 fosssweeper::SessionHost::Request request) {
+  auto &shard = *this->_shards[shard_i];
+  auto future = request._promise.get_future();
+  request._enqueueTime = std::chrono::steady_clock::now();
+  {
+    const std::lock_guard<std::mutex> lock(shard._mutex);
+    shard._pendingRequests.push_back(std::move(request));
+  }
+  shard._condition.notify_one();
+  return future;
+}
+
+std::uint64_t
+fosssweeper::SessionHost::makeSessionId(std::size_t shard_i,
+                                        std::uint32_t slot_i,
+                                        std::uint32_t generation) const noexcept {
+  return (static_cast<std::uint64_t>(generation) << 32) |
+         ((static_cast<std::uint64_t>(slot_i) * this->_shards.size()) +
+          shard_i);
+}
+
+std::size_t
+fosssweeper::SessionHost::getShardI(std::uint64_t session_id) const noexcept {
+  return static_cast<std::size_t>(session_id & 0xffffffff) %
+         this->_shards.size();
+}
+
+std::uint32_t
+fosssweeper::SessionHost::getSlotI(std::uint64_t session_id) const noexcept {
+  return static_cast<std::uint32_t>((session_id & 0xffffffff) /
+                                    this->_shards.size());
+}
+
+fosssweeper::SessionHost::SessionHost(std::size_t shard_count) {
+  if (shard_count == 0) {
+    throw std::runtime_error("shard count must not be zero");
+  }
+  for (std::size_t shard_i = 0; shard_i < shard_count; shard_i++) {
+    this->_shards.push_back(std::make_unique<fosssweeper::SessionHost::Shard>());
+  }
+  for (std::size_t shard_i = 0; shard_i < shard_count; shard_i++) {
+    this->_shards[shard_i]->_thread =
+        std::thread([this, shard_i]() { this->run(shard_i); });
+  }
+}
+
+// requests that are already queued are still answered
+fosssweeper::SessionHost::~SessionHost() {
+  for (auto &shard : this->_shards) {
+    {
+      const std::lock_guard<std::mutex> lock(shard->_mutex);
+      shard->_stopping = true;
+    }
+    shard->_condition.notify_one();
+  }
+  for (auto &shard : this->_shards) {
+    shard->_thread.join();
+  }
+}
+
+std::future<fosssweeper::SessionResponse> fosssweeper::SessionHost::create(
+    fosssweeper::GameConfiguration game_configuration,
+    fosssweeper::GenerationMode generation_mode, std::uint64_t game_seed) {
+  fosssweeper::SessionHost::Request request;
+  request._operation = fosssweeper::SessionOperation::Create;
+  request._gameConfiguration = game_configuration;
+  request._generationMode = generation_mode;
+  request._gameSeed = game_seed;
+  return this->submit(this->_nextShardI++ % this->_shards.size(),
+                      std::move(request));
+}
+
+std::future<fosssweeper::SessionResponse>
+fosssweeper::SessionHost::act(std::uint64_t session_id,
+                              std::vector<fosssweeper::Action> actions) {
+  fosssweeper::SessionHost::Request request;
+  request._operation = fosssweeper::SessionOperation::Act;
+  request._sessionId = session_id;
+  request._actions = std::move(actions);
+  return this->submit(this->getShardI(session_id), std::move(request));
+}
+
+std::future<fosssweeper::SessionResponse>
+fosssweeper::SessionHost::query(std::uint64_t session_id) {
+  fosssweeper::SessionHost::Request request;
+  request._operation = fosssweeper::SessionOperation::Query;
+  request._sessionId = session_id;
+  return this->submit(this->getShardI(session_id), std::move(request));
+}
+
+std::future<fosssweeper::SessionResponse>
+fosssweeper::SessionHost::destroy(std::uint64_t session_id) {
+  fosssweeper::SessionHost::Request request;
+  request._operation = fosssweeper::SessionOperation::Destroy;
+  request._sessionId = session_id;
+  return this->submit(this->getShardI(session_id), std::move(request));
+}
+
+std::size_t fosssweeper::SessionHost::getShardCount() const noexcept {
+  return this->_shards.size();
+}
+
+std::size_t fosssweeper::SessionHost::getSessionCount() const noexcept {
+  std::size_t session_count = 0;
+  for (const auto &shard : this->_shards) {
+    session_count += shard->_sessionCount.load();
+  }
+  return session_count;
+}
+
+fosssweeper::LatencyHistogram fosssweeper::SessionHost::getLatencyHistogram(
+    fosssweeper::SessionOperation operation) const {
+  fosssweeper::LatencyHistogram latency_histogram;
+  for (const auto &shard : this->_shards) {
+    const std::lock_guard<std::mutex> lock(shard->_statsMutex);
+    latency_histogram.merge(
+        shard->_latencyHistograms[static_cast<std::size_t>(operation)]);
+  }
+  return latency_histogram;
+}
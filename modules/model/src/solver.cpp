@@ -0,0 +1,306 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/board_snapshot.hpp>
+#include <fosssweeper/button_state.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/solver.hpp>
+#include <fosssweeper/surrounding_buttons.hpp>
+#include <vector>
+
+const std::int8_t fosssweeper::Solver::UNKNOWN_BUTTON = -1;
+
+bool fosssweeper::Solver::tryAddSafeButton(
+    std::size_t button_i, std::vector<std::size_t> &safe_buttons) {
+  if (this->_foundButtons[button_i])
+    return false;
+  this->_foundButtons[button_i] = 1;
+  safe_buttons.push_back(button_i);
+  return true;
+}
+
+bool fosssweeper::Solver::tryAddBombButton(
+    std::size_t button_i, std::vector<std::size_t> &bomb_buttons) {
+  if (this->_foundButtons[button_i])
+    return false;
+  this->_foundButtons[button_i] = 1;
+  bomb_buttons.push_back(button_i);
+  return true;
+}
+
+fosssweeper::Solver::Constraint
+fosssweeper::Solver::getConstraint(std::size_t button_i) const noexcept {
+  fosssweeper::Solver::Constraint constraint;
+  constraint._buttonI = button_i;
+  constraint._bombsLeft = this->_surroundingBombs[button_i];
+  const fosssweeper::SurroundingButtons surrounding_buttons(
+      button_i, this->_gameConfiguration.getButtonsWide(),
+      this->_gameConfiguration.getButtonsTall());
+  for (const auto surrounding_i : surrounding_buttons) {
+    if (this->_knownBombs[surrounding_i]) {
+      constraint._bombsLeft--;
+    } else if (this->_surroundingBombs[surrounding_i] ==
+               fosssweeper::Solver::UNKNOWN_BUTTON) {
+      constraint._unknownButtons[constraint._unknownCount++] = surrounding_i;
+    }
+  }
+  return constraint;
+}
+
+void fosssweeper::Solver::findSingleConstraintButtons(
+    std::vector<std::size_t> &safe_buttons,
+    std::vector<std::size_t> &bomb_buttons) {
+  this->_constraints.clear();
+  for (std::size_t button_i = 0; button_i < this->_surroundingBombs.size();
+       button_i++) {
+    if (this->_surroundingBombs[button_i] ==
+        fosssweeper::Solver::UNKNOWN_BUTTON) {
+      continue;
+    }
+    const auto constraint = this->getConstraint(button_i);
+    if (constraint._unknownCount == 0)
+      continue;
+    if (constraint._bombsLeft == 0) {
+      for (std::size_t unknown_i = 0; unknown_i < constraint._unknownCount;
+           unknown_i++) {
+        this->tryAddSafeButton(constraint._unknownButtons[unknown_i],
+                               safe_buttons);
+      }
+    } else if (constraint._bombsLeft ==
+               static_cast<int>(constraint._unknownCount)) {
+      for (std::size_t unknown_i = 0; unknown_i < constraint._unknownCount;
+           unknown_i++) {
+        this->tryAddBombButton(constraint._unknownButtons[unknown_i],
+                               bomb_buttons);
+      }
+    } else {
+      this->_constraintIndices[button_i] =
+          static_cast<int>(this->_constraints.size());
+      this->_constraints.push_back(constraint);
+    }
+  }
+}
+
+void fosssweeper::Solver::findPairConstraintButtons(
+    std::vector<std::size_t> &safe_buttons,
+    std::vector<std::size_t> &bomb_buttons) {
+  const int buttons_wide = this->_gameConfiguration.getButtonsWide();
+  const int buttons_tall = this->_gameConfiguration.getButtonsTall();
+  for (const auto &constraint_a : this->_constraints) {
+    const int a_x = static_cast<int>(constraint_a._buttonI) % buttons_wide;
+    const int a_y = static_cast<int>(constraint_a._buttonI) / buttons_wide;
+    for (int b_y = a_y - 2; b_y <= a_y + 2; b_y++) {
+      if (b_y < 0 || b_y >= buttons_tall)
+        continue;
+      for (int b_x = a_x - 2; b_x <= a_x + 2; b_x++) {
+        if (b_x < 0 || b_x >= buttons_wide || (b_x == a_x && b_y == a_y))
+          continue;
+        const int constraint_b_i =
+            this->_constraintIndices[static_cast<std::size_t>(
+                b_y * buttons_wide + b_x)];
+        if (constraint_b_i < 0)
+          continue;
+        const auto &constraint_b = this->_constraints[constraint_b_i];
+        // the bombs only surrounding b minus the bombs only surrounding a is
+        // the difference of their bombs left, so if that difference is as
+        // large as the buttons only surrounding b, all of them are bombs and
+        // all buttons only surrounding a are safe.
+        std::size_t only_a_count = 0;
+        std::size_t only_b_count = 0;
+        std::array<std::size_t, 8> only_a;
+        std::array<std::size_t, 8> only_b;
+        for (std::size_t a_i = 0; a_i < constraint_a._unknownCount; a_i++) {
+          bool shared = false;
+          for (std::size_t b_i = 0; b_i < constraint_b._unknownCount; b_i++) {
+            if (constraint_a._unknownButtons[a_i] ==
+                constraint_b._unknownButtons[b_i]) {
+              shared = true;
+              break;
+            }
+          }
+          if (!shared) {
+            only_a[only_a_count++] = constraint_a._unknownButtons[a_i];
+          }
+        }
+        if (only_a_count == constraint_a._unknownCount)
+          continue;
+        for (std::size_t b_i = 0; b_i < constraint_b._unknownCount; b_i++) {
+          bool shared = false;
+          for (std::size_t a_i = 0; a_i < constraint_a._unknownCount; a_i++) {
+            if (constraint_b._unknownButtons[b_i] ==
+                constraint_a._unknownButtons[a_i]) {
+              shared = true;
+              break;
+            }
+          }
+          if (!shared) {
+            only_b[only_b_count++] = constraint_b._unknownButtons[b_i];
+          }
+        }
+        if (constraint_b._bombsLeft - constraint_a._bombsLeft !=
+            static_cast<int>(only_b_count))
+          continue;
+        for (std::size_t only_i = 0; only_i < only_a_count; only_i++) {
+          this->tryAddSafeButton(only_a[only_i], safe_buttons);
+        }
+        for (std::size_t only_i = 0; only_i < only_b_count; only_i++) {
+          this->tryAddBombButton(only_b[only_i], bomb_buttons);
+        }
+      }
+    }
+  }
+}
+
+void fosssweeper::Solver::findBombCountButtons(
+    std::vector<std::size_t> &safe_buttons,
+    std::vector<std::size_t> &bomb_buttons) {
+  const int bombs_left =
+      this->_gameConfiguration.getBombCount() - this->_knownBombCount;
+  const int unknown_count = this->_gameConfiguration.getButtonCount() -
+                            this->_revealedCount - this->_knownBombCount;
+  if (unknown_count == 0 || (bombs_left != 0 && bombs_left != unknown_count))
+    return;
+  for (std::size_t button_i = 0; button_i < this->_surroundingBombs.size();
+       button_i++) {
+    if (this->_surroundingBombs[button_i] !=
+            fosssweeper::Solver::UNKNOWN_BUTTON ||
+        this->_knownBombs[button_i]) {
+      continue;
+    }
+    if (bombs_left == 0) {
+      this->tryAddSafeButton(button_i, safe_buttons);
+    } else {
+      this->tryAddBombButton(button_i, bomb_buttons);
+    }
+  }
+}
+
+fosssweeper::Solver::Solver(fosssweeper::GameConfiguration game_configuration) {
+  this->reset(game_configuration);
+}
+
+void fosssweeper::Solver::reset(
+    fosssweeper::GameConfiguration game_configuration) {
+  const auto button_count =
+      static_cast<std::size_t>(game_configuration.getButtonCount());
+  this->_gameConfiguration = game_configuration;
+  this->_surroundingBombs.assign(button_count,
+                                 fosssweeper::Solver::UNKNOWN_BUTTON);
+  this->_knownBombs.assign(button_count, 0);
+  this->_foundButtons.assign(button_count, 0);
+  this->_constraintIndices.assign(button_count, -1);
+  this->_constraints.clear();
+  this->_revealedCount = 0;
+  this->_knownBombCount = 0;
+}
+
+void fosssweeper::Solver::loadButton(std::size_t button_i,
+                                     const fosssweeper::Button &button) {
+  if (button.getButtonState() != fosssweeper::ButtonState::Down)
+    return;
+  if (button.getHasBomb()) {
+    this->markBomb(button_i);
+  } else {
+    this->reveal(button_i, button.getSurroundingBombs());
+  }
+}
+
+void fosssweeper::Solver::load(const fosssweeper::GameModel &game_model) {
+  this->reset(game_model.getGameConfiguration());
+  const auto &buttons = game_model.getButtons();
+  for (std::size_t button_i = 0; button_i < buttons.size(); button_i++) {
+    this->loadButton(button_i, buttons[button_i]);
+  }
+}
+
+void fosssweeper::Solver::load(
+    const fosssweeper::BoardSnapshot &board_snapshot) {
+  this->reset(board_snapshot.getGameConfiguration());
+  for (std::size_t button_i = 0; button_i < board_snapshot.getButtonCount();
+       button_i++) {
+    this->loadButton(button_i, board_snapshot.getButton(button_i));
+  }
+}
+
+void fosssweeper::Solver::reveal(std::size_t button_i, int surrounding_bombs) {
+  if (this->_surroundingBombs[button_i] == fosssweeper::Solver::UNKNOWN_BUTTON) {
+    this->_revealedCount++;
+  }
+  this->_surroundingBombs[button_i] = static_cast<std::int8_t>(surrounding_bombs);
+}
+
+void fosssweeper::Solver::markBomb(std::size_t button_i) {
+  if (!this->_knownBombs[button_i]) {
+    this->_knownBombs[button_i] = 1;
+    this->_knownBombCount++;
+  }
+}
+
+bool fosssweeper::Solver::findCertainButtons(
+    std::vector<std::size_t> &safe_buttons,
+    std::vector<std::size_t> &bomb_buttons) {
+  safe_buttons.clear();
+  bomb_buttons.clear();
+  this->findSingleConstraintButtons(safe_buttons, bomb_buttons);
+  if (safe_buttons.empty() && bomb_buttons.empty()) {
+    this->findPairConstraintButtons(safe_buttons, bomb_buttons);
+  }
+  if (safe_buttons.empty() && bomb_buttons.empty()) {
+    this->findBombCountButtons(safe_buttons, bomb_buttons);
+  }
+  for (const auto &constraint : this->_constraints) {
+    this->_constraintIndices[constraint._buttonI] = -1;
+  }
+  for (const auto button_i : safe_buttons) {
+    this->_foundButtons[button_i] = 0;
+  }
+  for (const auto button_i : bomb_buttons) {
+    this->_foundButtons[button_i] = 0;
+  }
+  return !safe_buttons.empty() || !bomb_buttons.empty();
+}
+
+bool fosssweeper::Solver::getIsRevealed(std::size_t button_i) const noexcept {
+  return this->_surroundingBombs[button_i] !=
+         fosssweeper::Solver::UNKNOWN_BUTTON;
+}
+
+bool fosssweeper::Solver::getIsKnownBomb(std::size_t button_i) const noexcept {
+  return this->_knownBombs[button_i] != 0;
+}
+
+int fosssweeper::Solver::getRevealedCount() const noexcept {
+  return this->_revealedCount;
+}
+
+int fosssweeper::Solver::getKnownBombCount() const noexcept {
+  return this->_knownBombCount;
+}
+
+fosssweeper::GameConfiguration
+fosssweeper::Solver::getGameConfiguration() const noexcept {
+  return this->_gameConfiguration;
+}
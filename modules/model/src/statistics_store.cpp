@@ -0,0 +1,395 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_record.hpp>
+#include <fosssweeper/mapped_file.hpp>
+#include <fosssweeper/statistics_store.hpp>
+#include <fosssweeper/zobrist.hpp>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+const std::array<char, 8> fosssweeper::StatisticsStore::MAGIC = {
+    'F', 'S', 'W', 'S', 'T', 'A', 'T', 'S'};
+const std::uint32_t fosssweeper::StatisticsStore::VERSION = 1;
+const std::size_t fosssweeper::StatisticsStore::HEADER_SIZE = 16;
+const std::size_t fosssweeper::StatisticsStore::BEST_TIME_COUNT = 10;
+const std::size_t fosssweeper::StatisticsStore::MAX_RECORD_COUNT = 1 << 22;
+
+namespace {
+void writeInteger(std::span<unsigned char> bytes, std::size_t offset,
+                  std::uint64_t value, std::size_t size) noexcept {
+  for (std::size_t byte_i = 0; byte_i < size; byte_i++) {
+    bytes[offset + byte_i] =
+        static_cast<unsigned char>((value >> (byte_i * 8)) & 0xff);
+  }
+}
+
+std::uint64_t readInteger(std::span<const unsigned char> bytes,
+                          std::size_t offset, std::size_t size) noexcept {
+  std::uint64_t value = 0;
+  for (std::size_t byte_i = 0; byte_i < size; byte_i++) {
+    value |= static_cast<std::uint64_t>(bytes[offset + byte_i]) << (byte_i * 8);
+  }
+  return value;
+}
+
+// ties go to the game finished first, it set the time
+bool getIsFaster(const fosssweeper::GameRecord &a,
+                 const fosssweeper::GameRecord &b) noexcept {
+  if (a._gameTime != b._gameTime)
+    return a._gameTime < b._gameTime;
+  return a._finishedAt < b._finishedAt;
+}
+} // namespace
+
+std::size_t fosssweeper::GameConfigurationHash::operator()(
+    const fosssweeper::GameConfiguration &game_configuration) const noexcept {
+  return static_cast<std::size_t>(fosssweeper::mixZobristKey(
+      fosssweeper::getConfigurationZobristKey(
+          game_configuration.getButtonsWide(),
+          game_configuration.getButtonsTall()) ^
+      static_cast<std::uint64_t>(game_configuration.getBombCount())));
+}
+
+// returns the place the game took among the best times
+std::optional<std::size_t> fosssweeper::StatisticsStore::insertBestTime(
+    BestTimeMap &best_times, const fosssweeper::GameRecord &game_record) {
+  if (!game_record.getIsWon())
+    return std::nullopt;
+  auto &records = best_times[game_record._gameConfiguration];
+  const auto it = std::upper_bound(records.begin(), records.end(),
+                                   game_record, getIsFaster);
+  const auto rank = static_cast<std::size_t>(it - records.begin());
+  if (rank >= fosssweeper::StatisticsStore::BEST_TIME_COUNT)
+    return std::nullopt;
+  records.insert(it, game_record);
+  if (records.size() > fosssweeper::StatisticsStore::BEST_TIME_COUNT) {
+    records.pop_back();
+  }
+  return rank;
+}
+
+void fosssweeper::StatisticsStore::run() {
+  this->load();
+  while (true) {
+    std::vector<fosssweeper::GameRecord> game_records;
+    {
+      std::unique_lock<std::mutex> lock(this->_mutex);
+      this->_condition.wait(lock, [&]() {
+        return this->_stopping || !this->_pendingRecords.empty();
+      });
+      // records added right before stopping are still written
+      if (this->_pendingRecords.empty())
+        return;
+      game_records.swap(this->_pendingRecords);
+      this->_writing = true;
+    }
+    try {
+      this->append(game_records);
+    } catch (const std::exception &) {
+      // the records stay in the best times until the game is closed
+    }
+    {
+      std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_writing = false;
+    }
+    this->_condition.notify_all();
+  }
+}
+
+// the best times are built from the log without holding the lock, games added
+// meanwhile are merged in afterwards
+void fosssweeper::StatisticsStore::load() {
+  std::vector<fosssweeper::GameRecord> game_records;
+  bool failed = false;
+  try {
+    bool needs_rewrite = false;
+    game_records =
+        fosssweeper::StatisticsStore::readLog(this->_path, needs_rewrite);
+    // a log that outgrew the limit in earlier sessions is compacted right
+    // away instead of waiting for this session to append to it
+    if (game_records.size() > this->_maxRecordCount) {
+      game_records = fosssweeper::StatisticsStore::compact(
+          game_records, this->_maxRecordCount / 4 * 3);
+      needs_rewrite = true;
+    }
+    if (needs_rewrite) {
+      fosssweeper::StatisticsStore::writeLog(this->_path, game_records);
+    }
+  } catch (const std::exception &) {
+    // a file that is not a statistics log is left alone
+    game_records.clear();
+    failed = true;
+  }
+  BestTimeMap best_times;
+  for (const auto &game_record : game_records) {
+    fosssweeper::StatisticsStore::insertBestTime(best_times, game_record);
+  }
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    for (const auto &[game_configuration, records] : this->_bestTimes) {
+      for (const auto &game_record : records) {
+        fosssweeper::StatisticsStore::insertBestTime(best_times, game_record);
+      }
+    }
+    this->_bestTimes = std::move(best_times);
+    this->_recordCount = game_records.size();
+    this->_failed = failed;
+    this->_loaded = true;
+  }
+  this->_condition.notify_all();
+}
+
+void fosssweeper::StatisticsStore::append(
+    const std::vector<fosssweeper::GameRecord> &game_records) {
+  if (this->_failed)
+    return;
+  std::error_code error_code;
+  if (!std::filesystem::exists(this->_path, error_code)) {
+    fosssweeper::StatisticsStore::writeLog(this->_path, {});
+  }
+  std::vector<unsigned char> bytes(game_records.size() *
+                                   fosssweeper::GameRecord::SIZE);
+  for (std::size_t record_i = 0; record_i < game_records.size(); record_i++) {
+    game_records[record_i].encode(std::span<unsigned char>(bytes).subspan(
+        record_i * fosssweeper::GameRecord::SIZE,
+        fosssweeper::GameRecord::SIZE));
+  }
+  {
+    std::ofstream stream(this->_path, std::ios::binary | std::ios::app);
+    stream.write(reinterpret_cast<const char *>(bytes.data()),
+                 static_cast<std::streamsize>(bytes.size()));
+    stream.flush();
+    if (!stream) {
+      throw std::runtime_error("failed to write " + this->_path.string());
+    }
+  }
+  std::size_t record_count = 0;
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    this->_recordCount += game_records.size();
+    record_count = this->_recordCount;
+  }
+  // compaction keeps a quarter of the limit free, so it runs at most once per
+  // that many appended games however they are spread over sessions
+  if (record_count <= this->_maxRecordCount)
+    return;
+  bool needs_rewrite = false;
+  const auto kept_records = fosssweeper::StatisticsStore::compact(
+      fosssweeper::StatisticsStore::readLog(this->_path, needs_rewrite),
+      this->_maxRecordCount / 4 * 3);
+  fosssweeper::StatisticsStore::writeLog(this->_path, kept_records);
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  this->_recordCount = kept_records.size();
+}
+
+fosssweeper::StatisticsStore::StatisticsStore(std::filesystem::path path,
+                                              std::size_t max_record_count)
+    : _path(std::move(path)), _maxRecordCount(max_record_count),
+      _thread([this]() { this->run(); }) {}
+
+fosssweeper::StatisticsStore::~StatisticsStore() {
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    this->_stopping = true;
+  }
+  this->_condition.notify_all();
+  this->_thread.join();
+}
+
+// a missing log holds no games yet; an empty one or one with a torn or damaged
+// record needs to be written again before records are appended to it
+std::vector<fosssweeper::GameRecord>
+fosssweeper::StatisticsStore::readLog(const std::filesystem::path &path,
+                                      bool &needs_rewrite) {
+  needs_rewrite = false;
+  std::vector<fosssweeper::GameRecord> game_records;
+  std::error_code error_code;
+  if (!std::filesystem::exists(path, error_code))
+    return game_records;
+  if (std::filesystem::file_size(path) == 0) {
+    needs_rewrite = true;
+    return game_records;
+  }
+  const fosssweeper::MappedFile mapped_file(path);
+  const auto bytes = mapped_file.getData();
+  if (bytes.size() < fosssweeper::StatisticsStore::HEADER_SIZE ||
+      !std::equal(fosssweeper::StatisticsStore::MAGIC.begin(),
+                  fosssweeper::StatisticsStore::MAGIC.end(), bytes.begin())) {
+    throw std::runtime_error("not a statistics log");
+  }
+  if (readInteger(bytes, 8, 4) != fosssweeper::StatisticsStore::VERSION) {
+    throw std::runtime_error("unsupported statistics log version");
+  }
+  if (readInteger(bytes, 12, 4) != fosssweeper::GameRecord::SIZE) {
+    throw std::runtime_error("invalid statistics log header");
+  }
+  const auto record_bytes =
+      bytes.subspan(fosssweeper::StatisticsStore::HEADER_SIZE);
+  const auto record_count = record_bytes.size() / fosssweeper::GameRecord::SIZE;
+  needs_rewrite = record_bytes.size() % fosssweeper::GameRecord::SIZE != 0;
+  game_records.reserve(record_count);
+  fosssweeper::GameRecord game_record;
+  for (std::size_t record_i = 0; record_i < record_count; record_i++) {
+    if (fosssweeper::GameRecord::tryDecode(
+            record_bytes.subspan(record_i * fosssweeper::GameRecord::SIZE,
+                                 fosssweeper::GameRecord::SIZE),
+            game_record)) {
+      game_records.push_back(game_record);
+    } else {
+      needs_rewrite = true;
+    }
+  }
+  return game_records;
+}
+
+// the log is replaced through a temporary file, so a crash while writing
+// leaves the previous log intact
+void fosssweeper::StatisticsStore::writeLog(
+    const std::filesystem::path &path,
+    std::span<const fosssweeper::GameRecord> game_records) {
+  std::vector<unsigned char> bytes(fosssweeper::StatisticsStore::HEADER_SIZE +
+                                   game_records.size() *
+                                       fosssweeper::GameRecord::SIZE);
+  std::copy(fosssweeper::StatisticsStore::MAGIC.begin(),
+            fosssweeper::StatisticsStore::MAGIC.end(), bytes.begin());
+  writeInteger(bytes, 8, fosssweeper::StatisticsStore::VERSION, 4);
+  writeInteger(bytes, 12, fosssweeper::GameRecord::SIZE, 4);
+  for (std::size_t record_i = 0; record_i < game_records.size(); record_i++) {
+    game_records[record_i].encode(std::span<unsigned char>(bytes).subspan(
+        fosssweeper::StatisticsStore::HEADER_SIZE +
+            record_i * fosssweeper::GameRecord::SIZE,
+        fosssweeper::GameRecord::SIZE));
+  }
+  auto temporary_path = path;
+  temporary_path += ".tmp";
+  {
+    std::ofstream stream(temporary_path, std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<const char *>(bytes.data()),
+                 static_cast<std::streamsize>(bytes.size()));
+    stream.flush();
+    if (!stream) {
+      throw std::runtime_error("failed to write " + temporary_path.string());
+    }
+  }
+  std::filesystem::rename(temporary_path, path);
+}
+
+// keeps the newest records and every best time, in their order in the log
+std::vector<fosssweeper::GameRecord> fosssweeper::StatisticsStore::compact(
+    std::span<const fosssweeper::GameRecord> game_records,
+    std::size_t kept_count) {
+  if (game_records.size() <= kept_count)
+    return std::vector<fosssweeper::GameRecord>(game_records.begin(),
+                                                game_records.end());
+  std::vector<std::uint8_t> kept(game_records.size(), 0);
+  std::fill(kept.end() - static_cast<std::ptrdiff_t>(kept_count), kept.end(),
+            1);
+  std::unordered_map<fosssweeper::GameConfiguration, std::vector<std::size_t>,
+                     fosssweeper::GameConfigurationHash>
+      best_records;
+  for (std::size_t record_i = 0; record_i < game_records.size(); record_i++) {
+    const auto &game_record = game_records[record_i];
+    if (!game_record.getIsWon())
+      continue;
+    auto &record_indices = best_records[game_record._gameConfiguration];
+    const auto it = std::upper_bound(
+        record_indices.begin(), record_indices.end(), record_i,
+        [&](std::size_t a, std::size_t b) {
+          return getIsFaster(game_records[a], game_records[b]);
+        });
+    if (static_cast<std::size_t>(it - record_indices.begin()) >=
+        fosssweeper::StatisticsStore::BEST_TIME_COUNT)
+      continue;
+    record_indices.insert(it, record_i);
+    if (record_indices.size() > fosssweeper::StatisticsStore::BEST_TIME_COUNT) {
+      record_indices.pop_back();
+    }
+  }
+  for (const auto &[game_configuration, record_indices] : best_records) {
+    for (const auto record_i : record_indices) {
+      kept[record_i] = 1;
+    }
+  }
+  std::vector<fosssweeper::GameRecord> kept_records;
+  for (std::size_t record_i = 0; record_i < game_records.size(); record_i++) {
+    if (kept[record_i] != 0) {
+      kept_records.push_back(game_records[record_i]);
+    }
+  }
+  return kept_records;
+}
+
+// the place among the best times is only final once the log was loaded
+std::optional<std::size_t>
+fosssweeper::StatisticsStore::add(const fosssweeper::GameRecord &game_record) {
+  std::optional<std::size_t> rank_o;
+  {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    rank_o =
+        fosssweeper::StatisticsStore::insertBestTime(this->_bestTimes,
+                                                     game_record);
+    this->_pendingRecords.push_back(game_record);
+  }
+  this->_condition.notify_all();
+  return rank_o;
+}
+
+std::vector<fosssweeper::GameRecord> fosssweeper::StatisticsStore::getBestTimes(
+    fosssweeper::GameConfiguration game_configuration) {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  const auto it = this->_bestTimes.find(game_configuration);
+  if (it == this->_bestTimes.end())
+    return std::vector<fosssweeper::GameRecord>();
+  return it->second;
+}
+
+void fosssweeper::StatisticsStore::flush() {
+  std::unique_lock<std::mutex> lock(this->_mutex);
+  this->_condition.wait(lock, [&]() {
+    return this->_loaded && this->_pendingRecords.empty() && !this->_writing;
+  });
+}
+
+std::size_t fosssweeper::StatisticsStore::getRecordCount() {
+  std::lock_guard<std::mutex> lock(this->_mutex);
+  return this->_recordCount;
+}
+
+const std::filesystem::path &
+fosssweeper::StatisticsStore::getPath() const noexcept {
+  return this->_path;
+}
@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fosssweeper/mapped_file.hpp>
+#include <fosssweeper/replay_player.hpp>
+#include <fosssweeper/tool_options.hpp>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+const char *const USAGE =
+    "usage: fosssweeper_replay [options] <path>...\n"
+    "  plays back replay logs, or every .fsr file in a directory, and checks\n"
+    "  each game against its recording\n"
+    "  --threads <count>    worker threads (default: hardware threads)\n";
+
+struct ReplayFile {
+  std::filesystem::path _path = std::filesystem::path();
+  std::uintmax_t _size = 0;
+};
+
+struct ReplayWorker {
+  fosssweeper::ReplayPlayResult _playResult = fosssweeper::ReplayPlayResult();
+  std::size_t _fileCount = 0;
+  std::size_t _invalidFileCount = 0;
+  std::uintmax_t _byteCount = 0;
+  std::string _firstError = std::string();
+};
+
+void addReplayFiles(const std::filesystem::path &path,
+                    std::vector<ReplayFile> &replay_files) {
+  if (!std::filesystem::is_directory(path)) {
+    replay_files.push_back({path, std::filesystem::file_size(path)});
+    return;
+  }
+  for (const auto &entry :
+       std::filesystem::recursive_directory_iterator(path)) {
+    if (entry.is_regular_file() && entry.path().extension() == ".fsr") {
+      replay_files.push_back({entry.path(), entry.file_size()});
+    }
+  }
+}
+
+// files are handed out largest first so a big file does not end up alone on
+// one thread at the end
+void runWorker(const std::vector<ReplayFile> &replay_files,
+               std::atomic<std::size_t> &next_file_i, ReplayWorker &worker) {
+  fosssweeper::ReplayPlayer replay_player;
+  while (true) {
+    const auto file_i = next_file_i.fetch_add(1, std::memory_order_relaxed);
+    if (file_i >= replay_files.size())
+      return;
+    const auto &replay_file = replay_files[file_i];
+    worker._fileCount++;
+    worker._byteCount += replay_file._size;
+    try {
+      const fosssweeper::MappedFile mapped_file(replay_file._path);
+      auto play_result = replay_player.play(mapped_file.getData());
+      if (!play_result._firstMismatch.empty()) {
+        play_result._firstMismatch =
+            replay_file._path.string() + ": " + play_result._firstMismatch;
+      }
+      worker._playResult.add(play_result);
+    } catch (const std::exception &e) {
+      if (worker._firstError.empty()) {
+        worker._firstError = replay_file._path.string() + ": " + e.what();
+      }
+      worker._invalidFileCount++;
+    }
+  }
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+  try {
+    std::size_t thread_count = std::thread::hardware_concurrency();
+    std::vector<ReplayFile> replay_files;
+    for (int arg_i = 1; arg_i < argc; arg_i++) {
+      const std::string_view option = argv[arg_i];
+      if (option == "--help") {
+        std::cout << USAGE;
+        return 0;
+      }
+      if (option == "--threads") {
+        if (arg_i + 1 >= argc) {
+          throw std::runtime_error("missing value for " + std::string(option));
+        }
+        thread_count = fosssweeper::parseNumber(option, argv[++arg_i]);
+      } else if (option.starts_with("--")) {
+        throw std::runtime_error("unknown option " + std::string(option));
+      } else {
+        addReplayFiles(std::filesystem::path(option), replay_files);
+      }
+    }
+    if (replay_files.empty())
+      throw std::runtime_error("no replay logs given");
+    thread_count = std::clamp<std::size_t>(thread_count, 1,
+                                           replay_files.size());
+    std::sort(replay_files.begin(), replay_files.end(),
+              [](const ReplayFile &a, const ReplayFile &b) {
+                return a._size > b._size;
+              });
+
+    const auto play_begin = std::chrono::steady_clock::now();
+    std::atomic<std::size_t> next_file_i = 0;
+    std::vector<ReplayWorker> workers(thread_count);
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+    for (auto &worker : workers) {
+      threads.emplace_back([&]() {
+        runWorker(replay_files, next_file_i, worker);
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      play_begin)
+            .count();
+
+    ReplayWorker total;
+    for (const auto &worker : workers) {
+      total._playResult.add(worker._playResult);
+      total._fileCount += worker._fileCount;
+      total._invalidFileCount += worker._invalidFileCount;
+      total._byteCount += worker._byteCount;
+      if (total._firstError.empty()) {
+        total._firstError = worker._firstError;
+      }
+    }
+    const auto &play_result = total._playResult;
+    const auto per_second = [&](double count) {
+      return seconds <= 0.0 ? 0.0 : count / seconds;
+    };
+    std::cout << "threads: " << thread_count << "\n";
+    std::cout << "files: " << total._fileCount << " ("
+              << total._invalidFileCount << " invalid)\n";
+    std::cout << "games: " << play_result._gameCount << " ("
+              << play_result._endedGameCount << " ended, "
+              << play_result._wonGameCount << " won)\n";
+    std::cout << "inputs: " << play_result._inputCount << "\n";
+    std::cout << "recorded seconds: "
+              << static_cast<double>(play_result._recordedTime) / 1000.0
+              << "\n";
+    std::cout << "mismatches: " << play_result._mismatchCount << "\n";
+    if (!play_result._firstMismatch.empty()) {
+      std::cout << "first mismatch: " << play_result._firstMismatch << "\n";
+    }
+    if (!total._firstError.empty()) {
+      std::cout << "first error: " << total._firstError << "\n";
+    }
+    std::cout << "seconds: " << seconds << "\n";
+    std::cout << "replays per second: "
+              << per_second(static_cast<double>(play_result._gameCount))
+              << "\n";
+    std::cout << "inputs per second: "
+              << per_second(static_cast<double>(play_result._inputCount))
+              << "\n";
+    std::cout << "megabytes per second: "
+              << per_second(static_cast<double>(total._byteCount) / 1.0e6)
+              << "\n";
+    if (play_result._mismatchCount != 0 || total._invalidFileCount != 0)
+      return 1;
+  } catch (const std::exception &e) {
+    std::cerr << "fosssweeper_replay: " << e.what() << "\n" << USAGE;
+    return 1;
+  }
+  return 0;
+}
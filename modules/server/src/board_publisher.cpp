@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <fosssweeper/game_model.hpp>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <utility>
+
+#include "board_publisher.hpp"
+
+void fosssweeper::BoardPublisher::beginBoardWrite() noexcept {
+  const auto board_sequence =
+      this->_header->_boardSequence.load(std::memory_order_relaxed);
+  this->_header->_boardSequence.store(board_sequence + 1,
+                                      std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+void fosssweeper::BoardPublisher::endBoardWrite(
+    const fosssweeper::GameModel &game_model) noexcept {
+  auto &header = *this->_header;
+  header._gameState.store(static_cast<std::uint32_t>(game_model.getGameState()),
+                          std::memory_order_relaxed);
+  header._flagCount.store(game_model.getFlagCount(), std::memory_order_relaxed);
+  header._buttonsLeft.store(game_model.getButtonsLeft(),
+                            std::memory_order_relaxed);
+  header._boardChangeCount.store(this->_changeCount,
+                                 std::memory_order_relaxed);
+  header._boardSequence.store(
+      header._boardSequence.load(std::memory_order_relaxed) + 1,
+      std::memory_order_release);
+  header._changeCount.store(this->_changeCount, std::memory_order_release);
+}
+
+void fosssweeper::BoardPublisher::publishButton(
+    const fosssweeper::GameModel &game_model, std::size_t button_i) noexcept {
+  const auto visible_code = game_model.getButtons()[button_i].getVisibleCode();
+  auto &entry = this->_entries[this->_changeCount % this->_header->_entryCount];
+  entry._sequence.store((this->_changeCount * 2) + 1,
+                        std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  entry._buttonI.store(static_cast<std::uint32_t>(button_i),
+                       std::memory_order_relaxed);
+  entry._visibleCode.store(visible_code, std::memory_order_relaxed);
+  entry._sequence.store((this->_changeCount * 2) + 2,
+                        std::memory_order_release);
+  this->_visibleCodes[button_i].store(visible_code, std::memory_order_relaxed);
+  this->_changeCount++;
+}
+
+fosssweeper::BoardPublisher::BoardPublisher(std::string name,
+                                            std::size_t entry_count,
+                                            std::size_t max_button_count)
+    : _name(std::move(name)),
+      _size(fosssweeper::getBoardRingSize(entry_count, max_button_count)) {
+  if (entry_count == 0) {
+    throw std::runtime_error("the change ring needs at least one entry");
+  }
+  this->_fd = ::shm_open(this->_name.c_str(), O_CREAT | O_RDWR, 0600);
+  if (this->_fd < 0) {
+    throw std::runtime_error("unable to open shared memory " + this->_name +
+                             ": " + std::strerror(errno));
+  }
+  if (::ftruncate(this->_fd, static_cast<off_t>(this->_size)) != 0 ||
+      (this->_memory = ::mmap(nullptr, this->_size, PROT_READ | PROT_WRITE,
+                              MAP_SHARED, this->_fd, 0)) == MAP_FAILED) {
+    const std::string error = std::strerror(errno);
+    ::close(this->_fd);
+    ::shm_unlink(this->_name.c_str());
+    throw std::runtime_error("unable to map shared memory " + this->_name +
+                             ": " + error);
+  }
+  this->_header = new (this->_memory) fosssweeper::BoardRingHeader();
+  // readers that attach during initialization see a wrong magic and retry
+  this->_header->_magic.store(0, std::memory_order_relaxed);
+  this->_header->_version = fosssweeper::BoardRingHeader::VERSION;
+  this->_header->_entryCount = entry_count;
+  this->_header->_maxButtonCount = max_button_count;
+  this->_header->_boardSequence.store(0, std::memory_order_relaxed);
+  this->_header->_epoch.store(0, std::memory_order_relaxed);
+  this->_header->_buttonsWide.store(0, std::memory_order_relaxed);
+  this->_header->_buttonsTall.store(0, std::memory_order_relaxed);
+  this->_header->_bombCount.store(0, std::memory_order_relaxed);
+  this->_header->_changeCount.store(0, std::memory_order_relaxed);
+  this->_header->_boardChangeCount.store(0, std::memory_order_relaxed);
+  this->_entries = fosssweeper::getBoardRingEntries(this->_header);
+  for (std::size_t entry_i = 0; entry_i < entry_count; entry_i++) {
+    auto *const entry = new (this->_entries + entry_i)
+        fosssweeper::BoardRingEntry();
+    entry->_sequence.store(0, std::memory_order_relaxed);
+  }
+  this->_visibleCodes = fosssweeper::getBoardRingVisibleCodes(this->_header);
+  for (std::size_t button_i = 0; button_i < max_button_count; button_i++) {
+    new (this->_visibleCodes + button_i) std::atomic<std::uint8_t>(0);
+  }
+  this->_header->_magic.store(fosssweeper::BoardRingHeader::MAGIC,
+                              std::memory_order_release);
+}
+
+fosssweeper::BoardPublisher::~BoardPublisher() {
+  ::munmap(this->_memory, this->_size);
+  ::close(this->_fd);
+  ::shm_unlink(this->_name.c_str());
+}
+
+// writes the whole board and starts a new epoch, which makes every reader
+// reload the board instead of following the change ring
+void fosssweeper::BoardPublisher::publishBoard(
+    const fosssweeper::GameModel &game_model) {
+  const auto game_configuration = game_model.getGameConfiguration();
+  const auto &buttons = game_model.getButtons();
+  if (buttons.size() > this->_header->_maxButtonCount) {
+    throw std::runtime_error("board too large to publish");
+  }
+  this->_gameModel = &game_model;
+  this->_gameConfiguration = game_configuration;
+  auto &header = *this->_header;
+  this->beginBoardWrite();
+  header._epoch.store(header._epoch.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+  header._buttonsWide.store(
+      static_cast<std::uint32_t>(game_configuration.getButtonsWide()),
+      std::memory_order_relaxed);
+  header._buttonsTall.store(
+      static_cast<std::uint32_t>(game_configuration.getButtonsTall()),
+      std::memory_order_relaxed);
+  header._bombCount.store(
+      static_cast<std::uint32_t>(game_configuration.getBombCount()),
+      std::memory_order_relaxed);
+  for (std::size_t button_i = 0; button_i < buttons.size(); button_i++) {
+    this->_visibleCodes[button_i].store(buttons[button_i].getVisibleCode(),
+                                        std::memory_order_relaxed);
+  }
+  this->endBoardWrite(game_model);
+}
+
+// publishes the ChangeSet of the last action of the GameModel
+void fosssweeper::BoardPublisher::publishChanges(
+    const fosssweeper::GameModel &game_model) {
+  if (this->_gameModel != &game_model ||
+      this->_gameConfiguration != game_model.getGameConfiguration()) {
+    this->publishBoard(game_model);
+    return;
+  }
+  const auto &change_set = game_model.getChangeSet();
+  this->beginBoardWrite();
+  if (change_set.getHasButtonList()) {
+    for (const auto button_i : change_set.getChangedButtons()) {
+      this->publishButton(game_model, button_i);
+    }
+  } else {
+    const auto &dirty_bits = change_set.getDirtyBits();
+    for (std::size_t word_i = 0; word_i < dirty_bits.size(); word_i++) {
+      auto word = dirty_bits[word_i];
+      while (word != 0) {
+        this->publishButton(game_model,
+                            (word_i * 64) +
+                                static_cast<std::size_t>(std::countr_zero(word)));
+        word &= word - 1;
+      }
+    }
+  }
+  this->endBoardWrite(game_model);
+}
+
+const std::string &fosssweeper::BoardPublisher::getName() const noexcept {
+  return this->_name;
+}
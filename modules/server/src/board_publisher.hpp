@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_BOARD_PUBLISHER_HPP
+#define FOSSSWEEPER_BOARD_PUBLISHER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <string>
+
+#include "board_ring.hpp"
+
+namespace fosssweeper {
+struct GameModel;
+
+// Publishes the visible board of one GameModel into named POSIX shared
+// memory for spectator processes. After every action the buttons of the
+// ChangeSet are appended to the change ring and written into the board, so
+// publishing costs the same as the action's own change tracking and never
+// waits for readers.
+struct BoardPublisher {
+  std::string _name;
+  int _fd = -1;
+  void *_memory = nullptr;
+  std::size_t _size = 0;
+  fosssweeper::BoardRingHeader *_header = nullptr;
+  fosssweeper::BoardRingEntry *_entries = nullptr;
+  std::atomic<std::uint8_t> *_visibleCodes = nullptr;
+  std::uint64_t _changeCount = 0;
+  const fosssweeper::GameModel *_gameModel = nullptr;
+  fosssweeper::GameConfiguration _gameConfiguration =
+      fosssweeper::GameConfiguration();
+
+  void beginBoardWrite() noexcept;
+  void endBoardWrite(const fosssweeper::GameModel &game_model) noexcept;
+  void publishButton(const fosssweeper::GameModel &game_model,
+                     std::size_t button_i) noexcept;
+
+  BoardPublisher(std::string name, std::size_t entry_count,
+                 std::size_t max_button_count);
+  BoardPublisher(const fosssweeper::BoardPublisher &) = delete;
+  fosssweeper::BoardPublisher &
+  operator=(const fosssweeper::BoardPublisher &) = delete;
+  ~BoardPublisher();
+
+  void publishBoard(const fosssweeper::GameModel &game_model);
+  void publishChanges(const fosssweeper::GameModel &game_model);
+  const std::string &getName() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "board_ring.hpp"
+
+const std::uint32_t fosssweeper::BoardRingHeader::MAGIC = 0x46535052;
+const std::uint32_t fosssweeper::BoardRingHeader::VERSION = 1;
+
+std::size_t
+fosssweeper::getBoardRingSize(std::size_t entry_count,
+                              std::size_t max_button_count) noexcept {
+  return sizeof(fosssweeper::BoardRingHeader) +
+         (entry_count * sizeof(fosssweeper::BoardRingEntry)) +
+         (max_button_count * sizeof(std::atomic<std::uint8_t>));
+}
+
+fosssweeper::BoardRingEntry *
+fosssweeper::getBoardRingEntries(fosssweeper::BoardRingHeader *header) noexcept {
+  return reinterpret_cast<fosssweeper::BoardRingEntry *>(header + 1);
+}
+
+std::atomic<std::uint8_t> *fosssweeper::getBoardRingVisibleCodes(
+    fosssweeper::BoardRingHeader *header) noexcept {
+  return reinterpret_cast<std::atomic<std::uint8_t> *>(
+      fosssweeper::getBoardRingEntries(header) + header->_entryCount);
+}
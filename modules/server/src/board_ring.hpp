@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_BOARD_RING_HPP
+#define FOSSSWEEPER_BOARD_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace fosssweeper {
+// Layout of the shared memory a BoardPublisher writes and BoardSubscribers
+// read: a BoardRingHeader, entryCount BoardRingEntries and maxButtonCount
+// visible codes. Every field a reader looks at is atomic, so the publisher
+// never waits for readers and readers detect torn reads instead.
+//
+// The board and its counters are guarded by the seqlock boardSequence,
+// which is odd while the publisher writes. Entry i of the change ring lives
+// in slot i % entryCount and is guarded by its own sequence, which is
+// 2 * i + 2 once the entry is complete; a larger value means the entry was
+// overwritten before the reader got to it.
+struct BoardRingEntry {
+  std::atomic<std::uint64_t> _sequence;
+  std::atomic<std::uint32_t> _buttonI;
+  std::atomic<std::uint8_t> _visibleCode;
+};
+
+struct BoardRingHeader {
+  static const std::uint32_t MAGIC;
+  static const std::uint32_t VERSION;
+
+  std::atomic<std::uint32_t> _magic;
+  std::uint32_t _version;
+  std::uint64_t _entryCount;
+  std::uint64_t _maxButtonCount;
+  alignas(64) std::atomic<std::uint64_t> _boardSequence;
+  std::atomic<std::uint64_t> _epoch;
+  std::atomic<std::uint32_t> _buttonsWide;
+  std::atomic<std::uint32_t> _buttonsTall;
+  std::atomic<std::uint32_t> _bombCount;
+  std::atomic<std::uint32_t> _gameState;
+  std::atomic<std::int32_t> _flagCount;
+  std::atomic<std::int32_t> _buttonsLeft;
+  std::atomic<std::uint64_t> _boardChangeCount;
+  alignas(64) std::atomic<std::uint64_t> _changeCount;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free &&
+                  std::atomic<std::uint8_t>::is_always_lock_free,
+              "shared memory needs address free atomics");
+
+std::size_t getBoardRingSize(std::size_t entry_count,
+                             std::size_t max_button_count) noexcept;
+fosssweeper::BoardRingEntry *
+getBoardRingEntries(fosssweeper::BoardRingHeader *header) noexcept;
+std::atomic<std::uint8_t> *
+getBoardRingVisibleCodes(fosssweeper::BoardRingHeader *header) noexcept;
+} // namespace fosssweeper
+
+#endif
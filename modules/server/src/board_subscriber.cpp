@@ -0,0 +1,247 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fcntl.h>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+
+#include "board_subscriber.hpp"
+
+const std::chrono::milliseconds fosssweeper::BoardSubscriber::MAX_WRITE_WAIT =
+    std::chrono::milliseconds(1000);
+
+// returns the board sequence once the publisher is not writing the board. A
+// publisher that died while writing leaves the sequence odd for good, so
+// the wait throws after MAX_WRITE_WAIT.
+std::uint64_t fosssweeper::BoardSubscriber::waitForBoardSequence() const {
+  const auto &header = *this->_header;
+  auto board_sequence = header._boardSequence.load(std::memory_order_acquire);
+  if (board_sequence % 2 == 0)
+    return board_sequence;
+  const auto deadline = std::chrono::steady_clock::now() +
+                        fosssweeper::BoardSubscriber::MAX_WRITE_WAIT;
+  while (board_sequence % 2 != 0) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      throw std::runtime_error("the publisher of " + this->_name +
+                               " stopped while writing the board");
+    }
+    std::this_thread::yield();
+    board_sequence = header._boardSequence.load(std::memory_order_acquire);
+  }
+  return board_sequence;
+}
+
+// copies the board under the seqlock, retrying while the publisher writes
+void fosssweeper::BoardSubscriber::reload() {
+  auto &header = *this->_header;
+  const auto *const visible_codes =
+      fosssweeper::getBoardRingVisibleCodes(this->_header);
+  while (true) {
+    const auto board_sequence = this->waitForBoardSequence();
+    this->_epoch = header._epoch.load(std::memory_order_relaxed);
+    this->_buttonsWide = static_cast<int>(
+        header._buttonsWide.load(std::memory_order_relaxed));
+    this->_buttonsTall = static_cast<int>(
+        header._buttonsTall.load(std::memory_order_relaxed));
+    this->_bombCount =
+        static_cast<int>(header._bombCount.load(std::memory_order_relaxed));
+    this->_gameState = static_cast<fosssweeper::GameState>(
+        header._gameState.load(std::memory_order_relaxed));
+    this->_flagCount = header._flagCount.load(std::memory_order_relaxed);
+    this->_buttonsLeft = header._buttonsLeft.load(std::memory_order_relaxed);
+    this->_nextChangeI =
+        header._boardChangeCount.load(std::memory_order_relaxed);
+    const auto button_count = std::min<std::size_t>(
+        static_cast<std::size_t>(this->_buttonsWide) *
+            static_cast<std::size_t>(this->_buttonsTall),
+        header._maxButtonCount);
+    this->_visibleCodes.resize(button_count);
+    for (std::size_t button_i = 0; button_i < button_count; button_i++) {
+      this->_visibleCodes[button_i] =
+          visible_codes[button_i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (header._boardSequence.load(std::memory_order_relaxed) ==
+        board_sequence)
+      break;
+  }
+  this->_reloadCount++;
+}
+
+// applies every complete change after the last one read, returning false
+// when the publisher overwrote one of them first
+bool fosssweeper::BoardSubscriber::tryReadChanges() {
+  auto &header = *this->_header;
+  const auto *const entries = fosssweeper::getBoardRingEntries(this->_header);
+  const auto change_count = header._changeCount.load(std::memory_order_acquire);
+  for (; this->_nextChangeI < change_count; this->_nextChangeI++) {
+    const auto &entry = entries[this->_nextChangeI % header._entryCount];
+    const auto expected_sequence = (this->_nextChangeI * 2) + 2;
+    const auto sequence = entry._sequence.load(std::memory_order_acquire);
+    if (sequence != expected_sequence)
+      return false;
+    const auto button_i = entry._buttonI.load(std::memory_order_relaxed);
+    const auto visible_code =
+        entry._visibleCode.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (entry._sequence.load(std::memory_order_relaxed) != sequence)
+      return false;
+    if (button_i < this->_visibleCodes.size()) {
+      this->_visibleCodes[button_i] = visible_code;
+    }
+  }
+  return true;
+}
+
+void fosssweeper::BoardSubscriber::readCounters() {
+  auto &header = *this->_header;
+  while (true) {
+    const auto board_sequence = this->waitForBoardSequence();
+    const auto game_state = header._gameState.load(std::memory_order_relaxed);
+    const auto flag_count = header._flagCount.load(std::memory_order_relaxed);
+    const auto buttons_left =
+        header._buttonsLeft.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (header._boardSequence.load(std::memory_order_relaxed) ==
+        board_sequence) {
+      this->_gameState = static_cast<fosssweeper::GameState>(game_state);
+      this->_flagCount = flag_count;
+      this->_buttonsLeft = buttons_left;
+      return;
+    }
+  }
+}
+
+fosssweeper::BoardSubscriber::BoardSubscriber(std::string name)
+    : _name(std::move(name)) {
+  this->_fd = ::shm_open(this->_name.c_str(), O_RDONLY, 0);
+  if (this->_fd < 0) {
+    throw std::runtime_error("unable to open shared memory " + this->_name +
+                             ": " + std::strerror(errno));
+  }
+  struct stat status;
+  if (::fstat(this->_fd, &status) != 0 ||
+      static_cast<std::size_t>(status.st_size) <
+          sizeof(fosssweeper::BoardRingHeader) ||
+      (this->_memory = ::mmap(nullptr, static_cast<std::size_t>(status.st_size),
+                              PROT_READ, MAP_SHARED, this->_fd, 0)) ==
+          MAP_FAILED) {
+    ::close(this->_fd);
+    throw std::runtime_error("unable to map shared memory " + this->_name);
+  }
+  this->_size = static_cast<std::size_t>(status.st_size);
+  this->_header = static_cast<fosssweeper::BoardRingHeader *>(this->_memory);
+  if (this->_header->_magic.load(std::memory_order_acquire) !=
+          fosssweeper::BoardRingHeader::MAGIC ||
+      this->_header->_version != fosssweeper::BoardRingHeader::VERSION ||
+      fosssweeper::getBoardRingSize(this->_header->_entryCount,
+                                    this->_header->_maxButtonCount) >
+          this->_size) {
+    ::munmap(this->_memory, this->_size);
+    ::close(this->_fd);
+    throw std::runtime_error(this->_name + " is not a published board");
+  }
+  try {
+    this->reload();
+  } catch (const std::exception &) {
+    ::munmap(this->_memory, this->_size);
+    ::close(this->_fd);
+    throw;
+  }
+}
+
+fosssweeper::BoardSubscriber::~BoardSubscriber() {
+  ::munmap(this->_memory, this->_size);
+  ::close(this->_fd);
+}
+
+// returns whether the board or its counters changed since the last poll
+bool fosssweeper::BoardSubscriber::poll() {
+  const auto previous_change_i = this->_nextChangeI;
+  const auto previous_game_state = this->_gameState;
+  const auto previous_flag_count = this->_flagCount;
+  const auto previous_buttons_left = this->_buttonsLeft;
+  if (this->_header->_epoch.load(std::memory_order_acquire) != this->_epoch ||
+      !this->tryReadChanges() ||
+      this->_header->_epoch.load(std::memory_order_acquire) != this->_epoch) {
+    this->reload();
+    return true;
+  }
+  this->readCounters();
+  return this->_nextChangeI != previous_change_i ||
+         this->_gameState != previous_game_state ||
+         this->_flagCount != previous_flag_count ||
+         this->_buttonsLeft != previous_buttons_left;
+}
+
+int fosssweeper::BoardSubscriber::getButtonsWide() const noexcept {
+  return this->_buttonsWide;
+}
+
+int fosssweeper::BoardSubscriber::getButtonsTall() const noexcept {
+  return this->_buttonsTall;
+}
+
+int fosssweeper::BoardSubscriber::getBombCount() const noexcept {
+  return this->_bombCount;
+}
+
+fosssweeper::GameState
+fosssweeper::BoardSubscriber::getGameState() const noexcept {
+  return this->_gameState;
+}
+
+int fosssweeper::BoardSubscriber::getFlagCount() const noexcept {
+  return this->_flagCount;
+}
+
+int fosssweeper::BoardSubscriber::getButtonsLeft() const noexcept {
+  return this->_buttonsLeft;
+}
+
+const std::vector<std::uint8_t> &
+fosssweeper::BoardSubscriber::getVisibleCodes() const noexcept {
+  return this->_visibleCodes;
+}
+
+std::uint64_t fosssweeper::BoardSubscriber::getChangeCount() const noexcept {
+  return this->_nextChangeI;
+}
+
+std::uint64_t fosssweeper::BoardSubscriber::getReloadCount() const noexcept {
+  return this->_reloadCount;
+}
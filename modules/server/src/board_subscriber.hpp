@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_BOARD_SUBSCRIBER_HPP
+#define FOSSSWEEPER_BOARD_SUBSCRIBER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_state.hpp>
+#include <string>
+#include <vector>
+
+#include "board_ring.hpp"
+
+namespace fosssweeper {
+// Follows a board published by a BoardPublisher. The board is loaded once
+// and then kept up to date from the change ring; only when the publisher
+// starts a new board or laps the reader is the whole board loaded again.
+struct BoardSubscriber {
+  static const std::chrono::milliseconds MAX_WRITE_WAIT;
+
+  std::string _name;
+  int _fd = -1;
+  void *_memory = nullptr;
+  std::size_t _size = 0;
+  fosssweeper::BoardRingHeader *_header = nullptr;
+  std::uint64_t _epoch = 0;
+  std::uint64_t _nextChangeI = 0;
+  int _buttonsWide = 0;
+  int _buttonsTall = 0;
+  int _bombCount = 0;
+  fosssweeper::GameState _gameState = fosssweeper::GameState::Default;
+  int _flagCount = 0;
+  int _buttonsLeft = 0;
+  std::vector<std::uint8_t> _visibleCodes = std::vector<std::uint8_t>();
+  std::uint64_t _reloadCount = 0;
+
+  std::uint64_t waitForBoardSequence() const;
+  void reload();
+  bool tryReadChanges();
+  void readCounters();
+
+  BoardSubscriber(std::string name);
+  BoardSubscriber(const fosssweeper::BoardSubscriber &) = delete;
+  fosssweeper::BoardSubscriber &
+  operator=(const fosssweeper::BoardSubscriber &) = delete;
+  ~BoardSubscriber();
+
+  bool poll();
+  int getButtonsWide() const noexcept;
+  int getButtonsTall() const noexcept;
+  int getBombCount() const noexcept;
+  fosssweeper::GameState getGameState() const noexcept;
+  int getFlagCount() const noexcept;
+  int getButtonsLeft() const noexcept;
+  const std::vector<std::uint8_t> &getVisibleCodes() const noexcept;
+  std::uint64_t getChangeCount() const noexcept;
+  std::uint64_t getReloadCount() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
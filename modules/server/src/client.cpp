@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "client.hpp"
+
+const std::size_t fosssweeper::Client::READ_SIZE = 64 * 1024;
+
+fosssweeper::Client::Client(const std::string &socket_path) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (socket_path.empty() || socket_path.size() >= sizeof(address.sun_path)) {
+    throw std::runtime_error("invalid socket path: " + socket_path);
+  }
+  std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size() + 1);
+  this->_fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (this->_fd < 0 ||
+      ::connect(this->_fd, reinterpret_cast<const sockaddr *>(&address),
+                sizeof(address)) != 0) {
+    const std::string error = std::strerror(errno);
+    if (this->_fd >= 0) {
+      ::close(this->_fd);
+    }
+    throw std::runtime_error("unable to connect to " + socket_path + ": " +
+                             error);
+  }
+}
+
+fosssweeper::Client::~Client() { ::close(this->_fd); }
+
+fosssweeper::MessageWriter fosssweeper::Client::getMessageWriter() noexcept {
+  return fosssweeper::MessageWriter(this->_output);
+}
+
+void fosssweeper::Client::flush() {
+  std::size_t sent_size = 0;
+  while (sent_size < this->_output.size()) {
+    const auto result =
+        ::send(this->_fd, this->_output.data() + sent_size,
+               this->_output.size() - sent_size, MSG_NOSIGNAL);
+    if (result < 0) {
+      if (errno == EINTR)
+        continue;
+      throw std::runtime_error(std::string("unable to send: ") +
+                               std::strerror(errno));
+    }
+    sent_size += static_cast<std::size_t>(result);
+  }
+  this->_output.clear();
+}
+
+// blocks until a whole frame arrived; the returned reader stays valid until
+// the next call
+fosssweeper::MessageReader fosssweeper::Client::receive() {
+  while (true) {
+    const std::span<const std::uint8_t> input =
+        std::span<const std::uint8_t>(this->_input).subspan(this->_inputBegin);
+    const auto frame_size = fosssweeper::MessageReader::getFrameSize(input);
+    if (frame_size != 0) {
+      this->_inputBegin += frame_size;
+      return fosssweeper::MessageReader(input.subspan(
+          fosssweeper::MessageWriter::FRAME_HEADER_SIZE,
+          frame_size - fosssweeper::MessageWriter::FRAME_HEADER_SIZE));
+    }
+    // only now is nothing handed out pointing into the buffer
+    this->_input.erase(this->_input.begin(),
+                       this->_input.begin() +
+                           static_cast<std::ptrdiff_t>(this->_inputBegin));
+    this->_inputBegin = 0;
+    const auto used_size = this->_input.size();
+    this->_input.resize(used_size + fosssweeper::Client::READ_SIZE);
+    const auto read_size = ::recv(this->_fd, this->_input.data() + used_size,
+                                  fosssweeper::Client::READ_SIZE, 0);
+    this->_input.resize(used_size +
+                        static_cast<std::size_t>(read_size > 0 ? read_size : 0));
+    if (read_size == 0) {
+      throw std::runtime_error("connection closed by the server");
+    }
+    if (read_size < 0 && errno != EINTR) {
+      throw std::runtime_error(std::string("unable to receive: ") +
+                               std::strerror(errno));
+    }
+  }
+}
+
+// whether receive() can return without reading from the socket
+bool fosssweeper::Client::getHasFrame() const {
+  return fosssweeper::MessageReader::getFrameSize(
+             std::span<const std::uint8_t>(this->_input)
+                 .subspan(this->_inputBegin)) != 0;
+}
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_CLIENT_HPP
+#define FOSSSWEEPER_CLIENT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "protocol.hpp"
+
+namespace fosssweeper {
+// Blocking client side of the server protocol. Frames are collected in an
+// output buffer and sent together by flush().
+struct Client {
+  static const std::size_t READ_SIZE;
+
+  int _fd = -1;
+  std::vector<std::uint8_t> _output = std::vector<std::uint8_t>();
+  std::vector<std::uint8_t> _input = std::vector<std::uint8_t>();
+  std::size_t _inputBegin = 0;
+
+  Client(const std::string &socket_path);
+  Client(const fosssweeper::Client &) = delete;
+  fosssweeper::Client &operator=(const fosssweeper::Client &) = delete;
+  ~Client();
+
+  fosssweeper::MessageWriter getMessageWriter() noexcept;
+  void flush();
+  fosssweeper::MessageReader receive();
+  bool getHasFrame() const;
+};
+} // namespace fosssweeper
+
+#endif
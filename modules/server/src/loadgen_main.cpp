@@ -0,0 +1,365 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fosssweeper/action.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_difficulty.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/latency_histogram.hpp>
+#include <fosssweeper/tool_options.hpp>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "client.hpp"
+#include "protocol.hpp"
+
+namespace {
+const char *const USAGE =
+    "usage: fosssweeper_loadgen [options]\n"
+    "  --socket <path>      server socket (default /tmp/fosssweeper.sock)\n"
+    "  --connections <n>    client connections, one thread each (default 4)\n"
+    "  --sessions <n>       sessions per connection (default 16)\n"
+    "  --depth <n>          requests in flight per connection (default 32)\n"
+    "  --actions <n>        actions per request (default 1)\n"
+    "  --seconds <n>        duration of the run (default 5)\n"
+    "  --config <config>    beginner, intermediate, expert or <w>x<h>x<b>\n"
+    "                       (default expert)\n"
+    "  --seed <seed>        seed of the first game (default 0)\n";
+
+struct LoadSettings {
+  std::string _socketPath = "/tmp/fosssweeper.sock";
+  std::size_t _connectionCount = 4;
+  std::size_t _sessionCount = 16;
+  std::size_t _depth = 32;
+  std::size_t _actionCount = 1;
+  std::size_t _seconds = 5;
+  fosssweeper::GameConfiguration _gameConfiguration =
+      fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert);
+  std::uint64_t _seed = 0;
+};
+
+struct LoadResult {
+  std::mutex _mutex = std::mutex();
+  fosssweeper::LatencyHistogram _latencyHistogram =
+      fosssweeper::LatencyHistogram();
+  std::uint64_t _requestCount = 0;
+  std::uint64_t _actionCount = 0;
+  std::uint64_t _gameCount = 0;
+  std::uint64_t _errorCount = 0;
+};
+
+// a session needs a new game once a response reports it over, and exactly
+// one NewGame request is sent for it
+enum class SessionState { Playing, Over, Restarting };
+
+struct PendingRequest {
+  std::chrono::steady_clock::time_point _sendTime =
+      std::chrono::steady_clock::time_point();
+  std::size_t _sessionI = 0;
+};
+
+void runConnection(const LoadSettings &load_settings, std::size_t connection_i,
+                   LoadResult &load_result) {
+  fosssweeper::Client client(load_settings._socketPath);
+  const auto &game_configuration = load_settings._gameConfiguration;
+  std::mt19937_64 rng(load_settings._seed + connection_i);
+  std::uniform_int_distribution<int> x_distribution(
+      0, game_configuration.getButtonsWide() - 1);
+  std::uniform_int_distribution<int> y_distribution(
+      0, game_configuration.getButtonsTall() - 1);
+  std::uniform_int_distribution<int> type_distribution(0, 19);
+  std::uint32_t request_id = 0;
+
+  auto message_writer = client.getMessageWriter();
+  for (std::size_t session_i = 0; session_i < load_settings._sessionCount;
+       session_i++) {
+    message_writer.beginFrame(fosssweeper::MessageType::Create, request_id++);
+    message_writer.writeU16(
+        static_cast<std::uint16_t>(game_configuration.getButtonsWide()));
+    message_writer.writeU16(
+        static_cast<std::uint16_t>(game_configuration.getButtonsTall()));
+    message_writer.writeU32(
+        static_cast<std::uint32_t>(game_configuration.getBombCount()));
+    message_writer.writeU8(
+        static_cast<std::uint8_t>(fosssweeper::GenerationMode::Opening));
+    message_writer.writeU64(rng());
+    message_writer.endFrame();
+  }
+  client.flush();
+  std::vector<std::uint64_t> session_ids;
+  for (std::size_t session_i = 0; session_i < load_settings._sessionCount;
+       session_i++) {
+    auto message_reader = client.receive();
+    if (message_reader.readHeader()._messageType !=
+        fosssweeper::MessageType::Created) {
+      throw std::runtime_error("unable to create a session");
+    }
+    session_ids.push_back(message_reader.readU64());
+  }
+
+  fosssweeper::LatencyHistogram latency_histogram;
+  std::uint64_t request_count = 0;
+  std::uint64_t action_count = 0;
+  std::uint64_t game_count = 0;
+  std::uint64_t error_count = 0;
+  std::vector<SessionState> session_states(session_ids.size(),
+                                           SessionState::Playing);
+  // responses arrive in request order, so the in flight requests form a ring
+  std::vector<PendingRequest> pending_requests(load_settings._depth);
+  std::size_t pending_begin = 0;
+  std::size_t pending_count = 0;
+  std::size_t next_session_i = 0;
+  const auto end_time = std::chrono::steady_clock::now() +
+                        std::chrono::seconds(load_settings._seconds);
+  while (true) {
+    const auto now = std::chrono::steady_clock::now();
+    const bool sending = now < end_time;
+    if (!sending && pending_count == 0)
+      break;
+    std::size_t skipped_count = 0;
+    while (sending && pending_count < load_settings._depth &&
+           skipped_count < session_ids.size()) {
+      const auto session_i = next_session_i;
+      next_session_i = (next_session_i + 1) % session_ids.size();
+      if (session_states[session_i] == SessionState::Restarting) {
+        skipped_count++;
+        continue;
+      }
+      skipped_count = 0;
+      if (session_states[session_i] == SessionState::Over) {
+        message_writer.beginFrame(fosssweeper::MessageType::NewGame,
+                                  request_id++);
+        message_writer.writeU64(session_ids[session_i]);
+        message_writer.writeU64(rng());
+        session_states[session_i] = SessionState::Restarting;
+      } else {
+        message_writer.beginFrame(fosssweeper::MessageType::Act, request_id++);
+        message_writer.writeU64(session_ids[session_i]);
+        message_writer.writeU16(
+            static_cast<std::uint16_t>(load_settings._actionCount));
+        for (std::size_t action_i = 0; action_i < load_settings._actionCount;
+             action_i++) {
+          const auto type_roll = type_distribution(rng);
+          const auto action_type = type_roll < 16 ? fosssweeper::ActionType::Click
+                                   : type_roll < 19
+                                       ? fosssweeper::ActionType::AltClick
+                                       : fosssweeper::ActionType::AreaClick;
+          message_writer.writeU8(static_cast<std::uint8_t>(action_type));
+          message_writer.writeU16(
+              static_cast<std::uint16_t>(x_distribution(rng)));
+          message_writer.writeU16(
+              static_cast<std::uint16_t>(y_distribution(rng)));
+        }
+      }
+      message_writer.endFrame();
+      pending_requests[(pending_begin + pending_count) % load_settings._depth] =
+          {now, session_i};
+      pending_count++;
+    }
+    client.flush();
+
+    // handle every response that already arrived before sending again
+    do {
+      auto message_reader = client.receive();
+      const auto pending_request = pending_requests[pending_begin];
+      pending_begin = (pending_begin + 1) % load_settings._depth;
+      pending_count--;
+      latency_histogram.record(static_cast<std::uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - pending_request._sendTime)
+              .count()));
+      request_count++;
+      const auto message_header = message_reader.readHeader();
+      if (message_header._messageType != fosssweeper::MessageType::Changes) {
+        error_count++;
+        continue;
+      }
+      const auto game_state =
+          static_cast<fosssweeper::GameState>(message_reader.readU8());
+      message_reader.readU32();
+      message_reader.readU32();
+      action_count += message_reader.readU16();
+      auto &session_state = session_states[pending_request._sessionI];
+      if (session_state == SessionState::Restarting &&
+          game_state == fosssweeper::GameState::None) {
+        session_state = SessionState::Playing;
+        game_count++;
+      } else if (session_state == SessionState::Playing &&
+                 (game_state == fosssweeper::GameState::Dead ||
+                  game_state == fosssweeper::GameState::Cool)) {
+        session_state = SessionState::Over;
+      }
+    } while (pending_count > 0 && client.getHasFrame());
+  }
+
+  for (const auto session_id : session_ids) {
+    message_writer.beginFrame(fosssweeper::MessageType::Destroy, request_id++);
+    message_writer.writeU64(session_id);
+    message_writer.endFrame();
+  }
+  client.flush();
+  for (std::size_t session_i = 0; session_i < session_ids.size(); session_i++) {
+    client.receive();
+  }
+
+  const std::lock_guard<std::mutex> lock(load_result._mutex);
+  load_result._latencyHistogram.merge(latency_histogram);
+  load_result._requestCount += request_count;
+  load_result._actionCount += action_count;
+  load_result._gameCount += game_count;
+  load_result._errorCount += error_count;
+}
+
+void writeLoadJson(std::ostream &os, const LoadSettings &load_settings,
+                   const LoadResult &load_result, double seconds) {
+  const auto per_second = [&](std::uint64_t count) {
+    return seconds <= 0.0 ? 0.0 : static_cast<double>(count) / seconds;
+  };
+  const auto microseconds = [&](double percentile) {
+    return static_cast<double>(
+               load_result._latencyHistogram.getPercentile(percentile)) /
+           1000.0;
+  };
+  os << "{\n";
+  os << "  \"connections\": " << load_settings._connectionCount << ",\n";
+  os << "  \"sessions_per_connection\": " << load_settings._sessionCount
+     << ",\n";
+  os << "  \"depth\": " << load_settings._depth << ",\n";
+  os << "  \"actions_per_request\": " << load_settings._actionCount << ",\n";
+  os << "  \"seconds\": " << seconds << ",\n";
+  os << "  \"requests\": " << load_result._requestCount << ",\n";
+  os << "  \"actions\": " << load_result._actionCount << ",\n";
+  os << "  \"games\": " << load_result._gameCount << ",\n";
+  os << "  \"errors\": " << load_result._errorCount << ",\n";
+  os << "  \"requests_per_second\": " << per_second(load_result._requestCount)
+     << ",\n";
+  os << "  \"actions_per_second\": " << per_second(load_result._actionCount)
+     << ",\n";
+  os << "  \"latency_us\": {\n";
+  os << "    \"p50\": " << microseconds(50.0) << ",\n";
+  os << "    \"p90\": " << microseconds(90.0) << ",\n";
+  os << "    \"p99\": " << microseconds(99.0) << ",\n";
+  os << "    \"p999\": " << microseconds(99.9) << ",\n";
+  os << "    \"max\": "
+     << static_cast<double>(load_result._latencyHistogram.getMax()) / 1000.0
+     << "\n";
+  os << "  }\n";
+  os << "}\n";
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+  try {
+    LoadSettings load_settings;
+    for (int arg_i = 1; arg_i < argc; arg_i++) {
+      const std::string_view option = argv[arg_i];
+      if (option == "--help") {
+        std::cout << USAGE;
+        return 0;
+      }
+      if (arg_i + 1 >= argc) {
+        throw std::runtime_error("missing value for " + std::string(option));
+      }
+      const std::string value = argv[++arg_i];
+      if (option == "--socket") {
+        load_settings._socketPath = value;
+      } else if (option == "--connections") {
+        load_settings._connectionCount =
+            fosssweeper::parseNumber(option, value);
+      } else if (option == "--sessions") {
+        load_settings._sessionCount = fosssweeper::parseNumber(option, value);
+      } else if (option == "--depth") {
+        load_settings._depth = fosssweeper::parseNumber(option, value);
+      } else if (option == "--actions") {
+        load_settings._actionCount = fosssweeper::parseNumber(option, value);
+      } else if (option == "--seconds") {
+        load_settings._seconds = fosssweeper::parseNumber(option, value);
+      } else if (option == "--config") {
+        load_settings._gameConfiguration =
+            fosssweeper::parseGameConfiguration(value);
+        // a Create message carries each side in 16 bits
+        if (load_settings._gameConfiguration.getButtonsWide() >
+                std::numeric_limits<std::uint16_t>::max() ||
+            load_settings._gameConfiguration.getButtonsTall() >
+                std::numeric_limits<std::uint16_t>::max()) {
+          throw std::runtime_error("configuration too large: " + value);
+        }
+      } else if (option == "--seed") {
+        load_settings._seed = fosssweeper::parseNumber(option, value);
+      } else {
+        throw std::runtime_error("unknown option " + std::string(option));
+      }
+    }
+    if (load_settings._connectionCount == 0 ||
+        load_settings._sessionCount == 0 || load_settings._depth == 0 ||
+        load_settings._actionCount == 0 ||
+        load_settings._actionCount > 0xffff) {
+      throw std::runtime_error("connections, sessions, depth and actions "
+                               "must be positive");
+    }
+
+    LoadResult load_result;
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> errors(load_settings._connectionCount);
+    const auto begin_time = std::chrono::steady_clock::now();
+    for (std::size_t connection_i = 0;
+         connection_i < load_settings._connectionCount; connection_i++) {
+      threads.emplace_back([&, connection_i]() {
+        try {
+          runConnection(load_settings, connection_i, load_result);
+        } catch (...) {
+          errors[connection_i] = std::current_exception();
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    const auto seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - begin_time)
+                             .count();
+    for (const auto &error : errors) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+    writeLoadJson(std::cout, load_settings, load_result, seconds);
+  } catch (const std::exception &e) {
+    std::cerr << "fosssweeper_loadgen: " << e.what() << "\n" << USAGE;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "protocol.hpp"
+
+const std::size_t fosssweeper::MessageWriter::FRAME_HEADER_SIZE = 4;
+const std::size_t fosssweeper::MessageWriter::MAX_FRAME_SIZE = 1 << 24;
+
+fosssweeper::MessageWriter::MessageWriter(
+    std::vector<std::uint8_t> &buffer) noexcept
+    : _buffer(buffer) {}
+
+void fosssweeper::MessageWriter::beginFrame(
+    fosssweeper::MessageType message_type, std::uint32_t request_id) {
+  this->_frameBegin = this->_buffer.size();
+  this->writeU32(0);
+  this->writeU8(static_cast<std::uint8_t>(message_type));
+  this->writeU32(request_id);
+}
+
+void fosssweeper::MessageWriter::endFrame() {
+  const auto payload_size = this->_buffer.size() - this->_frameBegin -
+                            fosssweeper::MessageWriter::FRAME_HEADER_SIZE;
+  if (payload_size > fosssweeper::MessageWriter::MAX_FRAME_SIZE) {
+    throw std::runtime_error("message too large");
+  }
+  for (std::size_t byte_i = 0;
+       byte_i < fosssweeper::MessageWriter::FRAME_HEADER_SIZE; byte_i++) {
+    this->_buffer[this->_frameBegin + byte_i] =
+        static_cast<std::uint8_t>(payload_size >> (byte_i * 8));
+  }
+}
+
+void fosssweeper::MessageWriter::writeU8(std::uint8_t value) {
+  this->_buffer.push_back(value);
+}
+
+void fosssweeper::MessageWriter::writeU16(std::uint16_t value) {
+  this->_buffer.push_back(static_cast<std::uint8_t>(value));
+  this->_buffer.push_back(static_cast<std::uint8_t>(value >> 8));
+}
+
+void fosssweeper::MessageWriter::writeU32(std::uint32_t value) {
+  for (int byte_i = 0; byte_i < 4; byte_i++) {
+    this->_buffer.push_back(static_cast<std::uint8_t>(value >> (byte_i * 8)));
+  }
+}
+
+void fosssweeper::MessageWriter::writeU64(std::uint64_t value) {
+  for (int byte_i = 0; byte_i < 8; byte_i++) {
+    this->_buffer.push_back(static_cast<std::uint8_t>(value >> (byte_i * 8)));
+  }
+}
+
+void fosssweeper::MessageWriter::writeString(std::string_view value) {
+  const auto length = std::min<std::size_t>(value.size(), 0xffff);
+  this->writeU16(static_cast<std::uint16_t>(length));
+  this->_buffer.insert(this->_buffer.end(), value.begin(),
+                       value.begin() + static_cast<std::ptrdiff_t>(length));
+}
+
+fosssweeper::MessageReader::MessageReader(
+    std::span<const std::uint8_t> bytes) noexcept
+    : _bytes(bytes) {}
+
+// returns the size of the first complete frame in bytes including its
+// length, or 0 when more bytes are needed
+std::size_t
+fosssweeper::MessageReader::getFrameSize(std::span<const std::uint8_t> bytes) {
+  if (bytes.size() < fosssweeper::MessageWriter::FRAME_HEADER_SIZE)
+    return 0;
+  std::size_t payload_size = 0;
+  for (std::size_t byte_i = 0;
+       byte_i < fosssweeper::MessageWriter::FRAME_HEADER_SIZE; byte_i++) {
+    payload_size |= static_cast<std::size_t>(bytes[byte_i]) << (byte_i * 8);
+  }
+  if (payload_size > fosssweeper::MessageWriter::MAX_FRAME_SIZE) {
+    throw std::runtime_error("message too large");
+  }
+  const auto frame_size =
+      fosssweeper::MessageWriter::FRAME_HEADER_SIZE + payload_size;
+  return bytes.size() < frame_size ? 0 : frame_size;
+}
+
+fosssweeper::MessageHeader fosssweeper::MessageReader::readHeader() {
+  fosssweeper::MessageHeader message_header;
+  message_header._messageType =
+      static_cast<fosssweeper::MessageType>(this->readU8());
+  message_header._requestId = this->readU32();
+  return message_header;
+}
+
+std::uint8_t fosssweeper::MessageReader::readU8() {
+  if (this->_position + 1 > this->_bytes.size()) {
+    throw std::runtime_error("truncated message");
+  }
+  return this->_bytes[this->_position++];
+}
+
+std::uint16_t fosssweeper::MessageReader::readU16() {
+  const auto low = this->readU8();
+  return static_cast<std::uint16_t>(low | (this->readU8() << 8));
+}
+
+std::uint32_t fosssweeper::MessageReader::readU32() {
+  const auto low = this->readU16();
+  return low | (static_cast<std::uint32_t>(this->readU16()) << 16);
+}
+
+std::uint64_t fosssweeper::MessageReader::readU64() {
+  const auto low = this->readU32();
+  return low | (static_cast<std::uint64_t>(this->readU32()) << 32);
+}
+
+std::string fosssweeper::MessageReader::readString() {
+  const auto length = this->readU16();
+  if (this->_position + length > this->_bytes.size()) {
+    throw std::runtime_error("truncated message");
+  }
+  std::string value(reinterpret_cast<const char *>(this->_bytes.data()) +
+                        this->_position,
+                    length);
+  this->_position += length;
+  return value;
+}
+
+void fosssweeper::MessageReader::requireEnd() const {
+  if (this->_position != this->_bytes.size()) {
+    throw std::runtime_error("unexpected bytes at the end of a message");
+  }
+}
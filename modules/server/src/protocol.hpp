@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_PROTOCOL_HPP
+#define FOSSSWEEPER_PROTOCOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Every message is a frame of a little endian u32 payload length followed by
+// the payload: a u8 message type, a u32 request id echoed in the response and
+// the body of the message type.
+//
+//   Create      u16 wide, u16 tall, u32 bombs, u8 generation mode, u64 seed
+//   Act         u64 session, u16 count, count * (u8 action type, u16 x, u16 y)
+//   Query       u64 session
+//   NewGame     u64 session, u64 seed
+//   Destroy     u64 session
+//
+//   Created     u64 session, u16 wide, u16 tall, u32 bombs
+//   Changes     u8 game state, u32 flags, u32 buttons left, u16 processed,
+//               u32 count, count * (u32 button index, u8 visible code)
+//   Board       u8 game state, u32 flags, u32 buttons left, u16 wide, u16 tall,
+//               wide * tall * u8 visible code
+//   Destroyed
+//   Error       u16 length, length * u8 message
+namespace fosssweeper {
+enum class MessageType : std::uint8_t {
+  Create = 0x01,
+  Act = 0x02,
+  Query = 0x03,
+  NewGame = 0x04,
+  Destroy = 0x05,
+  Created = 0x81,
+  Changes = 0x82,
+  Board = 0x83,
+  Destroyed = 0x84,
+  Error = 0xff
+};
+
+struct MessageHeader {
+  fosssweeper::MessageType _messageType = fosssweeper::MessageType::Error;
+  std::uint32_t _requestId = 0;
+};
+
+// Appends frames to a buffer. A frame is started with beginFrame() and its
+// length is filled in by endFrame().
+struct MessageWriter {
+  static const std::size_t FRAME_HEADER_SIZE;
+  static const std::size_t MAX_FRAME_SIZE;
+
+  std::vector<std::uint8_t> &_buffer;
+  std::size_t _frameBegin = 0;
+
+  MessageWriter(std::vector<std::uint8_t> &buffer) noexcept;
+
+  void beginFrame(fosssweeper::MessageType message_type,
+                  std::uint32_t request_id);
+  void endFrame();
+  void writeU8(std::uint8_t value);
+  void writeU16(std::uint16_t value);
+  void writeU32(std::uint32_t value);
+  void writeU64(std::uint64_t value);
+  void writeString(std::string_view value);
+};
+
+// Reads the payload of one frame, throwing when it is shorter than the
+// message type requires.
+struct MessageReader {
+  std::span<const std::uint8_t> _bytes;
+  std::size_t _position = 0;
+
+  MessageReader(std::span<const std::uint8_t> bytes) noexcept;
+
+  static std::size_t
+  getFrameSize(std::span<const std::uint8_t> bytes);
+
+  fosssweeper::MessageHeader readHeader();
+  std::uint8_t readU8();
+  std::uint16_t readU16();
+  std::uint32_t readU32();
+  std::uint64_t readU64();
+  std::string readString();
+  void requireEnd() const;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,511 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/button_position.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <utility>
+
+#include "server.hpp"
+
+const std::size_t fosssweeper::Server::READ_SIZE = 64 * 1024;
+const std::size_t fosssweeper::Server::MAX_OUTPUT_SIZE = 64 * 1024 * 1024;
+const std::size_t fosssweeper::Server::MAX_BUTTON_COUNT = 1 << 20;
+const int fosssweeper::Server::MAX_EVENTS = 256;
+const std::size_t fosssweeper::Server::PUBLISHED_CHANGE_COUNT = 1 << 16;
+
+namespace {
+std::runtime_error makeSystemError(const std::string &what) {
+  return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+fosssweeper::GenerationMode readGenerationMode(std::uint8_t value) {
+  switch (value) {
+  case static_cast<std::uint8_t>(fosssweeper::GenerationMode::Classic):
+    return fosssweeper::GenerationMode::Classic;
+  case static_cast<std::uint8_t>(fosssweeper::GenerationMode::Opening):
+    return fosssweeper::GenerationMode::Opening;
+  case static_cast<std::uint8_t>(fosssweeper::GenerationMode::NoGuess):
+    return fosssweeper::GenerationMode::NoGuess;
+  default:
+    throw std::runtime_error("invalid generation mode");
+  }
+}
+} // namespace
+
+void fosssweeper::Server::acceptConnections() {
+  while (true) {
+    const int fd =
+        ::accept4(this->_listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ECONNABORTED)
+        return;
+      if (errno == EINTR)
+        continue;
+      throw makeSystemError("unable to accept a connection");
+    }
+    epoll_event event{};
+    event.events = EPOLLIN | EPOLLRDHUP;
+    event.data.fd = fd;
+    if (::epoll_ctl(this->_epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+      ::close(fd);
+      throw makeSystemError("unable to watch a connection");
+    }
+    auto &connection = this->_connections[fd];
+    connection._fd = fd;
+    connection._connectionId = this->_nextConnectionId++;
+  }
+}
+
+// reads straight into the input buffer until the socket runs dry, returning
+// false once the peer closed the connection
+bool fosssweeper::Server::readInput(fosssweeper::Connection &connection) {
+  while (true) {
+    const auto used_size = connection._input.size();
+    connection._input.resize(used_size + fosssweeper::Server::READ_SIZE);
+    const auto read_size =
+        ::recv(connection._fd, connection._input.data() + used_size,
+               fosssweeper::Server::READ_SIZE, 0);
+    connection._input.resize(used_size +
+                             static_cast<std::size_t>(std::max<ssize_t>(read_size, 0)));
+    if (read_size == 0)
+      return false;
+    if (read_size < 0) {
+      if (errno == EINTR)
+        continue;
+      return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+    if (static_cast<std::size_t>(read_size) < fosssweeper::Server::READ_SIZE)
+      return true;
+  }
+}
+
+void fosssweeper::Server::handleFrames(fosssweeper::Connection &connection) {
+  const std::span<const std::uint8_t> input(connection._input);
+  fosssweeper::MessageWriter message_writer(connection._output);
+  std::size_t position = 0;
+  while (true) {
+    const auto frame_size =
+        fosssweeper::MessageReader::getFrameSize(input.subspan(position));
+    if (frame_size == 0)
+      break;
+    fosssweeper::MessageReader message_reader(input.subspan(
+        position + fosssweeper::MessageWriter::FRAME_HEADER_SIZE,
+        frame_size - fosssweeper::MessageWriter::FRAME_HEADER_SIZE));
+    position += frame_size;
+    fosssweeper::MessageHeader message_header;
+    const auto output_size = connection._output.size();
+    try {
+      message_header = message_reader.readHeader();
+      this->handleMessage(connection, message_reader, message_writer,
+                          message_header);
+    } catch (const std::exception &e) {
+      // drop the partial response of the failed message
+      connection._output.resize(output_size);
+      message_writer.beginFrame(fosssweeper::MessageType::Error,
+                                message_header._requestId);
+      message_writer.writeString(e.what());
+      message_writer.endFrame();
+    }
+    this->_requestCount++;
+  }
+  connection._input.erase(connection._input.begin(),
+                          connection._input.begin() +
+                              static_cast<std::ptrdiff_t>(position));
+  if (!connection._output.empty() && !connection._flushQueued) {
+    connection._flushQueued = true;
+    this->_flushFds.push_back(connection._fd);
+  }
+}
+
+void fosssweeper::Server::handleMessage(
+    fosssweeper::Connection &connection,
+    fosssweeper::MessageReader &message_reader,
+    fosssweeper::MessageWriter &message_writer,
+    const fosssweeper::MessageHeader &message_header) {
+  const auto request_id = message_header._requestId;
+  if (message_header._messageType == fosssweeper::MessageType::Create) {
+    const int buttons_wide = message_reader.readU16();
+    const int buttons_tall = message_reader.readU16();
+    const auto bomb_count = message_reader.readU32();
+    const auto generation_mode = readGenerationMode(message_reader.readU8());
+    const auto game_seed = message_reader.readU64();
+    message_reader.requireEnd();
+    if (static_cast<std::size_t>(buttons_wide) * buttons_tall >
+        fosssweeper::Server::MAX_BUTTON_COUNT) {
+      throw std::runtime_error("board too large");
+    }
+    const fosssweeper::GameConfiguration game_configuration(
+        buttons_wide, buttons_tall,
+        static_cast<int>(std::min<std::uint32_t>(bomb_count, 0x7fffffff)));
+    const auto session_id =
+        this->_sessionTable.create(connection._connectionId, game_configuration,
+                                   generation_mode, game_seed);
+    connection._sessionIds.push_back(session_id);
+    if (this->_boardPublisher != nullptr) {
+      this->_publishedConnectionId = connection._connectionId;
+      this->_publishedSessionId = session_id;
+      this->_boardPublisher->publishBoard(
+          *this->_sessionTable.find(connection._connectionId, session_id));
+    }
+    message_writer.beginFrame(fosssweeper::MessageType::Created, request_id);
+    message_writer.writeU64(session_id);
+    message_writer.writeU16(
+        static_cast<std::uint16_t>(game_configuration.getButtonsWide()));
+    message_writer.writeU16(
+        static_cast<std::uint16_t>(game_configuration.getButtonsTall()));
+    message_writer.writeU32(
+        static_cast<std::uint32_t>(game_configuration.getBombCount()));
+    message_writer.endFrame();
+    return;
+  }
+
+  const auto session_id = message_reader.readU64();
+  auto *const game_model =
+      this->_sessionTable.find(connection._connectionId, session_id);
+  if (game_model == nullptr) {
+    throw std::runtime_error("unknown session");
+  }
+  switch (message_header._messageType) {
+  case fosssweeper::MessageType::Act: {
+    const auto game_configuration = game_model->getGameConfiguration();
+    const auto action_count = message_reader.readU16();
+    this->_actions.clear();
+    for (std::size_t action_i = 0; action_i < action_count; action_i++) {
+      const auto action_type = message_reader.readU8();
+      const int x = message_reader.readU16();
+      const int y = message_reader.readU16();
+      if (action_type >
+          static_cast<std::uint8_t>(fosssweeper::ActionType::AreaClick)) {
+        throw std::runtime_error("invalid action type");
+      }
+      if (x >= game_configuration.getButtonsWide() ||
+          y >= game_configuration.getButtonsTall()) {
+        throw std::runtime_error("action outside of the board");
+      }
+      this->_actions.push_back(
+          {static_cast<fosssweeper::ActionType>(action_type),
+           fosssweeper::ButtonPosition(x, y)});
+    }
+    message_reader.requireEnd();
+    this->_actionResults.resize(this->_actions.size());
+    const auto processed_count =
+        game_model->applyActions(this->_actions, this->_actionResults);
+    this->_actionCount += processed_count;
+    this->publishChanges(connection, session_id, *game_model);
+    message_writer.beginFrame(fosssweeper::MessageType::Changes, request_id);
+    this->writeChanges(message_writer, *game_model, processed_count);
+    message_writer.endFrame();
+    break;
+  }
+  case fosssweeper::MessageType::Query:
+    message_reader.requireEnd();
+    message_writer.beginFrame(fosssweeper::MessageType::Board, request_id);
+    this->writeBoard(message_writer, *game_model);
+    message_writer.endFrame();
+    break;
+  case fosssweeper::MessageType::NewGame: {
+    const auto game_seed = message_reader.readU64();
+    message_reader.requireEnd();
+    game_model->newGame();
+    game_model->setGameSeed(game_seed);
+    this->publishChanges(connection, session_id, *game_model);
+    message_writer.beginFrame(fosssweeper::MessageType::Changes, request_id);
+    this->writeChanges(message_writer, *game_model, 0);
+    message_writer.endFrame();
+    break;
+  }
+  case fosssweeper::MessageType::Destroy: {
+    message_reader.requireEnd();
+    this->_sessionTable.destroy(connection._connectionId, session_id);
+    auto &session_ids = connection._sessionIds;
+    const auto session_id_it =
+        std::find(session_ids.begin(), session_ids.end(), session_id);
+    std::swap(*session_id_it, session_ids.back());
+    session_ids.pop_back();
+    message_writer.beginFrame(fosssweeper::MessageType::Destroyed, request_id);
+    message_writer.endFrame();
+    break;
+  }
+  default:
+    throw std::runtime_error("invalid message type");
+  }
+}
+
+void fosssweeper::Server::writeChanges(
+    fosssweeper::MessageWriter &message_writer,
+    const fosssweeper::GameModel &game_model, std::size_t processed_count) {
+  const auto &change_set = game_model.getChangeSet();
+  const auto &buttons = game_model.getButtons();
+  message_writer.writeU8(static_cast<std::uint8_t>(game_model.getGameState()));
+  message_writer.writeU32(static_cast<std::uint32_t>(game_model.getFlagCount()));
+  message_writer.writeU32(
+      static_cast<std::uint32_t>(game_model.getButtonsLeft()));
+  message_writer.writeU16(static_cast<std::uint16_t>(processed_count));
+  message_writer.writeU32(
+      static_cast<std::uint32_t>(change_set.getChangedButtonCount()));
+  const auto write_button = [&](std::size_t button_i) {
+    message_writer.writeU32(static_cast<std::uint32_t>(button_i));
+    message_writer.writeU8(buttons[button_i].getVisibleCode());
+  };
+  if (change_set.getHasButtonList()) {
+    for (const auto button_i : change_set.getChangedButtons()) {
+      write_button(button_i);
+    }
+    return;
+  }
+  const auto &dirty_bits = change_set.getDirtyBits();
+  for (std::size_t word_i = 0; word_i < dirty_bits.size(); word_i++) {
+    auto word = dirty_bits[word_i];
+    while (word != 0) {
+      write_button((word_i * 64) +
+                   static_cast<std::size_t>(std::countr_zero(word)));
+      word &= word - 1;
+    }
+  }
+}
+
+void fosssweeper::Server::writeBoard(fosssweeper::MessageWriter &message_writer,
+                                     const fosssweeper::GameModel &game_model) {
+  const auto game_configuration = game_model.getGameConfiguration();
+  message_writer.writeU8(static_cast<std::uint8_t>(game_model.getGameState()));
+  message_writer.writeU32(static_cast<std::uint32_t>(game_model.getFlagCount()));
+  message_writer.writeU32(
+      static_cast<std::uint32_t>(game_model.getButtonsLeft()));
+  message_writer.writeU16(
+      static_cast<std::uint16_t>(game_configuration.getButtonsWide()));
+  message_writer.writeU16(
+      static_cast<std::uint16_t>(game_configuration.getButtonsTall()));
+  for (const auto &button : game_model.getButtons()) {
+    message_writer.writeU8(button.getVisibleCode());
+  }
+}
+
+// returns false when the connection has to be closed
+bool fosssweeper::Server::flush(fosssweeper::Connection &connection) {
+  connection._flushQueued = false;
+  while (connection._outputSent < connection._output.size()) {
+    const auto sent_size =
+        ::send(connection._fd, connection._output.data() + connection._outputSent,
+               connection._output.size() - connection._outputSent,
+               MSG_NOSIGNAL);
+    if (sent_size < 0) {
+      if (errno == EINTR)
+        continue;
+      if (errno != EAGAIN && errno != EWOULDBLOCK)
+        return false;
+      // a client that stops reading must not make the server buffer forever
+      if (connection._output.size() - connection._outputSent >
+          fosssweeper::Server::MAX_OUTPUT_SIZE)
+        return false;
+      this->watchWrite(connection, true);
+      return true;
+    }
+    connection._outputSent += static_cast<std::size_t>(sent_size);
+  }
+  connection._output.clear();
+  connection._outputSent = 0;
+  this->watchWrite(connection, false);
+  return true;
+}
+
+void fosssweeper::Server::watchWrite(fosssweeper::Connection &connection,
+                                     bool write_watched) {
+  if (connection._writeWatched == write_watched)
+    return;
+  epoll_event event{};
+  event.events = EPOLLIN | EPOLLRDHUP | (write_watched ? EPOLLOUT : 0u);
+  event.data.fd = connection._fd;
+  if (::epoll_ctl(this->_epollFd, EPOLL_CTL_MOD, connection._fd, &event) != 0) {
+    throw makeSystemError("unable to watch a connection");
+  }
+  connection._writeWatched = write_watched;
+}
+
+void fosssweeper::Server::closeConnection(int fd) {
+  const auto connection_it = this->_connections.find(fd);
+  if (connection_it == this->_connections.end())
+    return;
+  for (const auto session_id : connection_it->second._sessionIds) {
+    this->_sessionTable.destroy(connection_it->second._connectionId, session_id);
+  }
+  ::epoll_ctl(this->_epollFd, EPOLL_CTL_DEL, fd, nullptr);
+  ::close(fd);
+  this->_connections.erase(connection_it);
+}
+
+void fosssweeper::Server::publishChanges(
+    const fosssweeper::Connection &connection, std::uint64_t session_id,
+    const fosssweeper::GameModel &game_model) {
+  if (this->_boardPublisher != nullptr &&
+      this->_publishedConnectionId == connection._connectionId &&
+      this->_publishedSessionId == session_id) {
+    this->_boardPublisher->publishChanges(game_model);
+  }
+}
+
+fosssweeper::Server::Server(std::string socket_path)
+    : _socketPath(std::move(socket_path)) {
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  if (this->_socketPath.empty() ||
+      this->_socketPath.size() >= sizeof(address.sun_path)) {
+    throw std::runtime_error("invalid socket path: " + this->_socketPath);
+  }
+  std::memcpy(address.sun_path, this->_socketPath.c_str(),
+              this->_socketPath.size() + 1);
+  this->_listenFd =
+      ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (this->_listenFd < 0) {
+    throw makeSystemError("unable to create a socket");
+  }
+  ::unlink(this->_socketPath.c_str());
+  if (::bind(this->_listenFd, reinterpret_cast<const sockaddr *>(&address),
+             sizeof(address)) != 0 ||
+      ::listen(this->_listenFd, SOMAXCONN) != 0) {
+    const auto error = makeSystemError("unable to listen on " + this->_socketPath);
+    ::close(this->_listenFd);
+    throw error;
+  }
+  this->_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.fd = this->_listenFd;
+  if (this->_epollFd < 0 ||
+      ::epoll_ctl(this->_epollFd, EPOLL_CTL_ADD, this->_listenFd, &event) != 0) {
+    const auto error = makeSystemError("unable to create an epoll instance");
+    if (this->_epollFd >= 0) {
+      ::close(this->_epollFd);
+    }
+    ::close(this->_listenFd);
+    ::unlink(this->_socketPath.c_str());
+    throw error;
+  }
+}
+
+fosssweeper::Server::~Server() {
+  for (const auto &[fd, connection] : this->_connections) {
+    ::close(fd);
+  }
+  ::close(this->_epollFd);
+  ::close(this->_listenFd);
+  ::unlink(this->_socketPath.c_str());
+}
+
+// runs until stopping is set, checking it at least every 100 milliseconds
+void fosssweeper::Server::run(const std::atomic<bool> &stopping) {
+  std::array<epoll_event, fosssweeper::Server::MAX_EVENTS> events;
+  while (!stopping.load()) {
+    const int event_count =
+        ::epoll_wait(this->_epollFd, events.data(),
+                     fosssweeper::Server::MAX_EVENTS, 100);
+    if (event_count < 0) {
+      if (errno == EINTR)
+        continue;
+      throw makeSystemError("unable to wait for events");
+    }
+    for (int event_i = 0; event_i < event_count; event_i++) {
+      const auto &event = events[event_i];
+      const int fd = event.data.fd;
+      if (fd == this->_listenFd) {
+        this->acceptConnections();
+        continue;
+      }
+      const auto connection_it = this->_connections.find(fd);
+      if (connection_it == this->_connections.end())
+        continue;
+      auto &connection = connection_it->second;
+      bool open = (event.events & EPOLLERR) == 0;
+      if (open && (event.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP)) != 0) {
+        const bool peer_open = this->readInput(connection);
+        try {
+          this->handleFrames(connection);
+        } catch (const std::exception &) {
+          // the framing itself is broken, so nothing after it can be read
+          open = false;
+        }
+        if (open && !peer_open) {
+          // answer what the peer sent before it stopped writing
+          this->flush(connection);
+          open = false;
+        }
+      }
+      if (open && (event.events & EPOLLOUT) != 0) {
+        open = this->flush(connection);
+      }
+      if (!open) {
+        this->closeConnection(fd);
+      }
+    }
+    for (const auto fd : this->_flushFds) {
+      const auto connection_it = this->_connections.find(fd);
+      if (connection_it != this->_connections.end() &&
+          connection_it->second._flushQueued &&
+          !this->flush(connection_it->second)) {
+        this->closeConnection(fd);
+      }
+    }
+    this->_flushFds.clear();
+  }
+}
+
+void fosssweeper::Server::publish(const std::string &name) {
+  this->_boardPublisher = std::make_unique<fosssweeper::BoardPublisher>(
+      name, fosssweeper::Server::PUBLISHED_CHANGE_COUNT,
+      fosssweeper::Server::MAX_BUTTON_COUNT);
+}
+
+std::size_t fosssweeper::Server::getConnectionCount() const noexcept {
+  return this->_connections.size();
+}
+
+std::size_t fosssweeper::Server::getSessionCount() const noexcept {
+  return this->_sessionTable.getSessionCount();
+}
+
+std::uint64_t fosssweeper::Server::getRequestCount() const noexcept {
+  return this->_requestCount;
+}
+
+std::uint64_t fosssweeper::Server::getActionCount() const noexcept {
+  return this->_actionCount;
+}
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_SERVER_HPP
+#define FOSSSWEEPER_SERVER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/action.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "board_publisher.hpp"
+#include "protocol.hpp"
+#include "session_table.hpp"
+
+namespace fosssweeper {
+struct GameModel;
+
+struct Connection {
+  int _fd = -1;
+  int _connectionId = 0;
+  std::vector<std::uint8_t> _input = std::vector<std::uint8_t>();
+  std::vector<std::uint8_t> _output = std::vector<std::uint8_t>();
+  std::size_t _outputSent = 0;
+  std::vector<std::uint64_t> _sessionIds = std::vector<std::uint64_t>();
+  bool _flushQueued = false;
+  bool _writeWatched = false;
+};
+
+// Single threaded game server on a Unix domain socket. All connections are
+// multiplexed with epoll; every frame that arrived in one wakeup is handled
+// before the responses are written, so a client pipelining requests gets
+// its responses in one send. Responses are encoded straight into the output
+// buffer of the connection, and actions are answered with the buttons they
+// changed instead of the whole board. With a BoardPublisher the most recently
+// created session is also published to shared memory for spectators.
+struct Server {
+  static const std::size_t READ_SIZE;
+  static const std::size_t MAX_OUTPUT_SIZE;
+  static const std::size_t MAX_BUTTON_COUNT;
+  static const int MAX_EVENTS;
+  static const std::size_t PUBLISHED_CHANGE_COUNT;
+
+  std::string _socketPath;
+  int _listenFd = -1;
+  int _epollFd = -1;
+  int _nextConnectionId = 0;
+  std::unordered_map<int, fosssweeper::Connection> _connections =
+      std::unordered_map<int, fosssweeper::Connection>();
+  std::vector<int> _flushFds = std::vector<int>();
+  fosssweeper::SessionTable _sessionTable;
+  std::vector<fosssweeper::Action> _actions =
+      std::vector<fosssweeper::Action>();
+  std::vector<fosssweeper::ActionResult> _actionResults =
+      std::vector<fosssweeper::ActionResult>();
+  std::unique_ptr<fosssweeper::BoardPublisher> _boardPublisher = nullptr;
+  int _publishedConnectionId = -1;
+  std::uint64_t _publishedSessionId = 0;
+  std::uint64_t _requestCount = 0;
+  std::uint64_t _actionCount = 0;
+
+  void acceptConnections();
+  bool readInput(fosssweeper::Connection &connection);
+  void handleFrames(fosssweeper::Connection &connection);
+  void handleMessage(fosssweeper::Connection &connection,
+                     fosssweeper::MessageReader &message_reader,
+                     fosssweeper::MessageWriter &message_writer,
+                     const fosssweeper::MessageHeader &message_header);
+  void writeChanges(fosssweeper::MessageWriter &message_writer,
+                    const fosssweeper::GameModel &game_model,
+                    std::size_t processed_count);
+  void writeBoard(fosssweeper::MessageWriter &message_writer,
+                  const fosssweeper::GameModel &game_model);
+  bool flush(fosssweeper::Connection &connection);
+  void watchWrite(fosssweeper::Connection &connection, bool write_watched);
+  void closeConnection(int fd);
+  void publishChanges(const fosssweeper::Connection &connection,
+                      std::uint64_t session_id,
+                      const fosssweeper::GameModel &game_model);
+
+  Server(std::string socket_path);
+  Server(const fosssweeper::Server &) = delete;
+  fosssweeper::Server &operator=(const fosssweeper::Server &) = delete;
+  ~Server();
+
+  void run(const std::atomic<bool> &stopping);
+  void publish(const std::string &name);
+  std::size_t getConnectionCount() const noexcept;
+  std::size_t getSessionCount() const noexcept;
+  std::uint64_t getRequestCount() const noexcept;
+  std::uint64_t getActionCount() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <atomic>
+#include <csignal>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "server.hpp"
+
+namespace {
+const char *const USAGE =
+    "usage: fosssweeper_server [options]\n"
+    "  --socket <path>      Unix domain socket to listen on\n"
+    "                       (default /tmp/fosssweeper.sock)\n"
+    "  --publish <name>     publish the newest session to POSIX shared\n"
+    "                       memory for fosssweeper_spectate, e.g. /fosssweeper\n";
+
+std::atomic<bool> stopping = false;
+
+void stop(int) { stopping = true; }
+} // namespace
+
+int main(int argc, char *argv[]) {
+  try {
+    std::string socket_path = "/tmp/fosssweeper.sock";
+    std::string publish_name;
+    for (int arg_i = 1; arg_i < argc; arg_i++) {
+      const std::string_view option = argv[arg_i];
+      if (option == "--help") {
+        std::cout << USAGE;
+        return 0;
+      }
+      if (arg_i + 1 >= argc) {
+        throw std::runtime_error("missing value for " + std::string(option));
+      }
+      const std::string value = argv[++arg_i];
+      if (option == "--socket") {
+        socket_path = value;
+      } else if (option == "--publish") {
+        publish_name = value;
+      } else {
+        throw std::runtime_error("unknown option " + std::string(option));
+      }
+    }
+
+    fosssweeper::Server server(socket_path);
+    if (!publish_name.empty()) {
+      server.publish(publish_name);
+    }
+    std::signal(SIGINT, stop);
+    std::signal(SIGTERM, stop);
+    std::cerr << "fosssweeper_server: listening on " << socket_path << "\n";
+    server.run(stopping);
+    std::cerr << "fosssweeper_server: handled " << server.getRequestCount()
+              << " requests with " << server.getActionCount() << " actions\n";
+  } catch (const std::exception &e) {
+    std::cerr << "fosssweeper_server: " << e.what() << "\n" << USAGE;
+    return 1;
+  }
+  return 0;
+}
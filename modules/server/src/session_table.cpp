@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_model.hpp>
+#include <memory>
+
+#include "session_table.hpp"
+
+fosssweeper::SessionTable::Slot *
+fosssweeper::SessionTable::findSlot(int owner_id, std::uint64_t session_id) {
+  const auto slot_i = static_cast<std::size_t>(session_id & 0xffffffff);
+  if (slot_i >= this->_slots.size())
+    return nullptr;
+  auto &slot = this->_slots[slot_i];
+  if (slot._ownerId != owner_id || owner_id < 0 ||
+      slot._generation != static_cast<std::uint32_t>(session_id >> 32))
+    return nullptr;
+  return &slot;
+}
+
+std::uint64_t fosssweeper::SessionTable::create(
+    int owner_id, fosssweeper::GameConfiguration game_configuration,
+    fosssweeper::GenerationMode generation_mode, std::uint64_t game_seed) {
+  std::uint32_t slot_i = 0;
+  if (this->_freeSlots.empty()) {
+    slot_i = static_cast<std::uint32_t>(this->_slots.size());
+    this->_slots.emplace_back();
+    this->_slots.back()._gameModel = std::make_unique<fosssweeper::GameModel>();
+    this->_slots.back()._gameModel->setChangeSetEnabled(true);
+  } else {
+    slot_i = this->_freeSlots.back();
+    this->_freeSlots.pop_back();
+  }
+  auto &slot = this->_slots[slot_i];
+  slot._ownerId = owner_id;
+  slot._gameModel->newGame(game_configuration);
+  slot._gameModel->setGenerationMode(generation_mode);
+  slot._gameModel->setGameSeed(game_seed);
+  this->_sessionCount++;
+  return (static_cast<std::uint64_t>(slot._generation) << 32) | slot_i;
+}
+
+fosssweeper::GameModel *
+fosssweeper::SessionTable::find(int owner_id, std::uint64_t session_id) {
+  auto *const slot = this->findSlot(owner_id, session_id);
+  return slot == nullptr ? nullptr : slot->_gameModel.get();
+}
+
+bool fosssweeper::SessionTable::destroy(int owner_id,
+                                        std::uint64_t session_id) {
+  auto *const slot = this->findSlot(owner_id, session_id);
+  if (slot == nullptr)
+    return false;
+  slot->_ownerId = -1;
+  slot->_generation++;
+  this->_freeSlots.push_back(static_cast<std::uint32_t>(session_id & 0xffffffff));
+  this->_sessionCount--;
+  return true;
+}
+
+std::size_t fosssweeper::SessionTable::getSessionCount() const noexcept {
+  return this->_sessionCount;
+}
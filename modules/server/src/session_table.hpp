@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_SESSION_TABLE_HPP
+#define FOSSSWEEPER_SESSION_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <memory>
+#include <vector>
+
+namespace fosssweeper {
+// The sessions of every connection of a server. Each session belongs to the
+// connection that created it, and the GameModel of a destroyed session is
+// kept for the next session instead of being freed. Session ids carry a
+// generation so a reused slot never answers to an old id.
+struct SessionTable {
+  struct Slot {
+    std::unique_ptr<fosssweeper::GameModel> _gameModel = nullptr;
+    std::uint32_t _generation = 0;
+    int _ownerId = -1;
+  };
+
+  std::vector<fosssweeper::SessionTable::Slot> _slots =
+      std::vector<fosssweeper::SessionTable::Slot>();
+  std::vector<std::uint32_t> _freeSlots = std::vector<std::uint32_t>();
+  std::size_t _sessionCount = 0;
+
+  fosssweeper::SessionTable::Slot *findSlot(int owner_id,
+                                            std::uint64_t session_id);
+
+  SessionTable() noexcept = default;
+  SessionTable(const fosssweeper::SessionTable &) = delete;
+  fosssweeper::SessionTable &
+  operator=(const fosssweeper::SessionTable &) = delete;
+
+  std::uint64_t create(int owner_id,
+                       fosssweeper::GameConfiguration game_configuration,
+                       fosssweeper::GenerationMode generation_mode,
+                       std::uint64_t game_seed);
+  fosssweeper::GameModel *find(int owner_id, std::uint64_t session_id);
+  bool destroy(int owner_id, std::uint64_t session_id);
+  std::size_t getSessionCount() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/tool_options.hpp>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "board_subscriber.hpp"
+
+namespace {
+const char *const USAGE =
+    "usage: fosssweeper_spectate [options]\n"
+    "  --name <name>        shared memory the server publishes to\n"
+    "                       (default /fosssweeper)\n"
+    "  --fps <count>        screen updates per second (default 30)\n"
+    "  --frames <count>     stop after this many updates (default: never)\n";
+
+std::atomic<bool> stopping = false;
+
+void stop(int) { stopping = true; }
+
+char getVisibleChar(std::uint8_t visible_code) {
+  if (visible_code == fosssweeper::Button::VISIBLE_CODE_FLAGGED)
+    return 'F';
+  if (visible_code == fosssweeper::Button::VISIBLE_CODE_QUESTIONED)
+    return '?';
+  if (visible_code == fosssweeper::Button::VISIBLE_CODE_EXPLODED)
+    return '*';
+  if (visible_code == fosssweeper::Button::VISIBLE_CODE_DOWN)
+    return '.';
+  if (visible_code > fosssweeper::Button::VISIBLE_CODE_DOWN &&
+      visible_code < fosssweeper::Button::VISIBLE_CODE_EXPLODED)
+    return static_cast<char>('0' + visible_code -
+                             fosssweeper::Button::VISIBLE_CODE_DOWN);
+  return '#';
+}
+
+const char *getGameStateName(fosssweeper::GameState game_state) {
+  switch (game_state) {
+  case fosssweeper::GameState::Playing:
+    return "playing";
+  case fosssweeper::GameState::Dead:
+    return "dead";
+  case fosssweeper::GameState::Cool:
+    return "cool";
+  default:
+    return "new";
+  }
+}
+
+void render(std::ostream &os,
+            const fosssweeper::BoardSubscriber &board_subscriber) {
+  std::string frame = "\x1b[H\x1b[2J";
+  frame += std::string(getGameStateName(board_subscriber.getGameState())) +
+           "  bombs left " +
+           std::to_string(board_subscriber.getBombCount() -
+                          board_subscriber.getFlagCount()) +
+           "  buttons left " +
+           std::to_string(board_subscriber.getButtonsLeft()) + "  changes " +
+           std::to_string(board_subscriber.getChangeCount()) + "  reloads " +
+           std::to_string(board_subscriber.getReloadCount()) + "\n";
+  const auto &visible_codes = board_subscriber.getVisibleCodes();
+  const auto buttons_wide =
+      static_cast<std::size_t>(board_subscriber.getButtonsWide());
+  for (std::size_t button_i = 0; button_i < visible_codes.size(); button_i++) {
+    frame += getVisibleChar(visible_codes[button_i]);
+    if ((button_i + 1) % buttons_wide == 0) {
+      frame += '\n';
+    }
+  }
+  os << frame << std::flush;
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+  try {
+    std::string name = "/fosssweeper";
+    std::uint64_t fps = 30;
+    std::uint64_t frame_count = 0;
+    for (int arg_i = 1; arg_i < argc; arg_i++) {
+      const std::string_view option = argv[arg_i];
+      if (option == "--help") {
+        std::cout << USAGE;
+        return 0;
+      }
+      if (arg_i + 1 >= argc) {
+        throw std::runtime_error("missing value for " + std::string(option));
+      }
+      const std::string value = argv[++arg_i];
+      if (option == "--name") {
+        name = value;
+      } else if (option == "--fps") {
+        fps = fosssweeper::parseNumber(option, value);
+      } else if (option == "--frames") {
+        frame_count = fosssweeper::parseNumber(option, value);
+      } else {
+        throw std::runtime_error("unknown option " + std::string(option));
+      }
+    }
+    if (fps == 0) {
+      throw std::runtime_error("fps must be positive");
+    }
+
+    std::signal(SIGINT, stop);
+    std::signal(SIGTERM, stop);
+    fosssweeper::BoardSubscriber board_subscriber(name);
+    render(std::cout, board_subscriber);
+    const auto frame_time = std::chrono::microseconds(1000000 / fps);
+    std::uint64_t rendered_count = 1;
+    while (!stopping.load() &&
+           (frame_count == 0 || rendered_count < frame_count)) {
+      std::this_thread::sleep_for(frame_time);
+      if (board_subscriber.poll()) {
+        render(std::cout, board_subscriber);
+        rendered_count++;
+      }
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "fosssweeper_spectate: " << e.what() << "\n" << USAGE;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_difficulty.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/tool_options.hpp>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "policy.hpp"
+#include "simulation.hpp"
+#include "work_stealing_pool.hpp"
+
+namespace {
+const char *const USAGE =
+    "usage: fosssweeper_sim [options]\n"
+    "  --games <count>      games per configuration (default 100000)\n"
+    "  --threads <count>    worker threads (default: hardware threads)\n"
+    "  --policy <policy>    random, solver or script:<path> (default solver)\n"
+    "  --config <config>    beginner, intermediate, expert or <w>x<h>x<b>,\n"
+    "                       may be repeated (default: all three presets)\n"
+    "  --mode <mode>        classic, opening or no_guess (default classic)\n"
+    "  --seed <seed>        seed of the first game (default 0)\n"
+    "  --output <path>      write the JSON report to a file\n";
+} // namespace
+
+int main(int argc, char *argv[]) {
+  try {
+    std::size_t game_count = 100000;
+    std::size_t thread_count = std::thread::hardware_concurrency();
+    std::string policy_name = "solver";
+    std::vector<fosssweeper::GameConfiguration> game_configurations;
+    auto generation_mode = fosssweeper::GenerationMode::Default;
+    std::uint64_t seed = 0;
+    std::string output_path;
+    for (int arg_i = 1; arg_i < argc; arg_i++) {
+      const std::string_view option = argv[arg_i];
+      if (option == "--help") {
+        std::cout << USAGE;
+        return 0;
+      }
+      if (arg_i + 1 >= argc) {
+        throw std::runtime_error("missing value for " + std::string(option));
+      }
+      const std::string value = argv[++arg_i];
+      if (option == "--games") {
+        game_count = fosssweeper::parseNumber(option, value);
+      } else if (option == "--threads") {
+        thread_count = fosssweeper::parseNumber(option, value);
+      } else if (option == "--policy") {
+        policy_name = value;
+      } else if (option == "--config") {
+        game_configurations.push_back(
+            fosssweeper::parseGameConfiguration(value));
+      } else if (option == "--mode") {
+        generation_mode = fosssweeper::parseGenerationMode(value);
+      } else if (option == "--seed") {
+        seed = fosssweeper::parseNumber(option, value);
+      } else if (option == "--output") {
+        output_path = value;
+      } else {
+        throw std::runtime_error("unknown option " + std::string(option));
+      }
+    }
+    if (game_configurations.empty()) {
+      game_configurations = {
+          fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Beginner),
+          fosssweeper::GameConfiguration(
+              fosssweeper::GameDifficulty::Intermediate),
+          fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert)};
+    }
+
+    const auto policy = fosssweeper::makePolicy(policy_name);
+    fosssweeper::WorkStealingPool pool(thread_count);
+    std::vector<fosssweeper::SimulationResult> simulation_results;
+    for (const auto &game_configuration : game_configurations) {
+      fosssweeper::SimulationSettings simulation_settings;
+      simulation_settings._gameConfiguration = game_configuration;
+      simulation_settings._generationMode = generation_mode;
+      simulation_settings._gameCount = game_count;
+      simulation_settings._seed = seed;
+      simulation_results.push_back(
+          fosssweeper::runSimulation(simulation_settings, *policy, pool));
+    }
+
+    if (output_path.empty()) {
+      fosssweeper::writeSimulationJson(std::cout, *policy,
+                                       pool.getThreadCount(),
+                                       simulation_results);
+    } else {
+      std::ofstream output(output_path);
+      if (!output)
+        throw std::runtime_error("unable to open " + output_path);
+      fosssweeper::writeSimulationJson(output, *policy, pool.getThreadCount(),
+                                       simulation_results);
+    }
+  } catch (const std::exception &e) {
+    std::cerr << "fosssweeper_sim: " << e.what() << "\n" << USAGE;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstddef>
+#include <fosssweeper/action.hpp>
+#include <fosssweeper/button_position.hpp>
+#include <fosssweeper/button_state.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "policy.hpp"
+
+namespace {
+bool getIsRunning(const fosssweeper::GameModel &game_model) {
+  return game_model.getGameState() == fosssweeper::GameState::None ||
+         game_model.getGameState() == fosssweeper::GameState::Playing;
+}
+} // namespace
+
+void fosssweeper::RandomPolicy::playGame(fosssweeper::GameModel &game_model,
+                                         std::mt19937_64 &rng) const {
+  while (getIsRunning(game_model) &&
+         fosssweeper::clickRandomButton(game_model, rng)) {
+  }
+}
+
+std::string fosssweeper::RandomPolicy::getName() const { return "random"; }
+
+void fosssweeper::SolverPolicy::playGame(fosssweeper::GameModel &game_model,
+                                         std::mt19937_64 &rng) const {
+  const auto game_configuration = game_model.getGameConfiguration();
+  game_model.clickButton(game_configuration.getButtonsWide() / 2,
+                         game_configuration.getButtonsTall() / 2);
+  while (game_model.getGameState() == fosssweeper::GameState::Playing) {
+    game_model.applyCertainMoves();
+    if (game_model.getGameState() != fosssweeper::GameState::Playing ||
+        !fosssweeper::clickRandomButton(game_model, rng))
+      break;
+  }
+}
+
+std::string fosssweeper::SolverPolicy::getName() const { return "solver"; }
+
+fosssweeper::ScriptedPolicy::ScriptedPolicy(std::string_view name,
+                                            std::istream &script)
+    : _name(name) {
+  std::string line;
+  std::size_t line_number = 0;
+  while (std::getline(script, line)) {
+    line_number++;
+    if (line.empty() || line[0] == '#')
+      continue;
+    std::istringstream line_stream(line);
+    char action_char = 0;
+    fosssweeper::Action action;
+    if (!(line_stream >> action_char >> action._buttonPosition.x >>
+          action._buttonPosition.y) ||
+        action._buttonPosition.x < 0 || action._buttonPosition.y < 0) {
+      throw std::runtime_error("invalid script action on line " +
+                               std::to_string(line_number));
+    }
+    switch (action_char) {
+    case 'c':
+      action._actionType = fosssweeper::ActionType::Click;
+      break;
+    case 'f':
+      action._actionType = fosssweeper::ActionType::AltClick;
+      break;
+    case 'a':
+      action._actionType = fosssweeper::ActionType::AreaClick;
+      break;
+    default:
+      throw std::runtime_error("invalid script action type on line " +
+                               std::to_string(line_number));
+    }
+    this->_actions.push_back(action);
+  }
+}
+
+void fosssweeper::ScriptedPolicy::playGame(fosssweeper::GameModel &game_model,
+                                           std::mt19937_64 &) const {
+  // actions outside of smaller boards are ignored by applyActions
+  thread_local std::vector<fosssweeper::ActionResult> action_results;
+  action_results.resize(this->_actions.size());
+  game_model.applyActions(this->_actions, action_results);
+}
+
+std::string fosssweeper::ScriptedPolicy::getName() const {
+  return this->_name;
+}
+
+bool fosssweeper::clickRandomButton(fosssweeper::GameModel &game_model,
+                                    std::mt19937_64 &rng) {
+  const auto &buttons = game_model.getButtons();
+  const auto buttons_wide = game_model.getGameConfiguration().getButtonsWide();
+  std::size_t candidate_count = 0;
+  for (const auto &button : buttons) {
+    if (button.getIsPressable()) {
+      candidate_count++;
+    }
+  }
+  if (candidate_count == 0)
+    return false;
+  auto candidate_i =
+      std::uniform_int_distribution<std::size_t>(0, candidate_count - 1)(rng);
+  for (std::size_t button_i = 0; button_i < buttons.size(); button_i++) {
+    if (!buttons[button_i].getIsPressable())
+      continue;
+    if (candidate_i == 0) {
+      game_model.clickButton(static_cast<int>(button_i % buttons_wide),
+                             static_cast<int>(button_i / buttons_wide));
+      return true;
+    }
+    candidate_i--;
+  }
+  return false;
+}
+
+std::unique_ptr<fosssweeper::Policy>
+fosssweeper::makePolicy(std::string_view name) {
+  static constexpr std::string_view SCRIPT_PREFIX = "script:";
+  if (name == "random")
+    return std::make_unique<fosssweeper::RandomPolicy>();
+  if (name == "solver")
+    return std::make_unique<fosssweeper::SolverPolicy>();
+  if (name.starts_with(SCRIPT_PREFIX)) {
+    const std::string path(name.substr(SCRIPT_PREFIX.size()));
+    std::ifstream script(path);
+    if (!script)
+      throw std::runtime_error("unable to open script " + path);
+    return std::make_unique<fosssweeper::ScriptedPolicy>(name, script);
+  }
+  throw std::runtime_error("unknown policy " + std::string(name));
+}
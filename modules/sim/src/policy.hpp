@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_POLICY_HPP
+#define FOSSSWEEPER_POLICY_HPP
+
+#include <fosssweeper/action.hpp>
+#include <istream>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fosssweeper {
+struct GameModel;
+
+// Plays a freshly started game until it is won, lost or the policy gives up.
+// Policies are shared between worker threads, so playGame must not change
+// the policy itself.
+struct Policy {
+  virtual ~Policy() = default;
+
+  virtual void playGame(fosssweeper::GameModel &game_model,
+                        std::mt19937_64 &rng) const = 0;
+  virtual std::string getName() const = 0;
+};
+
+// Clicks random covered buttons.
+struct RandomPolicy : public fosssweeper::Policy {
+  void playGame(fosssweeper::GameModel &game_model,
+                std::mt19937_64 &rng) const override;
+  std::string getName() const override;
+};
+
+// Opens the center button, then applies every certain move and only clicks a
+// random covered button when the solver is stuck.
+struct SolverPolicy : public fosssweeper::Policy {
+  void playGame(fosssweeper::GameModel &game_model,
+                std::mt19937_64 &rng) const override;
+  std::string getName() const override;
+};
+
+// Replays a fixed list of actions as one batch, one per line as
+// "<c|f|a> <x> <y>" for a click, a flag or an area click. Empty lines and
+// lines starting with '#' are skipped.
+struct ScriptedPolicy : public fosssweeper::Policy {
+  std::string _name = std::string();
+  std::vector<fosssweeper::Action> _actions =
+      std::vector<fosssweeper::Action>();
+
+  ScriptedPolicy(std::string_view name, std::istream &script);
+
+  void playGame(fosssweeper::GameModel &game_model,
+                std::mt19937_64 &rng) const override;
+  std::string getName() const override;
+};
+
+bool clickRandomButton(fosssweeper::GameModel &game_model,
+                       std::mt19937_64 &rng);
+std::unique_ptr<fosssweeper::Policy> makePolicy(std::string_view name);
+} // namespace fosssweeper
+
+#endif
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/zobrist.hpp>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "simulation.hpp"
+
+namespace {
+// one per worker thread, aligned so the counters of two workers never share
+// a cache line
+struct alignas(64) WorkerState {
+  fosssweeper::GameModel _gameModel;
+  std::mt19937_64 _rng;
+  std::size_t _winCount = 0;
+  std::size_t _lossCount = 0;
+  std::vector<std::uint64_t> _latencies;
+};
+
+void writeJsonString(std::ostream &os, const std::string &value) {
+  os << '"';
+  for (const char c : value) {
+    if (c == '"' || c == '\\') {
+      os << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      os << ' ';
+    } else {
+      os << c;
+    }
+  }
+  os << '"';
+}
+} // namespace
+
+std::uint64_t fosssweeper::SimulationResult::getLatencyPercentile(
+    double percentile) const noexcept {
+  if (this->_latencies.empty())
+    return 0;
+  const auto rank = static_cast<std::size_t>(
+      std::ceil(percentile / 100.0 * this->_latencies.size()));
+  return this->_latencies[std::clamp<std::size_t>(rank, 1,
+                                                  this->_latencies.size()) -
+                          1];
+}
+
+fosssweeper::SimulationResult fosssweeper::runSimulation(
+    const fosssweeper::SimulationSettings &simulation_settings,
+    const fosssweeper::Policy &policy, fosssweeper::WorkStealingPool &pool) {
+  std::vector<WorkerState> worker_states(pool.getThreadCount());
+  for (auto &worker_state : worker_states) {
+    worker_state._gameModel.newGame(simulation_settings._gameConfiguration);
+    worker_state._gameModel.setGenerationMode(
+        simulation_settings._generationMode);
+    worker_state._latencies.reserve(simulation_settings._gameCount /
+                                    worker_states.size());
+  }
+  const auto start = std::chrono::steady_clock::now();
+  pool.run(simulation_settings._gameCount, 64,
+           [&](std::size_t worker_i, std::size_t game_i) {
+             auto &worker_state = worker_states[worker_i];
+             auto &game_model = worker_state._gameModel;
+             const auto game_seed =
+                 fosssweeper::mixZobristKey(simulation_settings._seed + game_i);
+             const auto game_start = std::chrono::steady_clock::now();
+             game_model.newGame();
+             game_model.setGameSeed(game_seed);
+             worker_state._rng.seed(fosssweeper::mixZobristKey(game_seed));
+             policy.playGame(game_model, worker_state._rng);
+             const auto game_end = std::chrono::steady_clock::now();
+             worker_state._latencies.push_back(static_cast<std::uint64_t>(
+                 std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     game_end - game_start)
+                     .count()));
+             if (game_model.getGameState() == fosssweeper::GameState::Cool) {
+               worker_state._winCount++;
+             } else if (game_model.getGameState() ==
+                        fosssweeper::GameState::Dead) {
+               worker_state._lossCount++;
+             }
+           });
+  const auto end = std::chrono::steady_clock::now();
+  fosssweeper::SimulationResult simulation_result;
+  simulation_result._simulationSettings = simulation_settings;
+  simulation_result._seconds =
+      std::chrono::duration<double>(end - start).count();
+  simulation_result._latencies.reserve(simulation_settings._gameCount);
+  for (const auto &worker_state : worker_states) {
+    simulation_result._winCount += worker_state._winCount;
+    simulation_result._lossCount += worker_state._lossCount;
+    simulation_result._latencies.insert(simulation_result._latencies.end(),
+                                        worker_state._latencies.begin(),
+                                        worker_state._latencies.end());
+  }
+  std::sort(simulation_result._latencies.begin(),
+            simulation_result._latencies.end());
+  return simulation_result;
+}
+
+std::string
+fosssweeper::getGenerationModeName(fosssweeper::GenerationMode generation_mode) {
+  switch (generation_mode) {
+  case fosssweeper::GenerationMode::Opening:
+    return "opening";
+  case fosssweeper::GenerationMode::NoGuess:
+    return "no_guess";
+  default:
+    return "classic";
+  }
+}
+
+void fosssweeper::writeSimulationJson(
+    std::ostream &os, const fosssweeper::Policy &policy,
+    std::size_t thread_count,
+    const std::vector<fosssweeper::SimulationResult> &simulation_results) {
+  os << "{\n";
+  os << "  \"policy\": ";
+  writeJsonString(os, policy.getName());
+  os << ",\n";
+  os << "  \"threads\": " << thread_count << ",\n";
+  os << "  \"results\": [";
+  for (std::size_t result_i = 0; result_i < simulation_results.size();
+       result_i++) {
+    const auto &simulation_result = simulation_results[result_i];
+    const auto &simulation_settings = simulation_result._simulationSettings;
+    const auto &game_configuration = simulation_settings._gameConfiguration;
+    const auto game_count = simulation_settings._gameCount;
+    const double win_rate =
+        game_count == 0 ? 0.0
+                        : static_cast<double>(simulation_result._winCount) /
+                              static_cast<double>(game_count);
+    const double games_per_second =
+        simulation_result._seconds <= 0.0
+            ? 0.0
+            : static_cast<double>(game_count) / simulation_result._seconds;
+    os << (result_i == 0 ? "\n" : ",\n");
+    os << "    {\n";
+    os << "      \"buttons_wide\": " << game_configuration.getButtonsWide()
+       << ",\n";
+    os << "      \"buttons_tall\": " << game_configuration.getButtonsTall()
+       << ",\n";
+    os << "      \"bomb_count\": " << game_configuration.getBombCount()
+       << ",\n";
+    os << "      \"generation_mode\": \""
+       << fosssweeper::getGenerationModeName(
+              simulation_settings._generationMode)
+       << "\",\n";
+    os << "      \"seed\": " << simulation_settings._seed << ",\n";
+    os << "      \"games\": " << game_count << ",\n";
+    os << "      \"wins\": " << simulation_result._winCount << ",\n";
+    os << "      \"losses\": " << simulation_result._lossCount << ",\n";
+    os << "      \"win_rate\": " << win_rate << ",\n";
+    os << "      \"seconds\": " << simulation_result._seconds << ",\n";
+    os << "      \"games_per_second\": " << games_per_second << ",\n";
+    os << "      \"latency_ns\": {\"p50\": "
+       << simulation_result.getLatencyPercentile(50.0)
+       << ", \"p90\": " << simulation_result.getLatencyPercentile(90.0)
+       << ", \"p99\": " << simulation_result.getLatencyPercentile(99.0)
+       << ", \"p999\": " << simulation_result.getLatencyPercentile(99.9)
+       << ", \"max\": " << simulation_result.getLatencyPercentile(100.0)
+       << "}\n";
+    os << "    }";
+  }
+  os << (simulation_results.empty() ? "]\n" : "\n  ]\n");
+  os << "}\n";
+}
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_SIMULATION_HPP
+#define FOSSSWEEPER_SIMULATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "policy.hpp"
+#include "work_stealing_pool.hpp"
+
+namespace fosssweeper {
+struct SimulationSettings {
+  fosssweeper::GameConfiguration _gameConfiguration =
+      fosssweeper::GameConfiguration();
+  fosssweeper::GenerationMode _generationMode =
+      fosssweeper::GenerationMode::Default;
+  std::size_t _gameCount = 0;
+  std::uint64_t _seed = 0;
+};
+
+struct SimulationResult {
+  fosssweeper::SimulationSettings _simulationSettings =
+      fosssweeper::SimulationSettings();
+  std::size_t _winCount = 0;
+  std::size_t _lossCount = 0;
+  double _seconds = 0.0;
+  // sorted game latencies in nanoseconds
+  std::vector<std::uint64_t> _latencies = std::vector<std::uint64_t>();
+
+  std::uint64_t getLatencyPercentile(double percentile) const noexcept;
+};
+
+// Plays every game of the simulation on the pool. Game i is generated from
+// the seed mixZobristKey(seed + i), so a result does not depend on how the
+// games were spread over the threads.
+fosssweeper::SimulationResult
+runSimulation(const fosssweeper::SimulationSettings &simulation_settings,
+              const fosssweeper::Policy &policy,
+              fosssweeper::WorkStealingPool &pool);
+std::string getGenerationModeName(fosssweeper::GenerationMode generation_mode);
+void writeSimulationJson(
+    std::ostream &os, const fosssweeper::Policy &policy,
+    std::size_t thread_count,
+    const std::vector<fosssweeper::SimulationResult> &simulation_results);
+} // namespace fosssweeper
+
+#endif
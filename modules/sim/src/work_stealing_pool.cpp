@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "work_stealing_pool.hpp"
+
+fosssweeper::WorkStealingPool::WorkStealingPool(std::size_t thread_count) {
+  thread_count = std::max<std::size_t>(thread_count, 1);
+  this->_queues.reserve(thread_count);
+  for (std::size_t worker_i = 0; worker_i < thread_count; worker_i++) {
+    this->_queues.push_back(
+        std::make_unique<fosssweeper::WorkStealingPool::Queue>());
+  }
+}
+
+bool fosssweeper::WorkStealingPool::tryPop(
+    std::size_t worker_i, fosssweeper::WorkStealingPool::Chunk &chunk) {
+  auto &queue = *this->_queues[worker_i];
+  std::lock_guard<std::mutex> lock(queue._mutex);
+  if (queue._chunks.empty())
+    return false;
+  chunk = queue._chunks.back();
+  queue._chunks.pop_back();
+  return true;
+}
+
+bool fosssweeper::WorkStealingPool::trySteal(
+    std::size_t worker_i, fosssweeper::WorkStealingPool::Chunk &chunk) {
+  const auto thread_count = this->_queues.size();
+  for (std::size_t offset = 1; offset < thread_count; offset++) {
+    auto &queue = *this->_queues[(worker_i + offset) % thread_count];
+    std::lock_guard<std::mutex> lock(queue._mutex);
+    if (queue._chunks.empty())
+      continue;
+    chunk = queue._chunks.front();
+    queue._chunks.pop_front();
+    return true;
+  }
+  return false;
+}
+
+void fosssweeper::WorkStealingPool::work(
+    std::size_t worker_i,
+    const std::function<void(std::size_t, std::size_t)> &task) {
+  fosssweeper::WorkStealingPool::Chunk chunk;
+  // no chunks are added while running, so one failed steal means all are done
+  while (this->tryPop(worker_i, chunk) || this->trySteal(worker_i, chunk)) {
+    for (std::size_t task_i = chunk._begin; task_i < chunk._end; task_i++) {
+      task(worker_i, task_i);
+    }
+  }
+}
+
+void fosssweeper::WorkStealingPool::run(
+    std::size_t task_count, std::size_t chunk_size,
+    const std::function<void(std::size_t, std::size_t)> &task) {
+  const auto thread_count = this->_queues.size();
+  chunk_size = std::max<std::size_t>(chunk_size, 1);
+  std::size_t queue_i = 0;
+  for (std::size_t begin = 0; begin < task_count; begin += chunk_size) {
+    const auto end = std::min(begin + chunk_size, task_count);
+    this->_queues[queue_i]->_chunks.push_back({begin, end});
+    queue_i = (queue_i + 1) % thread_count;
+  }
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count - 1);
+  for (std::size_t worker_i = 1; worker_i < thread_count; worker_i++) {
+    threads.emplace_back([this, worker_i, &task] { this->work(worker_i, task); });
+  }
+  this->work(0, task);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+std::size_t fosssweeper::WorkStealingPool::getThreadCount() const noexcept {
+  return this->_queues.size();
+}
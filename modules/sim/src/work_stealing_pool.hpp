@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_WORK_STEALING_POOL_HPP
+#define FOSSSWEEPER_WORK_STEALING_POOL_HPP
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace fosssweeper {
+// Runs a batch of indexed tasks on a fixed number of threads. The tasks are
+// split into chunks that are dealt out to per thread queues; a thread works
+// through its own queue from the back and steals from the front of the other
+// queues once it runs dry.
+struct WorkStealingPool {
+  struct Chunk {
+    std::size_t _begin = 0;
+    std::size_t _end = 0;
+  };
+
+  struct Queue {
+    std::mutex _mutex = std::mutex();
+    std::deque<fosssweeper::WorkStealingPool::Chunk> _chunks =
+        std::deque<fosssweeper::WorkStealingPool::Chunk>();
+  };
+
+  std::vector<std::unique_ptr<fosssweeper::WorkStealingPool::Queue>> _queues =
+      std::vector<std::unique_ptr<fosssweeper::WorkStealingPool::Queue>>();
+
+  bool tryPop(std::size_t worker_i,
+              fosssweeper::WorkStealingPool::Chunk &chunk);
+  bool trySteal(std::size_t worker_i,
+                fosssweeper::WorkStealingPool::Chunk &chunk);
+  void work(std::size_t worker_i,
+            const std::function<void(std::size_t, std::size_t)> &task);
+
+  WorkStealingPool(std::size_t thread_count);
+
+  void run(std::size_t task_count, std::size_t chunk_size,
+           const std::function<void(std::size_t, std::size_t)> &task);
+  std::size_t getThreadCount() const noexcept;
+};
+} // namespace fosssweeper
+
+#endif
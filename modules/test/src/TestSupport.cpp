@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <fosssweeper/game_model.hpp>
+#include <fstream>
+#include <iterator>
+
+#include "TestSupport.hpp"
+
+std::filesystem::path
+fosssweeper::getTemporaryPath(const std::string &test_name,
+                              const std::string &name) {
+  auto path = std::filesystem::temp_directory_path() /
+              ("fosssweeper_" + test_name + "_test_" + name);
+  std::filesystem::remove(path);
+  return path;
+}
+
+std::vector<char> fosssweeper::readFile(const std::filesystem::path &path) {
+  std::ifstream stream(path, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(stream),
+                           std::istreambuf_iterator<char>());
+}
+
+std::vector<std::uint8_t>
+fosssweeper::getVisibleCodes(const fosssweeper::GameModel &game_model) {
+  std::vector<std::uint8_t> visible_codes;
+  for (const auto &button : game_model.getButtons()) {
+    visible_codes.push_back(button.getVisibleCode());
+  }
+  return visible_codes;
+}
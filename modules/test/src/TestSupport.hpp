@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_TEST_SUPPORT_HPP
+#define FOSSSWEEPER_TEST_SUPPORT_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fosssweeper {
+class GameModel;
+
+// a path in the temporary directory that no file occupies, unique to the test
+// named test_name
+std::filesystem::path getTemporaryPath(const std::string &test_name,
+                                       const std::string &name);
+std::vector<char> readFile(const std::filesystem::path &path);
+// the visible code of every button of the board in game_model
+std::vector<std::uint8_t> getVisibleCodes(const GameModel &game_model);
+} // namespace fosssweeper
+
+#endif
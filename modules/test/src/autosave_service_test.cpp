@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fosssweeper/autosave_service.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/mapped_file.hpp>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "TestSupport.hpp"
+
+SCENARIO("A file is memory mapped") {
+  GIVEN("A file with some bytes") {
+    const auto path = fosssweeper::getTemporaryPath("autosave", "mapped");
+    {
+      std::ofstream stream(path, std::ios::binary);
+      stream << "fosssweeper";
+    }
+
+    WHEN("It is mapped") {
+      fosssweeper::MappedFile mapped_file(path);
+
+      THEN("Its bytes are visible") {
+        REQUIRE(mapped_file.getSize() == 11);
+        CHECK(std::string(reinterpret_cast<const char *>(
+                              mapped_file.getData().data()),
+                          mapped_file.getSize()) == "fosssweeper");
+      }
+
+      AND_WHEN("The mapping is moved") {
+        fosssweeper::MappedFile moved_file(std::move(mapped_file));
+
+        THEN("The mapping belongs to the new object") {
+          CHECK(moved_file.getSize() == 11);
+          CHECK(mapped_file.getSize() == 0);
+        }
+      }
+    }
+
+    THEN("Mapping a missing file throws") {
+      CHECK_THROWS_AS(fosssweeper::MappedFile(
+                          fosssweeper::getTemporaryPath("autosave", "missing")),
+                      std::runtime_error);
+    }
+    std::filesystem::remove(path);
+  }
+}
+
+SCENARIO("A game is autosaved and restored") {
+  GIVEN("A GameModel with a game in progress and an AutosaveService") {
+    const auto path = fosssweeper::getTemporaryPath("autosave", "game");
+    fosssweeper::GameModel game_model;
+    game_model.newGame(fosssweeper::GameConfiguration(
+        fosssweeper::GameDifficulty::Intermediate));
+    game_model.setGenerationMode(fosssweeper::GenerationMode::Opening);
+    game_model.setGameSeed(17);
+    game_model.clickButton(8, 8);
+    game_model.altClickButton(0, 0);
+    game_model.updateTime(5000);
+
+    WHEN("The game is saved several times") {
+      {
+        fosssweeper::AutosaveService autosave_service(path);
+        autosave_service.request(game_model);
+        autosave_service.flush();
+        CHECK(autosave_service.getWrittenCount() == 1);
+        game_model.altClickButton(1, 0);
+        autosave_service.request(game_model);
+      }
+
+      THEN("The newest save is restored into another GameModel") {
+        fosssweeper::GameModel restored_model;
+        REQUIRE(fosssweeper::AutosaveService::tryLoad(path, restored_model));
+        CHECK(restored_model.getGameConfiguration() ==
+              game_model.getGameConfiguration());
+        CHECK(restored_model.getGameState() ==
+              fosssweeper::GameState::Playing);
+        CHECK(restored_model.getGameTime() == 5000);
+        CHECK(restored_model.getFlagCount() == 2);
+        CHECK(restored_model.getVisibleHash() == game_model.getVisibleHash());
+        CHECK(restored_model.getLayoutHash() == game_model.getLayoutHash());
+      }
+
+      THEN("No temporary file is left behind") {
+        auto temporary_path = path;
+        temporary_path += ".tmp";
+        CHECK_FALSE(std::filesystem::exists(temporary_path));
+      }
+    }
+
+    WHEN("The save file is missing or invalid") {
+      fosssweeper::GameModel restored_model;
+      restored_model.setGameSeed(3);
+      restored_model.clickButton(4, 4);
+      const auto visible_hash = restored_model.getVisibleHash();
+      const bool missing_loaded =
+          fosssweeper::AutosaveService::tryLoad(path, restored_model);
+      {
+        std::ofstream stream(path, std::ios::binary);
+        stream << "not a save";
+      }
+      const bool invalid_loaded =
+          fosssweeper::AutosaveService::tryLoad(path, restored_model);
+
+      THEN("Nothing is loaded and the game is unchanged") {
+        CHECK_FALSE(missing_loaded);
+        CHECK_FALSE(invalid_loaded);
+        CHECK(restored_model.getVisibleHash() == visible_hash);
+      }
+    }
+    std::filesystem::remove(path);
+  }
+}
+
+SCENARIO("A save is requested without serializing the game") {
+  GIVEN("A game in progress on a large board and an AutosaveService") {
+    const auto path = fosssweeper::getTemporaryPath("autosave", "large");
+    fosssweeper::GameModel game_model;
+    game_model.newGame(fosssweeper::GameConfiguration(1000, 1000, 100000));
+    game_model.setGameSeed(23);
+    game_model.clickButton(500, 500);
+    std::vector<std::size_t> pressable_buttons;
+    for (std::size_t button_i = 0; button_i < game_model.getButtons().size();
+         button_i++) {
+      if (game_model.getButtons()[button_i].getIsPressable()) {
+        pressable_buttons.push_back(button_i);
+      }
+    }
+    REQUIRE(pressable_buttons.size() >= 2);
+    const auto flag = [&](std::size_t button_i) {
+      game_model.altClickButton(static_cast<int>(button_i % 1000),
+                                static_cast<int>(button_i / 1000));
+    };
+    fosssweeper::AutosaveService autosave_service(path);
+    // the first request starts keeping the board copy-on-write
+    autosave_service.request(game_model);
+    autosave_service.flush();
+    flag(pressable_buttons[0]);
+
+    WHEN("A save is requested and the game goes on") {
+      // the fastest of a few requests, so a preempted request does not count
+      auto request_duration = std::chrono::steady_clock::duration::max();
+      for (int request_i = 0; request_i < 5; request_i++) {
+        if (request_i > 0)
+          autosave_service.flush();
+        const auto request_begin = std::chrono::steady_clock::now();
+        autosave_service.request(game_model);
+        request_duration = std::min(
+            request_duration, std::chrono::steady_clock::now() - request_begin);
+      }
+      const auto visible_hash = game_model.getVisibleHash();
+      std::ostringstream stream;
+      const auto save_begin = std::chrono::steady_clock::now();
+      game_model.save(stream);
+      const auto save_duration = std::chrono::steady_clock::now() - save_begin;
+      flag(pressable_buttons[1]);
+      autosave_service.flush();
+
+      THEN("The request takes a small fraction of serializing the board") {
+        CHECK(request_duration * 10 < save_duration);
+      }
+
+      THEN("The game is saved as it was when the save was requested") {
+        fosssweeper::GameModel restored_model;
+        REQUIRE(fosssweeper::AutosaveService::tryLoad(path, restored_model));
+        CHECK(restored_model.getFlagCount() == 1);
+        CHECK(restored_model.getVisibleHash() == visible_hash);
+        CHECK(restored_model.getVisibleHash() != game_model.getVisibleHash());
+        CHECK(restored_model.getLayoutHash() == game_model.getLayoutHash());
+      }
+    }
+    std::filesystem::remove(path);
+  }
+}
+
+SCENARIO("An expert autosave is restored within a frame", "[.][benchmark]") {
+  GIVEN("An autosave of an expert game in progress") {
+    const auto path = fosssweeper::getTemporaryPath("autosave", "expert");
+    {
+      fosssweeper::GameModel game_model;
+      game_model.newGame(
+          fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert));
+      game_model.setGameSeed(5);
+      game_model.clickButton(15, 8);
+      fosssweeper::AutosaveService autosave_service(path);
+      autosave_service.request(game_model);
+    }
+
+    WHEN("It is restored the way the desktop app restores it") {
+      fosssweeper::GameModel restored_model;
+      const auto restore_begin = std::chrono::steady_clock::now();
+      const bool loaded =
+          fosssweeper::AutosaveService::tryLoad(path, restored_model);
+      const auto restore_duration =
+          std::chrono::steady_clock::now() - restore_begin;
+
+      THEN("The restore takes well under a 60 Hz frame") {
+        std::cout << "expert restore: "
+                  << std::chrono::duration<double, std::micro>(
+                         restore_duration)
+                         .count()
+                  << " us\n";
+        REQUIRE(loaded);
+        CHECK(restore_duration < std::chrono::milliseconds(16));
+      }
+    }
+    std::filesystem::remove(path);
+  }
+}
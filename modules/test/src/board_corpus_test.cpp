@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fosssweeper/board_corpus.hpp>
+#include <fosssweeper/board_metrics.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <iostream>
+#include <vector>
+
+#include "TestSupport.hpp"
+
+SCENARIO("The 3BV of a board is measured") {
+  GIVEN("A board with an opening and two numbers outside of it") {
+    const fosssweeper::GameModel game_model(
+        fosssweeper::GameConfiguration(8, 1, 2), false,
+        fosssweeper::GameState::Playing, 0, "b..b....");
+
+    WHEN("The board is measured") {
+      const auto board_metrics = fosssweeper::BoardMetrics::measure(
+          game_model.getGameConfiguration(), game_model.getButtons());
+
+      THEN("The opening and the two numbers take a click each") {
+        CHECK(board_metrics._openingCount == 1);
+        CHECK(board_metrics._bbbv == 3);
+      }
+    }
+  }
+}
+
+SCENARIO("Boards are generated into a BoardCorpus and read back") {
+  GIVEN("Corpus settings for opening expert boards") {
+    fosssweeper::BoardCorpusSettings settings;
+    settings._gameConfiguration =
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert);
+    settings._generationMode = fosssweeper::GenerationMode::Opening;
+    settings._boardCount = 2500;
+    settings._firstSeed = 100;
+    const auto path = fosssweeper::getTemporaryPath("board_corpus", "expert");
+
+    WHEN("The corpus is generated with one and with three threads") {
+      fosssweeper::BoardCorpus::generate(path, settings, 1);
+      const auto single_thread_bytes = fosssweeper::readFile(path);
+      fosssweeper::BoardCorpus::generate(path, settings, 3);
+
+      THEN("Both files are the same") {
+        CHECK(fosssweeper::readFile(path) == single_thread_bytes);
+      }
+
+      THEN("Every record has the fixed size") {
+        CHECK(single_thread_bytes.size() ==
+              fosssweeper::BoardCorpus::HEADER_SIZE +
+                  settings._boardCount *
+                      fosssweeper::BoardCorpus::getRecordSize(
+                          settings._gameConfiguration));
+      }
+
+      AND_WHEN("The corpus is opened") {
+        const fosssweeper::BoardCorpus board_corpus(path);
+
+        THEN("The header is read back") {
+          CHECK(board_corpus.getBoardCount() == settings._boardCount);
+          CHECK(board_corpus.getGameConfiguration() ==
+                settings._gameConfiguration);
+          CHECK(board_corpus.getGenerationMode() ==
+                fosssweeper::GenerationMode::Opening);
+          CHECK_THROWS(board_corpus.getBoard(settings._boardCount));
+        }
+
+        THEN("A loaded board is the one its seed generates") {
+          const auto board_i = GENERATE(std::size_t(0), std::size_t(1337),
+                                        std::size_t(2499));
+          const auto board_record = board_corpus.getBoard(board_i);
+          CHECK(board_record._gameSeed == settings._firstSeed + board_i);
+
+          fosssweeper::GameModel loaded_model;
+          board_corpus.loadBoard(board_i, loaded_model);
+          fosssweeper::GameModel generated_model;
+          generated_model.newGame(settings._gameConfiguration);
+          generated_model.setGenerationMode(settings._generationMode);
+          generated_model.setGameSeed(board_record._gameSeed);
+          const auto first_click_x = static_cast<int>(
+              board_record._firstClickI %
+              static_cast<std::size_t>(
+                  settings._gameConfiguration.getButtonsWide()));
+          const auto first_click_y = static_cast<int>(
+              board_record._firstClickI /
+              static_cast<std::size_t>(
+                  settings._gameConfiguration.getButtonsWide()));
+          generated_model.clickButton(first_click_x, first_click_y);
+          CHECK(loaded_model.getGameState() ==
+                fosssweeper::GameState::Playing);
+          CHECK(loaded_model.getLayoutHash() ==
+                generated_model.getLayoutHash());
+
+          const auto board_metrics = fosssweeper::BoardMetrics::measure(
+              loaded_model.getGameConfiguration(), loaded_model.getButtons());
+          CHECK(board_record._bbbv == board_metrics._bbbv);
+          CHECK(board_record._openingCount == board_metrics._openingCount);
+
+          loaded_model.clickButton(first_click_x, first_click_y);
+          CHECK(loaded_model.getVisibleHash() ==
+                generated_model.getVisibleHash());
+          CHECK(loaded_model.getButtonsLeft() ==
+                generated_model.getButtonsLeft());
+        }
+      }
+
+      AND_WHEN("The corpus is cut off") {
+        std::filesystem::resize_file(
+            path, std::filesystem::file_size(path) - 1);
+
+        THEN("It is not opened") {
+          CHECK_THROWS(fosssweeper::BoardCorpus(path));
+        }
+      }
+    }
+    std::filesystem::remove(path);
+  }
+}
+
+SCENARIO("A large BoardCorpus is generated and read quickly",
+         "[.][benchmark]") {
+  GIVEN("Settings for 200000 classic expert boards") {
+    fosssweeper::BoardCorpusSettings settings;
+    settings._gameConfiguration =
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert);
+    settings._boardCount = 200000;
+    const auto path =
+        fosssweeper::getTemporaryPath("board_corpus", "benchmark");
+
+    WHEN("The corpus is generated and every board is loaded") {
+      const auto generate_begin = std::chrono::steady_clock::now();
+      fosssweeper::BoardCorpus::generate(path, settings, 4);
+      const auto generate_duration =
+          std::chrono::steady_clock::now() - generate_begin;
+      const auto load_begin = std::chrono::steady_clock::now();
+      const fosssweeper::BoardCorpus board_corpus(path);
+      fosssweeper::GameModel game_model;
+      long long bbbv_sum = 0;
+      for (std::size_t board_i = 0; board_i < board_corpus.getBoardCount();
+           board_i++) {
+        board_corpus.loadBoard(board_i, game_model);
+        bbbv_sum += board_corpus.getBoard(board_i)._bbbv;
+      }
+      const auto load_duration = std::chrono::steady_clock::now() - load_begin;
+
+      THEN("The rates are reported") {
+        const auto board_count = static_cast<double>(settings._boardCount);
+        std::cout << "generated boards: "
+                  << board_count /
+                         std::chrono::duration<double>(generate_duration)
+                             .count()
+                  << " per second\nloaded boards: "
+                  << board_count /
+                         std::chrono::duration<double>(load_duration).count()
+                  << " per second\nmean 3BV: " << bbbv_sum / board_count
+                  << "\nfile size: " << std::filesystem::file_size(path)
+                  << " bytes\n";
+        CHECK(bbbv_sum > 0);
+      }
+    }
+    std::filesystem::remove(path);
+  }
+}
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_difficulty.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+#include "TestSupport.hpp"
+#include "board_publisher.hpp"
+#include "board_subscriber.hpp"
+
+namespace {
+std::string getSharedMemoryName(const std::string &name) {
+  return "/fosssweeper_board_test_" + std::to_string(::getpid()) + "_" + name;
+}
+
+void checkBoard(const fosssweeper::BoardSubscriber &board_subscriber,
+                const fosssweeper::GameModel &game_model) {
+  const auto game_configuration = game_model.getGameConfiguration();
+  CHECK(board_subscriber.getButtonsWide() ==
+        game_configuration.getButtonsWide());
+  CHECK(board_subscriber.getButtonsTall() ==
+        game_configuration.getButtonsTall());
+  CHECK(board_subscriber.getBombCount() == game_configuration.getBombCount());
+  CHECK(board_subscriber.getGameState() == game_model.getGameState());
+  CHECK(board_subscriber.getFlagCount() == game_model.getFlagCount());
+  CHECK(board_subscriber.getButtonsLeft() == game_model.getButtonsLeft());
+  CHECK(board_subscriber.getVisibleCodes() ==
+        fosssweeper::getVisibleCodes(game_model));
+}
+} // namespace
+
+SCENARIO("A BoardSubscriber follows the board of a BoardPublisher") {
+  GIVEN("A published board and a subscriber with a small change ring") {
+    fosssweeper::GameModel game_model;
+    game_model.setChangeSetEnabled(true);
+    game_model.setGenerationMode(fosssweeper::GenerationMode::Opening);
+    game_model.newGame(
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert));
+    game_model.setGameSeed(7);
+    fosssweeper::BoardPublisher board_publisher(getSharedMemoryName("follow"),
+                                                8, 1024);
+    board_publisher.publishBoard(game_model);
+    fosssweeper::BoardSubscriber board_subscriber(board_publisher.getName());
+
+    THEN("The subscriber starts with the board") {
+      checkBoard(board_subscriber, game_model);
+      CHECK(board_subscriber.getReloadCount() == 1);
+      CHECK_FALSE(board_subscriber.poll());
+    }
+
+    WHEN("Flags are placed one action at a time") {
+      for (int x = 0; x < 5; x++) {
+        game_model.altClickButton(x, 0);
+        board_publisher.publishChanges(game_model);
+      }
+
+      THEN("Polling reads them from the change ring") {
+        CHECK(board_subscriber.poll());
+        checkBoard(board_subscriber, game_model);
+        CHECK(board_subscriber.getChangeCount() == 5);
+        CHECK(board_subscriber.getReloadCount() == 1);
+        CHECK_FALSE(board_subscriber.poll());
+      }
+
+      AND_WHEN("A flag is removed after the last poll") {
+        board_subscriber.poll();
+        game_model.altClickButton(0, 0);
+        board_publisher.publishChanges(game_model);
+
+        THEN("Only the new change is read") {
+          CHECK(board_subscriber.poll());
+          checkBoard(board_subscriber, game_model);
+          CHECK(board_subscriber.getChangeCount() == 6);
+          CHECK(board_subscriber.getReloadCount() == 1);
+        }
+      }
+    }
+
+    WHEN("An opening changes more buttons than the ring holds") {
+      game_model.clickButton(15, 8);
+      board_publisher.publishChanges(game_model);
+      REQUIRE(game_model.getChangeSet().getChangedButtonCount() > 8);
+
+      THEN("The lapped subscriber reloads the board") {
+        CHECK(board_subscriber.poll());
+        checkBoard(board_subscriber, game_model);
+        CHECK(board_subscriber.getReloadCount() == 2);
+      }
+
+      AND_WHEN("A single change follows") {
+        board_subscriber.poll();
+        game_model.altClickButton(0, 0);
+        board_publisher.publishChanges(game_model);
+
+        THEN("The subscriber follows the ring again") {
+          CHECK(board_subscriber.poll());
+          checkBoard(board_subscriber, game_model);
+          CHECK(board_subscriber.getReloadCount() == 2);
+        }
+      }
+    }
+
+    WHEN("A new board is published") {
+      game_model.clickButton(15, 8);
+      board_publisher.publishChanges(game_model);
+      game_model.newGame(fosssweeper::GameConfiguration(
+          fosssweeper::GameDifficulty::Intermediate));
+      board_publisher.publishBoard(game_model);
+
+      THEN("The subscriber reloads it under the new epoch") {
+        CHECK(board_subscriber.poll());
+        checkBoard(board_subscriber, game_model);
+        CHECK(board_subscriber.getReloadCount() == 2);
+        CHECK_FALSE(board_subscriber.poll());
+      }
+    }
+
+    WHEN("The publisher stops in the middle of writing the board") {
+      board_publisher.beginBoardWrite();
+
+      THEN("Polling gives up instead of waiting forever") {
+        CHECK_THROWS_AS(board_subscriber.poll(), std::runtime_error);
+        CHECK_THROWS_AS(
+            fosssweeper::BoardSubscriber(board_publisher.getName()),
+            std::runtime_error);
+      }
+    }
+  }
+}
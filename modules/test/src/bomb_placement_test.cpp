@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/bomb_placement.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/surrounding_buttons.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+std::size_t
+getFreeSurroundingCount(fosssweeper::GameConfiguration game_configuration,
+                        const std::vector<std::size_t> &bomb_buttons,
+                        std::size_t initial_i) {
+  std::size_t free_count = 0;
+  for (const auto surrounding_i : fosssweeper::SurroundingButtons(
+           initial_i, game_configuration.getButtonsWide(),
+           game_configuration.getButtonsTall())) {
+    if (std::find(bomb_buttons.begin(), bomb_buttons.end(), surrounding_i) ==
+        bomb_buttons.end()) {
+      free_count++;
+    }
+  }
+  return free_count;
+}
+} // namespace
+
+SCENARIO("Bombs are placed around a guaranteed opening") {
+  GIVEN("The preset game configurations") {
+    const auto game_difficulty = GENERATE(
+        fosssweeper::GameDifficulty::Beginner,
+        fosssweeper::GameDifficulty::Intermediate,
+        fosssweeper::GameDifficulty::Expert);
+    const fosssweeper::GameConfiguration game_configuration(game_difficulty);
+    std::mt19937_64 rng(game_configuration.getButtonCount());
+
+    WHEN("Bombs are placed for every initial Button") {
+      THEN("The bomb count is right and the initial Button is an opening") {
+        std::vector<std::size_t> bomb_buttons;
+        for (int y = 0; y < game_configuration.getButtonsTall(); y++) {
+          for (int x = 0; x < game_configuration.getButtonsWide(); x++) {
+            fosssweeper::placeOpeningBombs(game_configuration, x, y, rng,
+                                           bomb_buttons);
+            auto sorted_bomb_buttons = bomb_buttons;
+            std::sort(sorted_bomb_buttons.begin(), sorted_bomb_buttons.end());
+            REQUIRE(std::adjacent_find(sorted_bomb_buttons.begin(),
+                                       sorted_bomb_buttons.end()) ==
+                    sorted_bomb_buttons.end());
+            REQUIRE(bomb_buttons.size() ==
+                    static_cast<std::size_t>(
+                        game_configuration.getBombCount()));
+            REQUIRE(sorted_bomb_buttons.back() <
+                    static_cast<std::size_t>(
+                        game_configuration.getButtonCount()));
+            const auto initial_i = static_cast<std::size_t>(
+                y * game_configuration.getButtonsWide() + x);
+            REQUIRE(std::find(bomb_buttons.begin(), bomb_buttons.end(),
+                              initial_i) == bomb_buttons.end());
+            REQUIRE(getFreeSurroundingCount(game_configuration, bomb_buttons,
+                                            initial_i) ==
+                    fosssweeper::SurroundingButtons(
+                        initial_i, game_configuration.getButtonsWide(),
+                        game_configuration.getButtonsTall())
+                        .size());
+          }
+        }
+      }
+    }
+  }
+
+  GIVEN("Custom game configurations with extreme densities") {
+    const auto bomb_count = GENERATE(0, 1, 54, 55, 56, 60, 62, 63, 64);
+    const fosssweeper::GameConfiguration game_configuration(8, 8, bomb_count);
+    std::mt19937_64 rng(static_cast<std::uint64_t>(bomb_count));
+
+    WHEN("Bombs are placed for a middle and a corner initial Button") {
+      std::vector<std::size_t> middle_bomb_buttons;
+      std::vector<std::size_t> corner_bomb_buttons;
+      fosssweeper::placeOpeningBombs(game_configuration, 3, 3, rng,
+                                     middle_bomb_buttons);
+      fosssweeper::placeOpeningBombs(game_configuration, 0, 0, rng,
+                                     corner_bomb_buttons);
+
+      THEN("The bomb count is always right") {
+        CHECK(middle_bomb_buttons.size() ==
+              static_cast<std::size_t>(bomb_count));
+        CHECK(corner_bomb_buttons.size() ==
+              static_cast<std::size_t>(bomb_count));
+      }
+
+      THEN("The initial Button is free unless the board is all bombs") {
+        if (bomb_count < 64) {
+          CHECK(std::find(middle_bomb_buttons.begin(),
+                          middle_bomb_buttons.end(),
+                          27) == middle_bomb_buttons.end());
+          CHECK(std::find(corner_bomb_buttons.begin(),
+                          corner_bomb_buttons.end(),
+                          0) == corner_bomb_buttons.end());
+        }
+      }
+
+      THEN("As many surrounding Button objects as possible are free") {
+        if (bomb_count < 64) {
+          const auto free_count = static_cast<std::size_t>(63 - bomb_count);
+          CHECK(getFreeSurroundingCount(game_configuration,
+                                        middle_bomb_buttons, 27) ==
+                std::min<std::size_t>(8, free_count));
+          CHECK(getFreeSurroundingCount(game_configuration,
+                                        corner_bomb_buttons, 0) ==
+                std::min<std::size_t>(3, free_count));
+        }
+      }
+    }
+  }
+
+  GIVEN("A single row custom game configuration") {
+    const fosssweeper::GameConfiguration game_configuration(8, 1, 5);
+    std::mt19937_64 rng(5);
+
+    WHEN("Bombs are placed at the end of the row") {
+      std::vector<std::size_t> bomb_buttons;
+      fosssweeper::placeOpeningBombs(game_configuration, 7, 0, rng,
+                                     bomb_buttons);
+
+      THEN("The last two Button objects are free") {
+        CHECK(bomb_buttons.size() == 5);
+        CHECK(std::find(bomb_buttons.begin(), bomb_buttons.end(), 6) ==
+              bomb_buttons.end());
+        CHECK(std::find(bomb_buttons.begin(), bomb_buttons.end(), 7) ==
+              bomb_buttons.end());
+      }
+    }
+  }
+}
+
+SCENARIO("A GameModel generates a game with a guaranteed opening") {
+  GIVEN("A GameModel in opening generation mode") {
+    const auto game_difficulty = GENERATE(
+        fosssweeper::GameDifficulty::Beginner,
+        fosssweeper::GameDifficulty::Intermediate,
+        fosssweeper::GameDifficulty::Expert);
+    fosssweeper::GameModel game_model;
+    game_model.newGame(fosssweeper::GameConfiguration(game_difficulty));
+    game_model.setGenerationMode(fosssweeper::GenerationMode::Opening);
+
+    WHEN("The first Button is clicked") {
+      game_model.clickButton(5, 5);
+
+      THEN("The first Button has no surrounding bombs") {
+        CHECK(game_model.getGameState() != fosssweeper::GameState::Dead);
+        CHECK(game_model.getButton(5, 5).getSurroundingBombs() == 0);
+        CHECK(game_model.getButton(6, 6).getButtonState() ==
+              fosssweeper::ButtonState::Down);
+      }
+    }
+  }
+}
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/button_planes.hpp>
+#include <fosssweeper/button_state.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/zobrist.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+SCENARIO("Button strings are parsed into ButtonPlanes") {
+  GIVEN("A button string of random valid characters") {
+    const std::size_t button_count = GENERATE(1, 63, 64, 65, 200, 1000);
+    const std::string button_chars = "dbxfcqr.";
+    std::string button_string(button_count, '.');
+    std::uint64_t seed = button_count;
+    for (auto &c : button_string) {
+      seed = fosssweeper::mixZobristKey(seed);
+      c = button_chars[seed % button_chars.size()];
+    }
+
+    WHEN("It is parsed and unpacked") {
+      fosssweeper::ButtonPlanes button_planes;
+      button_planes.parseButtonString(button_string);
+      std::vector<fosssweeper::Button> buttons;
+      button_planes.unpack(buttons, static_cast<int>(button_count), 1);
+
+      THEN("Every button matches the button parsed from its character") {
+        REQUIRE(buttons.size() == button_count);
+        int flag_count = 0;
+        int down_count = 0;
+        int bomb_count = 0;
+        for (std::size_t button_i = 0; button_i < button_count; button_i++) {
+          const fosssweeper::Button button(button_string[button_i]);
+          REQUIRE(buttons[button_i].getButtonState() ==
+                  button.getButtonState());
+          REQUIRE(buttons[button_i].getHasBomb() == button.getHasBomb());
+          flag_count +=
+              button.getButtonState() == fosssweeper::ButtonState::Flagged;
+          down_count +=
+              button.getButtonState() == fosssweeper::ButtonState::Down;
+          bomb_count += button.getHasBomb();
+        }
+        CHECK(button_planes.getFlagCount() == flag_count);
+        CHECK(button_planes.getDownCount() == down_count);
+        CHECK(button_planes.getBombCount() == bomb_count);
+        CHECK_FALSE(button_planes.getHasPadding());
+      }
+    }
+
+    WHEN("One character is replaced by an invalid one") {
+      const std::size_t invalid_i = button_count / 2;
+      button_string[invalid_i] = 'z';
+
+      THEN("Parsing reports the character and its position") {
+        fosssweeper::ButtonPlanes button_planes;
+        CHECK_THROWS_WITH(button_planes.parseButtonString(button_string),
+                          "invalid button string character 'z' at " +
+                              std::to_string(invalid_i));
+      }
+    }
+  }
+}
+
+SCENARIO("A GameModel is constructed from a button string") {
+  GIVEN("A button string with every kind of button") {
+    const std::string button_string = "dbxfcqr."
+                                      "bbb....."
+                                      "b.b....."
+                                      "bbb....f";
+
+    WHEN("A GameModel is constructed from it") {
+      const fosssweeper::GameModel game_model(
+          fosssweeper::GameConfiguration(8, 4, 12), false,
+          fosssweeper::GameState::Playing, 0, button_string);
+
+      THEN("Counters and surrounding bombs match the board") {
+        CHECK(game_model.getFlagCount() == 3);
+        CHECK(game_model.getButtonsLeft() == 8 * 4 - 12 - 2);
+        CHECK(game_model.getButton(1, 2).getSurroundingBombs() == 8);
+        CHECK(game_model.getButton(0, 0).getSurroundingBombs() == 3);
+        CHECK(game_model.getButton(7, 3).getSurroundingBombs() == 0);
+      }
+    }
+
+    WHEN("A character is invalid") {
+      auto invalid_string = button_string;
+      invalid_string[9] = '?';
+
+      THEN("The constructor throws") {
+        CHECK_THROWS_AS(fosssweeper::GameModel(
+                            fosssweeper::GameConfiguration(8, 4, 12), false,
+                            fosssweeper::GameState::Playing, 0, invalid_string),
+                        std::runtime_error);
+      }
+    }
+  }
+}
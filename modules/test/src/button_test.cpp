@@ -207,6 +207,20 @@ SCENARIO("The Questioned state of a Button is removed") {
   }
 }
 
+SCENARIO("The ButtonState of a Button is set") {
+  GIVEN("A Button with ButtonState::Questioned") {
+    fosssweeper::Button button('q');
+
+    WHEN("The ButtonState is set to Flagged") {
+      button.setButtonState(fosssweeper::ButtonState::Flagged);
+
+      THEN("The ButtonState is Flagged") {
+        CHECK(button.getButtonState() == fosssweeper::ButtonState::Flagged);
+      }
+    }
+  }
+}
+
 SCENARIO("A Button is set having a bomb") {
   GIVEN("A Button") {
     fosssweeper::Button button;
@@ -294,4 +308,51 @@ SCENARIO("It is determined if a Button is pressable") {
       }
     }
   }
-}
\ No newline at end of file
+}
+SCENARIO("The visible code of a Button is calculated") {
+  GIVEN("A default constructed Button") {
+    fosssweeper::Button button;
+
+    THEN("The visible code is VISIBLE_CODE_NONE") {
+      CHECK(button.getVisibleCode() == fosssweeper::Button::VISIBLE_CODE_NONE);
+    }
+
+    WHEN("The Button is flagged") {
+      button.altPress(true);
+
+      THEN("The visible code is VISIBLE_CODE_FLAGGED") {
+        CHECK(button.getVisibleCode() ==
+              fosssweeper::Button::VISIBLE_CODE_FLAGGED);
+      }
+    }
+
+    WHEN("The Button is questioned") {
+      button.altPress(true);
+      button.altPress(true);
+
+      THEN("The visible code is VISIBLE_CODE_QUESTIONED") {
+        CHECK(button.getVisibleCode() ==
+              fosssweeper::Button::VISIBLE_CODE_QUESTIONED);
+      }
+    }
+
+    WHEN("The Button is pressed with 3 surrounding bombs") {
+      button.setSurroundingBombs(3);
+      button.press();
+
+      THEN("The visible code is VISIBLE_CODE_DOWN plus 3") {
+        CHECK(button.getVisibleCode() ==
+              fosssweeper::Button::VISIBLE_CODE_DOWN + 3);
+      }
+    }
+  }
+
+  GIVEN("A Button constructed with 'x'") {
+    const fosssweeper::Button button('x');
+
+    THEN("The visible code is VISIBLE_CODE_EXPLODED") {
+      CHECK(button.getVisibleCode() ==
+            fosssweeper::Button::VISIBLE_CODE_EXPLODED);
+    }
+  }
+}
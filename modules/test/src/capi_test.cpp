@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/fosssweeper.h>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <vector>
+
+SCENARIO("The C interface checks versions") {
+  GIVEN("The API version of the library") {
+    const auto api_version = fosssweeper_get_api_version();
+
+    THEN("Only callers of the same major and an older minor are accepted") {
+      CHECK(api_version == FOSSSWEEPER_API_VERSION);
+      CHECK(fosssweeper_check_version(FOSSSWEEPER_API_VERSION) ==
+            FOSSSWEEPER_OK);
+      CHECK(fosssweeper_check_version(FOSSSWEEPER_API_VERSION + 1) ==
+            FOSSSWEEPER_ERROR_VERSION_MISMATCH);
+      CHECK(fosssweeper_check_version(FOSSSWEEPER_API_VERSION + (1 << 16)) ==
+            FOSSSWEEPER_ERROR_VERSION_MISMATCH);
+    }
+  }
+}
+
+SCENARIO("A game is played through the C interface") {
+  GIVEN("A game created through the C interface and a GameModel") {
+    fosssweeper_game *game = nullptr;
+    REQUIRE(fosssweeper_game_create(30, 16, 99,
+                                    FOSSSWEEPER_GENERATION_MODE_OPENING, 7,
+                                    &game) == FOSSSWEEPER_OK);
+    fosssweeper::GameModel game_model;
+    game_model.newGame(fosssweeper::GameConfiguration(30, 16, 99));
+    game_model.setGenerationMode(fosssweeper::GenerationMode::Opening);
+    game_model.setGameSeed(7);
+
+    WHEN("The same actions are applied to both") {
+      const std::vector<fosssweeper_action> actions = {
+          {FOSSSWEEPER_ACTION_CLICK, 15, 8},
+          {FOSSSWEEPER_ACTION_ALT_CLICK, 0, 0},
+          {FOSSSWEEPER_ACTION_CLICK, 29, 15}};
+      std::vector<std::int32_t> results(actions.size());
+      std::size_t processed_count = 0;
+      REQUIRE(fosssweeper_game_apply_actions(game, actions.data(),
+                                             actions.size(), results.data(),
+                                             &processed_count) ==
+              FOSSSWEEPER_OK);
+      game_model.clickButton(15, 8);
+      game_model.altClickButton(0, 0);
+      game_model.clickButton(29, 15);
+
+      THEN("The exported state matches the GameModel") {
+        fosssweeper_game_info game_info{};
+        game_info.struct_size = sizeof(game_info);
+        REQUIRE(fosssweeper_game_get_info(game, &game_info) == FOSSSWEEPER_OK);
+        CHECK(game_info.buttons_wide == 30);
+        CHECK(game_info.buttons_tall == 16);
+        CHECK(game_info.game_state ==
+              static_cast<std::int32_t>(game_model.getGameState()));
+        CHECK(game_info.flag_count == game_model.getFlagCount());
+        CHECK(game_info.buttons_left == game_model.getButtonsLeft());
+        CHECK(game_info.visible_hash == game_model.getVisibleHash());
+        CHECK(processed_count <= actions.size());
+        CHECK(results[0] == FOSSSWEEPER_ACTION_RESULT_APPLIED);
+
+        std::size_t button_count = 0;
+        CHECK(fosssweeper_game_export_visible(game, nullptr, 0,
+                                              &button_count) ==
+              FOSSSWEEPER_ERROR_BUFFER_TOO_SMALL);
+        REQUIRE(button_count == 480);
+        std::vector<std::uint8_t> visible_codes(button_count);
+        REQUIRE(fosssweeper_game_export_visible(game, visible_codes.data(),
+                                                visible_codes.size(),
+                                                nullptr) == FOSSSWEEPER_OK);
+        for (std::size_t button_i = 0; button_i < button_count; button_i++) {
+          REQUIRE(visible_codes[button_i] ==
+                  game_model.getButtons()[button_i].getVisibleCode());
+        }
+      }
+    }
+
+    WHEN("A single flag is placed") {
+      const fosssweeper_action action = {FOSSSWEEPER_ACTION_ALT_CLICK, 3, 2};
+      REQUIRE(fosssweeper_game_apply_actions(game, &action, 1, nullptr,
+                                             nullptr) == FOSSSWEEPER_OK);
+
+      THEN("Only that button is exported as changed") {
+        std::vector<std::uint32_t> button_indices(4);
+        std::size_t change_count = 0;
+        REQUIRE(fosssweeper_game_export_changes(game, button_indices.data(),
+                                                button_indices.size(),
+                                                &change_count) ==
+                FOSSSWEEPER_OK);
+        REQUIRE(change_count == 1);
+        CHECK(button_indices[0] == 2 * 30 + 3);
+      }
+    }
+
+    WHEN("Invalid arguments are passed") {
+      const fosssweeper_action action = {FOSSSWEEPER_ACTION_CLICK, 30, 0};
+      fosssweeper_game *invalid_game = nullptr;
+
+      THEN("They are rejected without changing the game") {
+        CHECK(fosssweeper_game_apply_actions(game, &action, 1, nullptr,
+                                             nullptr) ==
+              FOSSSWEEPER_ERROR_INVALID_ARGUMENT);
+        CHECK(fosssweeper_game_create(0, 16, 10,
+                                      FOSSSWEEPER_GENERATION_MODE_CLASSIC, 0,
+                                      &invalid_game) ==
+              FOSSSWEEPER_ERROR_INVALID_ARGUMENT);
+        CHECK(fosssweeper_game_create(30, 16, 10, 7, 0, &invalid_game) ==
+              FOSSSWEEPER_ERROR_INVALID_ARGUMENT);
+        CHECK(invalid_game == nullptr);
+        fosssweeper_game_info game_info{};
+        game_info.struct_size = sizeof(game_info);
+        REQUIRE(fosssweeper_game_get_info(game, &game_info) == FOSSSWEEPER_OK);
+        CHECK(game_info.game_state == FOSSSWEEPER_GAME_STATE_NONE);
+      }
+    }
+
+    fosssweeper_game_destroy(game);
+  }
+}
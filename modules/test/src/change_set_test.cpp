@@ -0,0 +1,214 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/change_set.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <random>
+#include <vector>
+
+#include "TestSupport.hpp"
+
+SCENARIO("Buttons are added to a ChangeSet") {
+  GIVEN("A ChangeSet for an expert board") {
+    fosssweeper::ChangeSet change_set;
+    change_set.reset(480);
+
+    THEN("It has no changes") {
+      CHECK_FALSE(change_set.getHasChanges());
+      CHECK(change_set.getHasButtonList());
+      CHECK(change_set.getChangedButtonCount() == 0);
+    }
+
+    WHEN("A few Buttons are added, one of them twice") {
+      change_set.addButton(3);
+      change_set.addButton(479);
+      change_set.addButton(3);
+
+      THEN("Each Button is listed once and marked in the bitmask") {
+        CHECK(change_set.getHasChanges());
+        CHECK(change_set.getHasButtonList());
+        CHECK(change_set.getChangedButtons() ==
+              std::vector<std::size_t>{3, 479});
+        CHECK(change_set.getChangedButtonCount() == 2);
+        CHECK(change_set.getIsButtonChanged(3));
+        CHECK(change_set.getIsButtonChanged(479));
+        CHECK_FALSE(change_set.getIsButtonChanged(4));
+      }
+
+      WHEN("The ChangeSet is cleared") {
+        change_set.clear();
+
+        THEN("No Button is marked") {
+          CHECK_FALSE(change_set.getHasChanges());
+          CHECK_FALSE(change_set.getIsButtonChanged(3));
+          CHECK_FALSE(change_set.getIsButtonChanged(479));
+        }
+      }
+    }
+
+    WHEN("More Buttons are added than the list holds") {
+      for (std::size_t button_i = 0; button_i < 100; button_i++) {
+        change_set.addButton(button_i * 2);
+      }
+
+      THEN("Only the bitmask is kept") {
+        CHECK_FALSE(change_set.getHasButtonList());
+        CHECK(change_set.getChangedButtons().empty());
+        CHECK(change_set.getChangedButtonCount() == 100);
+        CHECK(change_set.getIsButtonChanged(198));
+        CHECK_FALSE(change_set.getIsButtonChanged(199));
+      }
+
+      WHEN("The ChangeSet is cleared") {
+        change_set.clear();
+
+        THEN("The list is used again") {
+          CHECK(change_set.getHasButtonList());
+          CHECK_FALSE(change_set.getIsButtonChanged(198));
+        }
+      }
+    }
+
+    WHEN("All Buttons are added") {
+      change_set.addAllButtons();
+
+      THEN("Exactly the Buttons of the board are marked") {
+        CHECK(change_set.getChangedButtonCount() == 480);
+        CHECK(change_set.getIsButtonChanged(479));
+        CHECK(change_set.getDirtyBits().back() ==
+              (std::uint64_t{1} << (480 % 64)) - 1);
+      }
+    }
+  }
+}
+
+SCENARIO("The counters of a ChangeSet are compared") {
+  GIVEN("A ChangeSet begun while no game is played") {
+    fosssweeper::ChangeSet change_set;
+    change_set.reset(64);
+    change_set.begin(fosssweeper::GameState::None, 0);
+
+    WHEN("It ends while playing with the same flag count") {
+      change_set.end(fosssweeper::GameState::Playing, 0);
+
+      THEN("The game state and the timer changed") {
+        CHECK(change_set.getGameStateChanged());
+        CHECK(change_set.getTimerChanged());
+        CHECK_FALSE(change_set.getFlagCountChanged());
+      }
+    }
+
+    WHEN("It ends unchanged but with one more flag") {
+      change_set.end(fosssweeper::GameState::None, 1);
+
+      THEN("Only the flag count changed") {
+        CHECK_FALSE(change_set.getGameStateChanged());
+        CHECK_FALSE(change_set.getTimerChanged());
+        CHECK(change_set.getFlagCountChanged());
+      }
+    }
+  }
+}
+
+SCENARIO("The ChangeSet of a GameModel matches a full board diff") {
+  GIVEN("A GameModel recording its changes") {
+    const auto seed = GENERATE(range(0, 16));
+    fosssweeper::GameModel game_model;
+    game_model.newGame(fosssweeper::GameConfiguration(
+        fosssweeper::GameDifficulty::Intermediate));
+    game_model.setQuestionsEnabled(true);
+    game_model.setChangeSetEnabled(true);
+    game_model.setGameSeed(static_cast<std::uint64_t>(seed));
+    std::mt19937_64 rng(static_cast<std::uint64_t>(seed));
+    const auto game_configuration = game_model.getGameConfiguration();
+    std::uniform_int_distribution<int> x_distributor(
+        0, game_configuration.getButtonsWide() - 1);
+    std::uniform_int_distribution<int> y_distributor(
+        0, game_configuration.getButtonsTall() - 1);
+    std::uniform_int_distribution<int> action_distributor(0, 99);
+
+    WHEN("Random actions are performed") {
+      THEN("Every ChangeSet holds exactly the changes of its action") {
+        for (int action_i = 0; action_i < 300; action_i++) {
+          const auto visible_codes =
+              fosssweeper::getVisibleCodes(game_model);
+          const auto game_state = game_model.getGameState();
+          const auto flag_count = game_model.getFlagCount();
+          const auto action = action_distributor(rng);
+          const auto x = x_distributor(rng);
+          const auto y = y_distributor(rng);
+          if (action < 45) {
+            game_model.clickButton(x, y);
+          } else if (action < 75) {
+            game_model.altClickButton(x, y);
+          } else if (action < 93) {
+            game_model.areaClickButton(x, y);
+          } else if (action < 97) {
+            game_model.applyCertainMoves();
+          } else {
+            game_model.newGame();
+          }
+
+          const auto new_visible_codes =
+              fosssweeper::getVisibleCodes(game_model);
+          const auto &change_set = game_model.getChangeSet();
+          std::vector<std::size_t> changed_buttons;
+          for (std::size_t button_i = 0; button_i < visible_codes.size();
+               button_i++) {
+            const bool changed =
+                visible_codes[button_i] != new_visible_codes[button_i];
+            REQUIRE(change_set.getIsButtonChanged(button_i) == changed);
+            if (changed) {
+              changed_buttons.push_back(button_i);
+            }
+          }
+          REQUIRE(change_set.getChangedButtonCount() == changed_buttons.size());
+          if (change_set.getHasButtonList()) {
+            auto listed_buttons = change_set.getChangedButtons();
+            std::sort(listed_buttons.begin(), listed_buttons.end());
+            REQUIRE(listed_buttons == changed_buttons);
+          }
+          REQUIRE(change_set.getGameStateChanged() ==
+                  (game_state != game_model.getGameState()));
+          REQUIRE(change_set.getFlagCountChanged() ==
+                  (flag_count != game_model.getFlagCount()));
+          REQUIRE(change_set.getTimerChanged() ==
+                  ((game_state == fosssweeper::GameState::Playing) !=
+                   (game_model.getGameState() ==
+                    fosssweeper::GameState::Playing)));
+          if (game_model.getGameState() == fosssweeper::GameState::Dead ||
+              game_model.getGameState() == fosssweeper::GameState::Cool) {
+            game_model.newGame();
+          }
+        }
+      }
+    }
+  }
+}
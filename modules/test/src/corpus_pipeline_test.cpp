@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fosssweeper/board_corpus.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_difficulty.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <vector>
+
+#include "TestSupport.hpp"
+#include "corpus_pipeline.hpp"
+
+namespace {
+// the seeds of the first candidates whose 3BV is at least min_bbbv, at most
+// as many as the corpus holds
+std::vector<std::uint64_t>
+getPassingSeeds(const fosssweeper::BoardCorpusSettings &settings,
+                std::size_t candidate_count, int min_bbbv) {
+  fosssweeper::GameModel game_model;
+  std::vector<unsigned char> bomb_bitmap;
+  std::vector<std::uint64_t> game_seeds;
+  for (std::size_t board_i = 0; board_i < candidate_count &&
+                                game_seeds.size() < settings._boardCount;
+       board_i++) {
+    const auto board_record = fosssweeper::BoardCorpus::generateRecord(
+        game_model, settings, settings._firstSeed + board_i, bomb_bitmap);
+    if (board_record._bbbv >= min_bbbv) {
+      game_seeds.push_back(board_record._gameSeed);
+    }
+  }
+  return game_seeds;
+}
+} // namespace
+
+SCENARIO("A board corpus is filled by the corpus pipeline") {
+  GIVEN("Pipeline settings for classic intermediate boards") {
+    fosssweeper::CorpusPipelineSettings settings;
+    auto &corpus_settings = settings._boardCorpusSettings;
+    corpus_settings._gameConfiguration = fosssweeper::GameConfiguration(
+        fosssweeper::GameDifficulty::Intermediate);
+    corpus_settings._generationMode = fosssweeper::GenerationMode::Classic;
+    corpus_settings._boardCount = 1500;
+    corpus_settings._firstSeed = 9;
+    settings._candidateLimit = 100000;
+    const auto record_size = fosssweeper::BoardCorpus::getRecordSize(
+        corpus_settings._gameConfiguration);
+    const auto path =
+        fosssweeper::getTemporaryPath("corpus_pipeline", "intermediate");
+
+    WHEN("Every board passes the filter") {
+      settings._threadCount = 1;
+      const auto pipeline_result =
+          fosssweeper::runCorpusPipeline(path, settings);
+      const auto single_thread_bytes = fosssweeper::readFile(path);
+      settings._threadCount = 4;
+      fosssweeper::runCorpusPipeline(path, settings);
+      const auto four_thread_bytes = fosssweeper::readFile(path);
+      fosssweeper::BoardCorpus::generate(path, corpus_settings, 1);
+
+      THEN("One and four threads write the same file") {
+        CHECK(pipeline_result._boardCount == corpus_settings._boardCount);
+        CHECK(four_thread_bytes == single_thread_bytes);
+      }
+
+      THEN("The file is the one BoardCorpus generates") {
+        CHECK(fosssweeper::readFile(path) == single_thread_bytes);
+      }
+    }
+
+    WHEN("The filter drops boards") {
+      settings._minBbbv = 60;
+      settings._threadCount = GENERATE(std::size_t(1), std::size_t(4));
+      const auto pipeline_result =
+          fosssweeper::runCorpusPipeline(path, settings);
+      const auto expected_seeds = getPassingSeeds(
+          corpus_settings, settings._candidateLimit, settings._minBbbv);
+      REQUIRE(expected_seeds.size() == corpus_settings._boardCount);
+
+      THEN("The header counts the requested boards, which are the first "
+           "passing ones") {
+        const fosssweeper::BoardCorpus board_corpus(path);
+        CHECK(pipeline_result._boardCount == corpus_settings._boardCount);
+        CHECK(board_corpus.getBoardCount() == corpus_settings._boardCount);
+        CHECK(std::filesystem::file_size(path) ==
+              fosssweeper::BoardCorpus::HEADER_SIZE +
+                  corpus_settings._boardCount * record_size);
+        for (std::size_t board_i = 0; board_i < board_corpus.getBoardCount();
+             board_i++) {
+          const auto board_record = board_corpus.getBoard(board_i);
+          CHECK(board_record._gameSeed == expected_seeds[board_i]);
+          CHECK(board_record._bbbv >= settings._minBbbv);
+        }
+      }
+    }
+
+    WHEN("The candidates run out before enough boards pass") {
+      settings._minBbbv = 60;
+      settings._candidateLimit = 2000;
+      settings._threadCount = GENERATE(std::size_t(1), std::size_t(4));
+      const auto pipeline_result =
+          fosssweeper::runCorpusPipeline(path, settings);
+      const auto expected_seeds = getPassingSeeds(
+          corpus_settings, settings._candidateLimit, settings._minBbbv);
+      REQUIRE(expected_seeds.size() < corpus_settings._boardCount);
+
+      THEN("The header counts the boards that were written") {
+        const fosssweeper::BoardCorpus board_corpus(path);
+        CHECK(pipeline_result._boardCount == expected_seeds.size());
+        CHECK(board_corpus.getBoardCount() == expected_seeds.size());
+        CHECK(std::filesystem::file_size(path) ==
+              fosssweeper::BoardCorpus::HEADER_SIZE +
+                  expected_seeds.size() * record_size);
+        for (std::size_t board_i = 0; board_i < board_corpus.getBoardCount();
+             board_i++) {
+          CHECK(board_corpus.getBoard(board_i)._gameSeed ==
+                expected_seeds[board_i]);
+        }
+      }
+    }
+  }
+}
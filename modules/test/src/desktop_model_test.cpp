@@ -23,10 +23,17 @@
  */
 
 #include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <fosssweeper/desktop_model.hpp>
+#include <fosssweeper/game_configuration.hpp>
 #include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/model_worker.hpp>
 #include <fosssweeper/point.hpp>
 #include <fosssweeper/sprite.hpp>
+#include <random>
+#include <thread>
 
 #include "TestTimer.hpp"
 
@@ -320,4 +327,169 @@ TEST_CASE("The mouse leaves the game area of a DesktopModel") {
       }
     }
   }
-}
\ No newline at end of file
+}
+TEST_CASE("A hint is shown and cleared through a DesktopModel") {
+  GIVEN("A default constructed TestTimer") {
+    fosssweeper::TestTimer timer;
+
+    GIVEN("A DesktopModel with a hint at (3, 3)") {
+      fosssweeper::GameModel game_model;
+      fosssweeper::DesktopModel desktop_model(game_model);
+      desktop_model.setHintButton(fosssweeper::ButtonPosition(3, 3));
+
+      THEN("The hint is shown") {
+        REQUIRE(desktop_model.getHintButtonO().has_value());
+        CHECK(desktop_model.getHintButtonO().value() ==
+              fosssweeper::ButtonPosition(3, 3));
+      }
+
+      WHEN("The mouse moves without clicking") {
+        desktop_model.mouseMove(18, 82);
+
+        THEN("The hint is still shown") {
+          CHECK(desktop_model.getHintButtonO().has_value());
+        }
+      }
+
+      WHEN("A Button is right pressed") {
+        desktop_model.mouseMove(18, 82);
+        desktop_model.rightPress(timer);
+
+        THEN("The hint is cleared") {
+          CHECK(!desktop_model.getHintButtonO().has_value());
+        }
+      }
+
+      WHEN("A Button is left clicked") {
+        desktop_model.mouseMove(18, 82);
+        desktop_model.leftPress();
+        desktop_model.leftRelease(timer);
+
+        THEN("The hint is cleared") {
+          CHECK(!desktop_model.getHintButtonO().has_value());
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Input is applied through a ModelWorker by a DesktopModel") {
+  GIVEN("Two DesktopModels on equal games, one of them with a ModelWorker") {
+    const auto seed = GENERATE(range(0, 4));
+    fosssweeper::TestTimer sync_timer;
+    fosssweeper::TestTimer worker_timer;
+    fosssweeper::GameModel sync_game_model;
+    fosssweeper::GameModel worker_game_model;
+    for (auto *const game_model : {&sync_game_model, &worker_game_model}) {
+      game_model->newGame(fosssweeper::GameConfiguration(
+          fosssweeper::GameDifficulty::Intermediate));
+      game_model->setGameSeed(static_cast<std::uint64_t>(seed));
+    }
+    fosssweeper::DesktopModel sync_desktop_model(sync_game_model);
+    fosssweeper::DesktopModel worker_desktop_model(worker_game_model);
+    fosssweeper::ModelWorker model_worker(worker_game_model, nullptr);
+    worker_desktop_model.setModelWorker(&model_worker);
+    const auto button_count = static_cast<std::size_t>(
+        sync_game_model.getGameConfiguration().getButtonCount());
+
+    WHEN("A Button is clicked") {
+      worker_desktop_model.mouseMove(18, 82);
+      worker_desktop_model.leftPress();
+      worker_desktop_model.leftRelease(worker_timer);
+
+      THEN("The board is drawn as it was until the update is applied") {
+        CHECK_FALSE(worker_desktop_model.getIsModelIdle());
+        CHECK(worker_desktop_model.getButtonSprite(0, 0) ==
+              fosssweeper::Sprite::ButtonNone);
+        CHECK_FALSE(worker_timer.getIsRunning());
+        while (!worker_desktop_model.applyModelUpdates(worker_timer)) {
+          std::this_thread::yield();
+        }
+        CHECK(worker_desktop_model.getButtonSprite(0, 0) !=
+              fosssweeper::Sprite::ButtonNone);
+        CHECK(worker_game_model.getGameState() ==
+              fosssweeper::GameState::Playing);
+        CHECK(worker_timer.getIsRunning());
+      }
+    }
+
+    WHEN("The same random mouse input is given to both") {
+      std::mt19937_64 rng(static_cast<std::uint64_t>(seed));
+      std::uniform_int_distribution<int> position_distributor(0, 15);
+      std::uniform_int_distribution<int> action_distributor(0, 3);
+      bool matched = true;
+      for (std::size_t input_i = 0; input_i < 300 && matched; input_i++) {
+        const auto action = action_distributor(rng);
+        const auto x = 18 + position_distributor(rng) * 32;
+        const auto y = 82 + position_distributor(rng) * 32;
+        for (auto *const desktop_model :
+             {&sync_desktop_model, &worker_desktop_model}) {
+          auto &timer = desktop_model == &sync_desktop_model ? sync_timer
+                                                             : worker_timer;
+          desktop_model->mouseMove(x, y);
+          if (action == 0) {
+            desktop_model->leftPress();
+            desktop_model->leftRelease(timer);
+          } else if (action == 1) {
+            desktop_model->rightPress(timer);
+            desktop_model->rightRelease(timer);
+          } else {
+            desktop_model->leftPress();
+            desktop_model->rightPress(timer);
+            if (action == 2) {
+              desktop_model->leftRelease(timer);
+              desktop_model->rightRelease(timer);
+            } else {
+              desktop_model->rightRelease(timer);
+              desktop_model->leftRelease(timer);
+            }
+          }
+        }
+        worker_desktop_model.finishModelUpdates(worker_timer);
+        matched = worker_game_model.getVisibleHash() ==
+                      sync_game_model.getVisibleHash() &&
+                  worker_game_model.getGameState() ==
+                      sync_game_model.getGameState() &&
+                  worker_timer.getIsRunning() == sync_timer.getIsRunning();
+      }
+
+      THEN("Both end up with the same board, counters and timer") {
+        CHECK(matched);
+        CHECK(worker_desktop_model.getIsModelIdle());
+        CHECK(worker_desktop_model.getBombsLeft() ==
+              sync_desktop_model.getBombsLeft());
+        CHECK(worker_desktop_model.getFaceSprite() ==
+              sync_desktop_model.getFaceSprite());
+        for (std::size_t button_i = 0; button_i < button_count; button_i++) {
+          const auto x = static_cast<int>(button_i % 16);
+          const auto y = static_cast<int>(button_i / 16);
+          REQUIRE(worker_desktop_model.getButtonSprite(x, y) ==
+                  sync_desktop_model.getButtonSprite(x, y));
+        }
+      }
+
+      AND_WHEN("The face is clicked on both") {
+        for (auto *const desktop_model :
+             {&sync_desktop_model, &worker_desktop_model}) {
+          auto &timer = desktop_model == &sync_desktop_model ? sync_timer
+                                                             : worker_timer;
+          desktop_model->mouseMove(250, 30);
+          desktop_model->leftPress();
+          desktop_model->leftRelease(timer);
+        }
+        worker_desktop_model.finishModelUpdates(worker_timer);
+
+        THEN("Both start a new game with a stopped timer") {
+          CHECK(worker_game_model.getGameState() ==
+                fosssweeper::GameState::None);
+          CHECK(sync_game_model.getGameState() ==
+                fosssweeper::GameState::None);
+          CHECK_FALSE(worker_timer.getIsRunning());
+          CHECK_FALSE(sync_timer.getIsRunning());
+        }
+      }
+    }
+    worker_desktop_model.finishModelUpdates(worker_timer);
+    worker_desktop_model.setModelWorker(nullptr);
+  }
+}
@@ -0,0 +1,330 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_history.hpp>
+#include <fosssweeper/game_record.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "TestSupport.hpp"
+
+namespace {
+std::vector<fosssweeper::GameRecord> makeGameRecords(std::size_t record_count,
+                                                     std::uint64_t seed) {
+  const std::vector<fosssweeper::GameConfiguration> game_configurations = {
+      fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Beginner),
+      fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Intermediate),
+      fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert),
+      fosssweeper::GameConfiguration(20, 12, 40)};
+  std::mt19937_64 rng(seed);
+  std::vector<fosssweeper::GameRecord> game_records;
+  for (std::size_t record_i = 0; record_i < record_count; record_i++) {
+    fosssweeper::GameRecord game_record;
+    game_record._gameConfiguration = game_configurations[rng() % 4];
+    game_record._generationMode =
+        static_cast<fosssweeper::GenerationMode>(rng() % 3);
+    game_record._gameState = rng() % 3 == 0 ? fosssweeper::GameState::Cool
+                                            : fosssweeper::GameState::Dead;
+    game_record._gameTime = rng() % 300000;
+    game_record._finishedAt =
+        1700000000 + static_cast<std::int64_t>(record_i * 600 + rng() % 600);
+    game_record._bbbv = static_cast<int>(rng() % 250);
+    game_record._clickCount = static_cast<int>(rng() % 400);
+    game_records.push_back(game_record);
+  }
+  // the first half is out of order, the second half in the order the games
+  // finished
+  std::shuffle(game_records.begin(),
+               game_records.begin() +
+                   static_cast<std::ptrdiff_t>(record_count / 2),
+               rng);
+  return game_records;
+}
+
+bool getIsSelected(const fosssweeper::GameRecord &game_record,
+                   const fosssweeper::GameHistoryFilter &filter) {
+  if (filter._gameConfigurationO.has_value() &&
+      !(game_record._gameConfiguration == filter._gameConfigurationO.value()))
+    return false;
+  if (filter._generationModeO.has_value() &&
+      game_record._generationMode != filter._generationModeO.value())
+    return false;
+  if (filter._wonO.has_value() &&
+      game_record.getIsWon() != filter._wonO.value())
+    return false;
+  return game_record._finishedAt >= filter._finishedFrom &&
+         game_record._finishedAt < filter._finishedTo;
+}
+
+struct ExpectedSummary {
+  std::size_t _gameCount = 0;
+  std::size_t _winCount = 0;
+  std::uint64_t _winTimeSum = 0;
+  std::uint64_t _bestTime = 0;
+};
+
+ExpectedSummary
+getExpectedSummary(const std::vector<fosssweeper::GameRecord> &game_records,
+                   const fosssweeper::GameHistoryFilter &filter,
+                   fosssweeper::GameConfiguration game_configuration) {
+  ExpectedSummary expected_summary;
+  for (const auto &game_record : game_records) {
+    if (!getIsSelected(game_record, filter) ||
+        !(game_record._gameConfiguration == game_configuration))
+      continue;
+    expected_summary._gameCount++;
+    if (!game_record.getIsWon())
+      continue;
+    if (expected_summary._winCount == 0 ||
+        game_record._gameTime < expected_summary._bestTime) {
+      expected_summary._bestTime = game_record._gameTime;
+    }
+    expected_summary._winCount++;
+    expected_summary._winTimeSum += game_record._gameTime;
+  }
+  return expected_summary;
+}
+
+fosssweeper::GameHistoryFilter getFilter(int filter_i) {
+  fosssweeper::GameHistoryFilter filter;
+  if (filter_i == 1) {
+    filter._gameConfigurationO =
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert);
+  } else if (filter_i == 2) {
+    filter._generationModeO = fosssweeper::GenerationMode::NoGuess;
+    filter._wonO = true;
+  } else if (filter_i == 3) {
+    filter._wonO = false;
+    filter._finishedFrom = 1700500000;
+    filter._finishedTo = 1703000000;
+  } else if (filter_i == 4) {
+    filter._gameConfigurationO = fosssweeper::GameConfiguration(5, 5, 5);
+  }
+  return filter;
+}
+} // namespace
+
+SCENARIO("A GameHistory answers queries like a scan of its games") {
+  GIVEN("A GameHistory built from game records") {
+    const auto game_records = makeGameRecords(10000, 5);
+    const fosssweeper::GameHistory game_history(game_records);
+    const auto filter = getFilter(GENERATE(range(0, 5)));
+
+    THEN("The games are counted and summarized per configuration") {
+      std::size_t expected_count = 0;
+      for (const auto &game_record : game_records) {
+        expected_count += getIsSelected(game_record, filter) ? 1 : 0;
+      }
+      CHECK(game_history.getRecordCount() == game_records.size());
+      CHECK(game_history.getGameConfigurations().size() == 4);
+      CHECK(game_history.count(filter) == expected_count);
+
+      std::size_t summarized_count = 0;
+      for (const auto &configuration_summary : game_history.summarize(filter)) {
+        const auto expected_summary = getExpectedSummary(
+            game_records, filter, configuration_summary._gameConfiguration);
+        CHECK(configuration_summary._gameCount == expected_summary._gameCount);
+        CHECK(configuration_summary._winCount == expected_summary._winCount);
+        CHECK(configuration_summary._winTimeSum ==
+              expected_summary._winTimeSum);
+        CHECK(configuration_summary._bestTime == expected_summary._bestTime);
+        summarized_count += configuration_summary._gameCount;
+      }
+      CHECK(summarized_count == expected_count);
+    }
+
+    THEN("The win rate trend covers every selected game") {
+      const std::int64_t bucket_seconds = 86400;
+      const auto trend_buckets =
+          game_history.getWinRateTrend(filter, bucket_seconds);
+      std::size_t game_count = 0;
+      for (const auto &trend_bucket : trend_buckets) {
+        CHECK(trend_bucket._begin % bucket_seconds == 0);
+        std::size_t expected_game_count = 0;
+        std::size_t expected_win_count = 0;
+        for (const auto &game_record : game_records) {
+          if (!getIsSelected(game_record, filter) ||
+              game_record._finishedAt < trend_bucket._begin ||
+              game_record._finishedAt >= trend_bucket._begin + bucket_seconds)
+            continue;
+          expected_game_count++;
+          expected_win_count += game_record.getIsWon() ? 1 : 0;
+        }
+        CHECK(trend_bucket._gameCount == expected_game_count);
+        CHECK(trend_bucket._winCount == expected_win_count);
+        game_count += trend_bucket._gameCount;
+      }
+      CHECK(game_count == game_history.count(filter));
+    }
+
+    THEN("The 3BV/s histogram counts the won games") {
+      const auto rate_histogram =
+          game_history.getBbbvRateHistogram(filter, 0.5, 8);
+      std::vector<std::size_t> expected_counts(8, 0);
+      for (const auto &game_record : game_records) {
+        if (!getIsSelected(game_record, filter) || !game_record.getIsWon())
+          continue;
+        const auto rate = static_cast<double>(game_record._bbbv) * 1000.0 /
+                          static_cast<double>(std::max<std::uint64_t>(
+                              game_record._gameTime, 1));
+        expected_counts[std::min<std::size_t>(
+            static_cast<std::size_t>(rate / 0.5), 7)]++;
+      }
+      CHECK(rate_histogram._counts == expected_counts);
+      CHECK(rate_histogram.getPercentile(1.0) <= 4.0);
+    }
+  }
+
+  GIVEN("A GameHistory written to a file") {
+    const auto path = fosssweeper::getTemporaryPath("game_history", "history");
+    const auto game_records = makeGameRecords(5000, 9);
+    const fosssweeper::GameHistory built_history(game_records);
+    built_history.write(path);
+
+    WHEN("The file is mapped") {
+      const fosssweeper::GameHistory mapped_history(path);
+
+      THEN("It answers the same queries") {
+        CHECK(std::filesystem::file_size(path) ==
+              fosssweeper::GameHistory::getLayout(5000, 4)._size);
+        CHECK(mapped_history.getRecordCount() == 5000);
+        CHECK(mapped_history.getGameConfigurations() ==
+              built_history.getGameConfigurations());
+        const auto filter = getFilter(2);
+        const auto built_summaries = built_history.summarize(filter);
+        const auto mapped_summaries = mapped_history.summarize(filter);
+        REQUIRE(mapped_summaries.size() == built_summaries.size());
+        for (std::size_t summary_i = 0; summary_i < built_summaries.size();
+             summary_i++) {
+          CHECK(mapped_summaries[summary_i]._gameCount ==
+                built_summaries[summary_i]._gameCount);
+          CHECK(mapped_summaries[summary_i]._winTimeSum ==
+                built_summaries[summary_i]._winTimeSum);
+        }
+        CHECK(mapped_history.getBbbvRateHistogram(filter, 1.0, 10)._counts ==
+              built_history.getBbbvRateHistogram(filter, 1.0, 10)._counts);
+      }
+    }
+
+    WHEN("The file is cut short") {
+      std::filesystem::resize_file(path, std::filesystem::file_size(path) - 64);
+
+      THEN("It is not mapped") {
+        CHECK_THROWS_AS(fosssweeper::GameHistory(path), std::runtime_error);
+      }
+    }
+
+    WHEN("The file is not a game history") {
+      {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream << std::string(128, 'x');
+      }
+
+      THEN("It is not mapped") {
+        CHECK_THROWS_AS(fosssweeper::GameHistory(path), std::runtime_error);
+      }
+    }
+    std::filesystem::remove(path);
+  }
+
+  GIVEN("An empty GameHistory") {
+    const fosssweeper::GameHistory game_history;
+
+    THEN("Every query is empty") {
+      CHECK(game_history.count(fosssweeper::GameHistoryFilter()) == 0);
+      CHECK(game_history.summarize(fosssweeper::GameHistoryFilter()).empty());
+      CHECK(game_history.getWinRateTrend(fosssweeper::GameHistoryFilter(), 60)
+                .empty());
+      CHECK(game_history
+                .getBbbvRateHistogram(fosssweeper::GameHistoryFilter(), 1.0, 4)
+                ._gameCount == 0);
+    }
+  }
+}
+
+SCENARIO("Game history queries are answered quickly", "[.][benchmark]") {
+  GIVEN("A mapped GameHistory of four million games") {
+    const auto path =
+        fosssweeper::getTemporaryPath("game_history", "benchmark");
+    fosssweeper::GameHistory(makeGameRecords(4000000, 1)).write(path);
+    const auto map_begin = std::chrono::steady_clock::now();
+    const fosssweeper::GameHistory game_history(path);
+    const auto map_duration = std::chrono::steady_clock::now() - map_begin;
+
+    WHEN("Every kind of query is run") {
+      fosssweeper::GameHistoryFilter expert_filter;
+      expert_filter._gameConfigurationO =
+          fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert);
+      const auto get_milliseconds = [](auto begin) {
+        return std::chrono::duration<double, std::milli>(
+                   std::chrono::steady_clock::now() - begin)
+            .count();
+      };
+      auto begin = std::chrono::steady_clock::now();
+      const auto configuration_summaries =
+          game_history.summarize(fosssweeper::GameHistoryFilter());
+      const auto summarize_milliseconds = get_milliseconds(begin);
+      begin = std::chrono::steady_clock::now();
+      const auto expert_summaries = game_history.summarize(expert_filter);
+      const auto expert_milliseconds = get_milliseconds(begin);
+      begin = std::chrono::steady_clock::now();
+      const auto trend_buckets = game_history.getWinRateTrend(
+          fosssweeper::GameHistoryFilter(), 86400 * 7);
+      const auto trend_milliseconds = get_milliseconds(begin);
+      begin = std::chrono::steady_clock::now();
+      const auto rate_histogram =
+          game_history.getBbbvRateHistogram(expert_filter, 0.25, 40);
+      const auto rate_milliseconds = get_milliseconds(begin);
+
+      THEN("The durations are reported") {
+        std::cout << "map of 4000000 games: "
+                  << std::chrono::duration<double, std::milli>(map_duration)
+                         .count()
+                  << " ms\nsummary per configuration: "
+                  << summarize_milliseconds
+                  << " ms\nexpert summary: " << expert_milliseconds
+                  << " ms\nweekly win rate trend: " << trend_milliseconds
+                  << " ms\nexpert 3BV/s histogram: " << rate_milliseconds
+                  << " ms\n";
+        CHECK(configuration_summaries.size() == 4);
+        CHECK(expert_summaries.size() == 1);
+        CHECK_FALSE(trend_buckets.empty());
+        CHECK(rate_histogram._gameCount > 0);
+      }
+    }
+    std::filesystem::remove(path);
+  }
+}
@@ -24,6 +24,33 @@
 
 #include <catch2/catch_all.hpp>
 #include <fosssweeper/game_model.hpp>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+std::string getButtonString(const fosssweeper::GameModel &game_model) {
+  std::string button_string;
+  for (const auto &button : game_model.getButtons()) {
+    switch (button.getButtonState()) {
+    case fosssweeper::ButtonState::Down:
+      button_string.push_back(button.getHasBomb() ? 'x' : 'd');
+      break;
+    case fosssweeper::ButtonState::Flagged:
+      button_string.push_back(button.getHasBomb() ? 'c' : 'f');
+      break;
+    case fosssweeper::ButtonState::Questioned:
+      button_string.push_back(button.getHasBomb() ? 'r' : 'q');
+      break;
+    default:
+      button_string.push_back(button.getHasBomb() ? 'b' : '.');
+      break;
+    }
+  }
+  return button_string;
+}
+} // namespace
 
 SCENARIO("A GameModel is constructed with its default constructor") {
   GIVEN("A default constructed GameModel") {
@@ -808,4 +835,304 @@ SCENARIO("Questions are enabled or disabled throughout a GameModel") {
       }
     }
   }
-}
\ No newline at end of file
+}
+
+SCENARIO("The Zobrist hashes of a GameModel are maintained") {
+  GIVEN("Two GameModel objects constructed from the same button string") {
+    const std::string button_string = "bq...dc."
+                                      "bb...b.."
+                                      "..ddddd."
+                                      ".bd.c.d."
+                                      "ccdddd.."
+                                      "b.f.c.d."
+                                      "...dddbb"
+                                      "ddddddbd";
+    fosssweeper::GameModel game_model(
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Beginner),
+        false, fosssweeper::GameState::Playing, 0, button_string);
+    const fosssweeper::GameModel other_game_model(
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Beginner),
+        false, fosssweeper::GameState::Playing, 0, button_string);
+
+    THEN("The hashes are equal") {
+      CHECK(game_model.getLayoutHash() == other_game_model.getLayoutHash());
+      CHECK(game_model.getVisibleHash() == other_game_model.getVisibleHash());
+    }
+
+    WHEN("A Button is flagged") {
+      game_model.altClickButton(7, 0);
+
+      THEN("Only the visible hash changes") {
+        CHECK(game_model.getLayoutHash() == other_game_model.getLayoutHash());
+        CHECK(game_model.getVisibleHash() !=
+              other_game_model.getVisibleHash());
+      }
+
+      WHEN("The flag is removed again") {
+        game_model.altClickButton(7, 0);
+
+        THEN("The visible hash is restored") {
+          CHECK(game_model.getVisibleHash() ==
+                other_game_model.getVisibleHash());
+        }
+      }
+    }
+
+    WHEN("A chord is performed") {
+      game_model.areaClickButton(4, 4);
+
+      THEN("The visible hash matches a GameModel built from scratch") {
+        const fosssweeper::GameModel expected_game_model(
+            fosssweeper::GameConfiguration(
+                fosssweeper::GameDifficulty::Beginner),
+            false, fosssweeper::GameState::Playing, 0,
+            getButtonString(game_model));
+        CHECK(game_model.getVisibleHash() ==
+              expected_game_model.getVisibleHash());
+      }
+    }
+  }
+
+  GIVEN("Two GameModel objects with different bomb layouts") {
+    const fosssweeper::GameModel game_model(
+        fosssweeper::GameConfiguration(8, 8, 1), false,
+        fosssweeper::GameState::Playing, 0,
+        "b......."
+        "........"
+        "........"
+        "........"
+        "........"
+        "........"
+        "........"
+        "........");
+    const fosssweeper::GameModel other_game_model(
+        fosssweeper::GameConfiguration(8, 8, 1), false,
+        fosssweeper::GameState::Playing, 0,
+        ".b......"
+        "........"
+        "........"
+        "........"
+        "........"
+        "........"
+        "........"
+        "........");
+
+    THEN("The layout hashes are different") {
+      CHECK(game_model.getLayoutHash() != other_game_model.getLayoutHash());
+    }
+
+    THEN("The visible hashes are equal") {
+      CHECK(game_model.getVisibleHash() == other_game_model.getVisibleHash());
+    }
+  }
+
+  GIVEN("A default constructed GameModel") {
+    fosssweeper::GameModel game_model;
+    const auto initial_visible_hash = game_model.getVisibleHash();
+
+    WHEN("The first Button is clicked") {
+      game_model.clickButton(3, 3);
+
+      THEN("Both hashes match a GameModel built from scratch") {
+        const fosssweeper::GameModel expected_game_model(
+            game_model.getGameConfiguration(), false,
+            game_model.getGameState(), 0, getButtonString(game_model));
+        CHECK(game_model.getLayoutHash() ==
+              expected_game_model.getLayoutHash());
+        CHECK(game_model.getVisibleHash() ==
+              expected_game_model.getVisibleHash());
+      }
+
+      WHEN("A new game is started") {
+        game_model.newGame();
+
+        THEN("The visible hash is the initial visible hash") {
+          CHECK(game_model.getVisibleHash() == initial_visible_hash);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("The certain moves of a GameModel are applied") {
+  GIVEN("A no guess GameModel after its first click") {
+    fosssweeper::GameModel game_model;
+    game_model.newGame(
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert));
+    game_model.setGenerationMode(fosssweeper::GenerationMode::NoGuess);
+    game_model.setGameSeed(1234);
+    game_model.clickButton(10, 10);
+    const auto button_string = getButtonString(game_model);
+
+    WHEN("The certain moves are applied") {
+      const auto changed_buttons = game_model.applyCertainMoves();
+
+      THEN("The game is won with every bomb flagged") {
+        CHECK(game_model.getGameState() == fosssweeper::GameState::Cool);
+        CHECK(game_model.getButtonsLeft() == 0);
+        CHECK(game_model.getBombsLeft() == 0);
+      }
+
+      THEN("Exactly the changed Buttons are returned") {
+        const auto new_button_string = getButtonString(game_model);
+        std::size_t changed_count = 0;
+        for (std::size_t button_i = 0; button_i < button_string.size();
+             button_i++) {
+          if (button_string[button_i] != new_button_string[button_i]) {
+            changed_count++;
+          }
+        }
+        CHECK(changed_buttons.size() == changed_count);
+        for (const auto button_i : changed_buttons) {
+          CHECK(button_string[button_i] != new_button_string[button_i]);
+        }
+      }
+
+      THEN("The visible hash matches a GameModel built from scratch") {
+        const fosssweeper::GameModel expected_game_model(
+            game_model.getGameConfiguration(), false,
+            game_model.getGameState(), 0, getButtonString(game_model));
+        CHECK(game_model.getVisibleHash() ==
+              expected_game_model.getVisibleHash());
+      }
+    }
+  }
+
+  GIVEN("A GameModel with a misplaced flag on a certain safe Button") {
+    fosssweeper::GameModel game_model(fosssweeper::GameConfiguration(8, 1, 1),
+                                      false, fosssweeper::GameState::Playing,
+                                      0, "df.b....");
+
+    WHEN("The certain moves are applied") {
+      const auto changed_buttons = game_model.applyCertainMoves();
+
+      THEN("The flag is moved onto the bomb and the game is won") {
+        CHECK(getButtonString(game_model) == "dddcdddd");
+        CHECK(game_model.getFlagCount() == 1);
+        CHECK(game_model.getGameState() == fosssweeper::GameState::Cool);
+        CHECK(changed_buttons.size() == 7);
+      }
+    }
+  }
+
+  GIVEN("A GameModel that is not being played") {
+    fosssweeper::GameModel game_model;
+
+    WHEN("The certain moves are applied") {
+      const auto changed_buttons = game_model.applyCertainMoves();
+
+      THEN("Nothing changes") {
+        CHECK(changed_buttons.empty());
+        CHECK(game_model.getGameState() == fosssweeper::GameState::None);
+      }
+    }
+  }
+}
+
+SCENARIO("A batch of actions is applied to a GameModel") {
+  GIVEN("Two GameModel objects with the same game seed") {
+    const auto seed = GENERATE(range(0, 8));
+    fosssweeper::GameModel game_model;
+    fosssweeper::GameModel other_game_model;
+    game_model.setQuestionsEnabled(true);
+    other_game_model.setQuestionsEnabled(true);
+    game_model.setGameSeed(static_cast<std::uint64_t>(seed));
+    other_game_model.setGameSeed(static_cast<std::uint64_t>(seed));
+    std::mt19937_64 rng(static_cast<std::uint64_t>(seed));
+    std::uniform_int_distribution<int> position_distributor(0, 7);
+    std::uniform_int_distribution<int> type_distributor(0, 2);
+    std::vector<fosssweeper::Action> actions(40);
+    for (auto &action : actions) {
+      action._actionType =
+          static_cast<fosssweeper::ActionType>(type_distributor(rng));
+      action._buttonPosition = fosssweeper::ButtonPosition(
+          position_distributor(rng), position_distributor(rng));
+    }
+    std::vector<fosssweeper::ActionResult> results(actions.size());
+
+    WHEN("The actions are applied as a batch and one at a time") {
+      const auto applied_count = game_model.applyActions(actions, results);
+      std::size_t other_applied_count = 0;
+      for (const auto &action : actions) {
+        const auto other_game_state = other_game_model.getGameState();
+        if (other_game_state == fosssweeper::GameState::Dead ||
+            other_game_state == fosssweeper::GameState::Cool)
+          break;
+        const auto &position = action._buttonPosition;
+        switch (action._actionType) {
+        case fosssweeper::ActionType::Click:
+          other_game_model.clickButton(position.x, position.y);
+          break;
+        case fosssweeper::ActionType::AltClick:
+          other_game_model.altClickButton(position.x, position.y);
+          break;
+        case fosssweeper::ActionType::AreaClick:
+          other_game_model.areaClickButton(position.x, position.y);
+          break;
+        }
+        other_applied_count++;
+      }
+
+      THEN("Both GameModel objects end up in the same state") {
+        CHECK(applied_count == other_applied_count);
+        CHECK(getButtonString(game_model) ==
+              getButtonString(other_game_model));
+        CHECK(game_model.getGameState() == other_game_model.getGameState());
+        CHECK(game_model.getFlagCount() == other_game_model.getFlagCount());
+        CHECK(game_model.getVisibleHash() ==
+              other_game_model.getVisibleHash());
+      }
+
+      THEN("Only the actions after the game ended are skipped") {
+        for (std::size_t action_i = 0; action_i < actions.size();
+             action_i++) {
+          CHECK((results[action_i] == fosssweeper::ActionResult::Skipped) ==
+                (action_i >= applied_count));
+        }
+      }
+    }
+  }
+
+  GIVEN("A GameModel with a bomb next to a revealed Button") {
+    fosssweeper::GameModel game_model(
+        fosssweeper::GameConfiguration(8, 1, 1), false,
+        fosssweeper::GameState::Playing, 0, "d.b.....");
+    const std::vector<fosssweeper::Action> actions = {
+        {fosssweeper::ActionType::AltClick, fosssweeper::ButtonPosition(2, 0)},
+        {fosssweeper::ActionType::Click, fosssweeper::ButtonPosition(2, 0)},
+        {fosssweeper::ActionType::Click, fosssweeper::ButtonPosition(9, 0)},
+        {fosssweeper::ActionType::Click, fosssweeper::ButtonPosition(1, 0)},
+        {fosssweeper::ActionType::AltClick,
+         fosssweeper::ButtonPosition(2, 0)},
+        {fosssweeper::ActionType::Click, fosssweeper::ButtonPosition(2, 0)},
+        {fosssweeper::ActionType::Click, fosssweeper::ButtonPosition(3, 0)}};
+    std::vector<fosssweeper::ActionResult> results(actions.size());
+
+    WHEN("The actions are applied") {
+      const auto applied_count = game_model.applyActions(actions, results);
+
+      THEN("The batch stops after the bomb is clicked") {
+        CHECK(applied_count == 6);
+        CHECK(game_model.getGameState() == fosssweeper::GameState::Dead);
+        CHECK(results == std::vector<fosssweeper::ActionResult>{
+                             fosssweeper::ActionResult::Applied,
+                             fosssweeper::ActionResult::Ignored,
+                             fosssweeper::ActionResult::Ignored,
+                             fosssweeper::ActionResult::Applied,
+                             fosssweeper::ActionResult::Applied,
+                             fosssweeper::ActionResult::Applied,
+                             fosssweeper::ActionResult::Skipped});
+      }
+    }
+
+    WHEN("The result buffer is too small") {
+      std::vector<fosssweeper::ActionResult> small_results(1);
+
+      THEN("An exception is thrown and nothing changes") {
+        CHECK_THROWS_AS(game_model.applyActions(actions, small_results),
+                        std::runtime_error);
+        CHECK(getButtonString(game_model) == "d.b.....");
+      }
+    }
+  }
+}
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/hint_service.hpp>
+#include <fosssweeper/solver.hpp>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+SCENARIO("A HintService finds a safe Button in the background") {
+  GIVEN("An expert GameModel after the first click") {
+    fosssweeper::GameModel game_model;
+    game_model.newGame(
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert));
+    game_model.setGenerationMode(fosssweeper::GenerationMode::NoGuess);
+    game_model.setGameSeed(5);
+    game_model.clickButton(15, 8);
+    std::mutex hint_mutex;
+    std::condition_variable hint_condition;
+    std::optional<fosssweeper::Hint> hint_o;
+    fosssweeper::HintService hint_service([&](const fosssweeper::Hint &hint) {
+      std::lock_guard<std::mutex> lock(hint_mutex);
+      hint_o = hint;
+      hint_condition.notify_one();
+    });
+
+    WHEN("A hint is requested") {
+      const auto start = std::chrono::steady_clock::now();
+      const auto generation = hint_service.request(game_model);
+      std::unique_lock<std::mutex> lock(hint_mutex);
+      hint_condition.wait_for(lock, std::chrono::seconds(1),
+                              [&]() { return hint_o.has_value(); });
+      const auto elapsed = std::chrono::steady_clock::now() - start;
+
+      THEN("A safe Button is delivered in less than 16 ms") {
+        REQUIRE(hint_o.has_value());
+        CHECK(hint_o->_generation == generation);
+        REQUIRE(hint_o->_safeButtonO.has_value());
+        const auto &button = game_model.getButton(hint_o->_safeButtonO->x,
+                                                  hint_o->_safeButtonO->y);
+        CHECK(button.getHasBomb() == false);
+        CHECK(button.getButtonState() != fosssweeper::ButtonState::Down);
+        CHECK(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)
+                  .count() < 16);
+      }
+    }
+
+    WHEN("A hint is requested and then cancelled") {
+      const auto generation = hint_service.request(game_model);
+      hint_service.cancel();
+
+      THEN("The request is no longer current") {
+        CHECK(hint_service.getIsCurrent(generation) == false);
+      }
+    }
+
+    WHEN("A stale request is solved") {
+      fosssweeper::Solver solver;
+      solver.load(game_model);
+      hint_service.cancel();
+      const auto safe_button_o =
+          hint_service.findSafeButton(solver, hint_service._generation - 1);
+
+      THEN("No safe Button is found") { CHECK(!safe_button_o.has_value()); }
+    }
+  }
+}
+
+SCENARIO("A HintService discards the hint of a changed board") {
+  GIVEN("An expert GameModel after the first click and a HintService that "
+        "holds its worker in the callback") {
+    fosssweeper::GameModel game_model;
+    game_model.newGame(
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert));
+    game_model.setGenerationMode(fosssweeper::GenerationMode::NoGuess);
+    game_model.setGameSeed(5);
+    game_model.clickButton(15, 8);
+    std::mutex hint_mutex;
+    std::condition_variable hint_condition;
+    std::vector<fosssweeper::Hint> hints;
+    bool is_released = false;
+    fosssweeper::HintService hint_service([&](const fosssweeper::Hint &hint) {
+      std::unique_lock<std::mutex> lock(hint_mutex);
+      hints.push_back(hint);
+      hint_condition.notify_all();
+      hint_condition.wait(lock, [&]() { return is_released; });
+    });
+
+    WHEN("A hint is requested, the board changes and a hint is requested "
+         "again while the worker is busy") {
+      const auto first_generation = hint_service.request(game_model);
+      std::unique_lock<std::mutex> lock(hint_mutex);
+      const bool is_held = hint_condition.wait_for(
+          lock, std::chrono::seconds(1), [&]() { return hints.size() == 1; });
+      const auto stale_generation = hint_service.request(game_model);
+      if (is_held && hints.front()._safeButtonO.has_value()) {
+        const auto safe_button = hints.front()._safeButtonO.value();
+        game_model.clickButton(safe_button.x, safe_button.y);
+      }
+      const auto new_generation = hint_service.request(game_model);
+      is_released = true;
+      hint_condition.notify_all();
+      hint_condition.wait_for(lock, std::chrono::seconds(1),
+                              [&]() { return hints.size() == 2; });
+
+      THEN("Only the hint of the changed board is delivered") {
+        REQUIRE(is_held);
+        CHECK(hints.front()._generation == first_generation);
+        REQUIRE(hints.front()._safeButtonO.has_value());
+        CHECK_FALSE(hint_service.getIsCurrent(stale_generation));
+        REQUIRE(hints.size() == 2);
+        CHECK(hints.back()._generation == new_generation);
+        CHECK(hint_service.getIsCurrent(new_generation));
+        REQUIRE(hints.back()._safeButtonO.has_value());
+        const auto &button = game_model.getButton(
+            hints.back()._safeButtonO->x, hints.back()._safeButtonO->y);
+        CHECK(button.getHasBomb() == false);
+        CHECK(button.getButtonState() != fosssweeper::ButtonState::Down);
+      }
+    }
+  }
+}
@@ -0,0 +1,292 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button_state.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/journal.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+struct Snapshot {
+  std::vector<fosssweeper::ButtonState> _buttonStates;
+  int _flagCount = 0;
+  int _buttonsLeft = 0;
+  fosssweeper::GameState _gameState = fosssweeper::GameState::Default;
+  std::uint64_t _visibleHash = 0;
+
+  bool operator==(const Snapshot &other) const = default;
+};
+
+Snapshot getSnapshot(const fosssweeper::GameModel &game_model) {
+  Snapshot snapshot;
+  for (const auto &button : game_model.getButtons()) {
+    snapshot._buttonStates.push_back(button.getButtonState());
+  }
+  snapshot._flagCount = game_model.getFlagCount();
+  snapshot._buttonsLeft = game_model.getButtonsLeft();
+  snapshot._gameState = game_model.getGameState();
+  snapshot._visibleHash = game_model.getVisibleHash();
+  return snapshot;
+}
+} // namespace
+
+SCENARIO("Actions are recorded in a Journal") {
+  GIVEN("An empty Journal") {
+    fosssweeper::Journal journal;
+
+    THEN("Nothing can be undone or redone") {
+      CHECK_FALSE(journal.getCanUndo());
+      CHECK_FALSE(journal.getCanRedo());
+      CHECK(journal.undo() == nullptr);
+    }
+
+    WHEN("An action pressing neighbouring Buttons is recorded") {
+      journal.begin({0, 10, fosssweeper::GameState::None});
+      for (const std::size_t button_i : {5, 3, 4, 9, 20, 21}) {
+        journal.recordButton(button_i, fosssweeper::ButtonState::None,
+                             fosssweeper::ButtonState::Down);
+      }
+      journal.recordButton(7, fosssweeper::ButtonState::Questioned,
+                           fosssweeper::ButtonState::Down);
+      journal.end({0, 3, fosssweeper::GameState::Playing});
+
+      THEN("The pressed Buttons are stored as runs") {
+        CHECK(journal.getEntryCount() == 1);
+        CHECK(journal.getRecordedRunCount() == 3);
+        CHECK(journal.getRecordedButtonCount() == 1);
+        CHECK(journal.getCanUndo());
+      }
+
+      WHEN("An action without any change is recorded") {
+        journal.begin({0, 3, fosssweeper::GameState::Playing});
+        journal.end({0, 3, fosssweeper::GameState::Playing});
+
+        THEN("No entry is added") { CHECK(journal.getEntryCount() == 1); }
+      }
+
+      WHEN("The action is undone and an action without any change is "
+           "recorded") {
+        journal.undo();
+        journal.begin({0, 10, fosssweeper::GameState::None});
+        journal.end({0, 10, fosssweeper::GameState::None});
+
+        THEN("The undone action can still be redone") {
+          CHECK(journal.getEntryCount() == 1);
+          CHECK(journal.getCanRedo());
+          CHECK(journal.getRecordedRunCount() == 3);
+          CHECK(journal.getRecordedButtonCount() == 1);
+        }
+      }
+
+      WHEN("The action is undone and another action is recorded") {
+        journal.undo();
+        journal.begin({0, 10, fosssweeper::GameState::None});
+        journal.recordButton(1, fosssweeper::ButtonState::None,
+                             fosssweeper::ButtonState::Flagged);
+        journal.end({1, 10, fosssweeper::GameState::None});
+
+        THEN("The undone action is discarded") {
+          CHECK(journal.getEntryCount() == 1);
+          CHECK(journal.getRecordedRunCount() == 0);
+          CHECK(journal.getRecordedButtonCount() == 1);
+          CHECK_FALSE(journal.getCanRedo());
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Actions of a GameModel are undone and redone") {
+  GIVEN("A GameModel with an enabled journal") {
+    const auto seed = GENERATE(range(0, 8));
+    fosssweeper::GameModel game_model;
+    game_model.newGame(fosssweeper::GameConfiguration(
+        fosssweeper::GameDifficulty::Intermediate));
+    game_model.setQuestionsEnabled(true);
+    game_model.setJournalEnabled(true);
+    game_model.setGameSeed(static_cast<std::uint64_t>(seed));
+    std::mt19937_64 rng(static_cast<std::uint64_t>(seed));
+    std::uniform_int_distribution<int> position_distributor(0, 15);
+    std::uniform_int_distribution<int> action_distributor(0, 9);
+
+    WHEN("Random actions are performed until the game ends") {
+      std::vector<Snapshot> snapshots = {getSnapshot(game_model)};
+      while (game_model.getGameState() == fosssweeper::GameState::None ||
+             game_model.getGameState() == fosssweeper::GameState::Playing) {
+        const auto action = action_distributor(rng);
+        const auto x = position_distributor(rng);
+        const auto y = position_distributor(rng);
+        if (action < 5) {
+          game_model.clickButton(x, y);
+        } else if (action < 8) {
+          game_model.altClickButton(x, y);
+        } else if (action < 9) {
+          game_model.areaClickButton(x, y);
+        } else {
+          game_model.applyCertainMoves();
+        }
+        if (getSnapshot(game_model) != snapshots.back()) {
+          snapshots.push_back(getSnapshot(game_model));
+        }
+      }
+
+      THEN("Every action was recorded") {
+        CHECK(game_model.getJournal().getEntryCount() == snapshots.size() - 1);
+      }
+
+      THEN("Undoing walks back through every state and redoing forward") {
+        for (auto snapshot_i = snapshots.size() - 1; snapshot_i > 0;
+             snapshot_i--) {
+          REQUIRE(game_model.undo());
+          REQUIRE(getSnapshot(game_model) == snapshots[snapshot_i - 1]);
+        }
+        CHECK_FALSE(game_model.undo());
+        for (std::size_t snapshot_i = 1; snapshot_i < snapshots.size();
+             snapshot_i++) {
+          REQUIRE(game_model.redo());
+          REQUIRE(getSnapshot(game_model) == snapshots[snapshot_i]);
+        }
+        CHECK_FALSE(game_model.redo());
+      }
+    }
+  }
+
+  GIVEN("A GameModel with an enabled journal after an opening click") {
+    fosssweeper::GameModel game_model;
+    game_model.newGame(
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert));
+    game_model.setGenerationMode(fosssweeper::GenerationMode::Opening);
+    game_model.setJournalEnabled(true);
+    game_model.setGameSeed(7);
+    game_model.clickButton(15, 8);
+    const auto pressed_count =
+        game_model.getGameConfiguration().getButtonCount() -
+        game_model.getGameConfiguration().getBombCount() -
+        game_model.getButtonsLeft();
+
+    THEN("The flood fill is stored as runs instead of single Buttons") {
+      CHECK(game_model.getJournal().getRecordedButtonCount() == 0);
+      CHECK(game_model.getJournal().getRecordedRunCount() <
+            static_cast<std::size_t>(pressed_count));
+    }
+
+    WHEN("The first click is undone and another Button is clicked") {
+      REQUIRE(game_model.undo());
+      CHECK(game_model.getGameState() == fosssweeper::GameState::None);
+      game_model.clickButton(0, 0);
+
+      THEN("The bombs are placed again") {
+        std::string button_string;
+        for (const auto &button : game_model.getButtons()) {
+          if (button.getButtonState() == fosssweeper::ButtonState::Down) {
+            button_string.push_back(button.getHasBomb() ? 'x' : 'd');
+          } else {
+            button_string.push_back(button.getHasBomb() ? 'b' : '.');
+          }
+        }
+        const fosssweeper::GameModel expected_game_model(
+            game_model.getGameConfiguration(), false,
+            game_model.getGameState(), 0, button_string);
+        CHECK(game_model.getButton(0, 0).getSurroundingBombs() ==
+              expected_game_model.getButton(0, 0).getSurroundingBombs());
+        CHECK(game_model.getLayoutHash() ==
+              expected_game_model.getLayoutHash());
+        CHECK(game_model.getVisibleHash() ==
+              expected_game_model.getVisibleHash());
+        CHECK_FALSE(game_model.getJournal().getCanRedo());
+      }
+    }
+
+    WHEN("A flag is placed, undone and an already pressed Button is clicked") {
+      const auto entry_count = game_model.getJournal().getEntryCount();
+      const auto &buttons = game_model.getButtons();
+      const auto pressed_it =
+          std::find_if(buttons.begin(), buttons.end(), [](const auto &button) {
+            return button.getButtonState() == fosssweeper::ButtonState::Down;
+          });
+      const auto unpressed_it =
+          std::find_if(buttons.begin(), buttons.end(), [](const auto &button) {
+            return button.getButtonState() == fosssweeper::ButtonState::None;
+          });
+      REQUIRE(pressed_it != buttons.end());
+      REQUIRE(unpressed_it != buttons.end());
+      const auto buttons_wide =
+          game_model.getGameConfiguration().getButtonsWide();
+      const auto pressed_i = static_cast<int>(pressed_it - buttons.begin());
+      const auto unpressed_i = static_cast<int>(unpressed_it - buttons.begin());
+      game_model.altClickButton(unpressed_i % buttons_wide,
+                                unpressed_i / buttons_wide);
+      REQUIRE(game_model.undo());
+      const auto snapshot = getSnapshot(game_model);
+      game_model.clickButton(pressed_i % buttons_wide,
+                             pressed_i / buttons_wide);
+
+      THEN("The flag can still be redone") {
+        CHECK(getSnapshot(game_model) == snapshot);
+        CHECK(game_model.getJournal().getEntryCount() == entry_count + 1);
+        REQUIRE(game_model.redo());
+        CHECK(game_model.getFlagCount() == 1);
+      }
+    }
+
+    WHEN("The first click is undone and a new game is started") {
+      REQUIRE(game_model.undo());
+      game_model.newGame();
+
+      THEN("No bomb of the undone click is left on the board") {
+        fosssweeper::GameModel expected_game_model;
+        expected_game_model.newGame(game_model.getGameConfiguration());
+        CHECK(game_model.getLayoutHash() ==
+              expected_game_model.getLayoutHash());
+        CHECK(game_model.getVisibleHash() == 0);
+        CHECK(std::none_of(
+            game_model.getButtons().begin(), game_model.getButtons().end(),
+            [](const auto &button) { return button.getHasBomb(); }));
+      }
+    }
+
+    WHEN("A flag is placed before the next first click and a new game is "
+         "started") {
+      REQUIRE(game_model.undo());
+      game_model.altClickButton(0, 0);
+      REQUIRE(game_model.getFlagCount() == 1);
+      game_model.newGame();
+
+      THEN("The flag is cleared") {
+        CHECK(game_model.getFlagCount() == 0);
+        CHECK(game_model.getVisibleHash() == 0);
+        CHECK(game_model.getButton(0, 0).getButtonState() ==
+              fosssweeper::ButtonState::None);
+      }
+    }
+  }
+}
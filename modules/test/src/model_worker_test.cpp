@@ -0,0 +1,273 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button_position.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/model_command.hpp>
+#include <fosssweeper/model_update.hpp>
+#include <fosssweeper/model_worker.hpp>
+#include <fosssweeper/spsc_queue.hpp>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+void applyCommand(fosssweeper::GameModel &game_model,
+                  const fosssweeper::ModelCommand &command) {
+  const auto x = command._buttonPosition.x;
+  const auto y = command._buttonPosition.y;
+  switch (command._commandType) {
+  case fosssweeper::ModelCommandType::Click:
+    game_model.clickButton(x, y);
+    break;
+  case fosssweeper::ModelCommandType::AltClick:
+    game_model.altClickButton(x, y);
+    break;
+  case fosssweeper::ModelCommandType::AreaClick:
+    game_model.areaClickButton(x, y);
+    break;
+  case fosssweeper::ModelCommandType::NewGame:
+    if (command._gameConfigurationO.has_value()) {
+      game_model.newGame(command._gameConfigurationO.value());
+    } else {
+      game_model.newGame();
+    }
+    break;
+  case fosssweeper::ModelCommandType::UpdateTime:
+    game_model.updateTime(static_cast<unsigned int>(command._value));
+    break;
+  case fosssweeper::ModelCommandType::SetGameSeed:
+    game_model.setGameSeed(command._value);
+    break;
+  case fosssweeper::ModelCommandType::SetQuestionsEnabled:
+    game_model.setQuestionsEnabled(command._value != 0);
+    break;
+  case fosssweeper::ModelCommandType::ApplyCertainMoves:
+    game_model.applyCertainMoves();
+    break;
+  case fosssweeper::ModelCommandType::Undo:
+    game_model.undo();
+    break;
+  case fosssweeper::ModelCommandType::Redo:
+    game_model.redo();
+    break;
+  }
+}
+
+std::vector<fosssweeper::ModelCommand> drawCommands(std::uint32_t seed,
+                                                    std::size_t count) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> x_distribution(0, 29);
+  std::uniform_int_distribution<int> y_distribution(0, 15);
+  std::uniform_int_distribution<int> type_distribution(0, 99);
+  std::vector<fosssweeper::ModelCommand> commands;
+  std::uint64_t game_time = 0;
+  while (commands.size() < count) {
+    fosssweeper::ModelCommand command;
+    command._buttonPosition = fosssweeper::ButtonPosition(
+        x_distribution(rng), y_distribution(rng));
+    const auto type_roll = type_distribution(rng);
+    if (type_roll < 40) {
+      command._commandType = fosssweeper::ModelCommandType::Click;
+    } else if (type_roll < 60) {
+      command._commandType = fosssweeper::ModelCommandType::AltClick;
+    } else if (type_roll < 75) {
+      command._commandType = fosssweeper::ModelCommandType::AreaClick;
+    } else if (type_roll < 82) {
+      command._commandType = fosssweeper::ModelCommandType::Undo;
+    } else if (type_roll < 87) {
+      command._commandType = fosssweeper::ModelCommandType::Redo;
+    } else if (type_roll < 90) {
+      command._commandType = fosssweeper::ModelCommandType::ApplyCertainMoves;
+    } else if (type_roll < 95) {
+      command._commandType = fosssweeper::ModelCommandType::UpdateTime;
+      game_time += 1500;
+      command._value = game_time;
+    } else if (type_roll < 97) {
+      command._commandType = fosssweeper::ModelCommandType::SetQuestionsEnabled;
+      command._value = type_roll % 2;
+    } else {
+      command._commandType = fosssweeper::ModelCommandType::NewGame;
+      commands.push_back(command);
+      command._commandType = fosssweeper::ModelCommandType::SetGameSeed;
+      command._value = rng();
+    }
+    commands.push_back(command);
+  }
+  return commands;
+}
+} // namespace
+
+SCENARIO("Values are passed through an SpscQueue") {
+  GIVEN("An SpscQueue with a capacity that is not a power of two") {
+    fosssweeper::SpscQueue<int> spsc_queue(5);
+
+    THEN("The capacity is rounded up and the queue is empty") {
+      CHECK(spsc_queue.getCapacity() == 8);
+      CHECK(spsc_queue.getIsEmpty());
+      int value = 0;
+      CHECK_FALSE(spsc_queue.tryPop(value));
+    }
+
+    WHEN("The queue is filled") {
+      for (int value = 0; value < 8; value++) {
+        REQUIRE(spsc_queue.tryPush(int(value)));
+      }
+
+      THEN("Further pushes fail and values come out in order") {
+        CHECK_FALSE(spsc_queue.tryPush(8));
+        for (int expected = 0; expected < 8; expected++) {
+          int value = -1;
+          REQUIRE(spsc_queue.tryPop(value));
+          CHECK(value == expected);
+        }
+        CHECK(spsc_queue.getIsEmpty());
+      }
+    }
+  }
+
+  GIVEN("A producer and a consumer thread") {
+    fosssweeper::SpscQueue<int> spsc_queue(64);
+    const int value_count = 200000;
+    std::thread producer([&]() {
+      for (int value = 0; value < value_count; value++) {
+        while (!spsc_queue.tryPush(int(value))) {
+          std::this_thread::yield();
+        }
+      }
+    });
+    bool ordered = true;
+    for (int expected = 0; expected < value_count; expected++) {
+      int value = -1;
+      while (!spsc_queue.tryPop(value)) {
+        std::this_thread::yield();
+      }
+      if (value != expected) {
+        ordered = false;
+      }
+    }
+    producer.join();
+
+    THEN("Every value arrives once and in order") {
+      CHECK(ordered);
+      CHECK(spsc_queue.getIsEmpty());
+    }
+  }
+}
+
+SCENARIO("A ModelWorker matches the synchronous GameModel") {
+  GIVEN("A GameModel behind a ModelWorker and a synchronous GameModel") {
+    const auto seed = GENERATE(range(0, 8));
+    const auto commands = drawCommands(static_cast<std::uint32_t>(seed), 2000);
+    const fosssweeper::GameConfiguration game_configuration(
+        fosssweeper::GameDifficulty::Expert);
+    fosssweeper::GameModel worker_model;
+    fosssweeper::GameModel game_model;
+    for (auto *model : {&worker_model, &game_model}) {
+      model->newGame(game_configuration);
+      model->setGenerationMode(fosssweeper::GenerationMode::Opening);
+      model->setGameSeed(static_cast<std::uint64_t>(seed));
+      model->setJournalEnabled(true);
+    }
+    game_model.setChangeSetEnabled(true);
+    std::atomic<std::size_t> notified_count = 0;
+    fosssweeper::ModelWorker model_worker(worker_model,
+                                          [&]() { notified_count++; });
+
+    WHEN("The same commands are applied to both") {
+      std::size_t pushed_count = 0;
+      std::size_t popped_count = 0;
+      bool sequenced = true;
+      bool matching = true;
+      bool changes_matching = true;
+      while (popped_count < commands.size()) {
+        while (pushed_count < commands.size()) {
+          const auto sequence_o = model_worker.tryPush(commands[pushed_count]);
+          if (!sequence_o.has_value())
+            break;
+          pushed_count++;
+          if (sequence_o.value() != pushed_count) {
+            sequenced = false;
+          }
+        }
+        fosssweeper::ModelUpdate model_update;
+        if (!model_worker.tryPopUpdate(model_update)) {
+          std::this_thread::yield();
+          continue;
+        }
+        const auto &command = commands[popped_count];
+        popped_count++;
+        if (model_update._sequence != popped_count) {
+          sequenced = false;
+        }
+        const auto previous_hash = game_model.getVisibleHash();
+        applyCommand(game_model, command);
+        const auto &board_snapshot = model_update._boardSnapshot;
+        if (board_snapshot.getGameState() != game_model.getGameState() ||
+            board_snapshot.getFlagCount() != game_model.getFlagCount() ||
+            board_snapshot.getButtonsLeft() != game_model.getButtonsLeft() ||
+            board_snapshot.getVisibleHash() != game_model.getVisibleHash() ||
+            model_update._gameTime != game_model.getGameTime() ||
+            model_update._canUndo != game_model.getJournal().getCanUndo() ||
+            model_update._canRedo != game_model.getJournal().getCanRedo()) {
+          matching = false;
+        }
+        for (std::size_t button_i = 0;
+             button_i < board_snapshot.getButtonCount(); button_i++) {
+          const auto &button = game_model.getButtons()[button_i];
+          const auto &snapshot_button = board_snapshot.getButton(button_i);
+          if (snapshot_button.getVisibleCode() != button.getVisibleCode() ||
+              snapshot_button.getHasBomb() != button.getHasBomb()) {
+            matching = false;
+          }
+        }
+        // every visible change has to be reported
+        if (previous_hash != game_model.getVisibleHash() &&
+            !model_update._allButtonsChanged &&
+            model_update._changedButtons.empty()) {
+          changes_matching = false;
+        }
+        if (!model_update._allButtonsChanged &&
+            !model_update._changedButtons.empty() &&
+            model_update._changedButtons !=
+                game_model.getChangeSet().getChangedButtons()) {
+          changes_matching = false;
+        }
+      }
+
+      THEN("Every update matches the synchronous GameModel") {
+        CHECK(sequenced);
+        CHECK(matching);
+        CHECK(changes_matching);
+        CHECK(notified_count.load() == commands.size());
+      }
+    }
+  }
+}
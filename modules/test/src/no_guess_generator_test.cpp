@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/no_guess_generator.hpp>
+#include <fosssweeper/solver.hpp>
+#include <fosssweeper/surrounding_buttons.hpp>
+#include <vector>
+
+namespace {
+bool getIsSolvable(fosssweeper::GameConfiguration game_configuration,
+                   const std::vector<bool> &bombs, std::size_t initial_i) {
+  fosssweeper::GameModel game_model;
+  game_model.newGame(game_configuration);
+  game_model._gameState = fosssweeper::GameState::Playing;
+  for (std::size_t button_i = 0; button_i < bombs.size(); button_i++) {
+    game_model._buttons[button_i].setHasBomb(bombs[button_i]);
+  }
+  game_model.calculateSurroundingBombs();
+  const auto buttons_wide = game_configuration.getButtonsWide();
+  game_model.clickButton(static_cast<int>(initial_i % buttons_wide),
+                         static_cast<int>(initial_i / buttons_wide));
+  fosssweeper::Solver solver;
+  std::vector<std::size_t> safe_buttons;
+  std::vector<std::size_t> bomb_buttons;
+  while (game_model.getGameState() == fosssweeper::GameState::Playing) {
+    solver.load(game_model);
+    bool pressed = false;
+    while (solver.findCertainButtons(safe_buttons, bomb_buttons)) {
+      for (const auto button_i : bomb_buttons) {
+        solver.markBomb(button_i);
+      }
+      if (!safe_buttons.empty())
+        break;
+    }
+    for (const auto button_i : safe_buttons) {
+      game_model.clickButton(static_cast<int>(button_i % buttons_wide),
+                             static_cast<int>(button_i / buttons_wide));
+      pressed = true;
+    }
+    if (!pressed)
+      break;
+  }
+  return game_model.getGameState() == fosssweeper::GameState::Cool;
+}
+} // namespace
+
+SCENARIO("No guess bomb layouts are generated") {
+  GIVEN("The preset game configurations") {
+    const auto game_difficulty = GENERATE(
+        fosssweeper::GameDifficulty::Beginner,
+        fosssweeper::GameDifficulty::Intermediate,
+        fosssweeper::GameDifficulty::Expert);
+    const fosssweeper::GameConfiguration game_configuration(game_difficulty);
+
+    WHEN("Layouts are generated for several seeds") {
+      THEN("Every layout can be cleared without guessing") {
+        for (std::uint64_t seed = 0; seed < 8; seed++) {
+          std::vector<bool> bombs;
+          REQUIRE(fosssweeper::generateNoGuessBombs(game_configuration, 3, 4,
+                                                    seed, bombs));
+          std::size_t bomb_count = 0;
+          for (const bool bomb : bombs) {
+            bomb_count += bomb ? 1 : 0;
+          }
+          CHECK(bomb_count ==
+                static_cast<std::size_t>(game_configuration.getBombCount()));
+          const std::size_t initial_i =
+              4 * game_configuration.getButtonsWide() + 3;
+          CHECK(bombs[initial_i] == false);
+          for (const auto surrounding_i : fosssweeper::SurroundingButtons(
+                   initial_i, game_configuration.getButtonsWide(),
+                   game_configuration.getButtonsTall())) {
+            CHECK(bombs[surrounding_i] == false);
+          }
+          CHECK(getIsSolvable(game_configuration, bombs, initial_i));
+        }
+      }
+    }
+
+    WHEN("A layout is generated twice with the same seed") {
+      std::vector<bool> bombs;
+      std::vector<bool> other_bombs;
+      fosssweeper::generateNoGuessBombs(game_configuration, 0, 0, 42, bombs);
+      fosssweeper::generateNoGuessBombs(game_configuration, 0, 0, 42,
+                                        other_bombs);
+
+      THEN("Both layouts are the same") { CHECK(bombs == other_bombs); }
+    }
+  }
+
+  GIVEN("An expert game configuration") {
+    const fosssweeper::GameConfiguration game_configuration(
+        fosssweeper::GameDifficulty::Expert);
+
+    WHEN("Several layouts are generated") {
+      const auto start = std::chrono::steady_clock::now();
+      const int layout_count = 16;
+      for (int layout_i = 0; layout_i < layout_count; layout_i++) {
+        std::vector<bool> bombs;
+        fosssweeper::generateNoGuessBombs(game_configuration, 15, 8,
+                                          static_cast<std::uint64_t>(layout_i),
+                                          bombs);
+      }
+      const auto elapsed = std::chrono::steady_clock::now() - start;
+
+      THEN("A layout takes less than 50 ms on average") {
+        CHECK(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)
+                  .count() < 50 * layout_count);
+      }
+    }
+  }
+
+  GIVEN("A game configuration too dense to solve") {
+    const fosssweeper::GameConfiguration game_configuration(8, 8, 62);
+
+    WHEN("A layout is generated") {
+      std::vector<bool> bombs;
+      const bool generated = fosssweeper::generateNoGuessBombs(
+          game_configuration, 0, 0, 7, bombs);
+
+      THEN("Generation gives up") { CHECK(generated == false); }
+    }
+  }
+}
+
+SCENARIO("A GameModel generates a no guess game") {
+  GIVEN("A GameModel in no guess generation mode") {
+    fosssweeper::GameModel game_model;
+    game_model.newGame(
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert));
+    game_model.setGenerationMode(fosssweeper::GenerationMode::NoGuess);
+    game_model.setGameSeed(1234);
+
+    WHEN("The first Button is clicked") {
+      game_model.clickButton(10, 10);
+
+      THEN("The game is playing and an opening was revealed") {
+        CHECK(game_model.getGameState() == fosssweeper::GameState::Playing);
+        CHECK(game_model.getButton(10, 10).getSurroundingBombs() == 0);
+        CHECK(game_model.getButtonsLeft() <
+              game_model.getGameConfiguration().getButtonCount() -
+                  game_model.getGameConfiguration().getBombCount() - 1);
+      }
+    }
+  }
+
+  GIVEN("Two GameModel objects with the same game seed") {
+    fosssweeper::GameModel game_model;
+    fosssweeper::GameModel other_game_model;
+    game_model.setGameSeed(99);
+    other_game_model.setGameSeed(99);
+
+    WHEN("The same first Button is clicked") {
+      game_model.clickButton(2, 2);
+      other_game_model.clickButton(2, 2);
+
+      THEN("Both GameModel objects have the same bomb layout") {
+        CHECK(game_model.getLayoutHash() == other_game_model.getLayoutHash());
+      }
+    }
+  }
+}
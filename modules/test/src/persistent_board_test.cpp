@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/board_snapshot.hpp>
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/button_state.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/persistent_board.hpp>
+#include <thread>
+#include <vector>
+
+SCENARIO("A PersistentBoard is copied and written to") {
+  GIVEN("A PersistentBoard of 200 Buttons and a copy of it") {
+    std::vector<fosssweeper::Button> buttons(200);
+    buttons[10].setHasBomb(true);
+    fosssweeper::PersistentBoard persistent_board;
+    persistent_board.assign(buttons);
+    const auto copied_board = persistent_board;
+
+    THEN("Both boards share every chunk") {
+      CHECK(copied_board.getButtonCount() == 200);
+      for (std::size_t chunk_i = 0; chunk_i < 4; chunk_i++) {
+        CHECK(copied_board.getChunk(chunk_i) ==
+              persistent_board.getChunk(chunk_i));
+      }
+    }
+
+    WHEN("A Button of the original board is written") {
+      fosssweeper::Button button('d');
+      persistent_board.setButton(130, button);
+
+      THEN("Only the written chunk is copied") {
+        CHECK(persistent_board.getButton(130).getButtonState() ==
+              fosssweeper::ButtonState::Down);
+        CHECK(copied_board.getButton(130).getButtonState() ==
+              fosssweeper::ButtonState::None);
+        CHECK(copied_board.getButton(10).getHasBomb());
+        CHECK(persistent_board.getChunk(2) != copied_board.getChunk(2));
+        CHECK(persistent_board.getChunk(0) == copied_board.getChunk(0));
+        CHECK(persistent_board.getChunk(1) == copied_board.getChunk(1));
+        CHECK(persistent_board.getChunk(3) == copied_board.getChunk(3));
+      }
+
+      WHEN("Another Button of the same chunk is written") {
+        const auto *const chunk = persistent_board.getChunk(2);
+        persistent_board.setButton(131, button);
+
+        THEN("The chunk is written in place") {
+          CHECK(persistent_board.getChunk(2) == chunk);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A GameModel is snapshotted") {
+  GIVEN("A GameModel with a game in progress") {
+    fosssweeper::GameModel game_model;
+    game_model.newGame(
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert));
+    game_model.setGenerationMode(fosssweeper::GenerationMode::Opening);
+    game_model.setGameSeed(11);
+    game_model.clickButton(15, 8);
+
+    WHEN("A snapshot is taken") {
+      const auto board_snapshot = game_model.snapshot();
+
+      THEN("The snapshot matches the GameModel") {
+        REQUIRE(board_snapshot.getButtonCount() ==
+                game_model.getButtons().size());
+        for (std::size_t button_i = 0;
+             button_i < board_snapshot.getButtonCount(); button_i++) {
+          const auto &button = game_model.getButtons()[button_i];
+          const auto &snapshot_button = board_snapshot.getButton(button_i);
+          REQUIRE(snapshot_button.getButtonState() == button.getButtonState());
+          REQUIRE(snapshot_button.getHasBomb() == button.getHasBomb());
+          REQUIRE(snapshot_button.getSurroundingBombs() ==
+                  button.getSurroundingBombs());
+        }
+        CHECK(board_snapshot.getGameState() == game_model.getGameState());
+        CHECK(board_snapshot.getButtonsLeft() == game_model.getButtonsLeft());
+        CHECK(board_snapshot.getVisibleHash() == game_model.getVisibleHash());
+      }
+
+      WHEN("The game goes on and a second snapshot is taken") {
+        game_model.altClickButton(0, 0);
+        game_model.newGame();
+        const auto new_board_snapshot = game_model.snapshot();
+
+        THEN("The first snapshot is unchanged") {
+          CHECK(board_snapshot.getButton(0, 0).getButtonState() ==
+                fosssweeper::ButtonState::None);
+          CHECK(board_snapshot.getButton(15, 8).getButtonState() ==
+                fosssweeper::ButtonState::Down);
+          CHECK(board_snapshot.getGameState() ==
+                fosssweeper::GameState::Playing);
+          CHECK(new_board_snapshot.getButton(15, 8).getButtonState() ==
+                fosssweeper::ButtonState::None);
+          CHECK(new_board_snapshot.getGameState() ==
+                fosssweeper::GameState::None);
+        }
+      }
+    }
+
+    WHEN("Snapshots are read on another thread while the game is played") {
+      std::atomic<bool> consistent = true;
+      std::vector<fosssweeper::BoardSnapshot> board_snapshots;
+      for (int y = 0; y < 16; y++) {
+        board_snapshots.push_back(game_model.snapshot());
+        for (int x = 0; x < 30; x++) {
+          game_model.altClickButton(x, y);
+        }
+      }
+      std::thread reader([&]() {
+        for (const auto &board_snapshot : board_snapshots) {
+          int flag_count = 0;
+          for (std::size_t button_i = 0;
+               button_i < board_snapshot.getButtonCount(); button_i++) {
+            if (board_snapshot.getButton(button_i).getButtonState() ==
+                fosssweeper::ButtonState::Flagged) {
+              flag_count++;
+            }
+          }
+          if (flag_count != board_snapshot.getFlagCount()) {
+            consistent = false;
+          }
+        }
+      });
+      for (int y = 0; y < 16; y++) {
+        for (int x = 0; x < 30; x++) {
+          game_model.altClickButton(x, y);
+        }
+      }
+      reader.join();
+
+      THEN("Every snapshot stays consistent") { CHECK(consistent); }
+    }
+  }
+}
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <fosssweeper/action.hpp>
+#include <fosssweeper/button_state.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_difficulty.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "policy.hpp"
+
+SCENARIO("Scripts are parsed by a ScriptedPolicy") {
+  GIVEN("A script with comments, empty lines and every action type") {
+    std::istringstream script("# opening\n"
+                              "\n"
+                              "c 4 4\n"
+                              "f 0 1\n"
+                              "a 2 3\n");
+    const fosssweeper::ScriptedPolicy scripted_policy("script:test", script);
+
+    THEN("Each action line becomes one action in order") {
+      CHECK(scripted_policy.getName() == "script:test");
+      REQUIRE(scripted_policy._actions.size() == 3);
+      CHECK(scripted_policy._actions[0]._actionType ==
+            fosssweeper::ActionType::Click);
+      CHECK(scripted_policy._actions[0]._buttonPosition.x == 4);
+      CHECK(scripted_policy._actions[0]._buttonPosition.y == 4);
+      CHECK(scripted_policy._actions[1]._actionType ==
+            fosssweeper::ActionType::AltClick);
+      CHECK(scripted_policy._actions[1]._buttonPosition.x == 0);
+      CHECK(scripted_policy._actions[1]._buttonPosition.y == 1);
+      CHECK(scripted_policy._actions[2]._actionType ==
+            fosssweeper::ActionType::AreaClick);
+      CHECK(scripted_policy._actions[2]._buttonPosition.x == 2);
+      CHECK(scripted_policy._actions[2]._buttonPosition.y == 3);
+    }
+
+    WHEN("A game is played with it") {
+      fosssweeper::GameModel game_model;
+      game_model.newGame(fosssweeper::GameConfiguration(
+          fosssweeper::GameDifficulty::Beginner));
+      std::mt19937_64 rng(0);
+      scripted_policy.playGame(game_model, rng);
+
+      THEN("The actions are applied to the game") {
+        CHECK(game_model.getGameState() != fosssweeper::GameState::None);
+        CHECK(game_model.getButton(4, 4).getButtonState() ==
+              fosssweeper::ButtonState::Down);
+      }
+    }
+  }
+
+  GIVEN("A script with a malformed action") {
+    const std::string line = GENERATE("c 1", "c", "c a b", "c -1 0", "f 0 -2");
+    std::istringstream script("# header\nc 0 0\n" + line + "\n");
+
+    THEN("It is rejected with the line number") {
+      CHECK_THROWS_WITH(fosssweeper::ScriptedPolicy("script:test", script),
+                        "invalid script action on line 3");
+    }
+  }
+
+  GIVEN("A script with an unknown action type") {
+    const std::string line = GENERATE("x 1 2", "C 1 2", "r 0 0");
+    std::istringstream script(line + "\n");
+
+    THEN("It is rejected with the line number") {
+      CHECK_THROWS_WITH(fosssweeper::ScriptedPolicy("script:test", script),
+                        "invalid script action type on line 1");
+    }
+  }
+}
+
+SCENARIO("Policies are made from their names") {
+  GIVEN("The name of a built in policy") {
+    const std::string name = GENERATE("random", "solver");
+
+    THEN("The policy with that name is made") {
+      CHECK(fosssweeper::makePolicy(name)->getName() == name);
+    }
+  }
+
+  GIVEN("An unknown policy name") {
+    const std::string name = GENERATE("", "greedy", "Solver", "script");
+
+    THEN("It is rejected") {
+      CHECK_THROWS_WITH(fosssweeper::makePolicy(name),
+                        "unknown policy " + name);
+    }
+  }
+
+  GIVEN("A script policy whose file does not exist") {
+    THEN("It is rejected with the path") {
+      CHECK_THROWS_WITH(
+          fosssweeper::makePolicy("script:/nonexistent/fosssweeper.script"),
+          "unable to open script /nonexistent/fosssweeper.script");
+    }
+  }
+}
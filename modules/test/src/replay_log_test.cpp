@@ -0,0 +1,323 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button_position.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <fosssweeper/replay_recorder.hpp>
+#include <iostream>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+fosssweeper::ReplayEvent createEvent(fosssweeper::ReplayEventType event_type,
+                                     std::uint64_t time, std::uint64_t value) {
+  fosssweeper::ReplayEvent replay_event;
+  replay_event._eventType = event_type;
+  replay_event._time = time;
+  replay_event._value = value;
+  return replay_event;
+}
+
+std::vector<fosssweeper::ReplayEvent>
+decodeAll(std::span<const std::uint8_t> bytes) {
+  std::vector<fosssweeper::ReplayEvent> replay_events;
+  fosssweeper::ReplayDecoder replay_decoder(bytes);
+  fosssweeper::ReplayEvent replay_event;
+  while (replay_decoder.tryDecode(replay_event)) {
+    replay_events.push_back(replay_event);
+  }
+  return replay_events;
+}
+
+std::vector<std::uint8_t> getBytes(const std::string &string) {
+  return std::vector<std::uint8_t>(string.begin(), string.end());
+}
+} // namespace
+
+SCENARIO("Replay events are encoded and decoded") {
+  GIVEN("A ReplayEncoder with a header") {
+    fosssweeper::ReplayEncoder replay_encoder;
+    replay_encoder.writeHeader();
+    const auto header_size = replay_encoder.getBytes().size();
+
+    WHEN("A game and some inputs are encoded") {
+      auto game_begin =
+          createEvent(fosssweeper::ReplayEventType::GameBegin, 5, 0);
+      game_begin._gameConfiguration = fosssweeper::GameConfiguration(
+          fosssweeper::GameDifficulty::Expert);
+      game_begin._generationMode = fosssweeper::GenerationMode::NoGuess;
+      game_begin._gameSeed = 0x0123456789abcdef;
+      game_begin._questionsEnabled = true;
+      const std::vector<fosssweeper::ReplayEvent> replay_events = {
+          game_begin,
+          createEvent(fosssweeper::ReplayEventType::Click, 900, 250),
+          createEvent(fosssweeper::ReplayEventType::AltClick, 1200, 251),
+          createEvent(fosssweeper::ReplayEventType::AreaClick, 1300, 220),
+          createEvent(fosssweeper::ReplayEventType::Undo, 1400, 0),
+          createEvent(fosssweeper::ReplayEventType::Redo, 1500, 0),
+          createEvent(fosssweeper::ReplayEventType::QuestionsEnabled, 1600, 0),
+          createEvent(fosssweeper::ReplayEventType::CertainMoves, 1700, 0),
+          createEvent(fosssweeper::ReplayEventType::Click, 100000, 0)};
+      for (const auto &replay_event : replay_events) {
+        replay_encoder.encode(replay_event);
+      }
+
+      THEN("Every event is decoded again") {
+        const auto decoded_events = decodeAll(replay_encoder.getBytes());
+        REQUIRE(decoded_events.size() == replay_events.size());
+        for (std::size_t event_i = 0; event_i < replay_events.size();
+             event_i++) {
+          CHECK(decoded_events[event_i]._eventType ==
+                replay_events[event_i]._eventType);
+          CHECK(decoded_events[event_i]._time == replay_events[event_i]._time);
+          CHECK(decoded_events[event_i]._value ==
+                replay_events[event_i]._value);
+        }
+        CHECK(decoded_events[0]._gameConfiguration ==
+              game_begin._gameConfiguration);
+        CHECK(decoded_events[0]._generationMode ==
+              fosssweeper::GenerationMode::NoGuess);
+        CHECK(decoded_events[0]._gameSeed == game_begin._gameSeed);
+        CHECK(decoded_events[0]._questionsEnabled);
+      }
+
+      THEN("Nearby clicks take a few bytes each") {
+        const auto size = replay_encoder.getBytes().size();
+        replay_encoder.encode(
+            createEvent(fosssweeper::ReplayEventType::Click, 100250, 31));
+        CHECK(replay_encoder.getBytes().size() - size == 4);
+      }
+
+      THEN("A truncated log throws") {
+        const auto bytes = replay_encoder.getBytes();
+        fosssweeper::ReplayDecoder replay_decoder(
+            bytes.first(header_size + 3));
+        fosssweeper::ReplayEvent replay_event;
+        CHECK_THROWS_AS(replay_decoder.tryDecode(replay_event),
+                        std::runtime_error);
+      }
+    }
+
+    WHEN("Two recordings are appended to each other") {
+      replay_encoder.encode(
+          createEvent(fosssweeper::ReplayEventType::Click, 2000, 10));
+      replay_encoder.writeHeader();
+      replay_encoder.encode(
+          createEvent(fosssweeper::ReplayEventType::Click, 30, 12));
+
+      THEN("They are decoded as one stream") {
+        const auto decoded_events = decodeAll(replay_encoder.getBytes());
+        REQUIRE(decoded_events.size() == 2);
+        CHECK(decoded_events[0]._time == 2000);
+        CHECK(decoded_events[1]._time == 30);
+        CHECK(decoded_events[1]._value == 12);
+      }
+    }
+
+    WHEN("The time goes backwards") {
+      replay_encoder.encode(
+          createEvent(fosssweeper::ReplayEventType::Undo, 500, 0));
+      replay_encoder.encode(
+          createEvent(fosssweeper::ReplayEventType::Redo, 400, 0));
+
+      THEN("No time passes") {
+        const auto decoded_events = decodeAll(replay_encoder.getBytes());
+        REQUIRE(decoded_events.size() == 2);
+        CHECK(decoded_events[1]._time == 500);
+      }
+    }
+  }
+
+  GIVEN("Bytes that are not a replay log") {
+    const auto bytes = getBytes("not a replay");
+
+    THEN("Decoding throws") {
+      fosssweeper::ReplayDecoder replay_decoder(bytes);
+      fosssweeper::ReplayEvent replay_event;
+      CHECK_THROWS_AS(replay_decoder.tryDecode(replay_event),
+                      std::runtime_error);
+    }
+  }
+}
+
+SCENARIO("A GameModel records its inputs") {
+  GIVEN("A GameModel with a ReplayRecorder") {
+    std::stringstream stream;
+    fosssweeper::GameModel game_model;
+    game_model.newGame(fosssweeper::GameConfiguration(
+        fosssweeper::GameDifficulty::Intermediate));
+    game_model.setGameSeed(17);
+    const auto game_seed = game_model.getGameSeed();
+    const auto buttons_wide =
+        game_model.getGameConfiguration().getButtonsWide();
+    {
+      fosssweeper::ReplayRecorder replay_recorder(stream);
+      game_model.setReplayRecorder(&replay_recorder);
+
+      WHEN("Some inputs are made") {
+        game_model.clickButton(8, 8);
+        game_model.altClickButton(0, 0);
+        game_model.areaClickButton(8, 8);
+        replay_recorder.flush();
+
+        THEN("The stream holds the game and the inputs") {
+          const auto bytes = getBytes(stream.str());
+          const auto decoded_events = decodeAll(bytes);
+          REQUIRE(decoded_events.size() == 4);
+          CHECK(decoded_events[0]._eventType ==
+                fosssweeper::ReplayEventType::GameBegin);
+          CHECK(decoded_events[0]._gameConfiguration ==
+                game_model.getGameConfiguration());
+          CHECK(decoded_events[0]._gameSeed == game_seed);
+          CHECK(decoded_events[1]._eventType ==
+                fosssweeper::ReplayEventType::Click);
+          CHECK(decoded_events[1]._value ==
+                fosssweeper::ButtonPosition(8, 8).getIndex(buttons_wide));
+          CHECK(decoded_events[2]._eventType ==
+                fosssweeper::ReplayEventType::AltClick);
+          CHECK(decoded_events[2]._value == 0);
+          CHECK(decoded_events[3]._eventType ==
+                fosssweeper::ReplayEventType::AreaClick);
+        }
+
+        AND_WHEN("Another game is started") {
+          game_model.newGame();
+          game_model.clickButton(1, 1);
+          replay_recorder.flush();
+
+          THEN("A second game is recorded") {
+            const auto bytes = getBytes(stream.str());
+            const auto decoded_events = decodeAll(bytes);
+            REQUIRE(decoded_events.size() == 6);
+            CHECK(decoded_events[4]._eventType ==
+                  fosssweeper::ReplayEventType::GameBegin);
+            CHECK(decoded_events[4]._gameSeed == game_model.getGameSeed());
+          }
+        }
+      }
+
+      WHEN("A keyframe is taken and the game goes on") {
+        replay_recorder.setKeyframeInterval(2, 1000000);
+        game_model.clickButton(8, 8);
+        game_model.altClickButton(0, 0);
+        std::ostringstream save_stream;
+        game_model.save(save_stream);
+        game_model.altClickButton(1, 0);
+        replay_recorder.flush();
+
+        THEN("The keyframe holds the save from when it was taken") {
+          const auto bytes = getBytes(stream.str());
+          const auto decoded_events = decodeAll(bytes);
+          REQUIRE(decoded_events.size() == 5);
+          CHECK(decoded_events[2]._eventType ==
+                fosssweeper::ReplayEventType::AltClick);
+          REQUIRE(decoded_events[3]._eventType ==
+                  fosssweeper::ReplayEventType::Keyframe);
+          CHECK(decoded_events[4]._eventType ==
+                fosssweeper::ReplayEventType::AltClick);
+          CHECK(decoded_events[4]._value == 1);
+          const auto keyframe = decoded_events[3]._keyframe;
+          CHECK(std::string(reinterpret_cast<const char *>(keyframe.data()),
+                            keyframe.size()) == save_stream.str());
+        }
+      }
+      game_model.setReplayRecorder(nullptr);
+    }
+
+    THEN("Destroying the recorder writes the header") {
+      CHECK(stream.str().size() >= fosssweeper::ReplayEncoder::MAGIC.size());
+    }
+  }
+
+  GIVEN("A GameModel with a game in progress") {
+    std::stringstream stream;
+    fosssweeper::GameModel game_model;
+    game_model.newGame(fosssweeper::GameConfiguration(
+        fosssweeper::GameDifficulty::Beginner));
+    game_model.clickButton(0, 0);
+
+    WHEN("A ReplayRecorder is attached") {
+      {
+        fosssweeper::ReplayRecorder replay_recorder(stream);
+        game_model.setReplayRecorder(&replay_recorder);
+        game_model.altClickButton(7, 7);
+        game_model.newGame();
+        game_model.setGameSeed(5);
+        game_model.clickButton(2, 2);
+        game_model.setReplayRecorder(nullptr);
+      }
+
+      THEN("Only the next game is recorded") {
+        const auto bytes = getBytes(stream.str());
+        const auto decoded_events = decodeAll(bytes);
+        REQUIRE(decoded_events.size() == 2);
+        CHECK(decoded_events[0]._eventType ==
+              fosssweeper::ReplayEventType::GameBegin);
+        CHECK(decoded_events[1]._eventType ==
+              fosssweeper::ReplayEventType::Click);
+      }
+    }
+  }
+}
+
+SCENARIO("Recording a replay is cheap", "[.][benchmark]") {
+  GIVEN("A ReplayRecorder") {
+    std::stringstream stream;
+    fosssweeper::ReplayRecorder replay_recorder(stream);
+
+    WHEN("A million clicks are recorded") {
+      const std::uint64_t click_count = 1000000;
+      const auto record_begin = std::chrono::steady_clock::now();
+      for (std::uint64_t click_i = 0; click_i < click_count; click_i++) {
+        replay_recorder.record(createEvent(fosssweeper::ReplayEventType::Click,
+                                           0, (click_i * 7) % 480));
+      }
+      const auto record_duration =
+          std::chrono::steady_clock::now() - record_begin;
+      replay_recorder.flush();
+
+      THEN("Every click takes a few bytes") {
+        const auto bytes_per_click =
+            static_cast<double>(stream.str().size()) /
+            static_cast<double>(click_count);
+        std::cout << "record: "
+                  << std::chrono::duration<double, std::nano>(
+                         record_duration)
+                             .count() /
+                         static_cast<double>(click_count)
+                  << " ns and " << bytes_per_click << " bytes per click\n";
+        CHECK(bytes_per_click < 5.0);
+      }
+    }
+  }
+}
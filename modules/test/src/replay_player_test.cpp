@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <fosssweeper/replay_player.hpp>
+#include <fosssweeper/replay_recorder.hpp>
+#include <iostream>
+#include <random>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+bool getIsRunning(const fosssweeper::GameModel &game_model) {
+  return game_model.getGameState() == fosssweeper::GameState::None ||
+         game_model.getGameState() == fosssweeper::GameState::Playing;
+}
+
+void playRandomGame(fosssweeper::GameModel &game_model, std::mt19937_64 &rng) {
+  const auto game_configuration = game_model.getGameConfiguration();
+  std::uniform_int_distribution<int> x_distribution(
+      0, game_configuration.getButtonsWide() - 1);
+  std::uniform_int_distribution<int> y_distribution(
+      0, game_configuration.getButtonsTall() - 1);
+  std::uniform_int_distribution<int> action_distribution(0, 9);
+  while (getIsRunning(game_model)) {
+    const auto x = x_distribution(rng);
+    const auto y = y_distribution(rng);
+    switch (action_distribution(rng)) {
+    case 0:
+      game_model.altClickButton(x, y);
+      break;
+    case 1:
+      game_model.areaClickButton(x, y);
+      break;
+    case 2:
+      game_model.applyCertainMoves();
+      break;
+    default:
+      game_model.clickButton(x, y);
+      break;
+    }
+  }
+}
+
+std::vector<std::uint8_t> getBytes(const std::stringstream &stream) {
+  const auto string = stream.str();
+  return std::vector<std::uint8_t>(string.begin(), string.end());
+}
+} // namespace
+
+SCENARIO("Recorded games are played back") {
+  GIVEN("A replay log with several recorded games") {
+    std::stringstream stream;
+    std::mt19937_64 rng(3);
+    fosssweeper::GameModel game_model;
+    game_model.setJournalEnabled(true);
+    {
+      fosssweeper::ReplayRecorder replay_recorder(stream);
+      game_model.setReplayRecorder(&replay_recorder);
+      game_model.newGame(fosssweeper::GameConfiguration(
+          fosssweeper::GameDifficulty::Intermediate));
+      playRandomGame(game_model, rng);
+      game_model.setGenerationMode(fosssweeper::GenerationMode::Opening);
+      game_model.newGame(
+          fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert));
+      game_model.setQuestionsEnabled(true);
+      playRandomGame(game_model, rng);
+      // a lost game that is undone and played to its end again
+      game_model.setGenerationMode(fosssweeper::GenerationMode::Classic);
+      game_model.newGame(fosssweeper::GameConfiguration(
+          fosssweeper::GameDifficulty::Beginner));
+      playRandomGame(game_model, rng);
+      game_model.undo();
+      game_model.undo();
+      game_model.redo();
+      playRandomGame(game_model, rng);
+      game_model.newGame();
+      game_model.clickButton(0, 0);
+      game_model.setReplayRecorder(nullptr);
+    }
+    const auto bytes = getBytes(stream);
+
+    WHEN("The log is played back") {
+      fosssweeper::ReplayPlayer replay_player;
+      const auto play_result = replay_player.play(bytes);
+
+      THEN("Every game matches its recording") {
+        CHECK(play_result._firstMismatch == "");
+        CHECK(play_result._mismatchCount == 0);
+        CHECK(play_result._gameCount == 4);
+        CHECK(play_result._endedGameCount == 3);
+        CHECK(play_result._inputCount > 4);
+      }
+    }
+
+    WHEN("The seed of a game is changed") {
+      std::vector<fosssweeper::ReplayEvent> replay_events;
+      fosssweeper::ReplayDecoder replay_decoder(bytes);
+      fosssweeper::ReplayEvent replay_event;
+      while (replay_decoder.tryDecode(replay_event)) {
+        replay_events.push_back(replay_event);
+      }
+      replay_events[0]._gameSeed++;
+      fosssweeper::ReplayEncoder replay_encoder;
+      replay_encoder.writeHeader();
+      for (const auto &changed_event : replay_events) {
+        replay_encoder.encode(changed_event);
+      }
+      fosssweeper::ReplayPlayer replay_player;
+      const auto play_result = replay_player.play(replay_encoder.getBytes());
+
+      THEN("Only that game does not match") {
+        CHECK(play_result._mismatchCount == 1);
+        CHECK(play_result._firstMismatch.starts_with("game 1: "));
+        CHECK(play_result._gameCount == 4);
+      }
+    }
+  }
+
+  GIVEN("A replay log with an input before any game") {
+    fosssweeper::ReplayEncoder replay_encoder;
+    replay_encoder.writeHeader();
+    fosssweeper::ReplayEvent replay_event;
+    replay_event._eventType = fosssweeper::ReplayEventType::Click;
+    replay_encoder.encode(replay_event);
+
+    THEN("Playing it back throws") {
+      fosssweeper::ReplayPlayer replay_player;
+      CHECK_THROWS_AS(replay_player.play(replay_encoder.getBytes()),
+                      std::runtime_error);
+    }
+  }
+}
+
+SCENARIO("Replays are played back quickly", "[.][benchmark]") {
+  GIVEN("A replay log with 10000 expert games") {
+    const std::size_t game_count = 10000;
+    std::stringstream stream;
+    std::mt19937_64 rng(7);
+    fosssweeper::GameModel game_model;
+    {
+      fosssweeper::ReplayRecorder replay_recorder(stream);
+      game_model.setReplayRecorder(&replay_recorder);
+      for (std::size_t game_i = 0; game_i < game_count; game_i++) {
+        game_model.newGame(fosssweeper::GameConfiguration(
+            fosssweeper::GameDifficulty::Expert));
+        game_model.clickButton(15, 8);
+        playRandomGame(game_model, rng);
+      }
+      game_model.setReplayRecorder(nullptr);
+    }
+    const auto bytes = getBytes(stream);
+
+    WHEN("The log is played back") {
+      fosssweeper::ReplayPlayer replay_player;
+      const auto play_begin = std::chrono::steady_clock::now();
+      const auto play_result = replay_player.play(bytes);
+      const auto play_duration = std::chrono::steady_clock::now() - play_begin;
+
+      THEN("Every game matches") {
+        std::cout << "replay: " << bytes.size() << " bytes, "
+                  << static_cast<double>(game_count) /
+                         std::chrono::duration<double>(play_duration).count()
+                  << " games per second\n";
+        CHECK(play_result._mismatchCount == 0);
+        CHECK(play_result._gameCount == game_count);
+      }
+    }
+  }
+}
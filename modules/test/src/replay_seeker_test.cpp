@@ -0,0 +1,245 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/replay_log.hpp>
+#include <fosssweeper/replay_recorder.hpp>
+#include <fosssweeper/replay_seeker.hpp>
+#include <iostream>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+struct SeekPoint {
+  std::uint64_t _time = 0;
+  std::uint64_t _visibleHash = 0;
+  bool _isUndoGame = false;
+};
+
+// every input is recorded 10 ms after the previous one, so seeking 5 ms
+// after an input has to give the board right after it
+struct RecordingGame {
+  fosssweeper::GameModel _gameModel = fosssweeper::GameModel();
+  std::vector<SeekPoint> _seekPoints = std::vector<SeekPoint>();
+  std::mt19937_64 _rng = std::mt19937_64(11);
+
+  void finishInput(fosssweeper::ReplayRecorder &replay_recorder,
+                   bool is_undo_game) {
+    this->_seekPoints.push_back({replay_recorder.getTime() + 5,
+                                 this->_gameModel.getVisibleHash(),
+                                 is_undo_game});
+    replay_recorder._startTime -= std::chrono::milliseconds(10);
+  }
+
+  void play(fosssweeper::ReplayRecorder &replay_recorder,
+            std::size_t input_count, bool is_undo_game) {
+    const auto game_configuration = this->_gameModel.getGameConfiguration();
+    std::uniform_int_distribution<int> x_distribution(
+        0, game_configuration.getButtonsWide() - 1);
+    std::uniform_int_distribution<int> y_distribution(
+        0, game_configuration.getButtonsTall() - 1);
+    this->_gameModel.clickButton(game_configuration.getButtonsWide() / 2,
+                                 game_configuration.getButtonsTall() / 2);
+    this->finishInput(replay_recorder, is_undo_game);
+    for (std::size_t input_i = 0; input_i < input_count; input_i++) {
+      const auto x = x_distribution(this->_rng);
+      const auto y = y_distribution(this->_rng);
+      if (is_undo_game && input_i % 7 == 3) {
+        this->_gameModel.undo();
+      } else if (is_undo_game && input_i % 7 == 5) {
+        this->_gameModel.redo();
+      } else if (input_i % 5 == 0 &&
+                 !this->_gameModel.getButton(x, y).getHasBomb()) {
+        this->_gameModel.clickButton(x, y);
+      } else {
+        this->_gameModel.altClickButton(x, y);
+      }
+      this->finishInput(replay_recorder, is_undo_game);
+    }
+  }
+};
+
+std::vector<std::uint8_t> record(RecordingGame &recording_game,
+                                 std::size_t keyframe_input_count) {
+  std::stringstream stream;
+  {
+    fosssweeper::ReplayRecorder replay_recorder(stream);
+    replay_recorder.setKeyframeInterval(keyframe_input_count, 1000000);
+    auto &game_model = recording_game._gameModel;
+    game_model.setJournalEnabled(true);
+    game_model.setReplayRecorder(&replay_recorder);
+    game_model.newGame(fosssweeper::GameConfiguration(64, 64, 300));
+    recording_game.play(replay_recorder, 200, false);
+    game_model.newGame(fosssweeper::GameConfiguration(40, 30, 100));
+    recording_game.play(replay_recorder, 100, true);
+    game_model.setReplayRecorder(nullptr);
+  }
+  const auto string = stream.str();
+  return std::vector<std::uint8_t>(string.begin(), string.end());
+}
+
+void checkSeekPoints(fosssweeper::ReplaySeeker &replay_seeker,
+                     const std::vector<SeekPoint> &seek_points,
+                     std::size_t keyframe_input_count) {
+  for (std::size_t point_i = 0; point_i < seek_points.size(); point_i++) {
+    const auto &seek_point = seek_points[point_i];
+    INFO("seek point " << point_i << " at " << seek_point._time << " ms");
+    REQUIRE(replay_seeker.seek(seek_point._time));
+    CHECK(replay_seeker.getGameModel().getVisibleHash() ==
+          seek_point._visibleHash);
+    if (!seek_point._isUndoGame) {
+      CHECK(replay_seeker.getAppliedCount() <= keyframe_input_count);
+    }
+  }
+}
+} // namespace
+
+SCENARIO("A replay is seeked with keyframes") {
+  GIVEN("A recording with a keyframe every 16 inputs") {
+    RecordingGame recording_game;
+    const auto bytes = record(recording_game, 16);
+
+    WHEN("A ReplaySeeker reads its index") {
+      fosssweeper::ReplaySeeker replay_seeker(bytes);
+      const auto &entries = replay_seeker.getReplayIndex()._entries;
+
+      THEN("The index holds both games and their keyframes") {
+        CHECK(entries.size() == 2 + 200 / 16 + 100 / 16);
+        CHECK(!entries.front()._isKeyframe);
+      }
+
+      THEN("Every input is found again") {
+        checkSeekPoints(replay_seeker, recording_game._seekPoints, 16);
+      }
+    }
+
+    WHEN("The index is cut off") {
+      fosssweeper::ReplaySeeker indexed_seeker(bytes);
+      std::vector<std::uint8_t> cut_bytes(bytes);
+      cut_bytes.resize(indexed_seeker.getReplayIndex()._recordingSize);
+      fosssweeper::ReplaySeeker replay_seeker(cut_bytes);
+
+      THEN("The same index is built by decoding") {
+        const auto &entries = replay_seeker.getReplayIndex()._entries;
+        const auto &indexed_entries =
+            indexed_seeker.getReplayIndex()._entries;
+        REQUIRE(entries.size() == indexed_entries.size());
+        for (std::size_t entry_i = 0; entry_i < entries.size(); entry_i++) {
+          CHECK(entries[entry_i]._position ==
+                indexed_entries[entry_i]._position);
+          CHECK(entries[entry_i]._time == indexed_entries[entry_i]._time);
+        }
+        checkSeekPoints(replay_seeker, recording_game._seekPoints, 16);
+      }
+    }
+
+    WHEN("Another recording is in front of it") {
+      RecordingGame earlier_game;
+      auto joined_bytes = record(earlier_game, 8);
+      const auto earlier_size = joined_bytes.size();
+      joined_bytes.insert(joined_bytes.end(), bytes.begin(), bytes.end());
+
+      THEN("The last recording is seeked") {
+        fosssweeper::ReplaySeeker replay_seeker(joined_bytes);
+        CHECK(replay_seeker._recordingBegin == earlier_size);
+        checkSeekPoints(replay_seeker, recording_game._seekPoints, 16);
+      }
+
+      THEN("The last recording is seeked without its index") {
+        fosssweeper::ReplaySeeker indexed_seeker(bytes);
+        joined_bytes.resize(earlier_size +
+                            indexed_seeker.getReplayIndex()._recordingSize);
+        fosssweeper::ReplaySeeker replay_seeker(joined_bytes);
+        CHECK(replay_seeker._recordingBegin == earlier_size);
+        checkSeekPoints(replay_seeker, recording_game._seekPoints, 16);
+      }
+    }
+  }
+}
+
+SCENARIO("Seeking a long replay of a huge board is fast", "[.][benchmark]") {
+  GIVEN("Recordings of 20000 inputs on a 1000x1000 board") {
+    const auto recordHugeGame = [](std::size_t keyframe_input_count) {
+      std::stringstream stream;
+      fosssweeper::GameModel game_model;
+      std::mt19937_64 rng(5);
+      std::uniform_int_distribution<int> distribution(0, 999);
+      {
+        fosssweeper::ReplayRecorder replay_recorder(stream);
+        replay_recorder.setKeyframeInterval(keyframe_input_count, 1000000);
+        game_model.setReplayRecorder(&replay_recorder);
+        game_model.newGame(fosssweeper::GameConfiguration(1000, 1000, 100000));
+        game_model.setGameSeed(11);
+        game_model.clickButton(500, 500);
+        for (std::size_t input_i = 0; input_i < 20000; input_i++) {
+          replay_recorder._startTime -= std::chrono::milliseconds(10);
+          game_model.altClickButton(distribution(rng), distribution(rng));
+        }
+        game_model.setReplayRecorder(nullptr);
+      }
+      const auto string = stream.str();
+      return std::vector<std::uint8_t>(string.begin(), string.end());
+    };
+    const auto keyframe_bytes = recordHugeGame(1000);
+    const auto plain_bytes = recordHugeGame(1000000);
+
+    WHEN("Both are seeked to their end") {
+      fosssweeper::ReplaySeeker keyframe_seeker(keyframe_bytes);
+      fosssweeper::ReplaySeeker plain_seeker(plain_bytes);
+      const auto keyframe_begin = std::chrono::steady_clock::now();
+      keyframe_seeker.seek(1000000);
+      const auto keyframe_duration =
+          std::chrono::steady_clock::now() - keyframe_begin;
+      const auto plain_begin = std::chrono::steady_clock::now();
+      plain_seeker.seek(1000000);
+      const auto plain_duration =
+          std::chrono::steady_clock::now() - plain_begin;
+
+      THEN("The keyframe makes the seek faster") {
+        std::cout << "seek with keyframes: "
+                  << std::chrono::duration<double, std::milli>(
+                         keyframe_duration)
+                         .count()
+                  << " ms, " << keyframe_seeker.getAppliedCount()
+                  << " inputs, " << keyframe_bytes.size()
+                  << " bytes\nseek without keyframes: "
+                  << std::chrono::duration<double, std::milli>(plain_duration)
+                         .count()
+                  << " ms, " << plain_seeker.getAppliedCount() << " inputs, "
+                  << plain_bytes.size() << " bytes\n";
+        CHECK(keyframe_seeker.getGameModel().getVisibleHash() ==
+              plain_seeker.getGameModel().getVisibleHash());
+        CHECK(keyframe_seeker.getAppliedCount() <
+              plain_seeker.getAppliedCount());
+      }
+    }
+  }
+}
@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/button_planes.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/save_file.hpp>
+#include <fosssweeper/zobrist.hpp>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+void checkEqualGames(const fosssweeper::GameModel &loaded_model,
+                     const fosssweeper::GameModel &game_model) {
+  CHECK(loaded_model.getGameConfiguration() ==
+        game_model.getGameConfiguration());
+  CHECK(loaded_model.getGameState() == game_model.getGameState());
+  CHECK(loaded_model.getGenerationMode() == game_model.getGenerationMode());
+  CHECK(loaded_model.getQuestionsEnabled() ==
+        game_model.getQuestionsEnabled());
+  CHECK(loaded_model.getGameTime() == game_model.getGameTime());
+  CHECK(loaded_model.getGameSeed() == game_model.getGameSeed());
+  CHECK(loaded_model.getFlagCount() == game_model.getFlagCount());
+  CHECK(loaded_model.getButtonsLeft() == game_model.getButtonsLeft());
+  CHECK(loaded_model.getClickCount() == game_model.getClickCount());
+  CHECK(loaded_model.getLayoutHash() == game_model.getLayoutHash());
+  CHECK(loaded_model.getVisibleHash() == game_model.getVisibleHash());
+  const auto &loaded_buttons = loaded_model.getButtons();
+  const auto &buttons = game_model.getButtons();
+  REQUIRE(loaded_buttons.size() == buttons.size());
+  for (std::size_t button_i = 0; button_i < buttons.size(); button_i++) {
+    REQUIRE(loaded_buttons[button_i].getButtonState() ==
+            buttons[button_i].getButtonState());
+    REQUIRE(loaded_buttons[button_i].getHasBomb() ==
+            buttons[button_i].getHasBomb());
+    REQUIRE(loaded_buttons[button_i].getSurroundingBombs() ==
+            buttons[button_i].getSurroundingBombs());
+  }
+}
+
+// exploded bombs are left out, a lost game does not count them off the
+// buttons left the way the button string constructor does
+std::string getButtonString(int button_count, std::uint64_t seed) {
+  const std::string button_chars = "dbfcqr..";
+  std::string button_string(static_cast<std::size_t>(button_count), ' ');
+  for (auto &c : button_string) {
+    seed = fosssweeper::mixZobristKey(seed);
+    c = button_chars[seed % button_chars.size()];
+  }
+  return button_string;
+}
+
+int getBombCount(const std::string &button_string) {
+  fosssweeper::ButtonPlanes button_planes;
+  button_planes.parseButtonString(button_string);
+  return button_planes.getBombCount();
+}
+} // namespace
+
+SCENARIO("A GameModel is saved and loaded") {
+  GIVEN("A GameModel with a game in progress") {
+    fosssweeper::GameModel game_model;
+    game_model.newGame(
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert));
+    game_model.setGenerationMode(fosssweeper::GenerationMode::Opening);
+    game_model.setQuestionsEnabled(true);
+    game_model.setGameSeed(21);
+    game_model.clickButton(15, 8);
+    game_model.altClickButton(0, 0);
+    game_model.altClickButton(29, 15);
+    game_model.altClickButton(29, 15);
+    game_model.updateTime(42);
+
+    WHEN("It is saved") {
+      std::stringstream stream;
+      game_model.save(stream);
+
+      THEN("The save has the size of the header and three planes") {
+        CHECK(stream.str().size() == fosssweeper::SaveFile::getFileSize(480));
+        CHECK(fosssweeper::SaveFile::getFileSize(480) == 72 + 3 * 8 * 8);
+      }
+
+      THEN("Loading it into another GameModel restores the game") {
+        fosssweeper::GameModel loaded_model;
+        loaded_model.setJournalEnabled(true);
+        loaded_model.clickButton(0, 0);
+        loaded_model.load(stream);
+        checkEqualGames(loaded_model, game_model);
+        CHECK_FALSE(loaded_model.getJournal().getCanUndo());
+
+        AND_WHEN("Both games continue with the same click") {
+          game_model.clickButton(3, 3);
+          loaded_model.clickButton(3, 3);
+
+          THEN("They stay equal") { checkEqualGames(loaded_model, game_model); }
+        }
+      }
+
+      THEN("A GameModel with a change set reports every button") {
+        fosssweeper::GameModel loaded_model;
+        loaded_model.setChangeSetEnabled(true);
+        loaded_model.load(stream);
+        CHECK(loaded_model.getChangeSet().getIsButtonChanged(0));
+        CHECK(loaded_model.getChangeSet().getIsButtonChanged(479));
+      }
+    }
+  }
+
+  GIVEN("A GameModel with a flag placed before the first click") {
+    fosssweeper::GameModel game_model;
+    game_model.altClickButton(1, 1);
+
+    WHEN("It is saved and loaded") {
+      std::stringstream stream;
+      game_model.save(stream);
+      fosssweeper::GameModel loaded_model;
+      loaded_model.load(stream);
+
+      THEN("The game without bombs is restored") {
+        checkEqualGames(loaded_model, game_model);
+        CHECK(loaded_model.getGameState() == fosssweeper::GameState::None);
+        CHECK(loaded_model.getClickCount() == 1);
+      }
+    }
+  }
+
+  GIVEN("Button strings of boards around whole plane words") {
+    const int buttons_wide = GENERATE(8, 9, 63, 64, 65, 71);
+    const int buttons_tall = GENERATE(range(1, 10));
+    const int button_count = buttons_wide * buttons_tall;
+    const auto button_string = getButtonString(
+        button_count, static_cast<std::uint64_t>(button_count));
+    fosssweeper::GameModel game_model(
+        fosssweeper::GameConfiguration(buttons_wide, buttons_tall,
+                                       getBombCount(button_string)),
+        false, fosssweeper::GameState::Playing, 7, button_string);
+
+    WHEN("They are saved and loaded") {
+      std::stringstream stream;
+      game_model.save(stream);
+      fosssweeper::GameModel loaded_model;
+      loaded_model.load(stream);
+
+      THEN("The games are equal") { checkEqualGames(loaded_model, game_model); }
+    }
+  }
+}
+
+SCENARIO("An invalid save file is loaded") {
+  GIVEN("A saved GameModel and another GameModel") {
+    fosssweeper::GameModel game_model;
+    game_model.setGameSeed(3);
+    game_model.clickButton(4, 4);
+    std::stringstream stream;
+    game_model.save(stream);
+    auto save = stream.str();
+    fosssweeper::GameModel loaded_model;
+    loaded_model.setGameSeed(5);
+    loaded_model.clickButton(2, 2);
+    const auto visible_hash = loaded_model.getVisibleHash();
+
+    WHEN("The save is truncated") {
+      save.resize(save.size() - 1);
+      std::stringstream invalid_stream(save);
+
+      THEN("Loading throws and leaves the game as it was") {
+        CHECK_THROWS_AS(loaded_model.load(invalid_stream), std::runtime_error);
+        CHECK(loaded_model.getVisibleHash() == visible_hash);
+      }
+    }
+
+    WHEN("The magic or the version is wrong") {
+      const std::size_t byte_i = GENERATE(0, 8);
+      save[byte_i] = static_cast<char>(save[byte_i] + 1);
+      std::stringstream invalid_stream(save);
+
+      THEN("Loading throws") {
+        CHECK_THROWS_AS(loaded_model.load(invalid_stream), std::runtime_error);
+      }
+    }
+
+    WHEN("A counter of the header does not match the planes") {
+      const auto [byte_i, message] = GENERATE(table<std::size_t, std::string>(
+          {{24, "save file bomb count mismatch"},
+           {48, "save file flag count mismatch"},
+           {52, "save file buttons left mismatch"}}));
+      save[byte_i] = static_cast<char>(save[byte_i] + 1);
+      std::stringstream invalid_stream(save);
+
+      THEN("Loading throws and leaves the game as it was") {
+        CHECK_THROWS_WITH(loaded_model.load(invalid_stream), message);
+        CHECK(loaded_model.getVisibleHash() == visible_hash);
+      }
+    }
+
+    WHEN("A bomb bit is flipped") {
+      save[fosssweeper::SaveFile::HEADER_SIZE] ^= 1;
+      std::stringstream invalid_stream(save);
+
+      THEN("The layout hash does not match") {
+        CHECK_THROWS_AS(loaded_model.load(invalid_stream), std::runtime_error);
+        CHECK(loaded_model.getVisibleHash() == visible_hash);
+      }
+    }
+  }
+}
+
+SCENARIO("A large save file is loaded", "[.][benchmark]") {
+  GIVEN("A 10000x10000 button string") {
+    const auto button_string = getButtonString(10000 * 10000, 1);
+    const fosssweeper::GameConfiguration game_configuration(
+        10000, 10000, getBombCount(button_string));
+    std::stringstream stream;
+    std::chrono::nanoseconds parse_duration;
+    std::uint64_t layout_hash = 0;
+    std::uint64_t visible_hash = 0;
+    {
+      const auto parse_begin = std::chrono::steady_clock::now();
+      const fosssweeper::GameModel game_model(
+          game_configuration, false, fosssweeper::GameState::Playing, 0,
+          button_string);
+      parse_duration = std::chrono::steady_clock::now() - parse_begin;
+      layout_hash = game_model.getLayoutHash();
+      visible_hash = game_model.getVisibleHash();
+      game_model.save(stream);
+    }
+
+    WHEN("The save is loaded") {
+      fosssweeper::GameModel loaded_model;
+      const auto load_begin = std::chrono::steady_clock::now();
+      loaded_model.load(stream);
+      const auto load_duration = std::chrono::steady_clock::now() - load_begin;
+
+      THEN("The board is restored") {
+        std::cout << "button string: "
+                  << std::chrono::duration<double, std::milli>(parse_duration)
+                         .count()
+                  << " ms, save file: "
+                  << std::chrono::duration<double, std::milli>(load_duration)
+                         .count()
+                  << " ms for " << stream.str().size() << " bytes\n";
+        CHECK(loaded_model.getGameConfiguration() == game_configuration);
+        CHECK(loaded_model.getLayoutHash() == layout_hash);
+        CHECK(loaded_model.getVisibleHash() == visible_hash);
+      }
+    }
+  }
+}
@@ -0,0 +1,342 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/action.hpp>
+#include <fosssweeper/button.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "TestSupport.hpp"
+#include "protocol.hpp"
+#include "server.hpp"
+
+namespace {
+// the payloads of the complete frames in bytes
+std::vector<std::span<const std::uint8_t>>
+getFrames(std::span<const std::uint8_t> bytes) {
+  std::vector<std::span<const std::uint8_t>> frames;
+  std::size_t position = 0;
+  while (true) {
+    const auto frame_size =
+        fosssweeper::MessageReader::getFrameSize(bytes.subspan(position));
+    if (frame_size == 0)
+      break;
+    frames.push_back(bytes.subspan(
+        position + fosssweeper::MessageWriter::FRAME_HEADER_SIZE,
+        frame_size - fosssweeper::MessageWriter::FRAME_HEADER_SIZE));
+    position += frame_size;
+  }
+  return frames;
+}
+
+void writeAct(fosssweeper::MessageWriter &message_writer,
+              std::uint32_t request_id, std::uint64_t session_id,
+              std::uint8_t action_type, std::uint16_t x, std::uint16_t y) {
+  message_writer.beginFrame(fosssweeper::MessageType::Act, request_id);
+  message_writer.writeU64(session_id);
+  message_writer.writeU16(1);
+  message_writer.writeU8(action_type);
+  message_writer.writeU16(x);
+  message_writer.writeU16(y);
+  message_writer.endFrame();
+}
+} // namespace
+
+SCENARIO("Messages are written and read back") {
+  GIVEN("A frame holding every kind of value") {
+    std::vector<std::uint8_t> buffer;
+    fosssweeper::MessageWriter message_writer(buffer);
+    message_writer.beginFrame(fosssweeper::MessageType::Board, 0x01020304);
+    message_writer.writeU8(0xab);
+    message_writer.writeU16(0xbeef);
+    message_writer.writeU32(0xdeadbeef);
+    message_writer.writeU64(0x0123456789abcdef);
+    message_writer.writeString("fosssweeper");
+    message_writer.endFrame();
+
+    THEN("The frame size covers the whole buffer") {
+      CHECK(fosssweeper::MessageReader::getFrameSize(buffer) == buffer.size());
+    }
+
+    THEN("Every value is read back") {
+      const std::span<const std::uint8_t> bytes(buffer);
+      fosssweeper::MessageReader message_reader(
+          bytes.subspan(fosssweeper::MessageWriter::FRAME_HEADER_SIZE));
+      const auto message_header = message_reader.readHeader();
+      CHECK(message_header._messageType == fosssweeper::MessageType::Board);
+      CHECK(message_header._requestId == 0x01020304);
+      CHECK(message_reader.readU8() == 0xab);
+      CHECK(message_reader.readU16() == 0xbeef);
+      CHECK(message_reader.readU32() == 0xdeadbeef);
+      CHECK(message_reader.readU64() == 0x0123456789abcdef);
+      CHECK(message_reader.readString() == "fosssweeper");
+      CHECK_NOTHROW(message_reader.requireEnd());
+    }
+
+    THEN("No prefix of the buffer is a complete frame") {
+      const std::span<const std::uint8_t> bytes(buffer);
+      for (std::size_t byte_count = 0; byte_count < bytes.size();
+           byte_count++) {
+        CHECK(fosssweeper::MessageReader::getFrameSize(
+                  bytes.first(byte_count)) == 0);
+      }
+    }
+
+    THEN("Reading a truncated payload throws") {
+      const auto payload = std::span<const std::uint8_t>(buffer).subspan(
+          fosssweeper::MessageWriter::FRAME_HEADER_SIZE);
+      fosssweeper::MessageReader message_reader(
+          payload.first(payload.size() - 1));
+      message_reader.readHeader();
+      message_reader.readU8();
+      message_reader.readU16();
+      message_reader.readU32();
+      message_reader.readU64();
+      CHECK_THROWS_WITH(message_reader.readString(), "truncated message");
+    }
+
+    WHEN("A second frame follows") {
+      message_writer.beginFrame(fosssweeper::MessageType::Destroyed, 7);
+      message_writer.endFrame();
+
+      THEN("Both frames are found and the extra bytes are noticed") {
+        const auto frames = getFrames(buffer);
+        REQUIRE(frames.size() == 2);
+        CHECK(frames[1].size() == 5);
+        fosssweeper::MessageReader message_reader(frames[0]);
+        message_reader.readHeader();
+        CHECK_THROWS(message_reader.requireEnd());
+      }
+    }
+  }
+
+  GIVEN("A frame length above the limit") {
+    std::vector<std::uint8_t> buffer;
+    fosssweeper::MessageWriter message_writer(buffer);
+    message_writer.writeU32(static_cast<std::uint32_t>(
+        fosssweeper::MessageWriter::MAX_FRAME_SIZE + 1));
+
+    THEN("It is rejected before the payload arrives") {
+      CHECK_THROWS_WITH(fosssweeper::MessageReader::getFrameSize(buffer),
+                        "message too large");
+    }
+  }
+
+  GIVEN("A frame with a payload above the limit") {
+    std::vector<std::uint8_t> buffer;
+    fosssweeper::MessageWriter message_writer(buffer);
+    message_writer.beginFrame(fosssweeper::MessageType::Board, 0);
+    buffer.resize(fosssweeper::MessageWriter::FRAME_HEADER_SIZE +
+                  fosssweeper::MessageWriter::MAX_FRAME_SIZE + 1);
+
+    THEN("It can not be finished") {
+      CHECK_THROWS_WITH(message_writer.endFrame(), "message too large");
+    }
+  }
+}
+
+SCENARIO("A Server answers the frames of a connection") {
+  GIVEN("A Server and a connection that created a session") {
+    fosssweeper::Server server(
+        fosssweeper::getTemporaryPath("server", "socket").string());
+    fosssweeper::Connection connection;
+    fosssweeper::MessageWriter input_writer(connection._input);
+    input_writer.beginFrame(fosssweeper::MessageType::Create, 1);
+    input_writer.writeU16(9);
+    input_writer.writeU16(9);
+    input_writer.writeU32(10);
+    input_writer.writeU8(
+        static_cast<std::uint8_t>(fosssweeper::GenerationMode::Opening));
+    input_writer.writeU64(42);
+    input_writer.endFrame();
+    server.handleFrames(connection);
+
+    auto frames = getFrames(connection._output);
+    REQUIRE(frames.size() == 1);
+    fosssweeper::MessageReader created_reader(frames[0]);
+    const auto created_header = created_reader.readHeader();
+    REQUIRE(created_header._messageType ==
+            fosssweeper::MessageType::Created);
+    CHECK(created_header._requestId == 1);
+    const auto session_id = created_reader.readU64();
+    CHECK(created_reader.readU16() == 9);
+    CHECK(created_reader.readU16() == 9);
+    CHECK(created_reader.readU32() == 10);
+    CHECK(connection._input.empty());
+    CHECK(server.getSessionCount() == 1);
+    const auto *const game_model =
+        server._sessionTable.find(connection._connectionId, session_id);
+    REQUIRE(game_model != nullptr);
+    connection._output.clear();
+
+    WHEN("An Act frame arrives split over several reads") {
+      std::vector<std::uint8_t> act_bytes;
+      fosssweeper::MessageWriter act_writer(act_bytes);
+      writeAct(act_writer, 2, session_id,
+               static_cast<std::uint8_t>(fosssweeper::ActionType::Click), 4,
+               4);
+      for (std::size_t byte_i = 0; byte_i + 1 < act_bytes.size(); byte_i++) {
+        connection._input.push_back(act_bytes[byte_i]);
+        server.handleFrames(connection);
+      }
+
+      THEN("Nothing is answered before the frame is complete") {
+        CHECK(connection._output.empty());
+        CHECK(connection._input.size() == act_bytes.size() - 1);
+      }
+
+      AND_WHEN("The last byte arrives") {
+        connection._input.push_back(act_bytes.back());
+        server.handleFrames(connection);
+
+        THEN("The changed buttons are answered") {
+          frames = getFrames(connection._output);
+          REQUIRE(frames.size() == 1);
+          fosssweeper::MessageReader message_reader(frames[0]);
+          const auto message_header = message_reader.readHeader();
+          CHECK(message_header._messageType ==
+                fosssweeper::MessageType::Changes);
+          CHECK(message_header._requestId == 2);
+          CHECK(message_reader.readU8() ==
+                static_cast<std::uint8_t>(game_model->getGameState()));
+          CHECK(message_reader.readU32() == 0);
+          CHECK(message_reader.readU32() ==
+                static_cast<std::uint32_t>(game_model->getButtonsLeft()));
+          CHECK(message_reader.readU16() == 1);
+          const auto change_count = message_reader.readU32();
+          CHECK(change_count > 0);
+          for (std::uint32_t change_i = 0; change_i < change_count;
+               change_i++) {
+            const auto button_i = message_reader.readU32();
+            REQUIRE(button_i < game_model->getButtons().size());
+            CHECK(message_reader.readU8() ==
+                  game_model->getButtons()[button_i].getVisibleCode());
+          }
+          CHECK_NOTHROW(message_reader.requireEnd());
+          CHECK(connection._input.empty());
+        }
+      }
+    }
+
+    WHEN("Bad Act frames are followed by a Query") {
+      writeAct(input_writer, 3, session_id,
+               static_cast<std::uint8_t>(fosssweeper::ActionType::Click), 9,
+               0);
+      writeAct(input_writer, 4, session_id,
+               static_cast<std::uint8_t>(fosssweeper::ActionType::Click), 0,
+               9);
+      writeAct(input_writer, 5, session_id, 3, 0, 0);
+      writeAct(input_writer, 6, session_id + 1,
+               static_cast<std::uint8_t>(fosssweeper::ActionType::Click), 0,
+               0);
+      input_writer.beginFrame(fosssweeper::MessageType::Act, 7);
+      input_writer.writeU64(session_id);
+      input_writer.writeU16(2);
+      input_writer.writeU8(
+          static_cast<std::uint8_t>(fosssweeper::ActionType::Click));
+      input_writer.writeU16(0);
+      input_writer.writeU16(0);
+      input_writer.endFrame();
+      input_writer.beginFrame(fosssweeper::MessageType::Query, 8);
+      input_writer.writeU64(session_id);
+      input_writer.endFrame();
+      server.handleFrames(connection);
+
+      THEN("Each bad frame gets an Error and the board is untouched") {
+        frames = getFrames(connection._output);
+        REQUIRE(frames.size() == 6);
+        const std::vector<std::string> errors = {
+            "action outside of the board", "action outside of the board",
+            "invalid action type", "unknown session", "truncated message"};
+        for (std::size_t error_i = 0; error_i < errors.size(); error_i++) {
+          fosssweeper::MessageReader message_reader(frames[error_i]);
+          const auto message_header = message_reader.readHeader();
+          CHECK(message_header._messageType ==
+                fosssweeper::MessageType::Error);
+          CHECK(message_header._requestId == error_i + 3);
+          CHECK(message_reader.readString() == errors[error_i]);
+        }
+
+        fosssweeper::MessageReader message_reader(frames[5]);
+        const auto message_header = message_reader.readHeader();
+        CHECK(message_header._messageType == fosssweeper::MessageType::Board);
+        CHECK(message_header._requestId == 8);
+        CHECK(message_reader.readU8() ==
+              static_cast<std::uint8_t>(fosssweeper::GameState::None));
+        message_reader.readU32();
+        message_reader.readU32();
+        CHECK(message_reader.readU16() == 9);
+        CHECK(message_reader.readU16() == 9);
+        const auto unclicked_code = fosssweeper::Button().getVisibleCode();
+        for (const auto &button : game_model->getButtons()) {
+          CHECK(message_reader.readU8() == button.getVisibleCode());
+          CHECK(button.getVisibleCode() == unclicked_code);
+        }
+        CHECK_NOTHROW(message_reader.requireEnd());
+      }
+    }
+
+    WHEN("The session is destroyed") {
+      input_writer.beginFrame(fosssweeper::MessageType::Destroy, 9);
+      input_writer.writeU64(session_id);
+      input_writer.endFrame();
+      writeAct(input_writer, 10, session_id,
+               static_cast<std::uint8_t>(fosssweeper::ActionType::Click), 0,
+               0);
+      server.handleFrames(connection);
+
+      THEN("Its id is no longer answered") {
+        frames = getFrames(connection._output);
+        REQUIRE(frames.size() == 2);
+        fosssweeper::MessageReader destroyed_reader(frames[0]);
+        CHECK(destroyed_reader.readHeader()._messageType ==
+              fosssweeper::MessageType::Destroyed);
+        fosssweeper::MessageReader error_reader(frames[1]);
+        CHECK(error_reader.readHeader()._messageType ==
+              fosssweeper::MessageType::Error);
+        CHECK(error_reader.readString() == "unknown session");
+        CHECK(server.getSessionCount() == 0);
+        CHECK(connection._sessionIds.empty());
+      }
+    }
+
+    WHEN("A frame announces a payload above the limit") {
+      input_writer.writeU32(static_cast<std::uint32_t>(
+          fosssweeper::MessageWriter::MAX_FRAME_SIZE + 1));
+
+      THEN("The framing is rejected so the connection gets closed") {
+        CHECK_THROWS_WITH(server.handleFrames(connection),
+                          "message too large");
+      }
+    }
+  }
+}
@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/action.hpp>
+#include <fosssweeper/button_position.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/latency_histogram.hpp>
+#include <fosssweeper/session_host.hpp>
+#include <future>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+std::vector<fosssweeper::Action> drawActions(std::uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> x_distribution(0, 15);
+  std::uniform_int_distribution<int> y_distribution(0, 15);
+  std::vector<fosssweeper::Action> actions;
+  actions.push_back({fosssweeper::ActionType::Click,
+                     fosssweeper::ButtonPosition(8, 8)});
+  for (int action_i = 0; action_i < 20; action_i++) {
+    const auto action_type = action_i % 4 == 0
+                                 ? fosssweeper::ActionType::AltClick
+                                 : fosssweeper::ActionType::Click;
+    actions.push_back(
+        {action_type, fosssweeper::ButtonPosition(x_distribution(rng),
+                                                  y_distribution(rng))});
+  }
+  return actions;
+}
+} // namespace
+
+SCENARIO("Latencies are recorded in a LatencyHistogram") {
+  GIVEN("A LatencyHistogram with the values 1 to 1000") {
+    fosssweeper::LatencyHistogram latency_histogram;
+    for (std::uint64_t value = 1; value <= 1000; value++) {
+      latency_histogram.record(value);
+    }
+
+    THEN("Percentiles are within an eighth of the exact value") {
+      CHECK(latency_histogram.getCount() == 1000);
+      CHECK(latency_histogram.getMax() == 1000);
+      CHECK(latency_histogram.getPercentile(50) >= 500);
+      CHECK(latency_histogram.getPercentile(50) <= 500 + (500 / 8));
+      CHECK(latency_histogram.getPercentile(99) >= 990);
+      CHECK(latency_histogram.getPercentile(99) <= 1000);
+      CHECK(latency_histogram.getPercentile(100) == 1000);
+      CHECK(latency_histogram.getPercentile(0) == 1);
+    }
+
+    WHEN("It is merged into another LatencyHistogram") {
+      fosssweeper::LatencyHistogram merged_histogram;
+      merged_histogram.record(5000);
+      merged_histogram.merge(latency_histogram);
+
+      THEN("The counts are combined") {
+        CHECK(merged_histogram.getCount() == 1001);
+        CHECK(merged_histogram.getMax() == 5000);
+        CHECK(merged_histogram.getPercentile(100) == 5000);
+      }
+    }
+  }
+
+  GIVEN("Values on bucket boundaries") {
+    THEN("Every bucket holds the values it is supposed to") {
+      for (std::uint64_t value = 0; value < 4096; value++) {
+        const auto bucket_i = fosssweeper::LatencyHistogram::getBucketI(value);
+        REQUIRE(value <= fosssweeper::LatencyHistogram::getBucketMax(bucket_i));
+        if (bucket_i > 0) {
+          REQUIRE(value >
+                  fosssweeper::LatencyHistogram::getBucketMax(bucket_i - 1));
+        }
+      }
+      CHECK(fosssweeper::LatencyHistogram::getBucketI(UINT64_MAX) <
+            fosssweeper::LatencyHistogram::BUCKET_COUNT);
+    }
+  }
+}
+
+SCENARIO("Many games are hosted by a SessionHost") {
+  GIVEN("A SessionHost with four shards and many sessions") {
+    const fosssweeper::GameConfiguration game_configuration(
+        fosssweeper::GameDifficulty::Intermediate);
+    const std::size_t session_count = 1000;
+    fosssweeper::SessionHost session_host(4);
+    std::vector<std::future<fosssweeper::SessionResponse>> futures;
+    for (std::size_t session_i = 0; session_i < session_count; session_i++) {
+      futures.push_back(session_host.create(
+          game_configuration, fosssweeper::GenerationMode::Opening, session_i));
+    }
+    std::vector<std::uint64_t> session_ids;
+    for (auto &future : futures) {
+      session_ids.push_back(future.get()._sessionId);
+    }
+
+    THEN("Every session has its own id") {
+      CHECK(std::set<std::uint64_t>(session_ids.begin(), session_ids.end())
+                .size() == session_count);
+      CHECK(session_host.getSessionCount() == session_count);
+    }
+
+    WHEN("Every session is played") {
+      futures.clear();
+      for (std::size_t session_i = 0; session_i < session_count; session_i++) {
+        futures.push_back(session_host.act(
+            session_ids[session_i],
+            drawActions(static_cast<std::uint32_t>(session_i))));
+      }
+
+      THEN("Every session matches a GameModel played the same way") {
+        fosssweeper::GameModel game_model;
+        for (std::size_t session_i = 0; session_i < session_count;
+             session_i++) {
+          const auto session_response = futures[session_i].get();
+          game_model.newGame(game_configuration);
+          game_model.setGenerationMode(fosssweeper::GenerationMode::Opening);
+          game_model.setGameSeed(session_i);
+          const auto actions =
+              drawActions(static_cast<std::uint32_t>(session_i));
+          std::vector<fosssweeper::ActionResult> action_results(actions.size());
+          const auto processed_count =
+              game_model.applyActions(actions, action_results);
+          REQUIRE(session_response._processedCount == processed_count);
+          REQUIRE(session_response._actionResults == action_results);
+          REQUIRE(session_response._boardSnapshot.getVisibleHash() ==
+                  game_model.getVisibleHash());
+          REQUIRE(session_response._boardSnapshot.getGameState() ==
+                  game_model.getGameState());
+        }
+        CHECK(session_host.getLatencyHistogram(
+                              fosssweeper::SessionOperation::Act)
+                  .getCount() == session_count);
+        CHECK(session_host
+                  .getLatencyHistogram(fosssweeper::SessionOperation::Create)
+                  .getPercentile(99) > 0);
+      }
+    }
+
+    WHEN("Half of the sessions are destroyed and new ones are created") {
+      for (std::size_t session_i = 0; session_i < session_count;
+           session_i += 2) {
+        session_host.destroy(session_ids[session_i]).get();
+      }
+      std::vector<std::uint64_t> new_session_ids;
+      for (std::size_t session_i = 0; session_i < session_count / 2;
+           session_i++) {
+        new_session_ids.push_back(
+            session_host
+                .create(game_configuration,
+                        fosssweeper::GenerationMode::Default, session_i)
+                .get()
+                ._sessionId);
+      }
+
+      THEN("Destroyed ids stay invalid while their GameModels are reused") {
+        CHECK(session_host.getSessionCount() == session_count);
+        for (std::size_t session_i = 0; session_i < session_count;
+             session_i += 2) {
+          REQUIRE_THROWS_AS(session_host.query(session_ids[session_i]).get(),
+                            std::runtime_error);
+          REQUIRE_THROWS_AS(session_host.act(session_ids[session_i], {}).get(),
+                            std::runtime_error);
+        }
+        for (const auto session_id : new_session_ids) {
+          const auto session_response = session_host.query(session_id).get();
+          REQUIRE(session_response._boardSnapshot.getGameState() ==
+                  fosssweeper::GameState::None);
+          REQUIRE(session_response._boardSnapshot.getButtonCount() ==
+                  static_cast<std::size_t>(
+                      game_configuration.getButtonCount()));
+        }
+        CHECK(session_host.query(session_ids[1]).get()._sessionId ==
+              session_ids[1]);
+        CHECK(session_host
+                  .getLatencyHistogram(fosssweeper::SessionOperation::Destroy)
+                  .getCount() == session_count / 2);
+      }
+    }
+  }
+}
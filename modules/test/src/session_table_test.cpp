@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_difficulty.hpp>
+#include <fosssweeper/generation_mode.hpp>
+
+#include "session_table.hpp"
+
+SCENARIO("Sessions are created, found and destroyed") {
+  GIVEN("A SessionTable with a session of owner 1") {
+    fosssweeper::SessionTable session_table;
+    const fosssweeper::GameConfiguration game_configuration(
+        fosssweeper::GameDifficulty::Intermediate);
+    const auto session_id =
+        session_table.create(1, game_configuration,
+                             fosssweeper::GenerationMode::NoGuess, 42);
+    auto *const game_model = session_table.find(1, session_id);
+
+    THEN("The session is found by its owner only") {
+      REQUIRE(game_model != nullptr);
+      CHECK(game_model->getGameConfiguration() == game_configuration);
+      CHECK(game_model->getGenerationMode() ==
+            fosssweeper::GenerationMode::NoGuess);
+      CHECK(game_model->getGameSeed() == 42);
+      CHECK(session_table.find(2, session_id) == nullptr);
+      CHECK(session_table.find(-1, session_id) == nullptr);
+      CHECK(session_table.find(1, session_id + 1) == nullptr);
+      CHECK(session_table.getSessionCount() == 1);
+    }
+
+    THEN("Another owner can not destroy it") {
+      CHECK_FALSE(session_table.destroy(2, session_id));
+      CHECK(session_table.find(1, session_id) == game_model);
+    }
+
+    WHEN("The session is destroyed") {
+      REQUIRE(session_table.destroy(1, session_id));
+
+      THEN("Its id is stale") {
+        CHECK(session_table.find(1, session_id) == nullptr);
+        CHECK_FALSE(session_table.destroy(1, session_id));
+        CHECK(session_table.getSessionCount() == 0);
+      }
+
+      AND_WHEN("Another session is created") {
+        const fosssweeper::GameConfiguration next_game_configuration(
+            fosssweeper::GameDifficulty::Expert);
+        const auto next_session_id =
+            session_table.create(2, next_game_configuration,
+                                 fosssweeper::GenerationMode::Classic, 7);
+
+        THEN("It reuses the slot and GameModel under a new id") {
+          CHECK((next_session_id & 0xffffffff) == (session_id & 0xffffffff));
+          CHECK(next_session_id != session_id);
+          CHECK(session_table.find(2, next_session_id) == game_model);
+          CHECK(game_model->getGameConfiguration() ==
+                next_game_configuration);
+          CHECK(game_model->getGameSeed() == 7);
+        }
+
+        THEN("The stale id does not reach the new session") {
+          CHECK(session_table.find(1, session_id) == nullptr);
+          CHECK(session_table.find(2, session_id) == nullptr);
+          CHECK_FALSE(session_table.destroy(2, session_id));
+          CHECK(session_table.getSessionCount() == 1);
+        }
+      }
+    }
+
+    WHEN("More sessions are created") {
+      const auto second_session_id = session_table.create(
+          1, game_configuration, fosssweeper::GenerationMode::Classic, 0);
+      const auto third_session_id = session_table.create(
+          3, game_configuration, fosssweeper::GenerationMode::Classic, 0);
+
+      THEN("Each one gets its own slot and GameModel") {
+        CHECK(second_session_id != session_id);
+        CHECK(third_session_id != second_session_id);
+        CHECK(session_table.find(1, second_session_id) != game_model);
+        CHECK(session_table.find(3, third_session_id) != nullptr);
+        CHECK(session_table.getSessionCount() == 3);
+      }
+    }
+  }
+}
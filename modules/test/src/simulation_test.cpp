@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_difficulty.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "policy.hpp"
+#include "simulation.hpp"
+#include "work_stealing_pool.hpp"
+
+SCENARIO("Simulations do not depend on the number of threads") {
+  GIVEN("Settings for beginner games and a policy") {
+    fosssweeper::SimulationSettings simulation_settings;
+    simulation_settings._gameConfiguration =
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Beginner);
+    simulation_settings._generationMode =
+        GENERATE(fosssweeper::GenerationMode::Classic,
+                 fosssweeper::GenerationMode::Opening);
+    simulation_settings._gameCount = 500;
+    simulation_settings._seed = 42;
+    const auto policy = fosssweeper::makePolicy(GENERATE("random", "solver"));
+
+    WHEN("The simulation runs on one thread and on four threads") {
+      fosssweeper::WorkStealingPool single_pool(1);
+      fosssweeper::WorkStealingPool multi_pool(4);
+      const auto single_result =
+          fosssweeper::runSimulation(simulation_settings, *policy, single_pool);
+      const auto multi_result =
+          fosssweeper::runSimulation(simulation_settings, *policy, multi_pool);
+
+      THEN("Both count the same wins and losses") {
+        CHECK(single_result._winCount == multi_result._winCount);
+        CHECK(single_result._lossCount == multi_result._lossCount);
+        CHECK(single_result._winCount + single_result._lossCount ==
+              simulation_settings._gameCount);
+      }
+
+      THEN("Both keep one sorted latency per game") {
+        for (const auto *const simulation_result :
+             {&single_result, &multi_result}) {
+          CHECK(simulation_result->_latencies.size() ==
+                simulation_settings._gameCount);
+          CHECK(std::is_sorted(simulation_result->_latencies.begin(),
+                               simulation_result->_latencies.end()));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Latency percentiles are read from a SimulationResult") {
+  GIVEN("A result without any latencies") {
+    const fosssweeper::SimulationResult simulation_result;
+
+    THEN("Every percentile is 0") {
+      const auto percentile = GENERATE(0.0, 50.0, 99.9, 100.0);
+      CHECK(simulation_result.getLatencyPercentile(percentile) == 0);
+    }
+  }
+
+  GIVEN("A result with one latency") {
+    fosssweeper::SimulationResult simulation_result;
+    simulation_result._latencies = {1234};
+
+    THEN("Every percentile is that latency") {
+      const auto percentile = GENERATE(0.0, 50.0, 99.9, 100.0);
+      CHECK(simulation_result.getLatencyPercentile(percentile) == 1234);
+    }
+  }
+
+  GIVEN("A result with the latencies 1 to 10") {
+    fosssweeper::SimulationResult simulation_result;
+    for (std::uint64_t latency = 1; latency <= 10; latency++) {
+      simulation_result._latencies.push_back(latency);
+    }
+
+    THEN("The nearest rank is returned") {
+      CHECK(simulation_result.getLatencyPercentile(0.0) == 1);
+      CHECK(simulation_result.getLatencyPercentile(10.0) == 1);
+      CHECK(simulation_result.getLatencyPercentile(50.0) == 5);
+      CHECK(simulation_result.getLatencyPercentile(51.0) == 6);
+      CHECK(simulation_result.getLatencyPercentile(99.9) == 10);
+      CHECK(simulation_result.getLatencyPercentile(100.0) == 10);
+    }
+  }
+}
+
+SCENARIO("Simulation results are written as a JSON report") {
+  GIVEN("A policy whose name needs escaping") {
+    std::istringstream script("c 0 0\n");
+    const fosssweeper::ScriptedPolicy scripted_policy("script:a\"b\\c",
+                                                      script);
+
+    WHEN("A report without results is written") {
+      std::ostringstream os;
+      fosssweeper::writeSimulationJson(os, scripted_policy, 2, {});
+
+      THEN("It holds the policy, the threads and an empty result list") {
+        CHECK(os.str() == "{\n"
+                          "  \"policy\": \"script:a\\\"b\\\\c\",\n"
+                          "  \"threads\": 2,\n"
+                          "  \"results\": []\n"
+                          "}\n");
+      }
+    }
+  }
+
+  GIVEN("Two results") {
+    const auto policy = fosssweeper::makePolicy("solver");
+    std::vector<fosssweeper::SimulationResult> simulation_results(2);
+    auto &first_result = simulation_results[0];
+    first_result._simulationSettings._gameConfiguration =
+        fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Beginner);
+    first_result._simulationSettings._generationMode =
+        fosssweeper::GenerationMode::NoGuess;
+    first_result._simulationSettings._gameCount = 4;
+    first_result._simulationSettings._seed = 7;
+    first_result._winCount = 1;
+    first_result._lossCount = 3;
+    first_result._seconds = 2.0;
+    first_result._latencies = {10, 20, 30, 40};
+
+    WHEN("The report is written") {
+      std::ostringstream os;
+      fosssweeper::writeSimulationJson(os, *policy, 4, simulation_results);
+
+      THEN("Each result is an object with its settings, counts and "
+           "latencies") {
+        CHECK(os.str() ==
+              "{\n"
+              "  \"policy\": \"solver\",\n"
+              "  \"threads\": 4,\n"
+              "  \"results\": [\n"
+              "    {\n"
+              "      \"buttons_wide\": 8,\n"
+              "      \"buttons_tall\": 8,\n"
+              "      \"bomb_count\": 10,\n"
+              "      \"generation_mode\": \"no_guess\",\n"
+              "      \"seed\": 7,\n"
+              "      \"games\": 4,\n"
+              "      \"wins\": 1,\n"
+              "      \"losses\": 3,\n"
+              "      \"win_rate\": 0.25,\n"
+              "      \"seconds\": 2,\n"
+              "      \"games_per_second\": 2,\n"
+              "      \"latency_ns\": {\"p50\": 20, \"p90\": 40, \"p99\": 40, "
+              "\"p999\": 40, \"max\": 40}\n"
+              "    },\n"
+              "    {\n"
+              "      \"buttons_wide\": 8,\n"
+              "      \"buttons_tall\": 8,\n"
+              "      \"bomb_count\": 10,\n"
+              "      \"generation_mode\": \"classic\",\n"
+              "      \"seed\": 0,\n"
+              "      \"games\": 0,\n"
+              "      \"wins\": 0,\n"
+              "      \"losses\": 0,\n"
+              "      \"win_rate\": 0,\n"
+              "      \"seconds\": 0,\n"
+              "      \"games_per_second\": 0,\n"
+              "      \"latency_ns\": {\"p50\": 0, \"p90\": 0, \"p99\": 0, "
+              "\"p999\": 0, \"max\": 0}\n"
+              "    }\n"
+              "  ]\n"
+              "}\n");
+      }
+    }
+  }
+}
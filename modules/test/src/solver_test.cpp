@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/solver.hpp>
+#include <vector>
+
+SCENARIO("A Solver finds certain Button objects") {
+  GIVEN("A Solver loaded from a GameModel with a single bomb left") {
+    const fosssweeper::GameModel game_model(
+        fosssweeper::GameConfiguration(8, 2, 1), false,
+        fosssweeper::GameState::Playing, 0,
+        "dddddddb"
+        "dddddddd");
+    fosssweeper::Solver solver;
+    solver.load(game_model);
+    std::vector<std::size_t> safe_buttons;
+    std::vector<std::size_t> bomb_buttons;
+
+    THEN("The Solver knows the revealed Button objects") {
+      CHECK(solver.getRevealedCount() == 15);
+      CHECK(solver.getIsRevealed(0) == true);
+      CHECK(solver.getIsRevealed(7) == false);
+    }
+
+    WHEN("The certain Button objects are found") {
+      const bool found = solver.findCertainButtons(safe_buttons, bomb_buttons);
+
+      THEN("The hidden Button is found to be a bomb") {
+        CHECK(found == true);
+        CHECK(safe_buttons.empty());
+        REQUIRE(bomb_buttons.size() == 1);
+        CHECK(bomb_buttons[0] == 7);
+      }
+    }
+  }
+
+  GIVEN("A Solver loaded from a GameModel where a number has no bombs left") {
+    const fosssweeper::GameModel game_model(
+        fosssweeper::GameConfiguration(8, 2, 1), false,
+        fosssweeper::GameState::Playing, 0,
+        "d......."
+        "dd.....b");
+    fosssweeper::Solver solver;
+    solver.load(game_model);
+    std::vector<std::size_t> safe_buttons;
+    std::vector<std::size_t> bomb_buttons;
+
+    WHEN("The certain Button objects are found") {
+      solver.findCertainButtons(safe_buttons, bomb_buttons);
+
+      THEN("The Button objects next to the zeros are safe") {
+        std::sort(safe_buttons.begin(), safe_buttons.end());
+        CHECK(safe_buttons == std::vector<std::size_t>{1, 2, 10});
+        CHECK(bomb_buttons.empty());
+      }
+    }
+  }
+
+  GIVEN("A Solver loaded from a GameModel with a row of ones") {
+    // no single number decides anything, but the corner numbers are subsets
+    // of their neighbors so only a pair of constraints solves it.
+    const fosssweeper::GameModel game_model(
+        fosssweeper::GameConfiguration(8, 2, 3), false,
+        fosssweeper::GameState::Playing, 0,
+        "b..b..b."
+        "dddddddd");
+    fosssweeper::Solver solver;
+    solver.load(game_model);
+    std::vector<std::size_t> safe_buttons;
+    std::vector<std::size_t> bomb_buttons;
+
+    WHEN("The certain Button objects are found") {
+      solver.findCertainButtons(safe_buttons, bomb_buttons);
+      std::sort(safe_buttons.begin(), safe_buttons.end());
+
+      THEN("The Button objects next to the corner subsets are safe") {
+        CHECK(safe_buttons == std::vector<std::size_t>{2, 5});
+        CHECK(bomb_buttons.empty());
+      }
+    }
+  }
+
+  GIVEN("A Solver loaded from a GameModel that needs a guess") {
+    const fosssweeper::GameModel game_model(
+        fosssweeper::GameConfiguration(8, 2, 2), false,
+        fosssweeper::GameState::Playing, 0,
+        "ddddddb."
+        "dddddd.b");
+    fosssweeper::Solver solver;
+    solver.load(game_model);
+    std::vector<std::size_t> safe_buttons;
+    std::vector<std::size_t> bomb_buttons;
+
+    WHEN("The certain Button objects are found") {
+      const bool found = solver.findCertainButtons(safe_buttons, bomb_buttons);
+
+      THEN("Nothing is certain") {
+        CHECK(found == false);
+        CHECK(safe_buttons.empty());
+        CHECK(bomb_buttons.empty());
+      }
+    }
+  }
+
+  GIVEN("A Solver loaded from a GameModel with misplaced flags") {
+    const fosssweeper::GameModel game_model(
+        fosssweeper::GameConfiguration(8, 2, 1), false,
+        fosssweeper::GameState::Playing, 0,
+        "ddddddfb"
+        "dddddddd");
+    fosssweeper::Solver solver;
+    solver.load(game_model);
+    std::vector<std::size_t> safe_buttons;
+    std::vector<std::size_t> bomb_buttons;
+
+    WHEN("The certain Button objects are found") {
+      solver.findCertainButtons(safe_buttons, bomb_buttons);
+
+      THEN("The flags are not trusted") {
+        CHECK(std::find(safe_buttons.begin(), safe_buttons.end(), 6) !=
+              safe_buttons.end());
+      }
+    }
+  }
+}
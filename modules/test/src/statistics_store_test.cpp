@@ -0,0 +1,311 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <array>
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_model.hpp>
+#include <fosssweeper/game_record.hpp>
+#include <fosssweeper/game_state.hpp>
+#include <fosssweeper/statistics_store.hpp>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "TestSupport.hpp"
+
+namespace {
+fosssweeper::GameRecord makeGameRecord(std::uint64_t game_time, bool won,
+                                       std::int64_t finished_at) {
+  fosssweeper::GameRecord game_record;
+  game_record._gameConfiguration =
+      fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert);
+  game_record._gameState =
+      won ? fosssweeper::GameState::Cool : fosssweeper::GameState::Dead;
+  game_record._gameTime = game_time;
+  game_record._gameSeed = static_cast<std::uint64_t>(finished_at) * 31;
+  game_record._finishedAt = finished_at;
+  game_record._bbbv = 150;
+  game_record._clickCount = 200;
+  return game_record;
+}
+
+std::vector<std::uint64_t>
+getGameTimes(const std::vector<fosssweeper::GameRecord> &game_records) {
+  std::vector<std::uint64_t> game_times;
+  for (const auto &game_record : game_records) {
+    game_times.push_back(game_record._gameTime);
+  }
+  return game_times;
+}
+} // namespace
+
+SCENARIO("A GameRecord is stored in fixed size bytes") {
+  GIVEN("A won game on a board without bombs") {
+    fosssweeper::GameModel game_model;
+    game_model.newGame(fosssweeper::GameConfiguration(8, 8, 0));
+    game_model.setGameSeed(42);
+    game_model.clickButton(3, 3);
+    REQUIRE(game_model.getGameState() == fosssweeper::GameState::Cool);
+
+    WHEN("Its record is taken") {
+      const auto game_record =
+          fosssweeper::GameRecord::fromGameModel(game_model, 1700000000);
+
+      THEN("The record describes the game") {
+        CHECK(game_record.getIsWon());
+        CHECK(game_record._gameConfiguration ==
+              fosssweeper::GameConfiguration(8, 8, 0));
+        CHECK(game_record._gameSeed == 42);
+        CHECK(game_record._bbbv == 1);
+        CHECK(game_record._clickCount == 1);
+      }
+
+      AND_WHEN("The record is encoded and decoded") {
+        std::array<unsigned char, 64> bytes = std::array<unsigned char, 64>();
+        game_record.encode(bytes);
+        fosssweeper::GameRecord decoded_record;
+        REQUIRE(fosssweeper::GameRecord::tryDecode(bytes, decoded_record));
+
+        THEN("Every field is kept") {
+          CHECK(decoded_record._gameConfiguration ==
+                game_record._gameConfiguration);
+          CHECK(decoded_record._gameState == game_record._gameState);
+          CHECK(decoded_record._gameTime == game_record._gameTime);
+          CHECK(decoded_record._gameSeed == game_record._gameSeed);
+          CHECK(decoded_record._finishedAt == game_record._finishedAt);
+          CHECK(decoded_record._bbbv == game_record._bbbv);
+          CHECK(decoded_record._clickCount == game_record._clickCount);
+        }
+
+        THEN("A changed byte is detected") {
+          bytes[20] ^= 1;
+          CHECK_FALSE(fosssweeper::GameRecord::tryDecode(bytes, decoded_record));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Finished games are kept in a StatisticsStore") {
+  GIVEN("A StatisticsStore without a log") {
+    const auto path = fosssweeper::getTemporaryPath("statistics_store", "log");
+    const std::vector<std::uint64_t> game_times = {
+        50000, 30000, 70000, 10000, 90000, 20000, 80000,
+        40000, 60000, 15000, 25000, 35000, 5000};
+
+    WHEN("Won and lost games are added") {
+      std::vector<bool> ranked;
+      {
+        fosssweeper::StatisticsStore statistics_store(path);
+        for (std::size_t game_i = 0; game_i < game_times.size(); game_i++) {
+          statistics_store.add(makeGameRecord(
+              1000, false, static_cast<std::int64_t>(game_i * 2)));
+          ranked.push_back(
+              statistics_store
+                  .add(makeGameRecord(game_times[game_i], true,
+                                      static_cast<std::int64_t>(game_i * 2 + 1)))
+                  .has_value());
+        }
+        statistics_store.flush();
+        CHECK(statistics_store.getRecordCount() == game_times.size() * 2);
+      }
+
+      THEN("Only the ten best wins are kept as best times") {
+        CHECK(ranked == std::vector<bool>(ranked.size(), true));
+        fosssweeper::StatisticsStore statistics_store(path);
+        statistics_store.flush();
+        CHECK(getGameTimes(statistics_store.getBestTimes(
+                  fosssweeper::GameConfiguration(
+                      fosssweeper::GameDifficulty::Expert))) ==
+              std::vector<std::uint64_t>{5000, 10000, 15000, 20000, 25000,
+                                         30000, 35000, 40000, 50000, 60000});
+        CHECK(statistics_store
+                  .getBestTimes(fosssweeper::GameConfiguration(
+                      fosssweeper::GameDifficulty::Beginner))
+                  .empty());
+        CHECK_FALSE(statistics_store.add(makeGameRecord(95000, true, 100))
+                        .has_value());
+        CHECK(statistics_store.add(makeGameRecord(1000, true, 101)) == 0);
+      }
+
+      AND_WHEN("The log ends in a torn record") {
+        {
+          std::ofstream stream(path, std::ios::binary | std::ios::app);
+          stream.write("torn", 4);
+        }
+        fosssweeper::StatisticsStore statistics_store(path);
+        statistics_store.add(makeGameRecord(3000, true, 200));
+        statistics_store.flush();
+
+        THEN("The log is rewritten without it") {
+          CHECK(statistics_store.getRecordCount() == game_times.size() * 2 + 1);
+          CHECK(std::filesystem::file_size(path) ==
+                fosssweeper::StatisticsStore::HEADER_SIZE +
+                    (game_times.size() * 2 + 1) *
+                        fosssweeper::GameRecord::SIZE);
+          CHECK(statistics_store
+                    .getBestTimes(fosssweeper::GameConfiguration(
+                        fosssweeper::GameDifficulty::Expert))
+                    .front()
+                    ._gameTime == 3000);
+        }
+      }
+    }
+
+    WHEN("The file is not a statistics log") {
+      {
+        std::ofstream stream(path, std::ios::binary);
+        stream << "something else";
+      }
+      {
+        fosssweeper::StatisticsStore statistics_store(path);
+        CHECK(statistics_store.add(makeGameRecord(3000, true, 1)) == 0);
+        statistics_store.flush();
+      }
+
+      THEN("The file is left alone") {
+        CHECK(std::filesystem::file_size(path) == 14);
+      }
+    }
+    std::filesystem::remove(path);
+  }
+
+  GIVEN("A log that outgrew the record limit in an earlier session") {
+    const auto path =
+        fosssweeper::getTemporaryPath("statistics_store", "outgrown");
+    {
+      std::vector<fosssweeper::GameRecord> game_records;
+      for (std::int64_t game_i = 0; game_i < 40; game_i++) {
+        game_records.push_back(makeGameRecord(1000, false, game_i));
+      }
+      fosssweeper::StatisticsStore::writeLog(path, game_records);
+    }
+
+    WHEN("It is loaded by a store with a limit of 20 records") {
+      fosssweeper::StatisticsStore statistics_store(path, 20);
+      statistics_store.flush();
+
+      THEN("It is compacted before any game is added") {
+        bool needs_rewrite = false;
+        const auto game_records =
+            fosssweeper::StatisticsStore::readLog(path, needs_rewrite);
+        CHECK(statistics_store.getRecordCount() == 15);
+        REQUIRE(game_records.size() == 15);
+        CHECK(game_records.front()._finishedAt == 25);
+      }
+
+      AND_WHEN("Games are added past the limit again") {
+        for (std::int64_t game_i = 40; game_i < 46; game_i++) {
+          statistics_store.add(makeGameRecord(1000, false, game_i));
+          statistics_store.flush();
+        }
+
+        THEN("The log is compacted as soon as it passes the limit") {
+          bool needs_rewrite = false;
+          const auto game_records =
+              fosssweeper::StatisticsStore::readLog(path, needs_rewrite);
+          CHECK(statistics_store.getRecordCount() == 15);
+          REQUIRE(game_records.size() == 15);
+          CHECK(game_records.back()._finishedAt == 45);
+        }
+      }
+    }
+    std::filesystem::remove(path);
+  }
+
+  GIVEN("A long history of games") {
+    std::vector<fosssweeper::GameRecord> game_records;
+    for (std::int64_t game_i = 0; game_i < 1000; game_i++) {
+      game_records.push_back(makeGameRecord(
+          static_cast<std::uint64_t>(100000 - game_i * 50), game_i % 3 == 0,
+          game_i));
+    }
+    game_records[6]._gameTime = 100;
+
+    WHEN("The history is compacted") {
+      const auto kept_records =
+          fosssweeper::StatisticsStore::compact(game_records, 100);
+
+      THEN("The newest games and the best times are kept in order") {
+        REQUIRE(kept_records.size() == 101);
+        CHECK(kept_records.front()._finishedAt == 6);
+        CHECK(kept_records[1]._finishedAt == 900);
+        CHECK(kept_records.back()._finishedAt == 999);
+      }
+    }
+  }
+}
+
+SCENARIO("Best times are looked up quickly", "[.][benchmark]") {
+  GIVEN("A log of a million games") {
+    const auto path =
+        fosssweeper::getTemporaryPath("statistics_store", "benchmark");
+    {
+      std::vector<fosssweeper::GameRecord> game_records;
+      for (std::int64_t game_i = 0; game_i < 1000000; game_i++) {
+        game_records.push_back(makeGameRecord(
+            static_cast<std::uint64_t>(game_i * 7919 % 1000003), game_i % 2,
+            game_i));
+      }
+      fosssweeper::StatisticsStore::writeLog(path, game_records);
+    }
+
+    WHEN("The log is loaded and games are added") {
+      const auto load_begin = std::chrono::steady_clock::now();
+      fosssweeper::StatisticsStore statistics_store(path);
+      statistics_store.flush();
+      const auto load_duration = std::chrono::steady_clock::now() - load_begin;
+      const auto add_begin = std::chrono::steady_clock::now();
+      std::size_t best_time_count = 0;
+      for (std::int64_t game_i = 0; game_i < 100000; game_i++) {
+        const auto game_record = makeGameRecord(
+            static_cast<std::uint64_t>(game_i), true, 1000000 + game_i);
+        statistics_store.add(game_record);
+        best_time_count +=
+            statistics_store.getBestTimes(game_record._gameConfiguration)
+                .size();
+      }
+      const auto add_duration = std::chrono::steady_clock::now() - add_begin;
+      statistics_store.flush();
+
+      THEN("The durations are reported") {
+        std::cout << "load of 1000000 games: "
+                  << std::chrono::duration<double, std::milli>(load_duration)
+                         .count()
+                  << " ms\nadd and best times lookup: "
+                  << std::chrono::duration<double, std::nano>(add_duration)
+                             .count() /
+                         100000.0
+                  << " ns per game\n";
+        CHECK(best_time_count > 0);
+        CHECK(statistics_store.getRecordCount() == 1100000);
+      }
+    }
+    std::filesystem::remove(path);
+  }
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/game_difficulty.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <fosssweeper/tool_options.hpp>
+#include <stdexcept>
+#include <string>
+
+SCENARIO("Numbers are parsed from command line values") {
+  GIVEN("Decimal digits") {
+    THEN("The number is returned") {
+      CHECK(fosssweeper::parseNumber("--games", "0") == 0);
+      CHECK(fosssweeper::parseNumber("--games", "18446744073709551615") ==
+            18446744073709551615ull);
+      CHECK(fosssweeper::parseDecimal("--width", "0.25") == 0.25);
+    }
+  }
+
+  GIVEN("A value that is not a whole number") {
+    const std::string value = GENERATE("", "abc", "12abc", "-1", "+1", " 1",
+                                       "18446744073709551616", "1.5");
+
+    THEN("It is rejected with the option in the message") {
+      CHECK_THROWS_WITH(fosssweeper::parseNumber("--games", value),
+                        "invalid number for --games: " + value);
+    }
+  }
+}
+
+SCENARIO("GameConfigurations are parsed from command line values") {
+  GIVEN("The name of a difficulty") {
+    THEN("The matching preset is returned") {
+      CHECK(fosssweeper::parseGameConfiguration("beginner") ==
+            fosssweeper::GameConfiguration(
+                fosssweeper::GameDifficulty::Beginner));
+      CHECK(fosssweeper::parseGameConfiguration("intermediate") ==
+            fosssweeper::GameConfiguration(
+                fosssweeper::GameDifficulty::Intermediate));
+      CHECK(fosssweeper::parseGameConfiguration("expert") ==
+            fosssweeper::GameConfiguration(
+                fosssweeper::GameDifficulty::Expert));
+    }
+  }
+
+  GIVEN("A custom configuration that fits the game") {
+    const auto game_configuration =
+        fosssweeper::parseGameConfiguration("9x3x27");
+
+    THEN("It is returned as given") {
+      CHECK(game_configuration.getButtonsWide() == 9);
+      CHECK(game_configuration.getButtonsTall() == 3);
+      CHECK(game_configuration.getBombCount() == 27);
+      CHECK(fosssweeper::getConfigurationName(game_configuration) == "9x3x27");
+    }
+  }
+
+  GIVEN("A custom configuration that does not fit the game") {
+    const std::string value =
+        GENERATE("0x0x0", "7x8x10", "8x0x10", "8x8x0", "8x8x65",
+                 "4294967297x3x1", "8x4294967297x1", "65536x65536x1",
+                 "8x8x4294967306");
+
+    THEN("It is rejected instead of being clamped") {
+      CHECK_THROWS_AS(fosssweeper::parseGameConfiguration(value),
+                      std::runtime_error);
+    }
+  }
+
+  GIVEN("A value that is not a configuration") {
+    const std::string value = GENERATE("", "huge", "8x8", "8xx10", "8x8x10x1",
+                                       "-8x8x10");
+
+    THEN("It is rejected") {
+      CHECK_THROWS_AS(fosssweeper::parseGameConfiguration(value),
+                      std::runtime_error);
+    }
+  }
+}
+
+SCENARIO("GenerationModes are parsed from command line values") {
+  THEN("Every mode is known by its name") {
+    CHECK(fosssweeper::parseGenerationMode("classic") ==
+          fosssweeper::GenerationMode::Classic);
+    CHECK(fosssweeper::parseGenerationMode("opening") ==
+          fosssweeper::GenerationMode::Opening);
+    CHECK(fosssweeper::parseGenerationMode("no_guess") ==
+          fosssweeper::GenerationMode::NoGuess);
+    CHECK_THROWS_AS(fosssweeper::parseGenerationMode("easy"),
+                    std::runtime_error);
+  }
+}
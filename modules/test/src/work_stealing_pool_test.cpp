@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "work_stealing_pool.hpp"
+
+SCENARIO("Tasks are run by a WorkStealingPool") {
+  GIVEN("A pool with four threads") {
+    fosssweeper::WorkStealingPool pool(4);
+    const std::size_t task_count = 1000;
+    const std::size_t chunk_size = 10;
+    std::vector<std::atomic<int>> run_counts(task_count);
+    std::vector<std::atomic<std::size_t>> worker_indices(task_count);
+
+    WHEN("Every thread but the first is slow") {
+      pool.run(task_count, chunk_size,
+               [&](std::size_t worker_i, std::size_t task_i) {
+                 run_counts[task_i]++;
+                 worker_indices[task_i] = worker_i;
+                 if (worker_i != 0) {
+                   std::this_thread::sleep_for(std::chrono::microseconds(200));
+                 }
+               });
+
+      THEN("Every task is run exactly once") {
+        for (std::size_t task_i = 0; task_i < task_count; task_i++) {
+          REQUIRE(run_counts[task_i] == 1);
+        }
+      }
+
+      THEN("The first thread steals chunks dealt to the other threads") {
+        std::size_t stolen_count = 0;
+        for (std::size_t task_i = 0; task_i < task_count; task_i++) {
+          const auto owner_i =
+              (task_i / chunk_size) % pool.getThreadCount();
+          if (owner_i != 0 && worker_indices[task_i] == 0) {
+            stolen_count++;
+          }
+        }
+        CHECK(stolen_count > 0);
+      }
+    }
+
+    WHEN("The pool is run again with a different chunk size") {
+      pool.run(task_count, 1, [](std::size_t, std::size_t) {});
+      pool.run(task_count, 3, [&](std::size_t, std::size_t task_i) {
+        run_counts[task_i]++;
+      });
+
+      THEN("Every task of the second run is run exactly once") {
+        for (std::size_t task_i = 0; task_i < task_count; task_i++) {
+          REQUIRE(run_counts[task_i] == 1);
+        }
+      }
+    }
+
+    WHEN("There are no tasks") {
+      std::atomic<int> run_count = 0;
+      pool.run(0, chunk_size,
+               [&](std::size_t, std::size_t) { run_count++; });
+
+      THEN("The task is never run") { CHECK(run_count == 0); }
+    }
+  }
+
+  GIVEN("A pool created with no threads") {
+    fosssweeper::WorkStealingPool pool(0);
+
+    THEN("It runs on one thread") { CHECK(pool.getThreadCount() == 1); }
+
+    WHEN("Tasks are run with a chunk size of 0") {
+      std::vector<int> run_counts(100);
+      std::vector<std::size_t> worker_indices;
+      pool.run(run_counts.size(), 0,
+               [&](std::size_t worker_i, std::size_t task_i) {
+                 run_counts[task_i]++;
+                 worker_indices.push_back(worker_i);
+               });
+
+      THEN("Every task is run exactly once on the calling thread") {
+        for (const auto run_count : run_counts) {
+          REQUIRE(run_count == 1);
+        }
+        CHECK(worker_indices == std::vector<std::size_t>(100, 0));
+      }
+    }
+  }
+}
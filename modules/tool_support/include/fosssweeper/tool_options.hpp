@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FOSSSWEEPER_TOOL_OPTIONS_HPP
+#define FOSSSWEEPER_TOOL_OPTIONS_HPP
+
+#include <cstdint>
+#include <fosssweeper/game_configuration.hpp>
+#include <fosssweeper/generation_mode.hpp>
+#include <string>
+#include <string_view>
+
+namespace fosssweeper {
+// Command line values shared by the headless tools. Every function throws a
+// std::runtime_error naming the value when it can not be parsed.
+std::uint64_t parseNumber(std::string_view option, const std::string &value);
+double parseDecimal(std::string_view option, const std::string &value);
+
+// beginner, intermediate, expert or <w>x<h>x<b>; a custom configuration has to
+// fit the game as given instead of being clamped into it
+fosssweeper::GameConfiguration parseGameConfiguration(const std::string &value);
+fosssweeper::GenerationMode parseGenerationMode(const std::string &value);
+
+// <w>x<h>x<b>, e.g. 30x16x99
+std::string
+getConfigurationName(fosssweeper::GameConfiguration game_configuration);
+} // namespace fosssweeper
+
+#endif
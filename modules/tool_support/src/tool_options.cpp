@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2025 Free Software Foundation <licensing@fsf.org>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2025 Free Software Foundation <licensing@fsf.org>
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * FossSweeper. If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <exception>
+#include <fosssweeper/game_difficulty.hpp>
+#include <fosssweeper/tool_options.hpp>
+#include <limits>
+#include <stdexcept>
+
+std::uint64_t fosssweeper::parseNumber(std::string_view option,
+                                       const std::string &value) {
+  std::size_t parsed_length = 0;
+  std::uint64_t number = 0;
+  try {
+    number = std::stoull(value, &parsed_length);
+  } catch (const std::exception &) {
+    parsed_length = 0;
+  }
+  // stoull skips blanks and accepts a sign, which wraps a negative number
+  if (parsed_length == 0 || parsed_length != value.size() ||
+      value.front() < '0' || value.front() > '9') {
+    throw std::runtime_error("invalid number for " + std::string(option) +
+                             ": " + value);
+  }
+  return number;
+}
+
+double fosssweeper::parseDecimal(std::string_view option,
+                                 const std::string &value) {
+  std::size_t parsed_length = 0;
+  double number = 0.0;
+  try {
+    number = std::stod(value, &parsed_length);
+  } catch (const std::exception &) {
+    parsed_length = 0;
+  }
+  if (parsed_length == 0 || parsed_length != value.size()) {
+    throw std::runtime_error("invalid number for " + std::string(option) +
+                             ": " + value);
+  }
+  return number;
+}
+
+fosssweeper::GameConfiguration
+fosssweeper::parseGameConfiguration(const std::string &value) {
+  if (value == "beginner")
+    return fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Beginner);
+  if (value == "intermediate")
+    return fosssweeper::GameConfiguration(
+        fosssweeper::GameDifficulty::Intermediate);
+  if (value == "expert")
+    return fosssweeper::GameConfiguration(fosssweeper::GameDifficulty::Expert);
+  const auto first_x = value.find('x');
+  const auto second_x =
+      first_x == std::string::npos ? first_x : value.find('x', first_x + 1);
+  if (second_x == std::string::npos) {
+    throw std::runtime_error("invalid configuration: " + value);
+  }
+  const auto buttons_wide =
+      fosssweeper::parseNumber("--config", value.substr(0, first_x));
+  const auto buttons_tall = fosssweeper::parseNumber(
+      "--config", value.substr(first_x + 1, second_x - first_x - 1));
+  const auto bomb_count =
+      fosssweeper::parseNumber("--config", value.substr(second_x + 1));
+  // the button count has to fit an int, which also bounds each side
+  const std::uint64_t max_button_count = std::numeric_limits<int>::max();
+  if (buttons_wide <
+          static_cast<std::uint64_t>(
+              fosssweeper::GameConfiguration::MIN_BUTTONS_WIDE) ||
+      buttons_tall <
+          static_cast<std::uint64_t>(
+              fosssweeper::GameConfiguration::MIN_BUTTONS_TALL) ||
+      buttons_wide > max_button_count ||
+      buttons_tall > max_button_count / buttons_wide) {
+    throw std::runtime_error("invalid configuration size: " + value);
+  }
+  if (bomb_count == 0 || bomb_count > buttons_wide * buttons_tall) {
+    throw std::runtime_error("invalid configuration bomb count: " + value);
+  }
+  return fosssweeper::GameConfiguration(static_cast<int>(buttons_wide),
+                                        static_cast<int>(buttons_tall),
+                                        static_cast<int>(bomb_count));
+}
+
+fosssweeper::GenerationMode
+fosssweeper::parseGenerationMode(const std::string &value) {
+  if (value == "classic")
+    return fosssweeper::GenerationMode::Classic;
+  if (value == "opening")
+    return fosssweeper::GenerationMode::Opening;
+  if (value == "no_guess")
+    return fosssweeper::GenerationMode::NoGuess;
+  throw std::runtime_error("invalid generation mode: " + value);
+}
+
+std::string fosssweeper::getConfigurationName(
+    fosssweeper::GameConfiguration game_configuration) {
+  return std::to_string(game_configuration.getButtonsWide()) + "x" +
+         std::to_string(game_configuration.getButtonsTall()) + "x" +
+         std::to_string(game_configuration.getBombCount());
+}